@@ -30,6 +30,7 @@
 #include "ArangoScheduler.h"
 #include "ArangoState.h"
 #include "Global.h"
+#include "HealthProbes.h"
 #include "utils.h"
 
 #include "pbjson.hpp"
@@ -50,6 +51,36 @@
 using namespace arangodb;
 using namespace std;
 
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private constants
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief capacity of the queue of offers and rescinds
+////////////////////////////////////////////////////////////////////////////////
+
+static const size_t OFFER_QUEUE_SIZE = 1024;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief capacity of the queue of status updates
+////////////////////////////////////////////////////////////////////////////////
+
+static const size_t STATUS_QUEUE_SIZE = 4096;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief converts a timestamp of the plan, seconds of the steady clock,
+/// into a time point
+////////////////////////////////////////////////////////////////////////////////
+
+static chrono::steady_clock::time_point steadyTime (double timestamp) {
+  return chrono::steady_clock::time_point(
+    chrono::duration_cast<chrono::steady_clock::duration>(
+      chrono::duration<double>(timestamp)));
+}
 
 // -----------------------------------------------------------------------------
 // --SECTION--                                               class ArangoManager
@@ -69,20 +100,27 @@ ArangoManager::ArangoManager ()
     _nextImplicitReconciliation(chrono::steady_clock::now()),
     _implicitReconciliationIntervall(chrono::minutes(5)),
     _maxReconcileIntervall(chrono::minutes(5)),
-    _task2position(),
     _lock(),
-    _storedOffers(),
-    _taskStatusUpdates() {
+    _queueWaiters(0),
+    _pending(false),
+    _offerEvents(OFFER_QUEUE_SIZE),
+    _statusUpdates(STATUS_QUEUE_SIZE),
+    _offers(),
+    _offerStatistics(),
+    _timeoutsVersion(0),
+    _reconciliationStatistics(),
+    _nextTargetSync(chrono::steady_clock::now()),
+    _targetStatistics() {
+
+  // already checked when the flags were read
+  string error;
+  _timeouts.parse(Global::taskTimeouts(), error);
+
+  Global::state().setWakeupListener([this] () {
+    wakeup(Wakeup::ADMIN);
+  });
 
   _dispatcher = new thread(&ArangoManager::dispatch, this);
-
-  auto lease = Global::state().lease(false);
-  Current current = lease.state().current();
-
-  fillKnownInstances(TaskType::AGENT, current.agents());
-  fillKnownInstances(TaskType::COORDINATOR, current.coordinators());
-  fillKnownInstances(TaskType::PRIMARY_DBSERVER, current.dbservers());
-  fillKnownInstances(TaskType::SECONDARY_DBSERVER, current.secondaries());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -90,10 +128,33 @@ ArangoManager::ArangoManager ()
 ////////////////////////////////////////////////////////////////////////////////
 
 ArangoManager::~ArangoManager () {
-  _stopDispatcher = true;
+  Global::state().setWakeupListener(nullptr);
+
+  {
+    lock_guard<mutex> lock(_lock);
+    _stopDispatcher = true;
+  }
+
+  _wakeup.notify_all();
   _dispatcher->join();
 
   delete _dispatcher;
+
+  for (auto& request : _failoverRequests) {
+    request._thread.join();
+  }
+
+  for (auto& request : _serverIdRequests) {
+    request._thread.join();
+  }
+
+  for (auto& request : _secondaryRequests) {
+    request._thread.join();
+  }
+
+  for (auto& request : _targetRequests) {
+    request._thread.join();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -104,11 +165,7 @@ ArangoManager::~ArangoManager () {
 /// @brief adds an offer
 ////////////////////////////////////////////////////////////////////////////////
 
-bool ArangoManager::addOffer (const mesos::Offer& offer) {
-  lock_guard<mutex> lock(_lock);
-  if (_storedOffers.find(offer.id().value()) == _storedOffers.end() && _storedOffers.size() > Global::offerLimit()) {
-    return false;
-  }
+void ArangoManager::addOffer (const mesos::Offer& offer) {
 #if 0
   // This is already logged in the scheduler in more concise format.
   {
@@ -116,8 +173,16 @@ bool ArangoManager::addOffer (const mesos::Offer& offer) {
   }
 #endif
 
-  _storedOffers[offer.id().value()] = offer;
-  return true;
+  if (! _offerEvents.push({ offer, false })) {
+    LOG(INFO)
+    << "Declining offer " << offer.id().value()
+    << " since our queue is full.";
+
+    Global::scheduler().declineOffer(offer.id());
+    return;
+  }
+
+  wakeup(Wakeup::OFFER);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -125,13 +190,20 @@ bool ArangoManager::addOffer (const mesos::Offer& offer) {
 ////////////////////////////////////////////////////////////////////////////////
 
 void ArangoManager::removeOffer (const mesos::OfferID& offerId) {
-  lock_guard<mutex> lock(_lock);
+  LOG(INFO) << "OFFER removed: " << offerId.value();
 
-  string id = offerId.value();
+  OfferEvent event;
+  event._offer.mutable_id()->CopyFrom(offerId);
+  event._rescinded = true;
 
-  LOG(INFO) << "OFFER removed: " << id;
-  
-  _storedOffers.erase(id);
+  // a rescind must not get lost, the dispatcher would use the offer
+  if (! _offerEvents.push(event)) {
+    waitForQueue([&] () -> bool {
+      return _offerEvents.push(event);
+    }, "offer");
+  }
+
+  wakeup(Wakeup::RESCIND);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -139,9 +211,76 @@ void ArangoManager::removeOffer (const mesos::OfferID& offerId) {
 ////////////////////////////////////////////////////////////////////////////////
 
 void ArangoManager::taskStatusUpdate (const mesos::TaskStatus& status) {
+  if (! _statusUpdates.push(status)) {
+    waitForQueue([&] () -> bool {
+      return _statusUpdates.push(status);
+    }, "status update");
+  }
+
+  wakeup(Wakeup::STATUS_UPDATE);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief wakes up the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoManager::wakeup (Wakeup reason) {
+  {
+    lock_guard<mutex> lock(_lock);
+
+    switch (reason) {
+      case Wakeup::OFFER:         ++_statistics._offers;        break;
+      case Wakeup::RESCIND:       ++_statistics._rescinds;      break;
+      case Wakeup::STATUS_UPDATE: ++_statistics._statusUpdates; break;
+      case Wakeup::REGISTERED:    ++_statistics._registered;    break;
+      case Wakeup::ADMIN:         ++_statistics._admin;         break;
+      case Wakeup::REQUEST:       ++_statistics._requests;      break;
+    }
+
+    if (! _pending) {
+      _pending = true;
+      _pendingSince = chrono::steady_clock::now();
+    }
+  }
+
+  // the driver may wait on the same condition for room in a queue
+  _wakeup.notify_all();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the cycles of the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+ArangoManager::DispatcherStatistics ArangoManager::dispatcherStatistics () {
   lock_guard<mutex> lock(_lock);
-  
-  _taskStatusUpdates.push_back(status);
+  return _statistics;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the offers held
+////////////////////////////////////////////////////////////////////////////////
+
+OfferInventory::Statistics ArangoManager::offerStatistics () {
+  lock_guard<mutex> lock(_lock);
+  return _offerStatistics;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the reconciliation
+////////////////////////////////////////////////////////////////////////////////
+
+ArangoManager::ReconciliationStatistics ArangoManager::reconciliationStatistics () {
+  lock_guard<mutex> lock(_lock);
+  return _reconciliationStatistics;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the synchronization of the cluster targets
+////////////////////////////////////////////////////////////////////////////////
+
+TargetSync::Statistics ArangoManager::targetStatistics () {
+  lock_guard<mutex> lock(_lock);
+  return _targetStatistics;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -173,9 +312,9 @@ void ArangoManager::destroy () {
         TaskPlan* entry = entries->mutable_entries(i);
         if (entry->state() != TASK_STATE_DEAD) {
           LOG(INFO) << "Planning to kill instance with id '"
-                    << currs.entries(i).task_info().task_id().value()
+                    << currs.entries(i).task_id()
                     << "'";
-          ids.push_back(currs.entries(i).task_info().task_id().value());
+          ids.push_back(currs.entries(i).task_id());
           entry->set_state(TASK_STATE_DEAD);
         }
       }
@@ -185,6 +324,7 @@ void ArangoManager::destroy () {
     markAllDead(plan->mutable_dbservers(), current->dbservers());
     markAllDead(plan->mutable_secondaries(), current->secondaries());
     markAllDead(plan->mutable_coordinators(), current->coordinators());
+    l.reindex();
 
     LOG(INFO) << "The new state with DEAD tasks:\nPLAN:"
               << arangodb::toJson(l.state().plan());
@@ -192,6 +332,8 @@ void ArangoManager::destroy () {
     killAllInstances(ids);
   }
 
+  wakeup(Wakeup::ADMIN);
+
   // During the following time we will get KILL messages, this will keep
   // the status and as a consequences we will destroy all persistent volumes,
   // unreserve all reserved resources and decline the offers:
@@ -211,11 +353,28 @@ void ArangoManager::destroy () {
   Global::scheduler().postRequest("master/shutdown", body);
 }
 
-void ArangoManager::restart() {
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts a restart job
+////////////////////////////////////////////////////////////////////////////////
+
+string ArangoManager::restart (uint32_t parallelism) {
   LOG(INFO) << "restarting cluster...";
   
   Caretaker& caretaker = Global::caretaker();
-  caretaker.restart();
+  string id = caretaker.restart(parallelism);
+
+  wakeup(Wakeup::ADMIN);
+
+  return id;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief id of the last restart job finished
+////////////////////////////////////////////////////////////////////////////////
+
+string ArangoManager::finishedRestart () {
+  lock_guard<mutex> lock(_lock);
+  return _finishedRestart;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -223,9 +382,8 @@ void ArangoManager::restart() {
 ////////////////////////////////////////////////////////////////////////////////
 
 vector<string> ArangoManager::coordinatorEndpoints () {
-  auto l = Global::state().lease();
-  Current current = l.state().current();
-  auto const& coordinators = current.coordinators();
+  auto snapshot = Global::state().snapshot();
+  auto const& coordinators = snapshot->state().current().coordinators();
 
   vector<string> endpoints;
 
@@ -252,9 +410,8 @@ vector<string> ArangoManager::coordinatorEndpoints () {
 ////////////////////////////////////////////////////////////////////////////////
 
 vector<string> ArangoManager::dbserverEndpoints () {
-  auto l = Global::state().lease();
-  Current current = l.state().current();
-  auto const& dbservers = current.dbservers();
+  auto snapshot = Global::state().snapshot();
+  auto const& dbservers = snapshot->state().current().dbservers();
 
   vector<string> endpoints;
 
@@ -276,75 +433,66 @@ vector<string> ArangoManager::dbserverEndpoints () {
   return endpoints;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief pause between two requests for the cluster targets
+////////////////////////////////////////////////////////////////////////////////
+
+static chrono::seconds const TargetSyncInterval(2);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief timeout of a request for the cluster targets in seconds
+////////////////////////////////////////////////////////////////////////////////
+
+static double const TargetSyncTimeout = 10;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief update target
+////////////////////////////////////////////////////////////////////////////////
+
 std::vector<std::string> ArangoManager::updateTarget() {
-  std::vector<std::string> cleanedServers = {};
+  auto now = chrono::steady_clock::now();
 
-  std::string coordinatorURL;
-  {
-    auto lease = Global::state().lease();
+  if (! finishedRequests(_targetRequests).empty()) {
+    if (_targetSync.apply(*_targetResponse)) {
+      LOG(INFO) << "Cluster targets changed, DBservers: "
+                << _targetSync.dbservers() << ", coordinators: "
+                << _targetSync.coordinators();
 
-    coordinatorURL = Global::state().getCoordinatorURL(lease);
-  }
-  if (coordinatorURL.empty()) {
-    return cleanedServers;
-  }
+      Global::setNrDBServers(_targetSync.dbservers());
+      Global::setNrCoordinators(_targetSync.coordinators());
+      Global::caretaker().updateTarget();
+    }
 
-  std::string body;
-  long httpCode = 0;
-  int res = doClusterHTTPGet(coordinatorURL + "/_admin/cluster/numberOfServers", body, httpCode);
+    _targetResponse.reset();
 
-  if (res != 0 || httpCode != 200) {
-    LOG(ERROR) << "Couldn't retrieve cluster targets. HTTP Code: " << httpCode;
-    return cleanedServers;
-  }
-    
-  picojson::value value;
-  std::string err = picojson::parse(value, body);
-  
-  if (!err.empty()) {
-    LOG(WARNING) << "Couldn't parse json(cluster targets): " << err << ". Body was: " << body;
-    return cleanedServers;
-  }
-  
-  if (!value.is<picojson::object>()) {
-    LOG(WARNING) << "Root result is not an object for cluster targets. Body was: " << body;
-    return cleanedServers;
+    lock_guard<mutex> lock(_lock);
+    _targetStatistics = _targetSync.statistics();
   }
 
-  auto propertyPairs = {
-    std::make_pair("numberOfDBServers", &Global::setNrDBServers),
-    std::make_pair("numberOfCoordinators", &Global::setNrCoordinators),
-  };
+  if (_targetRequests.empty() && _nextTargetSync <= now) {
+    std::string coordinatorURL;
+    {
+      auto snapshot = Global::state().snapshot();
 
-  auto cleanedServersValue = value.get("cleanedServers");
-  
-  if (cleanedServersValue.is<picojson::array>()) {
-    auto arr = cleanedServersValue.get<picojson::array>();
-    
-    for (picojson::array::iterator it = arr.begin(); it != arr.end(); ++it) {
-      if (it->is<std::string>()) {
-        if (it->is<std::string>()) {
-          cleanedServers.push_back(it->get<std::string>());
-        }
-      }
+      coordinatorURL = Global::state().getCoordinatorURL(*snapshot);
     }
-  }
 
-  {
-    auto lease = Global::state().lease();
-    for (auto const& it: propertyPairs) {
-      auto nrValue = value.get(it.first);
+    if (! coordinatorURL.empty()) {
+      auto response = make_shared<TargetSync::Response>();
+      std::string etag = _targetSync.etag();
 
-      if (!nrValue.is<double>()) {
-        LOG(ERROR) << it.first << " in cluster target is not a number but " << nrValue.to_str();
-        continue;
-      }
-      (*it.second)(std::round(nrValue.get<double>()));
+      _targetResponse = response;
+      _nextTargetSync = now + TargetSyncInterval;
+
+      startRequest(_targetRequests, "targets",
+                   [response, coordinatorURL, etag] (std::string&) -> bool {
+        *response = TargetSync::fetch(coordinatorURL, etag, TargetSyncTimeout);
+        return response->_result == 0;
+      });
     }
   }
-  Global::caretaker().updateTarget();
 
-  return cleanedServers;
+  return _targetSync.cleanedServers();
 }
 
 // -----------------------------------------------------------------------------
@@ -356,24 +504,39 @@ std::vector<std::string> ArangoManager::updateTarget() {
 ////////////////////////////////////////////////////////////////////////////////
 
 void ArangoManager::dispatch () {
-  static const int SLEEP_SEC = 2;
-  //static const int SLEEP_SEC = 1;
+  static const auto SLEEP_SEC = chrono::seconds(2);
 
   prepareReconciliation();
 
   while (! _stopDispatcher) {
-    bool found;
-    {
-      auto l = Global::state().lease();
-      found = l.state().has_framework_id();
-    }
+    bool found = Global::state().snapshot()->state().has_framework_id();
 
+    // the registration wakes us up, any other wakeup has to wait for it,
+    // the framework id is checked again after the wakeup is cleared
     if (! found) {
-      this_thread::sleep_for(chrono::seconds(SLEEP_SEC));
+      waitForWork(chrono::steady_clock::now() + SLEEP_SEC);
+
+      lock_guard<mutex> lock(_lock);
+      _pending = false;
       continue;
     }
 
+    auto start = chrono::steady_clock::now();
 
+    // the changes of this cycle are published with a single snapshot
+    Global::state().beginCycle();
+
+    {
+      lock_guard<mutex> lock(_lock);
+
+      if (_pending) {
+        double latency = chrono::duration<double>(start - _pendingSince).count();
+
+        _statistics._latencyLast = latency;
+        _statistics._latencyMax = max(_statistics._latencyMax, latency);
+        _pending = false;
+      }
+    }
 
     std::vector<std::string> cleanedServers = updateTarget();
 
@@ -404,242 +567,510 @@ void ArangoManager::dispatch () {
       case RESTART_RESTART:
         Global::startReverseProxy();
         break;
+      case RESTART_UPDATE:
+        Global::state().setRestartProxy(RESTART_KEEP_RUNNING);
+
+        if (! Global::state().sendReverseProxyCommands()) {
+          Global::state().createReverseProxyConfig();
+          Global::startReverseProxy();
+        }
+        break;
     }
 
     // apply any timeouts
     bool sleep = checkTimeouts();
 
-    // wait for a little while, if we are idle
-    if (sleep) {
-      this_thread::sleep_for(chrono::seconds(2));
-      {
-        lock_guard<mutex> lock(_lock);
-        if (! _storedOffers.empty()) {
-          sleep = false;
-        }
-      }
-      if (sleep) {
-        this_thread::sleep_for(chrono::seconds(SLEEP_SEC));
-      }
-    }
-  }
-}
+    // tell the agency about failovers
+    driveFailovers();
 
-void ArangoManager::manageClusterRestart() {
-  auto lease = Global::state().lease();
-  if (!lease.state().has_restart()) {
-    return;
-  }
-  Caretaker& caretaker = Global::caretaker();
+    // and about new secondaries
+    driveSecondaries();
 
-  Restart* restart = lease.state().mutable_restart();
-  
-  assert(restart->buckets_size() > 0);
-  RestartBucket* bucket = restart->mutable_buckets(0);
-  LOG(INFO) << "Number of tasks to restart in bucket is " << bucket->restart_tasks_size();
-  bool changed = false;
-  std::vector<RestartTaskInfo> newBucketContents;
-  for (size_t i=0;i<bucket->restart_tasks_size();i++) {
-    RestartTaskInfo task = bucket->restart_tasks(i);
-    LOG(INFO) << "Checking if task " <<  task.task_name() << " was restarted";
-    if (taskIsGoneOrRestarted(lease, static_cast<TaskType>(task.task_type()), task.task_name())) {
-      LOG(INFO) << "=> task was restarted";
-      changed = true;
-    } else {
-      LOG(INFO) << "=> task not yet restarted";
-      newBucketContents.emplace_back(task);
+    Global::state().endCycle();
+
+    {
+      lock_guard<mutex> lock(_lock);
+
+      double cycle = chrono::duration<double>(
+        chrono::steady_clock::now() - start).count();
+
+      ++_statistics._cycles;
+      _statistics._cycleLast = cycle;
+      _statistics._cycleMax = max(_statistics._cycleMax, cycle);
+      _statistics._cycleTotal += cycle;
     }
-  }
 
-  if (changed) {
-    if (newBucketContents.empty()) {
-      Restart originalRestart;
-      originalRestart.CopyFrom(*restart);
-      
-      restart->clear_buckets();
-      // mop: pop off first bucket
-      for (size_t i=1;i<originalRestart.buckets_size();i++) {
-        RestartBucket originalBucket = originalRestart.buckets(i);
-        restart->add_buckets()->CopyFrom(originalBucket);
-      }
-    } else {
-      bucket->clear_restart_tasks();
-      for (auto task: newBucketContents) {
-        bucket->add_restart_tasks()->CopyFrom(task);
-      }
+    // wait for new work, if we are idle
+    if (sleep) {
+      waitForWork(nextDeadline());
     }
-    lease.changed();
-  }
-   
-  LOG(INFO) << "Remaining restart buckets: " << restart->buckets_size();
-  // mop: we just cleared our last bucket so restart is complete
-  if (restart->buckets_size() == 0) {
-    LOG(INFO) << "Cluster restart completed";
-    lease.state().clear_restart();
-    lease.changed();
   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief fill in TaskStatus
+/// @brief waits until the dispatcher is woken up or the deadline is reached
 ////////////////////////////////////////////////////////////////////////////////
 
-static void fillTaskStatus (vector<pair<string,string>>& result,
-                            TasksPlan const& plans,
-                            TasksCurrent const& currents) {
-
-  // we have to check the TaskInfo (not TaskStatus!)
-  for (int i = 0;  i < currents.entries_size();  ++i) {
-    TaskPlan const& planEntry = plans.entries(i);
-    TaskCurrent const& entry = currents.entries(i);
+void ArangoManager::waitForWork (chrono::steady_clock::time_point deadline) {
+  unique_lock<mutex> lock(_lock);
 
-    switch (planEntry.state()) {
-      case TASK_STATE_NEW:
-      case TASK_STATE_TRYING_TO_RESERVE:
-      case TASK_STATE_TRYING_TO_PERSIST:
-      case TASK_STATE_TRYING_TO_START:
-      case TASK_STATE_TRYING_TO_RESTART:
-      case TASK_STATE_RUNNING:
-      case TASK_STATE_KILLED:
-      case TASK_STATE_FAILED_OVER:
-        // At this stage we do not distinguish the state, is this sensible?
-        if (entry.has_task_info()) {
-          auto const& info = entry.task_info();
-          string taskId = info.task_id().value();
-          string slaveId = info.slave_id().value();
-          result.push_back(make_pair(taskId, slaveId));
-        }
+  bool woken = _wakeup.wait_until(lock, deadline, [this] () -> bool {
+    return _pending || _stopDispatcher;
+  });
 
-        break;
-      case TASK_STATE_DEAD:
-        break;
-    }
+  if (! woken) {
+    ++_statistics._deadlines;
   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief prepares the reconciliation of tasks
+/// @brief waits until there is room in a queue
 ////////////////////////////////////////////////////////////////////////////////
 
-void ArangoManager::prepareReconciliation () {
-  auto l = Global::state().lease();
-  vector<pair<string,string>> taskSlaveIds;
+void ArangoManager::waitForQueue (function<bool()> const& push,
+                                  char const* name) {
+  unique_lock<mutex> lock(_lock);
 
-  fillTaskStatus(taskSlaveIds, l.state().plan().agents(),
-                               l.state().current().agents());
-  fillTaskStatus(taskSlaveIds, l.state().plan().coordinators(), 
-                               l.state().current().coordinators());
-  fillTaskStatus(taskSlaveIds, l.state().plan().dbservers(),
-                               l.state().current().dbservers());
-  fillTaskStatus(taskSlaveIds, l.state().plan().secondaries(),
-                               l.state().current().secondaries());
+  ++_statistics._queueWaits;
+  ++_queueWaiters;
 
-  auto now = chrono::steady_clock::now();
+  LOG(WARNING)
+  << name << " queue is full, waiting for the dispatcher";
 
-  for (auto const& taskSlaveId : taskSlaveIds) {
-    auto nextReconcile = now;
-    auto backoff = chrono::seconds(1);
+  // the dispatcher makes room in its next cycle
+  if (! _pending) {
+    _pending = true;
+    _pendingSince = chrono::steady_clock::now();
+  }
 
-    ReconcileTasks reconcile = {
-      taskSlaveId.first,   // TaskId
-      taskSlaveId.second,  // SlaveId
-      nextReconcile,
-      backoff
-    };
+  _wakeup.notify_all();
 
-    _reconciliationTasks[taskSlaveId.first] = reconcile;
+  // the dispatcher takes the lock after making room, a push failing under
+  // the lock cannot miss its notification
+  while (! push() && ! _stopDispatcher) {
+    _wakeup.wait(lock);
   }
+
+  --_queueWaiters;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief tries to recover tasks
+/// @brief wakes up the driver if it waits for room in a queue
 ////////////////////////////////////////////////////////////////////////////////
 
-void ArangoManager::reconcileTasks () {
-
-  // see http://mesos.apache.org/documentation/latest/reconciliation/
-  // for details about reconciliation
+void ArangoManager::queueDrained () {
+  lock_guard<mutex> lock(_lock);
 
-  auto now = chrono::steady_clock::now();
+  if (0 < _queueWaiters) {
+    _wakeup.notify_all();
+  }
+}
 
-  // first, we ask for implicit reconciliation periodically
-  if (_nextImplicitReconciliation <= now) {
-    LOG(INFO) << "DEBUG implicit reconciliation";
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the earliest time the dispatcher has something to do on its own
+////////////////////////////////////////////////////////////////////////////////
 
-    if (!Global::scheduler().reconcileTasks()) {
-      return;
-    }
-    _nextImplicitReconciliation = now + _implicitReconciliationIntervall;
-  }
+chrono::steady_clock::time_point ArangoManager::nextDeadline () {
 
-  // check for unknown tasks
-  for (auto& task : _reconciliationTasks) {
-    if (task.second._nextReconcile < now) {
-      LOG(INFO) << "DEBUG explicit reconciliation for " << task.first;
+  // anything else wakes up the dispatcher, the bound only keeps the
+  // arithmetic of the clocks in range
+  static const auto IDLE_WAIT = chrono::hours(1);
 
-      Global::scheduler().reconcileTask(task.second._taskId,
-                                        task.second._slaveId);
+  auto deadline = chrono::steady_clock::now() + IDLE_WAIT;
 
-      task.second._backoff *= 2;
+  if (_nextImplicitReconciliation < deadline) {
+    deadline = _nextImplicitReconciliation;
+  }
 
-      if (task.second._backoff >= _maxReconcileIntervall) {
-        task.second._backoff = _maxReconcileIntervall;
-      }
+  if (_targetRequests.empty() && _nextTargetSync < deadline) {
+    deadline = _nextTargetSync;
+  }
 
-      task.second._nextReconcile = now + task.second._backoff;
-    }
+  if (! _reconcileDeadlines.empty() &&
+      _reconcileDeadlines.top().first < deadline) {
+    deadline = _reconcileDeadlines.top().first;
   }
-}
 
-////////////////////////////////////////////////////////////////////////////////
-/// @brief checks for timeout
-////////////////////////////////////////////////////////////////////////////////
+  auto expiry = _offers.nextExpiry();
 
-static double const TryingToReserveTimeout  = 30;  // seconds
-static double const TryingToPersistTimeout  = 30;
-static double const TryingToStartTimeout    = 600; // docker pull might take
-static double const TryingToShutdownTimeout = 120; // forcefully kill task after wait
+  if (expiry < deadline) {
+    deadline = expiry;
+  }
 
-/* mop: time mesos will allow ourselves to restart properly. this must be set
- * to a high value. When this timeout is exceeded mesos will declare the whole
- * framework lost and it will kill all associated tasks!
- */
-static double const FailoverTimeout        = 60;
+  // the first timeout of the plan to expire, including those started
+  // after checkTimeouts in this cycle
+  collectTimeouts();
 
-// Note that the failover timeout can be configured by the user via a
-// command line option.
+  if (! _timeoutDeadlines.empty() &&
+      _timeoutDeadlines.top()._expires < deadline) {
+    deadline = _timeoutDeadlines.top()._expires;
+  }
 
-// For debugging purposes:
-#if 0
-static double const TryingToReserveTimeout = 30;  // seconds
-static double const TryingToPersistTimeout = 30;
-static double const TryingToStartTimeout   = 30; // docker pull might take
-static double const TryingToRestartTimeout = 30;
-static double const FailoverTimeout        = 86400;
-static double const TryingToResurrectTimeout = 30;  // Patience before we
-                                                    // give up on a persistent
-                                                    // task.
-#endif
+  // the next attempt to tell the agency about a failover, the timestamps
+  // of the failovers are taken from the system clock, as they survive a
+  // restart
+  double wallNow = chrono::duration<double>(
+    chrono::system_clock::now().time_since_epoch()).count();
+  auto steadyNow = chrono::steady_clock::now();
 
-static bool getServerId(TaskCurrent* task, std::string& server_id) {
-  std::string body;
-  long httpCode = 0;
+  auto retry = [&] (double timestamp) -> chrono::steady_clock::time_point {
+    return steadyNow + chrono::duration_cast<chrono::steady_clock::duration>(
+      chrono::duration<double>(timestamp - wallNow));
+  };
 
-  std::string endpoint;
-  if (!Global::arangoDBSslKeyfile().empty()) {
-    endpoint = "https://";
-  } else {
-    endpoint = "http://";
+  // the next attempt to tell the agency about a new secondary
+  for (auto const& pending : _secondaryRegistrations) {
+    if (! isRequestRunning(_secondaryRequests, pending.first) &&
+        pending.second._next < deadline) {
+      deadline = pending.second._next;
+    }
   }
-  endpoint += task->hostname() + ":" + to_string(task->ports(0)) + "/_admin/server/id";
 
-  int res = doClusterHTTPGet(endpoint, body, httpCode);
+  auto snapshot = Global::state().snapshot();
 
-  if (res != 0 || httpCode != 200) {
-    LOG(ERROR) << "Couldn't retrieve server id. HTTP Code: " << httpCode;
-    return false;
+  for (auto const& failover : snapshot->state().failovers().entries()) {
+    if (failover.state() == FAILOVER_SWAP_REQUESTED &&
+        ! isRequestRunning(_failoverRequests, failover.primary()) &&
+        retry(failover.timestamp()) < deadline) {
+      deadline = retry(failover.timestamp());
+    }
   }
-    
+
+  return deadline;
+}
+
+void ArangoManager::manageClusterRestart() {
+  if (! Global::state().snapshot()->state().has_restart()) {
+    _restartServingSince.clear();
+    return;
+  }
+
+  auto lease = Global::state().lease();
+  if (!lease.state().has_restart()) {
+    return;
+  }
+
+  Restart* restart = lease.state().mutable_restart();
+  
+  if (0 < restart->buckets_size()) {
+    RestartBucket* bucket = restart->mutable_buckets(0);
+    bool done = true;
+
+    for (auto& task : *bucket->mutable_restart_tasks()) {
+      TaskType type = static_cast<TaskType>(task.task_type());
+
+      if (! task.restarted()) {
+        if (! taskIsGoneOrRestarted(lease, type, task.task_name())) {
+          done = false;
+          continue;
+        }
+
+        LOG(INFO) << "Task " << task.task_name() << " was restarted";
+        task.set_restarted(true);
+        lease.changed();
+      }
+
+      if (! restartedTaskServes(lease, type, task.task_name())) {
+        done = false;
+      }
+    }
+
+    // mop: pop off first bucket
+    if (done) {
+      google::protobuf::RepeatedPtrField<RestartBucket> remaining;
+
+      for (int i = 1;  i < restart->buckets_size();  ++i) {
+        remaining.Add()->CopyFrom(restart->buckets(i));
+      }
+
+      restart->mutable_buckets()->Swap(&remaining);
+      _restartServingSince.clear();
+      lease.changed();
+
+      LOG(INFO) << "Remaining restart buckets: " << restart->buckets_size();
+    }
+  }
+   
+  // mop: we just cleared our last bucket so restart is complete
+  if (restart->buckets_size() == 0) {
+    LOG(INFO) << "Cluster restart " << restart->id() << " completed";
+
+    {
+      lock_guard<mutex> lock(_lock);
+      _finishedRestart = restart->id();
+    }
+
+    lease.state().clear_restart();
+    lease.changed();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief how long a restarted task may take to answer its health probes
+////////////////////////////////////////////////////////////////////////////////
+
+static chrono::seconds const RestartHealthTimeout(120);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether a restarted task answers its health probes
+////////////////////////////////////////////////////////////////////////////////
+
+bool ArangoManager::restartedTaskServes (ArangoState::Lease& lease,
+                                         TaskType type,
+                                         string const& name) {
+  HealthProbes* probes = Global::healthProbes();
+
+  if (probes == nullptr ||
+      lease.index().findByName(type, name) < 0) {
+    return true;
+  }
+
+  auto now = chrono::system_clock::now();
+  auto key = make_pair(type, name);
+  auto it = _restartServingSince.find(key);
+
+  if (it == _restartServingSince.end()) {
+    it = _restartServingSince.emplace(key, now).first;
+  }
+
+  // only a probe after the restart counts
+  TaskHealth health;
+
+  if (probes->find(type, name, health) &&
+      health._healthy &&
+      it->second < health._lastProbe) {
+    return true;
+  }
+
+  if (it->second + RestartHealthTimeout < now) {
+    LOG(WARNING) << "Task " << name << " does not answer its health probes "
+                 << "after its restart, continuing the restart anyway";
+    return true;
+  }
+
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether a status update tells that a launch was refused,
+/// because the task or one of the operations before it was invalid, or
+/// the offer was no longer valid
+////////////////////////////////////////////////////////////////////////////////
+
+static bool launchFailed (mesos::TaskStatus const& status) {
+  if (status.state() == mesos::TASK_ERROR) {
+    return true;
+  }
+
+  return status.state() == mesos::TASK_LOST && status.has_reason() &&
+         status.reason() == mesos::TaskStatus::REASON_INVALID_OFFERS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief fill in TaskStatus
+////////////////////////////////////////////////////////////////////////////////
+
+static void fillTaskStatus (vector<pair<string,string>>& result,
+                            TasksPlan const& plans,
+                            TasksCurrent const& currents) {
+
+  // we have to check the TaskInfo (not TaskStatus!)
+  for (int i = 0;  i < currents.entries_size();  ++i) {
+    TaskPlan const& planEntry = plans.entries(i);
+    TaskCurrent const& entry = currents.entries(i);
+
+    switch (planEntry.state()) {
+      case TASK_STATE_NEW:
+      case TASK_STATE_TRYING_TO_RESERVE:
+      case TASK_STATE_TRYING_TO_PERSIST:
+      case TASK_STATE_TRYING_TO_START:
+      case TASK_STATE_TRYING_TO_RESTART:
+      case TASK_STATE_RUNNING:
+      case TASK_STATE_KILLED:
+      case TASK_STATE_FAILED_OVER:
+        // At this stage we do not distinguish the state, is this sensible?
+        if (! entry.task_id().empty()) {
+          string taskId = entry.task_id();
+          string slaveId = entry.slave_id().value();
+          result.push_back(make_pair(taskId, slaveId));
+        }
+
+        break;
+      case TASK_STATE_DEAD:
+        break;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief prepares the reconciliation of tasks
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoManager::prepareReconciliation () {
+
+  // the tasks are taken from the published state, which a standby has
+  // kept up to date, the reconciliation itself is a conversation with
+  // the master and cannot start before we are registered
+  auto snapshot = Global::state().snapshot();
+  State const& state = snapshot->state();
+  vector<pair<string,string>> taskSlaveIds;
+
+  fillTaskStatus(taskSlaveIds, state.plan().agents(),
+                               state.current().agents());
+  fillTaskStatus(taskSlaveIds, state.plan().coordinators(), 
+                               state.current().coordinators());
+  fillTaskStatus(taskSlaveIds, state.plan().dbservers(),
+                               state.current().dbservers());
+  fillTaskStatus(taskSlaveIds, state.plan().secondaries(),
+                               state.current().secondaries());
+
+  auto now = chrono::steady_clock::now();
+
+  for (auto const& taskSlaveId : taskSlaveIds) {
+    auto nextReconcile = now;
+    auto backoff = chrono::seconds(1);
+
+    ReconcileTasks reconcile = {
+      taskSlaveId.first,   // TaskId
+      taskSlaveId.second,  // SlaveId
+      nextReconcile,
+      backoff,
+      chrono::steady_clock::time_point()
+    };
+
+    _reconciliationTasks[taskSlaveId.first] = reconcile;
+    _reconcileDeadlines.emplace(nextReconcile, taskSlaveId.first);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief tries to recover tasks
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoManager::reconcileTasks () {
+
+  // see http://mesos.apache.org/documentation/latest/reconciliation/
+  // for details about reconciliation
+
+  auto now = chrono::steady_clock::now();
+
+  // first, we ask for implicit reconciliation periodically
+  if (_nextImplicitReconciliation <= now) {
+    LOG(INFO) << "DEBUG implicit reconciliation";
+
+    if (!Global::scheduler().reconcileTasks()) {
+      return;
+    }
+    _nextImplicitReconciliation = now + _implicitReconciliationIntervall;
+    _lastImplicitReconciliation = now;
+    ++_reconciliation._implicit;
+  }
+
+  // then for all unknown tasks which are due, with one request
+  vector<pair<string, string>> due;
+
+  while (! _reconcileDeadlines.empty() &&
+         _reconcileDeadlines.top().first <= now) {
+    ReconcileDeadline deadline = _reconcileDeadlines.top();
+    _reconcileDeadlines.pop();
+
+    auto it = _reconciliationTasks.find(deadline.second);
+
+    if (it == _reconciliationTasks.end() ||
+        it->second._nextReconcile != deadline.first) {
+      continue;
+    }
+
+    ReconcileTasks& task = it->second;
+
+    due.emplace_back(task._taskId, task._slaveId);
+
+    if (task._requested == chrono::steady_clock::time_point()) {
+      task._requested = now;
+    }
+
+    task._backoff *= 2;
+
+    if (task._backoff >= _maxReconcileIntervall) {
+      task._backoff = _maxReconcileIntervall;
+    }
+
+    task._nextReconcile = now + task._backoff;
+    _reconcileDeadlines.emplace(task._nextReconcile, task._taskId);
+  }
+
+  if (! due.empty()) {
+    LOG(INFO) << "DEBUG explicit reconciliation for " << due.size() << " tasks";
+
+    Global::scheduler().reconcileTasks(due);
+
+    ++_reconciliation._explicit;
+    _reconciliation._explicitTasks += due.size();
+  }
+
+  _reconciliation._pending = _reconciliationTasks.size();
+
+  lock_guard<mutex> lock(_lock);
+  _reconciliationStatistics = _reconciliation;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a status update has arrived, the task is reconciled
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoManager::reconciled (mesos::TaskStatus const& status) {
+  auto now = chrono::steady_clock::now();
+  auto it = _reconciliationTasks.find(status.task_id().value());
+
+  if (it != _reconciliationTasks.end()) {
+    if (it->second._requested != chrono::steady_clock::time_point()) {
+      double latency
+        = chrono::duration<double>(now - it->second._requested).count();
+
+      ++_reconciliation._explicitAnswers;
+      _reconciliation._explicitLatencyLast = latency;
+      _reconciliation._explicitLatencyMax
+        = max(_reconciliation._explicitLatencyMax, latency);
+      _reconciliation._explicitLatencyTotal += latency;
+    }
+
+    // the entry in the deadlines is outdated now and skipped later
+    _reconciliationTasks.erase(it);
+  }
+  else if (status.reason() == mesos::TaskStatus::REASON_RECONCILIATION &&
+           0 < _reconciliation._implicit) {
+    double latency
+      = chrono::duration<double>(now - _lastImplicitReconciliation).count();
+
+    ++_reconciliation._implicitAnswers;
+    _reconciliation._implicitLatencyLast = latency;
+    _reconciliation._implicitLatencyMax
+      = max(_reconciliation._implicitLatencyMax, latency);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief URL to ask a task for its server id
+////////////////////////////////////////////////////////////////////////////////
+
+static string serverIdURL (TaskCurrent const& task) {
+  string endpoint;
+
+  if (!Global::arangoDBSslKeyfile().empty()) {
+    endpoint = "https://";
+  } else {
+    endpoint = "http://";
+  }
+
+  return endpoint + task.hostname() + ":" + to_string(task.ports(0))
+    + "/_admin/server/id";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief extracts the server id from an answer to /_admin/server/id
+////////////////////////////////////////////////////////////////////////////////
+
+static bool parseServerId (string const& body, string& server_id) {
   picojson::value s;
   std::string err = picojson::parse(s, body);
 
@@ -657,466 +1088,951 @@ static bool getServerId(TaskCurrent* task, std::string& server_id) {
 
   if (!id.is<string>()) {
     LOG(WARNING) << "Id is not a string. Body was: " << body;
+    return false;
+  }
+
+  server_id = id.get<string>();
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief maximal number of concurrent requests for server ids
+////////////////////////////////////////////////////////////////////////////////
+
+static size_t const MaxServerIdRequests = 8;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief timeout of a request for a server id in seconds
+////////////////////////////////////////////////////////////////////////////////
+
+static double const ServerIdTimeout = 10;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief pause before a server is asked again after a failed request
+////////////////////////////////////////////////////////////////////////////////
+
+static chrono::seconds const ServerIdRetry(2);
+
+bool ArangoManager::registerNewSecondary(ArangoState::Lease& lease, std::string const& primaryId) {
+  Plan* plan = lease.state().mutable_plan();
+
+  int i = lease.index().findByServerId(TaskType::PRIMARY_DBSERVER, primaryId);
+  if (i >= 0) {
+    return registerNewSecondary(lease, plan->mutable_dbservers()->mutable_entries(i));
+  }
+  LOG(ERROR) << "Couldn't find primary " << primaryId;
+  return false;
+}
+
+bool ArangoManager::registerNewSecondary(ArangoState::Lease& lease, TaskPlan* primary) {
+  if (primary->server_id().empty()) {
+    LOG(WARNING) << "Server ID from " << primary->name() << " not yet known. Can't register secondary yet";
+    return false;
   }
 
-  server_id = id.get<string>();
-  return true;
-}
+  // already requested, the agency is told by driveSecondaries
+  if (_secondaryRegistrations.find(primary->name())
+        != _secondaryRegistrations.end()) {
+    return true;
+  }
+
+  // the name must neither be in the plan nor be taken by another
+  // registration still waiting for the agency
+  int number = lease.state().plan().secondaries().entries_size() + 1;
+  std::string secondaryName;
+
+  while (true) {
+    secondaryName = "Secondary" + std::to_string(number++);
+
+    if (0 <= lease.index().findByName(TaskType::SECONDARY_DBSERVER,
+                                      secondaryName)) {
+      continue;
+    }
+
+    bool taken = false;
+
+    for (auto const& pending : _secondaryRegistrations) {
+      if (pending.second._secondary == secondaryName) {
+        taken = true;
+        break;
+      }
+    }
+
+    if (! taken) {
+      break;
+    }
+  }
+
+  SecondaryRegistration registration;
+  registration._primary = primary->name();
+  registration._serverId = primary->server_id();
+  registration._oldSecondary = primary->sync_partner().empty()
+                             ? "none" : primary->sync_partner();
+  registration._secondary = secondaryName;
+  registration._attempts = 0;
+  registration._next = chrono::steady_clock::now();
+
+  _secondaryRegistrations[primary->name()] = registration;
+
+  return true;
+}
+
+void ArangoManager::updateServerIds() {
+  static TaskType const types[] = {
+    TaskType::PRIMARY_DBSERVER,
+    TaskType::SECONDARY_DBSERVER,
+    TaskType::COORDINATOR
+  };
+
+  auto now = chrono::steady_clock::now();
+
+  // collect the answers, these are parsed without holding the state
+  unordered_map<string, string> found;
+
+  for (auto const& answer : finishedRequests(_serverIdRequests)) {
+    string id;
+
+    if (answer._ok && parseServerId(answer._body, id)) {
+      found[answer._key] = id;
+    }
+    else {
+      _serverIdRetries[answer._key] = now + ServerIdRetry;
+    }
+  }
+
+  // apply all ids found in one short lease, a task which has been
+  // restarted in the meantime is asked again with its new endpoint
+  if (! found.empty()) {
+    auto l = Global::state().lease();
+
+    auto* plan = l.state().mutable_plan();
+    auto* current = l.state().mutable_current();
+
+    for (auto taskType : types) {
+      TasksPlan* tasksPlan = nullptr;
+      TasksCurrent* tasksCurr = nullptr;
+
+      switch (taskType) {
+        case TaskType::COORDINATOR:
+          tasksPlan = plan->mutable_coordinators();
+          tasksCurr = current->mutable_coordinators();
+          break;
+        case TaskType::PRIMARY_DBSERVER:
+          tasksPlan = plan->mutable_dbservers();
+          tasksCurr = current->mutable_dbservers();
+          break;
+        case TaskType::SECONDARY_DBSERVER:
+          tasksPlan = plan->mutable_secondaries();
+          tasksCurr = current->mutable_secondaries();
+          break;
+        default:
+          continue;
+      }
+
+      for (int i = 0; i < tasksPlan->entries_size(); i++) {
+        auto tp = tasksPlan->mutable_entries(i);
+        auto const& tc = tasksCurr->entries(i);
+
+        if (tp->state() != TASK_STATE_RUNNING ||
+            ! tp->server_id().empty() ||
+            tc.ports_size() == 0) {
+          continue;
+        }
+
+        auto it = found.find(serverIdURL(tc));
+
+        if (it != found.end()) {
+          tp->set_server_id(it->second);
+          l.update(taskType, i);
+          l.changed();
+        }
+      }
+    }
+  }
+
+  // forget the pauses which are over
+  for (auto it = _serverIdRetries.begin();  it != _serverIdRetries.end();) {
+    if (it->second <= now) {
+      it = _serverIdRetries.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+
+  // ask the running servers without a server id, at most a few at a time,
+  // the tasks which have just started running are not yet published
+  auto lease = Global::state().leaseRead();
+  State const& state = lease.state();
+
+  for (auto taskType : types) {
+    TasksPlan const& plan = tasksPlan(state, taskType);
+    TasksCurrent const& current = tasksCurrent(state, taskType);
+
+    for (int i = 0;  i < plan.entries_size();  ++i) {
+      if (MaxServerIdRequests <= _serverIdRequests.size()) {
+        return;
+      }
+
+      TaskPlan const& tp = plan.entries(i);
+
+      if (tp.state() != TASK_STATE_RUNNING ||
+          ! tp.server_id().empty() ||
+          current.entries_size() <= i ||
+          current.entries(i).ports_size() == 0) {
+        continue;
+      }
+
+      string url = serverIdURL(current.entries(i));
+
+      if (isRequestRunning(_serverIdRequests, url) ||
+          _serverIdRetries.find(url) != _serverIdRetries.end()) {
+        continue;
+      }
+
+      startRequest(_serverIdRequests, url,
+                   [url] (std::string& resultBody) -> bool {
+        long httpCode = 0;
+        int res = doClusterHTTPGet(url, resultBody, httpCode, ServerIdTimeout);
+
+        if (res != 0 || httpCode != 200) {
+          LOG(ERROR) << "Couldn't retrieve server id from " << url
+                     << ". HTTP Code: " << httpCode;
+          return false;
+        }
+
+        return true;
+      });
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks for timeouts
+////////////////////////////////////////////////////////////////////////////////
+
+bool ArangoManager::checkTimeouts () {
+  collectTimeouts();
+
+  auto steadyNow = chrono::steady_clock::now();
+  vector<ArangoState::TimedTask> expired;
+
+  while (! _timeoutDeadlines.empty() &&
+         _timeoutDeadlines.top()._expires <= steadyNow) {
+    expired.push_back(_timeoutDeadlines.top()._task);
+    _timeoutDeadlines.pop();
+  }
+
+  // the state is only leased if a timeout has expired
+  if (expired.empty()) {
+    return true;
+  }
+
+  auto l = Global::state().lease();
+
+  auto* plan = l.state().mutable_plan();
+  auto* current = l.state().mutable_current();
+
+  double now = chrono::duration<double>(steadyNow.time_since_epoch()).count();
+
+  for (auto const& task : expired) {
+    TaskType taskType = task._type;
+    TaskPlanState planState = task._state;
+    TasksPlan* tasksPlan;
+    TasksCurrent* tasksCurr;
+    switch (taskType) {
+      case TaskType::AGENT:
+        tasksPlan = plan->mutable_agents();
+        tasksCurr = current->mutable_agents();
+        break;
+      case TaskType::PRIMARY_DBSERVER:
+        tasksPlan = plan->mutable_dbservers();
+        tasksCurr = current->mutable_dbservers();
+        break;
+      case TaskType::SECONDARY_DBSERVER:
+        tasksPlan = plan->mutable_secondaries();
+        tasksCurr = current->mutable_secondaries();
+        break;
+      case TaskType::COORDINATOR:
+        tasksPlan = plan->mutable_coordinators();
+        tasksCurr = current->mutable_coordinators();
+        break;
+      default:  // never happens
+        tasksPlan = nullptr;
+        tasksCurr = nullptr;
+        break;
+    }
+
+    int i = l.index().findByName(taskType, task._name);
+
+    if (tasksPlan == nullptr || i < 0) {
+      continue;
+    }
+
+    TaskPlan* tp = tasksPlan->mutable_entries(i);
+    TaskCurrent* ic = tasksCurr->mutable_entries(i);
+
+    // the task or an earlier timeout may have changed the task in the
+    // meantime, its timeout has then started anew
+    if (tp->state() != planState || tp->timestamp() != task._timestamp) {
+      continue;
+    }
+
+    // the timeouts may have changed since the deadline was computed, the
+    // deadlines are all computed again then
+    double timeout = _timeouts.timeout(taskType, planState);
+
+    if (timeout <= 0.0 || steadyNow < steadyTime(task._timestamp + timeout)) {
+      continue;
+    }
+
+    LOG(INFO) << "Timeout " << timeout << "s reached "
+              << " for task " << tp->name()
+              << " in state " << TaskPlanState_Name(planState) << ".";
+
+    switch (tp->state()) {
+      case TASK_STATE_TRYING_TO_RESERVE:
+        // After a timeout, go back to state TASK_STATE_NEW, because
+        // there was no satisfactory answer to our reservation request.
+        // Resources will be freed automatically.
+        LOG(INFO) << "Going back to state TASK_STATE_NEW.";
+        tp->set_state(TASK_STATE_NEW);
+        tp->clear_persistence_id();
+        tp->set_timestamp(now);
+        l.changed();
+        break;
+      case TASK_STATE_TRYING_TO_PERSIST:
+        // After a timeout, go back to state TASK_STATE_NEW, because
+        // there was no satisfactory answer to our persistence request.
+        // Resources will be freed automatically.
+        LOG(INFO) << "Going back to state TASK_STATE_NEW.";
+        tp->set_state(TASK_STATE_NEW);
+        tp->clear_persistence_id();
+        tp->set_timestamp(now);
+        l.changed();
+        break;
+      case TASK_STATE_TRYING_TO_START:
+        // After a timeout, go back to state TASK_STATE_NEW, because
+        // there was no satisfactory answer to our start request.
+        // Resources will be freed automatically.
+        LOG(INFO) << "Going back to state TASK_STATE_NEW.";
+        tp->set_state(TASK_STATE_NEW);
+        tp->clear_persistence_id();
+        tp->set_timestamp(now);
+        l.changed();
+        break;
+      case TASK_STATE_FAILED_OVER:
+        // This task has been replaced by its failover partner, now we
+        // finally lose patience to wait for a restart and give up on the
+        // task. This can only happen to a primary DBserver that has been
+        // interchanged with its secondary and is now a secondary.
+        // We want to get rid of this task and replace it with a new one.
+        // This is exactly what we would have done if this server was a
+        // secondary that has failed in the first place. Therefore we
+        // fall through here and let the case for TASK_STATE_KILLED
+        // take care of the rest.
+      case TASK_STATE_KILLED:
+        // After some time being killed, we have to take action and
+        // engage in some automatic failover procedure:
+        if (taskType == TaskType::AGENT) {
+          // ignore timeout, keep trying, otherwise we are lost
+          LOG(INFO) << "Task is an agent, simply reset the timestamp and "
+                    << "wait forever.";
+          tp->set_timestamp(now);
+          l.changed();
+        }
+        else if (taskType == TaskType::COORDINATOR) {
+          // simply go back to TASK_STATE_NEW to start another one
+          // There were no reservations and persistent volumes,
+          // so Mesos will clean up behind ourselves.
+          LOG(INFO) << "Going back to state TASK_STATE_NEW.";
+          tp->set_state(TASK_STATE_NEW);
+          tp->clear_persistence_id();
+          tp->set_timestamp(now);
+          l.changed();
+        }
+        else if (taskType == TaskType::SECONDARY_DBSERVER) {
+          // find corresponding primary (partner)
+          // make new secondary, change primary's secondary entry in
+          // our state and in the registry, declare old secondary dead
+          std::string primaryName = tp->sync_partner();
+          // Give up on this one:
+          tp->set_state(TASK_STATE_DEAD);
+          tp->set_timestamp(now);
+          tp->clear_persistence_id();
+          tp->clear_sync_partner();
+          ic->clear_slave_id();
+          ic->clear_offer_id();
+          ic->clear_ports();
+          ic->clear_hostname();
+          ic->clear_container_path();
+          ic->clear_task_id();
+          ic->clear_launch_hash();
+
+          registerNewSecondary(l, primaryName);
+          l.changed();
+        }
+        else if (taskType == TaskType::PRIMARY_DBSERVER) {
+          // interchange plan and current infos, update task2position
+          // map, promote secondary to primary in state and agency,
+          // make old primary the secondary of the old secondary,
+          // set state of old primary to TASK_STATE_FAILED_OVER
+          if (! tp->has_sync_partner()) {
+            if (tp->state() == TASK_STATE_KILLED) {
+              // We cannot do much here, so let's keep waiting...
+              LOG(INFO) << "Task is a dbserver without a replica."
+                << " Will start a new primary and wait for the supervision"
+                << " to take action and either declare the old server dead"
+                << " or wait for user action";
+              
+              TaskPlan* tpnew = tasksPlan->add_entries();
+              std::string name = "DBServer" 
+                 + std::to_string(tasksPlan->entries_size());
+              tpnew->set_name(name);
+              tpnew->set_state(TASK_STATE_NEW);
+              tpnew->set_timestamp(now);
+
+              // mop: by convention: keep size in sync 
+              tasksCurr->add_entries();
+              l.update(taskType, tasksPlan->entries_size() - 1);
+              tp->set_state(TASK_STATE_FAILED_OVER);
+
+              LOG(INFO) << "Task " << tp->name() << " is now TASK_STATE_FAILED_OVER(" << tp->state() << ")";
+            } else {
+              LOG(INFO) << "Still waiting for dbserver " << tp->name();
+            }
+            
+            tp->set_timestamp(now);
+            l.changed();
+          }
+          else {
+            std::string secondaryName = tp->sync_partner();
+
+            // Find the corresponding secondary:
+            int j = l.index().findByName(TaskType::SECONDARY_DBSERVER,
+                                         secondaryName);
+            if (j < 0) {
+              LOG(INFO) << "Did not find replica of dbserver task, simply "
+                        << "reset the timestamp and wait forever.";
+              tp->set_timestamp(now);
+              l.changed();
+            }
+            else {
+              // Now interchange the information on primary[i] and
+              // secondary[j]:
+              TaskPlan* tpsecond
+                  = plan->mutable_secondaries()->mutable_entries(j);
+              TaskPlan dummy;
+              dummy.CopyFrom(*tpsecond);
+              tpsecond->CopyFrom(*tp);
+              tp->CopyFrom(dummy);
+              TaskCurrent dummy2;
+              TaskCurrent* tpsecondcur
+                  = current->mutable_secondaries()->mutable_entries(j);
+              dummy2.CopyFrom(*tpsecondcur);
+              tpsecondcur->CopyFrom(*ic);
+              ic->CopyFrom(dummy2);
+              
+              tp->set_timestamp(now);
+              tpsecond->set_timestamp(now);
+
+              // Set the new state of the failed task to 
+              // TASK_STATE_FAILED_OVER:
+              tpsecond->set_state(TASK_STATE_FAILED_OVER);
+
+              // Now update the task index, the primary and the
+              // secondary have been interchanged, the primary is
+              // updated below:
+              l.update(TaskType::SECONDARY_DBSERVER, j);
+
+              // The agency is told about the swap by the
+              // dispatcher later on, see driveFailovers, the
+              // failover is persisted together with the swap.
+              Failover* failover
+                = l.state().mutable_failovers()->add_entries();
+              failover->set_primary(tpsecond->name());
+              failover->set_secondary(tp->name());
+              failover->set_state(FAILOVER_SWAP_REQUESTED);
+              failover->set_timestamp(chrono::duration<double>(
+                chrono::system_clock::now().time_since_epoch()).count());
+              failover->set_attempts(0);
+
+              l.changed();
+
+              LOG(INFO) << "Switched primary " << tpsecond->name()
+                        << " and secondary " << tp->name()
+                        << " in the plan, telling the agency";
+            }
+          }
+        }
+        break;
+      case TASK_STATE_TRYING_TO_RESTART:
+        // We got the offer for a restart, but the restart is not happening.
+        // We need to go back to state TASK_STATE_KILLED to wait for another
+        // offer.
+        LOG(INFO) << "Going back to state TASK_STATE_KILL.";
+        tp->set_state(TASK_STATE_KILLED);
+        l.changed();
+        // Do not change the time stamp here, because we want to
+        // notice alternating between KILLED and TRYING_TO_RESTART!
+        break;
+      case TASK_STATE_NEW:
+      case TASK_STATE_RUNNING:
+      case TASK_STATE_DEAD:
+        // These states have no timeout.
+        break;
+      case TASK_STATE_SHUTTING_DOWN:
+        // Kill the task forcefully, again after the next timeout if
+        // it is still there then.
+        Global::scheduler().killInstance(ic->task_id());
+        tp->set_timestamp(now);
+        l.changed();
+        break;
+    }
+
+    l.update(taskType, i);
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief registers the deadlines of timeouts started anew
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoManager::collectTimeouts () {
+  vector<ArangoState::TimedTask> tasks;
+  bool complete = Global::state().takeTimedTasks(tasks);
+  uint64_t version = _timeouts.version();
+
+  if (! complete || version != _timeoutsVersion) {
+    _timeoutsVersion = version;
+    _timeoutDeadlines = decltype(_timeoutDeadlines)();
+    tasks.clear();
+
+    // the tasks handed over before are part of the state as well
+    auto lease = Global::state().leaseRead();
+
+    for (auto type : TaskTimeouts::timedTypes()) {
+      for (auto const& entry : tasksPlan(lease.state(), type).entries()) {
+        if (entry.has_timestamp()) {
+          ArangoState::TimedTask task = {
+            type, entry.name(), entry.state(), entry.timestamp()
+          };
+
+          tasks.push_back(task);
+        }
+      }
+    }
+  }
+
+  for (auto const& task : tasks) {
+    double timeout = _timeouts.timeout(task._type, task._state);
+
+    if (0.0 < timeout) {
+      TimeoutDeadline deadline = {
+        steadyTime(task._timestamp + timeout), task
+      };
+
+      _timeoutDeadlines.push(deadline);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief pause before telling the agency about a failover again, doubled
+/// with each attempt up to the maximum, in seconds
+////////////////////////////////////////////////////////////////////////////////
+
+static double const FailoverRetryMin = 1;
+static double const FailoverRetryMax = 60;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief number of finished failovers kept in the state
+////////////////////////////////////////////////////////////////////////////////
+
+static int const FinishedFailoversKept = 10;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief timeout of a request telling the agency about a failover in
+/// seconds
+////////////////////////////////////////////////////////////////////////////////
+
+static double const FailoverTimeout = 10;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief tells the agency about swapped primaries and secondaries
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoManager::driveFailovers () {
+  auto answers = finishedRequests(_failoverRequests);
+
+  struct Swap {
+    std::string _primary;
+    std::string _secondary;
+  };
+
+  std::vector<Swap> swaps;
+  std::string coordinatorURL;
+
+  {
+    auto l = Global::state().lease();
+
+    if (! l.state().has_failovers()) {
+      return;
+    }
+
+    // the failovers are persisted, so their time is the system time
+    double now = chrono::duration<double>(
+      chrono::system_clock::now().time_since_epoch()).count();
+
+    auto* failovers = l.state().mutable_failovers()->mutable_entries();
+
+    for (auto const& answer : answers) {
+      for (auto& failover : *failovers) {
+        if (failover.primary() != answer._key ||
+            failover.state() != FAILOVER_SWAP_REQUESTED) {
+          continue;
+        }
+
+        if (answer._ok) {
+          LOG(INFO) << "Successfully reconfigured agency "
+                    << "(switching primary " << failover.primary()
+                    << " and secondary " << failover.secondary() << ")";
+
+          failover.set_state(FAILOVER_AGENCY_ACKNOWLEDGED);
+          failover.set_timestamp(now);
+          l.changed();
+        }
+        else {
+          LOG(WARNING) << "Agency not yet reconfigured "
+                       << "(switching primary " << failover.primary()
+                       << " and secondary " << failover.secondary()
+                       << "), retrying in "
+                       << (failover.timestamp() - now) << "s";
+        }
+      }
+    }
+
+    int finished = 0;
+
+    for (auto& failover : *failovers) {
+      switch (failover.state()) {
+        case FAILOVER_SWAP_REQUESTED: {
+          if (isRequestRunning(_failoverRequests, failover.primary()) ||
+              now < failover.timestamp()) {
+            break;
+          }
+
+          if (coordinatorURL.empty()) {
+            coordinatorURL = Global::state().getCoordinatorURL(l);
+          }
+
+          // the next attempt is set before this one is started, so a
+          // failed attempt has nothing to change in the state
+          double pause = FailoverRetryMin;
+
+          for (uint32_t i = 0;  i < failover.attempts();  ++i) {
+            pause = min(2 * pause, FailoverRetryMax);
+          }
+
+          failover.set_attempts(failover.attempts() + 1);
+          failover.set_timestamp(now + pause);
+          l.changed();
+
+          if (coordinatorURL.empty()) {
+            LOG(WARNING) << "No active coordinator found, cannot switch "
+                         << "primary " << failover.primary()
+                         << " and secondary " << failover.secondary();
+            break;
+          }
+
+          Swap swap = { failover.primary(), failover.secondary() };
+          swaps.push_back(swap);
+          break;
+        }
+
+        case FAILOVER_AGENCY_ACKNOWLEDGED: {
+          // the old secondary is the new primary
+          int i = l.index().findByName(TaskType::PRIMARY_DBSERVER,
+                                       failover.secondary());
+
+          // the new primary has gone from the plan, this must not
+          // happen, the failover stays open and is reported once
+          if (i < 0) {
+            if (_failoverAnomalies.insert(failover.primary()).second) {
+              LOG(ERROR) << "Failover of primary " << failover.primary()
+                         << " to " << failover.secondary()
+                         << " is stuck, the new primary is not in the plan";
+            }
+            break;
+          }
+
+          _failoverAnomalies.erase(failover.primary());
+
+          if (l.state().plan().dbservers().entries(i).state()
+                == TASK_STATE_RUNNING) {
+            LOG(INFO) << "Failover of primary " << failover.primary()
+                      << " to " << failover.secondary() << " is done";
+
+            failover.set_state(FAILOVER_DONE);
+            failover.set_timestamp(now);
+            l.changed();
+          }
+          break;
+        }
+
+        case FAILOVER_DONE:
+          ++finished;
+          break;
+      }
+    }
+
+    // forget the oldest finished failovers
+    if (FinishedFailoversKept < finished) {
+      int forget = finished - FinishedFailoversKept;
+      Failovers kept;
 
-bool ArangoManager::registerNewSecondary(ArangoState::Lease& lease, std::string const& primaryId) {
-  Plan* plan = lease.state().mutable_plan();
+      for (auto const& failover : *failovers) {
+        if (failover.state() == FAILOVER_DONE && 0 < forget) {
+          --forget;
+          continue;
+        }
+
+        kept.add_entries()->CopyFrom(failover);
+      }
 
-  for (int i=0;i<plan->mutable_dbservers()->entries_size();i++) {
-    if (plan->mutable_dbservers()->mutable_entries(i)->server_id() == primaryId) {
-      return registerNewSecondary(lease, plan->mutable_dbservers()->mutable_entries(i));
+      l.state().mutable_failovers()->Swap(&kept);
+      l.changed();
     }
   }
-  LOG(ERROR) << "Couldn't find primary " << primaryId;
-  return false;
-}
 
-bool ArangoManager::registerNewSecondary(ArangoState::Lease& lease, TaskPlan* primary) {
-  if (primary->server_id().empty()) {
-    LOG(WARNING) << "Server ID from " << primary->name() << " not yet known. Can't register secondary yet";
-    return false;
-  }
+  // the requests run without the state, any number at the same time
+  for (auto const& swap : swaps) {
+    std::string url = coordinatorURL + "/_admin/cluster/swapPrimaryAndSecondary";
+    std::string body
+      =   R"({"primary":")" + swap._primary + R"(",)"
+        + R"("secondary":")" + swap._secondary + R"("})";
+
+    startRequest(_failoverRequests, swap._primary,
+                 [url, body] (std::string& resultBody) -> bool {
+      long httpCode = 0;
+
+      int res = arangodb::doClusterHTTPPut(url, body, resultBody, httpCode,
+                                           FailoverTimeout);
+
+      if (res != 0 || httpCode != 200) {
+        LOG(ERROR) << "Problems with reconfiguring agency " << body
+                   << "\n" << resultBody
+                   << ", libcurl error code: " << res
+                   << ", HTTP result code: " << httpCode;
+        return false;
+      }
 
-  Plan* plan = lease.state().mutable_plan();
-  TasksPlan* tasksPlanSecondary = plan->mutable_secondaries();
-  std::string secondaryName = "Secondary"
-    + std::to_string(tasksPlanSecondary->entries_size() + 1);
-  
-  // to the new one:
-  std::string previousSecondaryName = "none";
-  if (!primary->sync_partner().empty()) {
-    previousSecondaryName = primary->sync_partner();
+      return true;
+    });
   }
+}
 
-  // Still needed: Tell the agency about this change and
-  // configure the new server there:
-  std::string resultBody;
-  std::string coordinatorURL = Global::state().getCoordinatorURL(lease);
+////////////////////////////////////////////////////////////////////////////////
+/// @brief tells the agency about new secondaries
+////////////////////////////////////////////////////////////////////////////////
 
-  if (coordinatorURL.empty()) {
-    LOG(WARNING) << "Couldn't register secondary. There is no coordinator to talk to right now";
-    return false;
-  }
+void ArangoManager::driveSecondaries () {
+  auto answers = finishedRequests(_secondaryRequests);
+  auto steadyNow = chrono::steady_clock::now();
 
-  long httpCode = 0;
-  int res = 0;
-  auto logError = [&] (std::string msg) -> void {
-    LOG(ERROR) << "Problems with reconfiguring agency (secondary "
-      << "of primary " << primary->server_id() << " from "
-      << previousSecondaryName << " to new " << secondaryName
-      << ")\n" << msg
-      << ", libcurl error code: " << res
-      << ", HTTP result code: " << httpCode
-      << ", retrying...";
-  };
+  // a new secondary is only added to the plan once the agency knows it
+  if (! answers.empty()) {
+    auto l = Global::state().lease();
 
-  std::string body 
-    =   R"({"primary":")" + primary->server_id() + R"(",)"
-    + R"("oldSecondary":")" + previousSecondaryName + R"(",)"
-    + R"("newSecondary":")" + secondaryName + R"("})";
+    double now = chrono::duration<double>(
+      steadyNow.time_since_epoch()).count();
 
-  res = arangodb::doClusterHTTPPut(coordinatorURL +
-      "/_admin/cluster/replaceSecondary",
-      body, resultBody, httpCode);
+    for (auto const& answer : answers) {
+      auto it = _secondaryRegistrations.find(answer._key);
 
-  if (res != 0 || httpCode != 200) {
-    logError(resultBody);
-    return false;
-  }
-  LOG(INFO) << "Successfully reconfigured agency (secondary "
-    << "of primary " << primary->server_id() << " from "
-    << previousSecondaryName << " to new " << secondaryName << ")";
-  
-  // mop: we successfully told the agency about our future secondary server
-  // now update our taskplan
-  primary->set_sync_partner(secondaryName);
-  Current* current = lease.state().mutable_current();
+      if (it == _secondaryRegistrations.end()) {
+        continue;
+      }
 
-  TasksCurrent* tasksCurrentSecondary = current->mutable_secondaries();
+      SecondaryRegistration& registration = it->second;
 
-  double now = chrono::duration_cast<chrono::seconds>(
-      chrono::steady_clock::now().time_since_epoch()).count();
+      if (! answer._ok) {
+        double pause = FailoverRetryMin;
 
+        for (uint32_t i = 1;  i < registration._attempts;  ++i) {
+          pause = min(2 * pause, FailoverRetryMax);
+        }
 
-  // Now create a new secondary:
-  TaskPlan* tpnew = tasksPlanSecondary->add_entries();
-  tpnew->set_state(TASK_STATE_NEW);
-  tpnew->set_name(secondaryName);
-  tpnew->set_sync_partner(primary->server_id());
-  tpnew->set_timestamp(now);
+        registration._next = steadyNow +
+          chrono::duration_cast<chrono::steady_clock::duration>(
+            chrono::duration<double>(pause));
+        continue;
+      }
 
-  // mop: by convention: keep size in sync 
-  tasksCurrentSecondary->add_entries();
+      LOG(INFO) << "Successfully reconfigured agency (secondary "
+        << "of primary " << registration._serverId << " from "
+        << registration._oldSecondary << " to new "
+        << registration._secondary << ")";
+
+      int i = l.index().findByName(TaskType::PRIMARY_DBSERVER,
+                                   registration._primary);
+
+      // the primary has changed in the meantime, it gets a secondary of
+      // its own later on
+      if (i < 0 || l.state().plan().dbservers().entries(i).server_id()
+                     != registration._serverId) {
+        LOG(WARNING) << "Primary " << registration._primary
+                     << " has changed, not adding secondary "
+                     << registration._secondary;
+        _secondaryRegistrations.erase(it);
+        continue;
+      }
 
-  return true;
-}
+      // mop: we successfully told the agency about our future secondary
+      // server now update our taskplan
+      TaskPlan* primary
+        = l.state().mutable_plan()->mutable_dbservers()->mutable_entries(i);
+      primary->set_sync_partner(registration._secondary);
+      l.update(TaskType::PRIMARY_DBSERVER, i);
+
+      TasksPlan* tasksPlanSecondary
+        = l.state().mutable_plan()->mutable_secondaries();
+      TasksCurrent* tasksCurrentSecondary
+        = l.state().mutable_current()->mutable_secondaries();
+
+      // Now create a new secondary:
+      TaskPlan* tpnew = tasksPlanSecondary->add_entries();
+      tpnew->set_state(TASK_STATE_NEW);
+      tpnew->set_name(registration._secondary);
+      tpnew->set_sync_partner(registration._serverId);
+      tpnew->set_timestamp(now);
+
+      // mop: by convention: keep size in sync 
+      tasksCurrentSecondary->add_entries();
+      l.update(TaskType::SECONDARY_DBSERVER,
+               tasksPlanSecondary->entries_size() - 1);
+
+      l.changed();
+      _secondaryRegistrations.erase(it);
+    }
+  }
 
-void ArangoManager::updateServerIds() {
-  auto l = Global::state().lease();
+  // the requests run without the state, any number at the same time
+  std::string coordinatorURL;
 
-  std::vector<TaskType> types 
-    = { TaskType::PRIMARY_DBSERVER, TaskType::SECONDARY_DBSERVER, TaskType::COORDINATOR };
+  for (auto& pending : _secondaryRegistrations) {
+    SecondaryRegistration& registration = pending.second;
 
-  auto* plan = l.state().mutable_plan();
-  auto* current = l.state().mutable_current();
+    if (isRequestRunning(_secondaryRequests, registration._primary) ||
+        steadyNow < registration._next) {
+      continue;
+    }
 
-  for (auto taskType : types) {
-    TasksPlan* tasksPlan;
-    TasksCurrent* tasksCurr;
-    switch (taskType) {
-      case TaskType::COORDINATOR:
-        tasksPlan = plan->mutable_coordinators();
-        tasksCurr = current->mutable_coordinators();
-        break;
-      case TaskType::PRIMARY_DBSERVER:
-        tasksPlan = plan->mutable_dbservers();
-        tasksCurr = current->mutable_dbservers();
-        break;
-      case TaskType::SECONDARY_DBSERVER:
-        tasksPlan = plan->mutable_secondaries();
-        tasksCurr = current->mutable_secondaries();
-        break;
-      case TaskType::AGENT:
-        continue;
+    if (coordinatorURL.empty()) {
+      coordinatorURL = Global::state().getCoordinatorURL(
+        *Global::state().snapshot());
     }
-    for (int i = 0; i < tasksPlan->entries_size(); i++) {
-      auto tp = tasksPlan->mutable_entries(i);
-      auto tc = tasksCurr->mutable_entries(i);
-      if (tp->state() == TASK_STATE_RUNNING) {
-        if (tp->server_id().empty()) {
-          std::string id;
-
-          if (getServerId(tc, id)) {
-            tp->set_server_id(id);
-            l.changed();
-          }
-        }
-      }
+
+    ++registration._attempts;
+
+    if (coordinatorURL.empty()) {
+      LOG(WARNING) << "Couldn't register secondary. There is no coordinator to talk to right now";
+      registration._next = steadyNow +
+        chrono::duration_cast<chrono::steady_clock::duration>(
+          chrono::duration<double>(FailoverRetryMin));
+      continue;
     }
+
+    std::string url = coordinatorURL + "/_admin/cluster/replaceSecondary";
+    std::string body 
+      =   R"({"primary":")" + registration._serverId + R"(",)"
+        + R"("oldSecondary":")" + registration._oldSecondary + R"(",)"
+        + R"("newSecondary":")" + registration._secondary + R"("})";
+
+    startRequest(_secondaryRequests, registration._primary,
+                 [url, body] (std::string& resultBody) -> bool {
+      long httpCode = 0;
+
+      int res = arangodb::doClusterHTTPPut(url, body, resultBody, httpCode,
+                                           FailoverTimeout);
+
+      if (res != 0 || httpCode != 200) {
+        LOG(ERROR) << "Problems with reconfiguring agency " << body
+                   << "\n" << resultBody
+                   << ", libcurl error code: " << res
+                   << ", HTTP result code: " << httpCode
+                   << ", retrying...";
+        return false;
+      }
+
+      return true;
+    });
   }
 }
 
-bool ArangoManager::checkTimeouts () {
-  auto l = Global::state().lease();
+////////////////////////////////////////////////////////////////////////////////
+/// @brief runs a request to the cluster in a thread of its own
+////////////////////////////////////////////////////////////////////////////////
 
-  std::vector<TaskType> types 
-    = { TaskType::AGENT, TaskType::PRIMARY_DBSERVER,
-        TaskType::SECONDARY_DBSERVER, TaskType::COORDINATOR };
+void ArangoManager::startRequest (vector<ClusterRequest>& requests,
+                                  string const& key,
+                                  function<bool (string&)> request) {
+  auto done = make_shared<promise<ClusterAnswer>>();
 
-  auto* plan = l.state().mutable_plan();
-  auto* current = l.state().mutable_current();
+  ClusterRequest running;
+  running._key = key;
+  running._done = done->get_future();
 
-  for (auto taskType : types) {
-    TasksPlan* tasksPlan;
-    TasksCurrent* tasksCurr;
-    switch (taskType) {
-      case TaskType::AGENT:
-        tasksPlan = plan->mutable_agents();
-        tasksCurr = current->mutable_agents();
-        break;
-      case TaskType::PRIMARY_DBSERVER:
-        tasksPlan = plan->mutable_dbservers();
-        tasksCurr = current->mutable_dbservers();
-        break;
-      case TaskType::SECONDARY_DBSERVER:
-        tasksPlan = plan->mutable_secondaries();
-        tasksCurr = current->mutable_secondaries();
-        break;
-      case TaskType::COORDINATOR:
-        tasksPlan = plan->mutable_coordinators();
-        tasksCurr = current->mutable_coordinators();
-        break;
-      default:  // never happens
-        tasksPlan = nullptr;
-        tasksCurr = nullptr;
-        break;
+  // the answer is set before the dispatcher is woken up, such that it
+  // finds the request finished
+  running._thread = thread([this, done, key, request] () -> void {
+    ClusterAnswer answer;
+    answer._key = key;
+    answer._ok = request(answer._body);
+
+    done->set_value(answer);
+    wakeup(Wakeup::REQUEST);
+  });
+
+  requests.push_back(std::move(running));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether a request with the given key is running
+////////////////////////////////////////////////////////////////////////////////
+
+bool ArangoManager::isRequestRunning (vector<ClusterRequest> const& requests,
+                                      string const& key) {
+  for (auto const& request : requests) {
+    if (request._key == key) {
+      return true;
     }
-    double now = chrono::duration_cast<chrono::seconds>(
-      chrono::steady_clock::now().time_since_epoch()).count();
-    double timeStamp;
-    for (int i = 0; i < tasksPlan->entries_size(); i++) {
-      TaskPlan* tp = tasksPlan->mutable_entries(i);
-      TaskCurrent* ic = tasksCurr->mutable_entries(i);
-      switch (tp->state()) {
-        case TASK_STATE_NEW:
-          // Wait forever here, no timeout.
-          break;
-        case TASK_STATE_TRYING_TO_RESERVE:
-          // After a timeout, go back to state TASK_STATE_NEW, because
-          // there was no satisfactory answer to our reservation request.
-          // Resources will be freed automatically.
-          timeStamp = tp->timestamp();
-          if (now - timeStamp > TryingToReserveTimeout) {
-            LOG(INFO) << "Timeout " << TryingToReserveTimeout << "s reached "
-                      << " for task " << ic->task_info().name()
-                      << " in state TASK_STATE_TRYING_TO_RESERVE.";
-            LOG(INFO) << "Going back to state TASK_STATE_NEW.";
-            tp->set_state(TASK_STATE_NEW);
-            tp->clear_persistence_id();
-            tp->set_timestamp(now);
-            l.changed();
-          }
-          break;
-        case TASK_STATE_TRYING_TO_PERSIST:
-          // After a timeout, go back to state TASK_STATE_NEW, because
-          // there was no satisfactory answer to our persistence request.
-          // Resources will be freed automatically.
-          timeStamp = tp->timestamp();
-          if (now - timeStamp > TryingToPersistTimeout) {
-            LOG(INFO) << "Timeout " << TryingToPersistTimeout << "s reached "
-                      << " for task " << ic->task_info().name()
-                      << " in state TASK_STATE_TRYING_TO_PERSIST.";
-            LOG(INFO) << "Going back to state TASK_STATE_NEW.";
-            tp->set_state(TASK_STATE_NEW);
-            tp->clear_persistence_id();
-            tp->set_timestamp(now);
-            l.changed();
-          }
-          break;
-        case TASK_STATE_TRYING_TO_START:
-          // After a timeout, go back to state TASK_STATE_NEW, because
-          // there was no satisfactory answer to our start request.
-          // Resources will be freed automatically.
-          timeStamp = tp->timestamp();
-          if (now - timeStamp > TryingToStartTimeout) {
-            LOG(INFO) << "Timeout " << TryingToPersistTimeout << "s reached "
-                      << " for task " << ic->task_info().name()
-                      << " in state TASK_STATE_TRYING_TO_START.";
-            LOG(INFO) << "Going back to state TASK_STATE_NEW.";
-            tp->set_state(TASK_STATE_NEW);
-            tp->clear_persistence_id();
-            tp->set_timestamp(now);
-            l.changed();
-          }
-          break;
-        case TASK_STATE_RUNNING:
-          // Run forever here, no timeout.
-          break;
-        case TASK_STATE_FAILED_OVER:
-          // This task has been replaced by its failover partner, now we
-          // finally lose patience to wait for a restart and give up on the
-          // task. This can only happen to a primary DBserver that has been
-          // interchanged with its secondary and is now a secondary.
-          // We want to get rid of this task and replace it with a new one.
-          // This is exactly what we would have done if this server was a
-          // secondary that has failed in the first place. Therefore we
-          // fall through here and let the case for TASK_STATE_KILLED
-          // take care of the rest.
-        case TASK_STATE_KILLED:
-          // After some time being killed, we have to take action and
-          // engage in some automatic failover procedure:
-          timeStamp = tp->timestamp();
-          if (now - timeStamp > FailoverTimeout) {
-            LOG(INFO) << "Timeout " << FailoverTimeout << "s reached "
-                      << " for task " << ic->task_info().name()
-                      << " in state TASK_STATE_KILLED.";
-            if (taskType == TaskType::AGENT) {
-              // ignore timeout, keep trying, otherwise we are lost
-              LOG(INFO) << "Task is an agent, simply reset the timestamp and "
-                        << "wait forever.";
-              tp->set_timestamp(now);
-              l.changed();
-            }
-            else if (taskType == TaskType::COORDINATOR) {
-              // simply go back to TASK_STATE_NEW to start another one
-              // There were no reservations and persistent volumes,
-              // so Mesos will clean up behind ourselves.
-              LOG(INFO) << "Going back to state TASK_STATE_NEW.";
-              tp->set_state(TASK_STATE_NEW);
-              tp->clear_persistence_id();
-              tp->set_timestamp(now);
-              l.changed();
-            }
-            else if (taskType == TaskType::SECONDARY_DBSERVER) {
-              // find corresponding primary (partner)
-              // make new secondary, change primary's secondary entry in
-              // our state and in the registry, declare old secondary dead
-              std::string primaryName = tp->sync_partner();
-              // Give up on this one:
-              tp->set_state(TASK_STATE_DEAD);
-              tp->set_timestamp(now);
-              tp->clear_persistence_id();
-              tp->clear_sync_partner();
-              ic->clear_slave_id();
-              ic->clear_offer_id();
-              ic->clear_resources();
-              ic->clear_ports();
-              ic->clear_hostname();
-              ic->clear_container_path();
-              ic->clear_task_info();
-
-              registerNewSecondary(l, primaryName);
-              l.changed();
-            }
-            else if (taskType == TaskType::PRIMARY_DBSERVER) {
-              // interchange plan and current infos, update task2position
-              // map, promote secondary to primary in state and agency,
-              // make old primary the secondary of the old secondary,
-              // set state of old primary to TASK_STATE_FAILED_OVER
-              if (! tp->has_sync_partner()) {
-                if (tp->state() == TASK_STATE_KILLED) {
-                  // We cannot do much here, so let's keep waiting...
-                  LOG(INFO) << "Task is a dbserver without a replica."
-                    << " Will start a new primary and wait for the supervision"
-                    << " to take action and either declare the old server dead"
-                    << " or wait for user action";
-                  
-                  TaskPlan* tpnew = tasksPlan->add_entries();
-                  std::string name = "DBServer" 
-                     + std::to_string(tasksPlan->entries_size());
-                  tpnew->set_name(name);
-                  tpnew->set_state(TASK_STATE_NEW);
-                  tpnew->set_timestamp(now);
-
-                  // mop: by convention: keep size in sync 
-                  tasksCurr->add_entries();
-                  tp->set_state(TASK_STATE_FAILED_OVER);
-
-                  LOG(INFO) << "Task " << tp->name() << " is now TASK_STATE_FAILED_OVER(" << tp->state() << ")";
-                } else {
-                  LOG(INFO) << "Still waiting for dbserver " << tp->name();
-                }
-                
-                tp->set_timestamp(now);
-                l.changed();
-              }
-              else {
-                std::string secondaryName = tp->sync_partner();
-
-                // Find the corresponding secondary:
-                TasksPlan* tasksPlanSecondary = plan->mutable_secondaries();
-                TaskPlan* tpsecond;
-                bool found = false;
-                int j;
-                for (j = 0; j < tasksPlanSecondary->entries_size(); j++) {
-                  tpsecond = tasksPlanSecondary->mutable_entries(j);
-                  if (tpsecond->name() == secondaryName) {
-                    found = true;
-                    break;
-                  }
-                }
-                if (! found) {
-                  LOG(INFO) << "Did not find replica of dbserver task, simply "
-                            << "reset the timestamp and wait forever.";
-                  tp->set_timestamp(now);
-                  l.changed();
-                }
-                else {
-                  // Now interchange the information on primary[i] and
-                  // secondary[j]:
-                  TaskPlan dummy;
-                  dummy.CopyFrom(*tpsecond);
-                  tpsecond->CopyFrom(*tp);
-                  tp->CopyFrom(dummy);
-                  TaskCurrent dummy2;
-                  TaskCurrent* tpsecondcur
-                      = current->mutable_secondaries()->mutable_entries(j);
-                  dummy2.CopyFrom(*tpsecondcur);
-                  tpsecondcur->CopyFrom(*ic);
-                  ic->CopyFrom(dummy2);
-                  
-                  tp->set_timestamp(now);
-                  tpsecond->set_timestamp(now);
-
-                  // Set the new state of the failed task to 
-                  // TASK_STATE_FAILED_OVER:
-                  tpsecond->set_state(TASK_STATE_FAILED_OVER);
-
-                  // Now update _task2position (note that ic and tpsecondcur
-                  // have been interchanged by now!):
-                  _task2position[ic->task_info().task_id().value()] 
-                      = std::make_pair(TaskType::PRIMARY_DBSERVER, i);
-                  _task2position[tpsecondcur->task_info().task_id().value()]
-                      = std::make_pair(TaskType::SECONDARY_DBSERVER, j);
-
-                  std::string resultBody;
-
-                  // We try to reconfigure until the agency has answered...
-                  while (true) {
-                  // Still needed: Tell the agency about this change.
-                    std::string coordinatorURL 
-                        = Global::state().getCoordinatorURL(l);
-
-                    if (coordinatorURL.empty()) {
-                      LOG(WARNING) << "No active coordinator found";
-                      this_thread::sleep_for(chrono::seconds(1));
-                      continue;
-                    }
-
-                    long httpCode = 0;
-                    int res = 0;
-                    auto logError = [&] (std::string msg) -> void {
-                      LOG(ERROR) << "Problems with reconfiguring agency "
-                                 << "(switching primary " 
-                                 << tpsecond->name()
-                                 << " and secondary " << tp->name()
-                                 << ")\n" << msg
-                                 << ", libcurl error code: " << res
-                                 << ", HTTP result code: " << httpCode
-                                 << ", retrying...";
-                      this_thread::sleep_for(chrono::seconds(2));
-                    };
-
-                    std::string body 
-                      =   R"({"primary":")" + tpsecond->name() + R"(",)"
-                        + R"("secondary":")" + tp->name() + R"("})";
-                  
-                    res = arangodb::doClusterHTTPPut(std::string(coordinatorURL) +
-                          "/_admin/cluster/swapPrimaryAndSecondary",
-                          body, resultBody, httpCode);
-
-                    if (res != 0 || httpCode != 200) {
-                      logError(resultBody);
-                      continue;
-                    }
-                    // All OK, let's get out of here:
-                    break;
-                  }
-
-                  l.changed();
-
-                  LOG(INFO) << "Successfully reconfigured agency "
-                            << "(switching primary " << tpsecond->name()
-                            << " and secondary " << tp->name() << ")";
-                }
-              }
-            }
-          }
-          break;
-        case TASK_STATE_TRYING_TO_RESTART:
-          // We got the offer for a restart, but the restart is not happening.
-          // We need to go back to state TASK_STATE_KILLED to wait for another
-          // offer.
-          timeStamp = tp->timestamp();
-          if (now - timeStamp > TryingToStartTimeout) {
-            LOG(INFO) << "Timeout " << TryingToPersistTimeout << "s reached "
-                      << " for task " << ic->task_info().name()
-                      << " in state TASK_STATE_TRYING_TO_RESTART.";
-            LOG(INFO) << "Going back to state TASK_STATE_KILL.";
-            tp->set_state(TASK_STATE_KILLED);
-            l.changed();
-            // Do not change the time stamp here, because we want to
-            // notice alternating between KILLED and TRYING_TO_RESTART!
-          }
-          break;
-        case TASK_STATE_DEAD:
-          // This task is no longer used. Do nothing.
-          break;
-        case TASK_STATE_SHUTTING_DOWN:
-          timeStamp = tp->timestamp();
-          if (now - timeStamp > TryingToShutdownTimeout) {
-            LOG(INFO) << "Timeout " << TryingToShutdownTimeout << " shutting down task " << ic->task_info().name() << " reached";
-            Global::scheduler().killInstance(ic->task_info().task_id().value());
-          }
-          break;
-      }
+  }
+
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief removes the finished requests
+////////////////////////////////////////////////////////////////////////////////
+
+vector<ArangoManager::ClusterAnswer> ArangoManager::finishedRequests (
+    vector<ClusterRequest>& requests) {
+  vector<ClusterAnswer> result;
+
+  for (auto it = requests.begin();  it != requests.end();) {
+    if (it->_done.wait_for(chrono::seconds(0)) != future_status::ready) {
+      ++it;
+      continue;
     }
+
+    result.push_back(it->_done.get());
+    it->_thread.join();
+    it = requests.erase(it);
   }
-  return true;
+
+  return result;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1125,8 +2041,20 @@ bool ArangoManager::checkTimeouts () {
 
 void ArangoManager::applyStatusUpdates (std::vector<std::string>& cleanedServers) {
   Caretaker& caretaker = Global::caretaker();
-  
-  lock_guard<mutex> lock(_lock);
+
+  vector<mesos::TaskStatus> updates;
+  mesos::TaskStatus status;
+
+  while (_statusUpdates.pop(status)) {
+    updates.push_back(status);
+  }
+
+  queueDrained();
+
+  if (updates.empty()) {
+    return;
+  }
+
   typedef std::unordered_set<int> DeleteMap;
 
   DeleteMap agentPosToDelete;
@@ -1134,128 +2062,141 @@ void ArangoManager::applyStatusUpdates (std::vector<std::string>& cleanedServers
   DeleteMap dbServerPosToDelete;
   DeleteMap secondaryPosToDelete;
 
-  auto lease = Global::state().lease(true);
-  bool deleted = false;
-  for (auto&& status : _taskStatusUpdates) {
-    mesos::TaskID taskId = status.task_id();
-    string taskIdStr = taskId.value();
+  // the cleaned servers are reported to the cluster after the lease is
+  // given back
+  string body;
+  string coordinatorURL;
 
-    _reconciliationTasks.erase(taskIdStr);
+  {
+    auto lease = Global::state().lease(true);
+    bool deleted = false;
+    for (auto&& status : updates) {
+      mesos::TaskID taskId = status.task_id();
+      string taskIdStr = taskId.value();
 
-    std::pair<TaskType, int>& pos = _task2position[taskIdStr];
+      reconciled(status);
 
-    switch (status.state()) {
-      case mesos::TASK_STAGING:
-        break;
+      TaskIndex::Position pos = lease.index().findByTaskId(taskIdStr);
 
-      case mesos::TASK_RUNNING: {
-        caretaker.setTaskPlanState(lease, pos.first, pos.second,
-                                   TASK_STATE_RUNNING, deleted);
-        break;
-      }
-      case mesos::TASK_STARTING:
-        // do nothing
-        break;
+      switch (status.state()) {
+        case mesos::TASK_STAGING:
+          break;
 
-      case mesos::TASK_FINISHED: // TERMINAL. The task finished successfully.
-      case mesos::TASK_FAILED:   // TERMINAL. The task failed to finish successfully.
-      case mesos::TASK_KILLED:   // TERMINAL. The task was killed by the executor.
-      case mesos::TASK_LOST:     // TERMINAL. The task failed but can be rescheduled.
-      case mesos::TASK_ERROR: {  // TERMINAL. The task failed but can be rescheduled.
-        caretaker.setTaskPlanState(lease, pos.first, pos.second,
-                                   TASK_STATE_KILLED, deleted);
-        if (deleted) {
-          switch(pos.first) {
-            case TaskType::AGENT: {
-                agentPosToDelete.insert(pos.second);
-                break;
-              }
-            case TaskType::PRIMARY_DBSERVER: {
-                dbServerPosToDelete.insert(pos.second);
-                break;
-              }
-            case TaskType::SECONDARY_DBSERVER: {
-                secondaryPosToDelete.insert(pos.second);
-                break;
-              }
-            case TaskType::COORDINATOR: {
-                coordinatorPosToDelete.insert(pos.second);
-                break;
-              }
+        case mesos::TASK_RUNNING: {
+          caretaker.setTaskPlanState(lease, pos.first, pos.second,
+                                     TASK_STATE_RUNNING, deleted);
+          break;
+        }
+        case mesos::TASK_STARTING:
+          // do nothing
+          break;
+
+        case mesos::TASK_FINISHED: // TERMINAL. The task finished successfully.
+        case mesos::TASK_FAILED:   // TERMINAL. The task failed to finish successfully.
+        case mesos::TASK_KILLED:   // TERMINAL. The task was killed by the executor.
+        case mesos::TASK_LOST:     // TERMINAL. The task failed but can be rescheduled.
+        case mesos::TASK_ERROR: {  // TERMINAL. The task failed but can be rescheduled.
+          if (launchFailed(status) &&
+              caretaker.startStepwise(lease, pos.first, pos.second)) {
+            break;
+          }
+
+          caretaker.setTaskPlanState(lease, pos.first, pos.second,
+                                     TASK_STATE_KILLED, deleted);
+          if (deleted) {
+            switch(pos.first) {
+              case TaskType::AGENT: {
+                  agentPosToDelete.insert(pos.second);
+                  break;
+                }
+              case TaskType::PRIMARY_DBSERVER: {
+                  dbServerPosToDelete.insert(pos.second);
+                  break;
+                }
+              case TaskType::SECONDARY_DBSERVER: {
+                  secondaryPosToDelete.insert(pos.second);
+                  break;
+                }
+              case TaskType::COORDINATOR: {
+                  coordinatorPosToDelete.insert(pos.second);
+                  break;
+                }
+            }
           }
+          break;
         }
-        break;
       }
     }
-  }
   
-  Plan* plan = lease.state().mutable_plan();
-  Current* current = lease.state().mutable_current();
-  auto toDo = {
-    std::make_tuple(agentPosToDelete, plan->mutable_agents(), current->mutable_agents()),
-    std::make_tuple(dbServerPosToDelete, plan->mutable_dbservers(), current->mutable_dbservers()),
-    std::make_tuple(secondaryPosToDelete, plan->mutable_secondaries(), current->mutable_secondaries()),
-    std::make_tuple(coordinatorPosToDelete, plan->mutable_coordinators(), current->mutable_coordinators()),
-  };
+    Plan* plan = lease.state().mutable_plan();
+    Current* current = lease.state().mutable_current();
+    auto toDo = {
+      std::make_tuple(agentPosToDelete, plan->mutable_agents(), current->mutable_agents()),
+      std::make_tuple(dbServerPosToDelete, plan->mutable_dbservers(), current->mutable_dbservers()),
+      std::make_tuple(secondaryPosToDelete, plan->mutable_secondaries(), current->mutable_secondaries()),
+      std::make_tuple(coordinatorPosToDelete, plan->mutable_coordinators(), current->mutable_coordinators()),
+    };
   
-  bool changed = false;
-  for (auto const& tup: toDo) {
-    auto const& toDelete = std::get<0>(tup);
-    TasksCurrent* current = std::get<2>(tup);
-    if (toDelete.size() > 0) {
-      changed = true;
-
-      TasksPlan* plan = std::get<1>(tup);
-
-      TasksPlan originalPlan;
-      originalPlan.CopyFrom(*plan);
-      TasksCurrent originalCurrent;
-      originalCurrent.CopyFrom(*current);
+    bool changed = false;
+    for (auto const& tup: toDo) {
+      auto const& toDelete = std::get<0>(tup);
+      TasksCurrent* current = std::get<2>(tup);
+      if (toDelete.size() > 0) {
+        changed = true;
+
+        TasksPlan* plan = std::get<1>(tup);
+
+        TasksPlan originalPlan;
+        originalPlan.CopyFrom(*plan);
+        TasksCurrent originalCurrent;
+        originalCurrent.CopyFrom(*current);
       
-      plan->clear_entries();
-      current->clear_entries();
-      for (int i=0;i<originalPlan.entries_size();i++) {
-        auto got = toDelete.find(i);
-        TaskPlan planEntry = originalPlan.entries(i);
-        // mop: re-add if not marked for deletion
-        if (got == toDelete.end()) {
-          plan->add_entries()->CopyFrom(planEntry);
+        plan->clear_entries();
+        current->clear_entries();
+        for (int i=0;i<originalPlan.entries_size();i++) {
+          auto got = toDelete.find(i);
+          TaskPlan planEntry = originalPlan.entries(i);
+          // mop: re-add if not marked for deletion
+          if (got == toDelete.end()) {
+            plan->add_entries()->CopyFrom(planEntry);
           
-          TaskCurrent currentEntry = originalCurrent.entries(i);
-          current->add_entries()->CopyFrom(currentEntry);
-        } else {
-          if (planEntry.has_server_id()) {
-            for (auto it=cleanedServers.begin();it!=cleanedServers.end();++it) {
-              if (*it == planEntry.server_id()) {
-                cleanedServers.erase(it);
-                break;
+            TaskCurrent currentEntry = originalCurrent.entries(i);
+            current->add_entries()->CopyFrom(currentEntry);
+          } else {
+            if (planEntry.has_server_id()) {
+              for (auto it=cleanedServers.begin();it!=cleanedServers.end();++it) {
+                if (*it == planEntry.server_id()) {
+                  cleanedServers.erase(it);
+                  break;
+                }
               }
             }
+            LOG(INFO) << "Deleting " << planEntry.name();
           }
-          LOG(INFO) << "Deleting " << originalCurrent.entries(i).task_info().name();
         }
       }
     }
-  }
 
-  if (changed) {
-    // mop: this is suboptimal but the framework will be rewritten soon :S
-    _task2position.clear();
-    fillKnownInstances(TaskType::AGENT, current->agents());
-    fillKnownInstances(TaskType::COORDINATOR, current->coordinators());
-    fillKnownInstances(TaskType::PRIMARY_DBSERVER, current->dbservers());
-    fillKnownInstances(TaskType::SECONDARY_DBSERVER, current->secondaries());
-    
-    std::vector<picojson::value> cleanedServersJsonValues;
-    std::transform(cleanedServers.begin(), cleanedServers.end(), std::back_inserter(cleanedServersJsonValues), [](std::string const& cleanedServer) {
-      return picojson::value(cleanedServer);
-    });
-    picojson::value cleanedServersJson = picojson::value(cleanedServersJsonValues);
+    if (changed) {
+      // the positions of the remaining tasks have moved
+      lease.reindex();
+
+      std::vector<picojson::value> cleanedServersJsonValues;
+      std::transform(cleanedServers.begin(), cleanedServers.end(), std::back_inserter(cleanedServersJsonValues), [](std::string const& cleanedServer) {
+        return picojson::value(cleanedServer);
+      });
+      picojson::value cleanedServersJson = picojson::value(cleanedServersJsonValues);
 
-    std::string body = "{\"cleanedServers\": " + cleanedServersJson.serialize() + "}";
+      body = "{\"cleanedServers\": " + cleanedServersJson.serialize() + "}";
+      coordinatorURL = Global::state().getCoordinatorURL(lease);
+
+      lease.changed();
+    }
+  }
+
+  if (! body.empty()) {
     std::string resultBody; 
     long httpCode = 0;
-    std::string coordinatorURL = Global::state().getCoordinatorURL(lease);
     int res = arangodb::doClusterHTTPPut(coordinatorURL +
       "/_admin/cluster/numberOfServers",
       body, resultBody, httpCode);
@@ -1265,11 +2206,7 @@ void ArangoManager::applyStatusUpdates (std::vector<std::string>& cleanedServers
     } else {
       LOG(WARNING) << "Failed resetting cleaned servers. Statuscode " << httpCode << ", Body: " << resultBody;
     }
-    
-    lease.changed();
   }
-
-  _taskStatusUpdates.clear();
 }
 
 void ArangoManager::updatePlan(std::vector<std::string> const& cleanedServers) {
@@ -1289,42 +2226,82 @@ void ArangoManager::updatePlan(std::vector<std::string> const& cleanedServers) {
 void ArangoManager::checkOutstandOffers () {
   Caretaker& caretaker = Global::caretaker();
 
+  drainOffers();
+
   // ...........................................................................
-  // check all stored offers
+  // score the offers against the tasks waiting for one
   // ...........................................................................
 
+  vector<OfferDemand> demand;
+
   {
-    lock_guard<mutex> lock(_lock);
+    auto lease = Global::state().leaseRead();
+    demand = offerDemand(lease.state());
+  }
+
+  // ...........................................................................
+  // check all offers held, they stay in the inventory meanwhile, such
+  // that a rescind still finds them
+  // ...........................................................................
+
+  unordered_map<string, vector<mesos::OfferID>> merged;
 
-    for (auto&& id_offer : _storedOffers) {
-      caretaker.checkOffer(id_offer.second);
+  if (_offers.setDemand(demand)) {
+    Global::scheduler().reviveOffers();
+  }
+
+  vector<mesos::Offer> offers = _offers.take(merged);
+
+  if (! offers.empty()) {
+    Global::scheduler().beginOfferBatch(merged);
+    caretaker.checkOffers(offers);
+    unordered_set<string> accepted;
+    auto declined = Global::scheduler().endOfferBatch(accepted);
+
+    // .........................................................................
+    // keep the offers not accepted for a while, decline the expired ones
+    // .........................................................................
+
+    auto declines = _offers.settle(offers, merged, accepted, declined,
+                                   chrono::steady_clock::now());
+
+    for (auto const& decline : declines) {
+      Global::scheduler().refuseOffer(decline._offerId,
+                                      decline._refuseSeconds);
     }
+  }
 
-    _storedOffers.clear();
+  {
+    lock_guard<mutex> lock(_lock);
+    _offerStatistics = _offers.statistics();
   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief recover task mapping
+/// @brief moves the queued offers and rescinds into the inventory
 ////////////////////////////////////////////////////////////////////////////////
 
-void ArangoManager::fillKnownInstances (TaskType type,
-                                        TasksCurrent const& currents) {
-  LOG(INFO)
-  << "recovering instance type " << (int) type;
-
-  for (int i = 0;  i < currents.entries_size();  ++i) {
-    TaskCurrent const& entry = currents.entries(i);
+void ArangoManager::drainOffers () {
+  auto now = chrono::steady_clock::now();
+  OfferEvent event;
 
-    if (entry.has_task_info()) {
-      string id = entry.task_info().task_id().value();
+  while (_offerEvents.pop(event)) {
+    if (event._rescinded) {
+      _offers.remove(event._offer.id());
+      continue;
+    }
 
+    for (auto const& decline : _offers.add(event._offer, now)) {
       LOG(INFO)
-      << "for task id " << id << ": " << i;
+      << "Declining offer " << decline._offerId.value()
+      << " since our queue is full.";
 
-      _task2position[id] = std::make_pair(type, i);
+      Global::scheduler().refuseOffer(decline._offerId,
+                                      decline._refuseSeconds);
     }
   }
+
+  queueDrained();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1368,35 +2345,35 @@ bool ArangoManager::taskIsGoneOrRestarted(ArangoState::Lease& lease, TaskType co
   TaskPlan* taskPlan = nullptr;
   TaskCurrent* taskCurrent = nullptr;
 
-  for (size_t i=0;i<tasksPlan->entries_size();i++) {
-    if (tasksPlan->mutable_entries(i)->name() == taskName) {
-      taskCurrent = tasksCurrent->mutable_entries(i);
-      taskPlan = tasksPlan->mutable_entries(i);
-    }
+  int i = lease.index().findByName(taskType, taskName);
+  if (i >= 0 && i < tasksCurrent->entries_size()) {
+    taskCurrent = tasksCurrent->mutable_entries(i);
+    taskPlan = tasksPlan->mutable_entries(i);
   }
   if (taskPlan == nullptr || taskCurrent == nullptr) {
     LOG(INFO) << "Task of type " << static_cast<int>(taskType) << " with name " << taskName << " is gone during restart.";
     return true;
   }
 
-  LOG(INFO) << "Task " << taskPlan->name() << " has state " << taskPlan->state();
   if (taskPlan->state() == TASK_STATE_RUNNING || taskPlan->state() == TASK_STATE_FAILED_OVER) {
-    double now = chrono::duration_cast<chrono::seconds>(
+    double now = chrono::duration<double>(
         chrono::steady_clock::now().time_since_epoch()).count();
     
-    if (!taskCurrent->has_kill_time() || (taskCurrent->start_time() < taskCurrent->kill_time())) {
-      if (!taskCurrent->has_kill_time() || taskCurrent->kill_time() - taskCurrent->start_time() > 60) {
-        LOG(INFO) << "Killing " << taskPlan->name();
-        Global::scheduler().killInstance(taskCurrent->task_info().task_id().value());
-        taskCurrent->set_kill_time(now);
-        lease.changed();
-      }
-      return false;
-    } else {
+    // started again after it was killed
+    if (taskCurrent->has_kill_time() && taskCurrent->kill_time() < taskCurrent->start_time()) {
       taskCurrent->clear_kill_time();
       lease.changed();
       return true;
     }
+
+    // the kill is repeated, if it has not taken effect for a while
+    if (!taskCurrent->has_kill_time() || now - taskCurrent->kill_time() > 60) {
+      LOG(INFO) << "Killing " << taskPlan->name() << " for a restart";
+      Global::scheduler().killInstance(taskCurrent->task_id());
+      taskCurrent->set_kill_time(now);
+      lease.changed();
+    }
+    return false;
   } else {
     return false;
   }
@@ -29,9 +29,21 @@
 #define ARANGO_MANAGER_H 1
 
 #include "Caretaker.h"
+#include "MpscQueue.h"
+#include "OfferInventory.h"
+#include "TargetSync.h"
+#include "TaskTimeouts.h"
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <queue>
+#include <set>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -55,6 +67,7 @@ namespace arangodb {
       std::string _slaveId;
       std::chrono::steady_clock::time_point _nextReconcile;
       std::chrono::steady_clock::duration _backoff;
+      std::chrono::steady_clock::time_point _requested;   // first request
   };
 
 // -----------------------------------------------------------------------------
@@ -69,6 +82,116 @@ namespace arangodb {
     ArangoManager (const ArangoManager&) = delete;
     ArangoManager& operator= (const ArangoManager&) = delete;
 
+// -----------------------------------------------------------------------------
+// --SECTION--                                                      public types
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief why the dispatcher is woken up
+////////////////////////////////////////////////////////////////////////////////
+
+      enum class Wakeup {
+        OFFER,
+        RESCIND,
+        STATUS_UPDATE,
+        REGISTERED,
+        ADMIN,
+        REQUEST
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the cycles of the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+      struct DispatcherStatistics {
+        uint64_t _cycles;         // number of cycles run
+        uint64_t _offers;         // wakeups by new offers
+        uint64_t _rescinds;       // wakeups by rescinded offers
+        uint64_t _statusUpdates;  // wakeups by status updates
+        uint64_t _registered;     // wakeups by the registration
+        uint64_t _admin;          // wakeups by the HTTP interface
+        uint64_t _requests;       // wakeups by finished cluster requests
+        uint64_t _deadlines;      // wakeups without work, at a deadline
+        uint64_t _queueWaits;     // waits of the driver for a full queue
+        double _cycleLast;        // duration of the last cycle in seconds
+        double _cycleMax;         // longest cycle in seconds
+        double _cycleTotal;       // duration of all cycles in seconds
+        double _latencyLast;      // from the last wakeup to its cycle
+        double _latencyMax;       // longest time from wakeup to cycle
+
+        DispatcherStatistics ()
+          : _cycles(0), _offers(0), _rescinds(0), _statusUpdates(0),
+            _registered(0), _admin(0), _requests(0), _deadlines(0),
+            _queueWaits(0),
+            _cycleLast(0.0), _cycleMax(0.0), _cycleTotal(0.0),
+            _latencyLast(0.0), _latencyMax(0.0) {
+        }
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the answer to a request to the cluster
+////////////////////////////////////////////////////////////////////////////////
+
+      struct ClusterAnswer {
+        std::string _key;
+        bool _ok;
+        std::string _body;
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a request to the cluster running in a thread of its own
+////////////////////////////////////////////////////////////////////////////////
+
+      struct ClusterRequest {
+        std::string _key;
+        std::future<ClusterAnswer> _done;
+        std::thread _thread;
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a new secondary of a primary, not yet known to the agency
+////////////////////////////////////////////////////////////////////////////////
+
+      struct SecondaryRegistration {
+        std::string _primary;       // name of the primary
+        std::string _serverId;      // server id of the primary
+        std::string _oldSecondary;  // previous secondary or "none"
+        std::string _secondary;     // name of the new secondary
+        uint32_t _attempts;         // requests to the agency so far
+        std::chrono::steady_clock::time_point _next;  // next attempt
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the reconciliation, an answer is a status
+/// update with reason REASON_RECONCILIATION, latencies are in seconds
+/// from the request to the answer, for an explicit one from the first
+/// request for the task
+////////////////////////////////////////////////////////////////////////////////
+
+      struct ReconciliationStatistics {
+        uint64_t _implicit;             // implicit requests
+        uint64_t _implicitAnswers;      // answers to implicit requests
+        double _implicitLatencyLast;
+        double _implicitLatencyMax;
+        uint64_t _explicit;             // explicit requests
+        uint64_t _explicitTasks;        // tasks in explicit requests
+        uint64_t _explicitAnswers;      // answers for these tasks
+        double _explicitLatencyLast;
+        double _explicitLatencyMax;
+        double _explicitLatencyTotal;
+        uint64_t _pending;              // tasks still to reconcile
+
+        ReconciliationStatistics ()
+          : _implicit(0), _implicitAnswers(0),
+            _implicitLatencyLast(0.0), _implicitLatencyMax(0.0),
+            _explicit(0), _explicitTasks(0), _explicitAnswers(0),
+            _explicitLatencyLast(0.0), _explicitLatencyMax(0.0),
+            _explicitLatencyTotal(0.0), _pending(0) {
+        }
+      };
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                      constructors and destructors
 // -----------------------------------------------------------------------------
@@ -94,29 +217,80 @@ namespace arangodb {
     public:
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief checks and adds an offer
+/// @brief queues an offer for the inventory, never blocks
 ////////////////////////////////////////////////////////////////////////////////
 
-      bool addOffer (const mesos::Offer&);
+      void addOffer (const mesos::Offer&);
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief removes an offer
+/// @brief queues the removal of an offer, never blocks
 ////////////////////////////////////////////////////////////////////////////////
 
       void removeOffer (const mesos::OfferID& offerId);
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief status update
+/// @brief queues a status update, only waits if the queue is full
 ////////////////////////////////////////////////////////////////////////////////
 
       void taskStatusUpdate (const mesos::TaskStatus& status);
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief wakes up the dispatcher, such that it runs a cycle right away
+////////////////////////////////////////////////////////////////////////////////
+
+      void wakeup (Wakeup reason);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the cycles of the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+      DispatcherStatistics dispatcherStatistics ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the offers held
+////////////////////////////////////////////////////////////////////////////////
+
+      OfferInventory::Statistics offerStatistics ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the reconciliation
+////////////////////////////////////////////////////////////////////////////////
+
+      ReconciliationStatistics reconciliationStatistics ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the synchronization of the cluster targets
+////////////////////////////////////////////////////////////////////////////////
+
+      TargetSync::Statistics targetStatistics ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief timeouts of the task states, wake up the dispatcher after
+/// changing them
+////////////////////////////////////////////////////////////////////////////////
+
+      TaskTimeouts& timeouts () {
+        return _timeouts;
+      }
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief destroys the cluster
 ////////////////////////////////////////////////////////////////////////////////
 
       void destroy ();
-      void restart();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts a restart job, see Caretaker::restart, returns its id
+////////////////////////////////////////////////////////////////////////////////
+
+      std::string restart (uint32_t parallelism);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief id of the last restart job finished, empty if there is none
+////////////////////////////////////////////////////////////////////////////////
+
+      std::string finishedRestart ();
+
       void restartCluster();
       void restartStandalone();
 
@@ -133,20 +307,15 @@ namespace arangodb {
       std::vector<std::string> dbserverEndpoints ();
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief register newly started task
-////////////////////////////////////////////////////////////////////////////////
-
-      void registerNewTask (std::string tid, TaskType taskType, int pos) {
-        _task2position[tid] = std::make_pair(taskType, pos);
-      }
-
-////////////////////////////////////////////////////////////////////////////////
-/// @brief register a secondary server
+/// @brief register a secondary server, only records the registration, the
+/// agency is told by the dispatcher once the lease has been given back and
+/// the secondary is added to the plan then, returns false if the primary
+/// has no server id yet, must only be called by the dispatcher
 ////////////////////////////////////////////////////////////////////////////////
       bool registerNewSecondary(ArangoState::Lease&, TaskPlan*);
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief register a secondary server
+/// @brief register a secondary server for the primary with a server id
 ////////////////////////////////////////////////////////////////////////////////
       bool registerNewSecondary(ArangoState::Lease&, std::string const&);
 
@@ -162,6 +331,32 @@ namespace arangodb {
 
       void dispatch ();
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief waits until the dispatcher is woken up or the deadline is reached
+////////////////////////////////////////////////////////////////////////////////
+
+      void waitForWork (std::chrono::steady_clock::time_point deadline);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief waits until push succeeds, called by the driver once a queue is
+/// full, the dispatcher makes room
+////////////////////////////////////////////////////////////////////////////////
+
+      void waitForQueue (std::function<bool()> const& push, char const* name);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief wakes up the driver if it waits for room in a queue, called by
+/// the dispatcher after taking values out of the queues
+////////////////////////////////////////////////////////////////////////////////
+
+      void queueDrained ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the earliest time the dispatcher has something to do on its own
+////////////////////////////////////////////////////////////////////////////////
+
+      std::chrono::steady_clock::time_point nextDeadline ();
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief prepares the reconciliation of tasks
 ////////////////////////////////////////////////////////////////////////////////
@@ -174,12 +369,64 @@ namespace arangodb {
 
       void reconcileTasks ();
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a status update has arrived, the task is reconciled
+////////////////////////////////////////////////////////////////////////////////
+
+      void reconciled (mesos::TaskStatus const&);
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief checks for timeout
 ////////////////////////////////////////////////////////////////////////////////
 
       bool checkTimeouts ();
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief registers the deadlines of the tasks whose timeouts have started
+/// anew, all deadlines are computed again if the index of the state has
+/// been rebuilt or the timeouts have changed
+////////////////////////////////////////////////////////////////////////////////
+
+      void collectTimeouts ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief tells the agency about swapped primaries and secondaries and
+/// follows the failovers until they are done
+////////////////////////////////////////////////////////////////////////////////
+
+      void driveFailovers ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief tells the agency about the registered secondaries and adds them
+/// to the plan once it knows them, see registerNewSecondary
+////////////////////////////////////////////////////////////////////////////////
+
+      void driveSecondaries ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief runs a request to the cluster in a thread of its own, the
+/// dispatcher is woken up when it has finished, the request returns
+/// whether it has succeeded and fills in the body of the answer
+////////////////////////////////////////////////////////////////////////////////
+
+      void startRequest (std::vector<ClusterRequest>&,
+                         std::string const& key,
+                         std::function<bool (std::string&)> request);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether a request with the given key is running
+////////////////////////////////////////////////////////////////////////////////
+
+      static bool isRequestRunning (std::vector<ClusterRequest> const&,
+                                    std::string const& key);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief removes the finished requests and returns their answers
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<ClusterAnswer> finishedRequests (
+        std::vector<ClusterRequest>&);
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief applies status updates
 ////////////////////////////////////////////////////////////////////////////////
@@ -187,7 +434,8 @@ namespace arangodb {
       void applyStatusUpdates(std::vector<std::string>&);
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief update target
+/// @brief update target, applies the last answer of a coordinator and
+/// asks again, if it is time, returns the servers cleaned out
 ////////////////////////////////////////////////////////////////////////////////
 
       std::vector<std::string> updateTarget();
@@ -198,28 +446,29 @@ namespace arangodb {
       void updatePlan(std::vector<std::string> const& cleanedServers);
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief updates server ids
+/// @brief updates server ids, the running servers without one are asked
+/// concurrently outside the lease, the answers are applied in one lease
 ////////////////////////////////////////////////////////////////////////////////
 
       void updateServerIds();
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief checks available offers
+/// @brief moves the queued offers and rescinds into the inventory
 ////////////////////////////////////////////////////////////////////////////////
 
-      void checkOutstandOffers ();
+      void drainOffers ();
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief starts new instances
+/// @brief checks available offers
 ////////////////////////////////////////////////////////////////////////////////
 
-      bool startNewInstances ();
+      void checkOutstandOffers ();
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief recover task mapping
+/// @brief starts new instances
 ////////////////////////////////////////////////////////////////////////////////
 
-      void fillKnownInstances (TaskType, const TasksCurrent&);
+      bool startNewInstances ();
 
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief kills all running tasks
@@ -227,9 +476,56 @@ namespace arangodb {
 
       void killAllInstances (std::vector<std::string>&);
       
+////////////////////////////////////////////////////////////////////////////////
+/// @brief drives a restart job, kills the tasks of the first bucket and
+/// moves to the next one, once they all run again and serve
+////////////////////////////////////////////////////////////////////////////////
+
       void manageClusterRestart();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief kills a task for a restart, returns true once it runs again
+/// or if it is gone
+////////////////////////////////////////////////////////////////////////////////
+
       bool taskIsGoneOrRestarted(ArangoState::Lease&, TaskType const&, std::string const&);
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether a restarted task answers its health probes, a
+/// task not confirmed in time is taken as serving
+////////////////////////////////////////////////////////////////////////////////
+
+      bool restartedTaskServes (ArangoState::Lease&, TaskType, std::string const&);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                     private types
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a new or rescinded offer, only the id is set for the latter
+////////////////////////////////////////////////////////////////////////////////
+
+      struct OfferEvent {
+        mesos::Offer _offer;
+        bool _rescinded;
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the time a timeout of a task expires, the task has not changed
+/// since if its plan entry still has the same state and timestamp
+////////////////////////////////////////////////////////////////////////////////
+
+      struct TimeoutDeadline {
+        std::chrono::steady_clock::time_point _expires;
+        ArangoState::TimedTask _task;
+
+        bool operator> (TimeoutDeadline const& that) const {
+          return _expires > that._expires;
+        }
+      };
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                 private variables
 // -----------------------------------------------------------------------------
@@ -273,28 +569,194 @@ namespace arangodb {
       std::unordered_map<std::string, ReconcileTasks> _reconciliationTasks;
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief positions of tasks
+/// @brief next reconciliation and task id of the tasks to reconcile, the
+/// earliest first; an entry is outdated if its task is no longer to be
+/// reconciled or at another time, such entries are skipped
+////////////////////////////////////////////////////////////////////////////////
+
+      typedef std::pair<std::chrono::steady_clock::time_point, std::string>
+        ReconcileDeadline;
+
+      std::priority_queue<ReconcileDeadline,
+                          std::vector<ReconcileDeadline>,
+                          std::greater<ReconcileDeadline>> _reconcileDeadlines;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief last implicit reconciliation
+////////////////////////////////////////////////////////////////////////////////
+
+      std::chrono::steady_clock::time_point _lastImplicitReconciliation;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the reconciliation, only used by the dispatcher
 ////////////////////////////////////////////////////////////////////////////////
 
-      std::unordered_map<std::string, std::pair<TaskType, int>> _task2position;
+      ReconciliationStatistics _reconciliation;
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief protects _taskStatusUpdates and _storedOffers
+/// @brief protects the wakeups and the statistics, never held while
+/// waiting for anything else
 ////////////////////////////////////////////////////////////////////////////////
 
       std::mutex _lock;
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief offers received
+/// @brief signalled when there is work for the dispatcher or room in a
+/// queue, the driver waits for the latter
+////////////////////////////////////////////////////////////////////////////////
+
+      std::condition_variable _wakeup;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief number of threads waiting for room in a queue
+////////////////////////////////////////////////////////////////////////////////
+
+      int _queueWaiters;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief whether there was a wakeup since the last cycle, and when the
+/// first of them happened
+////////////////////////////////////////////////////////////////////////////////
+
+      bool _pending;
+      std::chrono::steady_clock::time_point _pendingSince;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the cycles
+////////////////////////////////////////////////////////////////////////////////
+
+      DispatcherStatistics _statistics;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief offers received and rescinded by the driver, not yet seen by
+/// the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+      MpscQueue<OfferEvent> _offerEvents;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief status updates received by the driver, not yet applied
+////////////////////////////////////////////////////////////////////////////////
+
+      MpscQueue<mesos::TaskStatus> _statusUpdates;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief offers received and not yet used or declined, only used by
+/// the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+      OfferInventory _offers;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the offers, copied by the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+      OfferInventory::Statistics _offerStatistics;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief timeouts of the task states
+////////////////////////////////////////////////////////////////////////////////
+
+      TaskTimeouts _timeouts;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief deadlines of the timeouts, the earliest first, and the version of
+/// the timeouts they were computed with, only used by the dispatcher; an
+/// entry is outdated if its task has changed in the meantime, such entries
+/// are skipped
+////////////////////////////////////////////////////////////////////////////////
+
+      std::priority_queue<TimeoutDeadline,
+                          std::vector<TimeoutDeadline>,
+                          std::greater<TimeoutDeadline>> _timeoutDeadlines;
+
+      uint64_t _timeoutsVersion;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the reconciliation, copied by the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+      ReconciliationStatistics _reconciliationStatistics;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief requests to the agency for failovers, keyed by the name of the
+/// old primary, only used by the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<ClusterRequest> _failoverRequests;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief failovers whose new primary is missing from the plan, keyed by
+/// the name of the old primary, such that each is reported once
+////////////////////////////////////////////////////////////////////////////////
+
+      std::set<std::string> _failoverAnomalies;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief secondaries registered, keyed by the name of the primary, and
+/// the requests telling the agency about them, only used by the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+      std::map<std::string, SecondaryRegistration> _secondaryRegistrations;
+
+      std::vector<ClusterRequest> _secondaryRequests;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief requests for server ids, keyed by the URL asked, only used by
+/// the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<ClusterRequest> _serverIdRequests;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief URLs whose last request for the server id has failed, with the
+/// time after which they are asked again, only used by the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+      std::unordered_map<std::string,
+                         std::chrono::steady_clock::time_point> _serverIdRetries;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the cluster targets as last read from a coordinator, only used
+/// by the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+      TargetSync _targetSync;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the running request for the cluster targets and its answer,
+/// only used by the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<ClusterRequest> _targetRequests;
+      std::shared_ptr<TargetSync::Response> _targetResponse;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief time of the next request for the cluster targets
+////////////////////////////////////////////////////////////////////////////////
+
+      std::chrono::steady_clock::time_point _nextTargetSync;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the cluster targets, copied by the dispatcher
+////////////////////////////////////////////////////////////////////////////////
+
+      TargetSync::Statistics _targetStatistics;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief since when the restarted tasks of the current restart bucket
+/// are waited for to answer their health probes, by type and name, only
+/// used by the dispatcher
 ////////////////////////////////////////////////////////////////////////////////
 
-      std::unordered_map<std::string, mesos::Offer> _storedOffers;
+      std::map<std::pair<TaskType, std::string>,
+               std::chrono::system_clock::time_point> _restartServingSince;
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief status updates received
+/// @brief id of the last restart job finished, protected by _lock
 ////////////////////////////////////////////////////////////////////////////////
 
-      std::vector<mesos::TaskStatus> _taskStatusUpdates;
+      std::string _finishedRestart;
   };
 }
 
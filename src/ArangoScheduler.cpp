@@ -139,6 +139,60 @@ static void checkVersion (string hostname, int port) {
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief applies an operation to the resources of an offer, like the
+/// master does when the offer is accepted
+////////////////////////////////////////////////////////////////////////////////
+
+static void applyOperation (mesos::Resources& resources,
+                            mesos::Offer::Operation const& operation) {
+  switch (operation.type()) {
+    case mesos::Offer::Operation::RESERVE: {
+      mesos::Resources reserved = operation.reserve().resources();
+      resources -= reserved.flatten();
+      resources += reserved;
+      break;
+    }
+
+    case mesos::Offer::Operation::UNRESERVE: {
+      mesos::Resources reserved = operation.unreserve().resources();
+      resources -= reserved;
+      resources += reserved.flatten();
+      break;
+    }
+
+    case mesos::Offer::Operation::CREATE: {
+      for (auto const& volume : operation.create().volumes()) {
+        mesos::Resource disk = volume;
+        disk.clear_disk();
+        resources -= disk;
+        resources += volume;
+      }
+      break;
+    }
+
+    case mesos::Offer::Operation::DESTROY: {
+      for (auto const& volume : operation.destroy().volumes()) {
+        mesos::Resource disk = volume;
+        disk.clear_disk();
+        resources -= volume;
+        resources += disk;
+      }
+      break;
+    }
+
+    case mesos::Offer::Operation::LAUNCH: {
+      for (auto const& task : operation.launch().task_infos()) {
+        resources -= mesos::Resources(task.resources());
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                             class ArangoScheduler
 // -----------------------------------------------------------------------------
@@ -184,7 +238,7 @@ void ArangoScheduler::reserveDynamically (const mesos::Offer& offer,
   reserve.set_type(mesos::Offer::Operation::RESERVE);
   reserve.mutable_reserve()->mutable_resources()->CopyFrom(resources);
 
-  _driver->acceptOffers({offer.id()}, {reserve});
+  accept(offer.id(), {reserve});
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -197,7 +251,7 @@ void ArangoScheduler::unreserveDynamically (const mesos::Offer& offer,
   unreserve.set_type(mesos::Offer::Operation::UNRESERVE);
   unreserve.mutable_unreserve()->mutable_resources()->CopyFrom(resources);
 
-  _driver->acceptOffers({offer.id()}, {unreserve});
+  accept(offer.id(), {unreserve});
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -210,7 +264,7 @@ void ArangoScheduler::makePersistent (const mesos::Offer& offer,
   reserve.set_type(mesos::Offer::Operation::CREATE);
   reserve.mutable_create()->mutable_volumes()->CopyFrom(resources);
 
-  _driver->acceptOffers({offer.id()}, {reserve});
+  accept(offer.id(), {reserve});
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -223,69 +277,203 @@ void ArangoScheduler::destroyPersistent (const mesos::Offer& offer,
   destroy.set_type(mesos::Offer::Operation::DESTROY);
   destroy.mutable_destroy()->mutable_volumes()->CopyFrom(resources);
 
-  _driver->acceptOffers({offer.id()}, {destroy});
+  accept(offer.id(), {destroy});
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief declines an offer
 ////////////////////////////////////////////////////////////////////////////////
 
-void ArangoScheduler::declineOffer (const mesos::OfferID& offerId) const {
+void ArangoScheduler::declineOffer (const mesos::OfferID& offerId,
+                                    DeclineReason reason) const {
+  {
+    lock_guard<mutex> lock(_batchLock);
+
+    if (_batchThread == this_thread::get_id()) {
+      _declined.emplace_back(offerId, reason);
+      return;
+    }
+  }
+
+  refuseOffer(offerId, Global::declineOfferRefuseSeconds());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief declines an offer and refuses its agent for the given time
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoScheduler::refuseOffer (const mesos::OfferID& offerId,
+                                   double refuseSeconds) const {
   mesos::Filters filters;
-  filters.set_refuse_seconds(Global::declineOfferRefuseSeconds());
+  filters.set_refuse_seconds(refuseSeconds);
   _driver->declineOffer(offerId, filters);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief starts an instances with a given offer and resources
+/// @brief removes all refuse filters
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoScheduler::reviveOffers () const {
+  LOG(INFO) << "reviving offers";
+
+  _driver->reviveOffers();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts a batch of offers
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoScheduler::beginOfferBatch (
+    unordered_map<string, vector<mesos::OfferID>> const& merged) {
+  lock_guard<mutex> lock(_batchLock);
+
+  _batchThread = this_thread::get_id();
+  _declined.clear();
+  _operations.clear();
+  _merged = merged;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief ends a batch of offers
+////////////////////////////////////////////////////////////////////////////////
+
+vector<pair<mesos::OfferID, DeclineReason>> ArangoScheduler::endOfferBatch (
+    unordered_set<string>& accepted) {
+  vector<pair<mesos::OfferID, DeclineReason>> declined;
+  vector<pair<vector<mesos::OfferID>, vector<mesos::Offer::Operation>>> accepts;
+
+  {
+    lock_guard<mutex> lock(_batchLock);
+
+    // an offer which is accepted is not declined, even if what was left
+    // of it was declined later on
+    for (auto& decline : _declined) {
+      if (_operations.find(decline.first.value()) == _operations.end()) {
+        declined.push_back(decline);
+      }
+    }
+
+    for (auto& operations : _operations) {
+      accepted.insert(operations.first);
+
+      vector<mesos::OfferID> ids;
+      auto it = _merged.find(operations.first);
+
+      if (it == _merged.end()) {
+        mesos::OfferID offerId;
+        offerId.set_value(operations.first);
+        ids.push_back(offerId);
+      }
+      else {
+        ids = it->second;
+      }
+
+      accepts.emplace_back(ids, operations.second);
+    }
+
+    _batchThread = thread::id();
+    _merged.clear();
+    _declined.clear();
+    _operations.clear();
+  }
+
+  for (auto const& accept : accepts) {
+    _driver->acceptOffers(accept.first, accept.second);
+  }
+
+  return declined;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
-mesos::TaskInfo ArangoScheduler::startInstance (
-    string const& taskId,
-    string const& name,
-    TaskCurrent const& info,
-    mesos::ContainerInfo const& container,
-    mesos::CommandInfo const& command) const {
+/// @brief the operations collected for an offer in the current batch
+////////////////////////////////////////////////////////////////////////////////
+
+vector<mesos::Offer::Operation> ArangoScheduler::batchOperations (
+    mesos::OfferID const& offerId) const {
+  lock_guard<mutex> lock(_batchLock);
+
+  auto it = _operations.find(offerId.value());
+
+  if (it == _operations.end()) {
+    return {};
+  }
+
+  return it->second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the resources of an offer left by the collected operations
+////////////////////////////////////////////////////////////////////////////////
+
+mesos::Resources ArangoScheduler::remainingResources (
+    mesos::Offer const& offer) const {
+  mesos::Resources resources = offer.resources();
 
-  mesos::SlaveID const& slaveId = info.slave_id();
-  mesos::OfferID const& offerId = info.offer_id();
-  mesos::Resources const& resources = info.resources();
-  string const& offerStr = offerId.value();
+  for (auto const& operation : batchOperations(offer.id())) {
+    applyOperation(resources, operation);
+  }
+
+  return resources;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts an instances with a given offer and resources
+////////////////////////////////////////////////////////////////////////////////
+void ArangoScheduler::startInstance (mesos::OfferID const& offerId,
+                                     mesos::TaskInfo const& task) const {
+  mesos::Resources resources = task.resources();
 
   LOG(INFO)
   << "DEBUG startInstance: "
-  << "launching task " << name 
-  << " using offer " << offerStr
+  << "launching task " << task.name()
+  << " using offer " << offerId.value()
   << " and resources " << resources;
 
-  mesos::TaskInfo task;
+  // launch the task
+  mesos::Offer::Operation launch;
+  launch.set_type(mesos::Offer::Operation::LAUNCH);
+  launch.mutable_launch()->add_task_infos()->CopyFrom(task);
 
-  task.set_name(name);
-  task.mutable_task_id()->set_value(taskId);
-  task.mutable_slave_id()->CopyFrom(slaveId);
-  task.mutable_resources()->CopyFrom(resources);
-  task.mutable_container()->CopyFrom(container);
-  task.mutable_command()->CopyFrom(command);
+  accept(offerId, {launch});
+}
 
-  mesos::DiscoveryInfo di;
-  di.set_visibility(mesos::DiscoveryInfo::CLUSTER);
-  string lower = name;
-  std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
-  di.set_name(lower);
-  mesos::Ports po;
-  auto p = po.add_ports();
-  p->set_number(info.ports(0));
-  p->set_name("ArangoDB");
-  p->set_protocol("tcp");
-  di.mutable_ports()->CopyFrom(po);
-  task.mutable_discovery()->CopyFrom(di);
+////////////////////////////////////////////////////////////////////////////////
+/// @brief reserves, creates persistent disks and starts an instance
+////////////////////////////////////////////////////////////////////////////////
 
-  // launch the tasks
-  vector<mesos::TaskInfo> tasks;
-  tasks.push_back(task);
+void ArangoScheduler::startPersistentInstance (mesos::OfferID const& offerId,
+                                               mesos::Resources const& reservation,
+                                               mesos::Resources const& volumes,
+                                               mesos::TaskInfo const& task) const {
+  LOG(INFO)
+  << "DEBUG startPersistentInstance: "
+  << "launching task " << task.name()
+  << " using offer " << offerId.value()
+  << " after reserving " << reservation
+  << " and creating " << volumes;
+
+  // the operations are applied in order, each to the resources the
+  // previous one left, if one fails the task is not launched
+  vector<mesos::Offer::Operation> operations;
+
+  if (! reservation.empty()) {
+    mesos::Offer::Operation reserve;
+    reserve.set_type(mesos::Offer::Operation::RESERVE);
+    reserve.mutable_reserve()->mutable_resources()->CopyFrom(reservation);
+    operations.push_back(reserve);
+  }
 
-  _driver->launchTasks(offerId, tasks);
+  mesos::Offer::Operation create;
+  create.set_type(mesos::Offer::Operation::CREATE);
+  create.mutable_create()->mutable_volumes()->CopyFrom(volumes);
+  operations.push_back(create);
 
-  return task;
+  mesos::Offer::Operation launch;
+  launch.set_type(mesos::Offer::Operation::LAUNCH);
+  launch.mutable_launch()->add_task_infos()->CopyFrom(task);
+  operations.push_back(launch);
+
+  accept(offerId, operations);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -345,16 +533,19 @@ bool ArangoScheduler::reconcileTasks () {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief reconciles a single task
+/// @brief reconciles the given tasks with one request
 ////////////////////////////////////////////////////////////////////////////////
 
-void ArangoScheduler::reconcileTask (std::string const& taskId,
-                                     std::string const& slaveId) {
+void ArangoScheduler::reconcileTasks (
+    vector<pair<string, string>> const& tasks) {
   vector<mesos::TaskStatus> status;
-  mesos::TaskStatus ts;
-  ts.mutable_task_id()->set_value(taskId);
-  ts.mutable_slave_id()->set_value(slaveId);
-  status.push_back(ts);
+
+  for (auto const& task : tasks) {
+    mesos::TaskStatus ts;
+    ts.mutable_task_id()->set_value(task.first);
+    ts.mutable_slave_id()->set_value(task.second);
+    status.push_back(ts);
+  }
 
   _driver->reconcileTasks(status);
 }
@@ -379,6 +570,8 @@ void ArangoScheduler::registered (mesos::SchedulerDriver* driver,
     l.state().mutable_framework_id()->CopyFrom(frameworkId);
   }
 
+  Global::manager().wakeup(ArangoManager::Wakeup::REGISTERED);
+
   checkVersion(master.hostname(), master.port());
 
   Global::setMasterUrl("http://" + master.hostname() + ":" + to_string(master.port()) + "/");
@@ -418,36 +611,30 @@ void ArangoScheduler::resourceOffers (mesos::SchedulerDriver* driver,
   // if it is not healthy we might need to look at offers
   bool isHealthy = true;
   {
-    auto lease = Global::state().lease();
-    Current current = lease.state().current();
-    isHealthy = current.cluster_complete();
-    if (isHealthy) {
-      Plan plan = lease.state().plan();
-
-      auto taskGroups = {
-        std::make_pair(plan.agents(), current.agents()),
-        std::make_pair(plan.coordinators(), current.coordinators()),
-        std::make_pair(plan.dbservers(), current.dbservers()),
-        std::make_pair(plan.secondaries(), current.secondaries()),
-      };
-
-      for (auto const& taskGroup: taskGroups) {
-        TasksPlan const& plan = taskGroup.first;
-        TasksCurrent const& current = taskGroup.second;
-
-        if (current.entries().size() != plan.entries().size()) {
-          isHealthy = false;
-          break;
-        }
+    auto snapshot = Global::state().snapshot();
+    Current const& current = snapshot->state().current();
+    Plan const& plan = snapshot->state().plan();
+
+    auto allRunning = [] (TasksPlan const& plan,
+                          TasksCurrent const& current) -> bool {
+      if (current.entries_size() != plan.entries_size()) {
+        return false;
+      }
 
-        for (auto const& planTask: plan.entries()) {
-          if (planTask.state() != TASK_STATE_RUNNING) {
-            isHealthy = false;
-            break;
-          }
+      for (auto const& planTask: plan.entries()) {
+        if (planTask.state() != TASK_STATE_RUNNING) {
+          return false;
         }
       }
-    }
+
+      return true;
+    };
+
+    isHealthy = current.cluster_complete()
+             && allRunning(plan.agents(), current.agents())
+             && allRunning(plan.coordinators(), current.coordinators())
+             && allRunning(plan.dbservers(), current.dbservers())
+             && allRunning(plan.secondaries(), current.secondaries());
   }
 
   for (auto& offer : offers) {
@@ -465,11 +652,7 @@ void ArangoScheduler::resourceOffers (mesos::SchedulerDriver* driver,
       declineOffer(offer.id());
     }
     else {
-      bool hasAccepted = Global::manager().addOffer(offer);
-      if (!hasAccepted) {
-        LOG(INFO) << "Declining offer since our queue is full.";
-        declineOffer(offer.id());
-      }
+      Global::manager().addOffer(offer);
     }
   }
 }
@@ -547,6 +730,47 @@ void ArangoScheduler::error (mesos::SchedulerDriver* driver,
   LOG(ERROR) << "ERROR " << message;
 }
 
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the offers an offer of the current batch stands for
+////////////////////////////////////////////////////////////////////////////////
+
+vector<mesos::OfferID> ArangoScheduler::offerIds (
+    mesos::OfferID const& offerId) const {
+  lock_guard<mutex> lock(_batchLock);
+
+  auto it = _merged.find(offerId.value());
+
+  if (it == _merged.end()) {
+    return { offerId };
+  }
+
+  return it->second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief accepts an offer with the given operations
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoScheduler::accept (
+    mesos::OfferID const& offerId,
+    vector<mesos::Offer::Operation> const& operations) const {
+  {
+    lock_guard<mutex> lock(_batchLock);
+
+    if (_batchThread == this_thread::get_id()) {
+      auto& collected = _operations[offerId.value()];
+      collected.insert(collected.end(), operations.begin(), operations.end());
+      return;
+    }
+  }
+
+  _driver->acceptOffers(offerIds(offerId), operations);
+}
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                       END-OF-FILE
 // -----------------------------------------------------------------------------
@@ -29,10 +29,16 @@
 #define ARANGO_SCHEDULER_H 1
 
 #include "arangodb.pb.h"
+#include "OfferInventory.h"
 
 #include <mesos/resources.hpp>
 #include <mesos/scheduler.hpp>
 #include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 // -----------------------------------------------------------------------------
 // --SECTION--                                             class ArangoScheduler
@@ -105,20 +111,75 @@ namespace arangodb {
                               const mesos::Resources& resources) const;
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief declines an offer
+/// @brief declines an offer, the reason is only used in a batch
 ////////////////////////////////////////////////////////////////////////////////
 
-      void declineOffer (mesos::OfferID const&) const;
+      void declineOffer (mesos::OfferID const&,
+                         DeclineReason reason = DeclineReason::NOT_NEEDED) const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief declines an offer and refuses its agent for the given time
+////////////////////////////////////////////////////////////////////////////////
+
+      void refuseOffer (mesos::OfferID const&, double refuseSeconds) const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief removes all refuse filters
+////////////////////////////////////////////////////////////////////////////////
+
+      void reviveOffers () const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts a batch of offers, until the batch ends the offers the
+/// calling thread declines and the operations it wants to perform on
+/// offers are only collected. An offer listed in merged stands for all
+/// offers given there, these are used together.
+////////////////////////////////////////////////////////////////////////////////
+
+      void beginOfferBatch (
+        std::unordered_map<std::string, std::vector<mesos::OfferID>> const& merged);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief ends a batch of offers, the operations collected for an offer
+/// are performed with a single acceptance of it, the offers accepted are
+/// put into accepted. Returns the offers declined in the batch without
+/// those accepted, it is up to the caller to actually decline them.
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<std::pair<mesos::OfferID, DeclineReason>> endOfferBatch (
+        std::unordered_set<std::string>& accepted);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the operations collected for an offer in the current batch
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<mesos::Offer::Operation> batchOperations (
+        mesos::OfferID const&) const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the resources of an offer left by the operations collected for
+/// it in the current batch
+////////////////////////////////////////////////////////////////////////////////
+
+      mesos::Resources remainingResources (mesos::Offer const&) const;
 
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief starts an agency with a given offer
 ////////////////////////////////////////////////////////////////////////////////
 
-      mesos::TaskInfo startInstance (std::string const& taskId,
-                                     std::string const& name,
-                                     TaskCurrent const&,
-                                     mesos::ContainerInfo const&,
-                                     mesos::CommandInfo const&) const;
+      void startInstance (mesos::OfferID const&,
+                          mesos::TaskInfo const&) const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief reserves resources, creates persistent disks and starts an
+/// instance with a single acceptance of the offer, an empty reservation
+/// is skipped
+////////////////////////////////////////////////////////////////////////////////
+
+      void startPersistentInstance (mesos::OfferID const&,
+                                    mesos::Resources const& reservation,
+                                    mesos::Resources const& volumes,
+                                    mesos::TaskInfo const&) const;
 
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief kills an instances
@@ -146,11 +207,12 @@ namespace arangodb {
       bool reconcileTasks ();
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief reconciles a single task
+/// @brief reconciles the given tasks, pairs of task and slave id, with
+/// one request
 ////////////////////////////////////////////////////////////////////////////////
 
-      void reconcileTask (std::string const& taskId,
-                          std::string const& slaveId);
+      void reconcileTasks (
+        std::vector<std::pair<std::string, std::string>> const& tasks);
 
 
 // -----------------------------------------------------------------------------
@@ -233,6 +295,26 @@ namespace arangodb {
       void error (mesos::SchedulerDriver*,
                   const std::string& message) override;
 
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the offers an offer of the current batch stands for
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<mesos::OfferID> offerIds (mesos::OfferID const&) const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief accepts an offer with the given operations, in a batch they are
+/// only collected
+////////////////////////////////////////////////////////////////////////////////
+
+      void accept (mesos::OfferID const&,
+                   std::vector<mesos::Offer::Operation> const&) const;
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                 private variables
 // -----------------------------------------------------------------------------
@@ -244,6 +326,29 @@ namespace arangodb {
 ////////////////////////////////////////////////////////////////////////////////
 
       mesos::SchedulerDriver* _driver;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the thread running a batch of offers and the offers it declined,
+/// offers are declined right away by all other threads
+////////////////////////////////////////////////////////////////////////////////
+
+      mutable std::mutex _batchLock;
+      std::thread::id _batchThread;
+      mutable std::vector<std::pair<mesos::OfferID, DeclineReason>> _declined;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the merged offers of the batch
+////////////////////////////////////////////////////////////////////////////////
+
+      std::unordered_map<std::string, std::vector<mesos::OfferID>> _merged;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the operations collected for each offer of the batch, in the
+/// order they were asked for
+////////////////////////////////////////////////////////////////////////////////
+
+      mutable std::unordered_map<std::string,
+                                 std::vector<mesos::Offer::Operation>> _operations;
   };
 }
 
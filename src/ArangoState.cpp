@@ -28,6 +28,10 @@
 #include "ArangoState.h"
 
 #include "Global.h"
+#include "HealthProbes.h"
+#include "ReverseProxy.h"
+#include "StateJournal.h"
+#include "StateLayout.h"
 #include "utils.h"
 
 #include "pbjson.hpp"
@@ -40,6 +44,7 @@
 
 #include <cstdlib>
 #include <fstream>
+#include <map>
 #include <random>
 #include <regex>
 #include <string>
@@ -48,6 +53,22 @@ using namespace arangodb;
 using namespace mesos::internal::state;
 using namespace std;
 
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private constants
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief minimal number of slots in the proxy backend
+////////////////////////////////////////////////////////////////////////////////
+
+static const size_t PROXY_MIN_SLOTS = 8;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief weight of a coordinator in the proxy backend
+////////////////////////////////////////////////////////////////////////////////
+
+static const uint32_t PROXY_WEIGHT = 100;
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                 class ArangoState
 // -----------------------------------------------------------------------------
@@ -65,8 +86,21 @@ ArangoState::ArangoState (const string& name, const string& zk)
     _zk(zk),
     _storage(nullptr),
     _stateStore(nullptr),
+    _journalSequence(0),
+    _journalDeltas(0),
+    _journalBytes(0),
+    _snapshotNeeded(true),
+    _legacyLayout(false),
+    _strayShards(false),
+    _dirtyVersion(0),
+    _publishedVersion(0),
+    _persistedVersion(0),
+    _timedTasksLost(true),
+    _persisterThread(nullptr),
+    _stopPersister(false),
     _isLeased(false),
-    _coordinatorHAProxyList(""),
+    _readLeases(0),
+    _writersWaiting(0),
     _proxyPid(0),
     _restartProxy(RESTART_KEEP_RUNNING)
 {
@@ -80,6 +114,14 @@ ArangoState::ArangoState (const string& name, const string& zk)
   _proxyConfFilename += "/arango-haproxy.conf";
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief destructor
+////////////////////////////////////////////////////////////////////////////////
+
+ArangoState::~ArangoState () {
+  stopPersister();
+}
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                    public methods
 // -----------------------------------------------------------------------------
@@ -147,6 +189,10 @@ void ArangoState::init () {
   _state.mutable_current()->mutable_secondaries();
 
   _state.mutable_current()->set_cluster_complete(false);
+
+  _state.set_schema_version(STATE_SCHEMA_VERSION);
+
+  publishReplaced(0);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -154,38 +200,270 @@ void ArangoState::init () {
 ////////////////////////////////////////////////////////////////////////////////
 
 void ArangoState::load () {
-  lock_guard<mutex> lock(_lock);
-  assert(! _isLeased);
+  lock_guard<mutex> persistLock(_persistLock);
 
-  Variable variable = _stateStore->fetch("state_"+_name).get();
-  string value = variable.value();
+  {
+    lock_guard<mutex> lock(_lock);
+    assert(! _isLeased);
+  }
 
-  if (! value.empty()) {
-    _state.ParseFromString(value);
+  set<string> names = _stateStore->names().get();
+  bool found = loadShards(names);
 
-    if (_state.targets().mode() != Global::modeLC()) {
-      LOG(ERROR)
-      << "FATAL stored state is for mode '"
-      << _state.targets().mode() << "', "
-      << "requested mode is '" << Global::modeLC() << "'";
+  if (! found) {
+    found = loadLegacy();
+  }
 
-      exit(EXIT_FAILURE);
+  // replay the journal written since the snapshot, the sequence numbers
+  // must be contiguous, anything after a gap was never acknowledged
+  map<uint64_t, string> journal;
+
+  for (auto const& name : names) {
+    uint64_t sequence;
+
+    if (parseJournalVariableName(_name, name, sequence)) {
+      journal[sequence] = name;
     }
+  }
 
-    bool stateAsyncRepl 
-        = _state.targets().has_asynchronous_replication() &&
-          _state.targets().asynchronous_replication();
-    if (stateAsyncRepl != Global::asyncReplication()) {
-      LOG(ERROR)
-      << "FATAL stored state is for asyncReplication flag '"
-      << stateAsyncRepl << "', "
-      << "requested value is '" << Global::asyncReplication() << "'";
+  _journalSequence = _state.journal_sequence();
 
-      exit(EXIT_FAILURE);
+  for (auto const& entry : journal) {
+    if (entry.first <= _journalSequence) {
+      continue;
+    }
+
+    if (entry.first != _journalSequence + 1) {
+      LOG(WARNING)
+      << "state journal has a gap after sequence " << _journalSequence
+      << ", ignoring " << entry.second << " and later entries";
+      break;
+    }
+
+    StateDelta delta;
+
+    if (! delta.ParseFromString(_stateStore->fetch(entry.second).get().value())) {
+      LOG(WARNING)
+      << "cannot parse state journal entry " << entry.second
+      << ", ignoring it and later entries";
+      break;
+    }
+
+    applyStateDelta(_state, delta);
+    _journalSequence = entry.first;
+    _persistenceStatistics._replayed++;
+  }
+
+  if (! journal.empty()) {
+    LOG(INFO)
+    << "replayed " << _persistenceStatistics._replayed
+    << " state journal entries up to sequence " << _journalSequence;
+  }
+
+  if (found || ! journal.empty()) {
+    verifyTargets();
+  }
+
+  bool upgraded = upgradeState(_state);
+
+  if (upgraded) {
+    LOG(INFO)
+    << "converted stored state to schema version " << STATE_SCHEMA_VERSION;
+  }
+
+  _persisted.CopyFrom(_state);
+  _persistedBytes.clear();
+
+  // compact right away, so that the next start need not replay again,
+  // a state in an old layout or schema is converted right away as well
+  if (! journal.empty() || _legacyLayout || upgraded) {
+    for (auto const& entry : journal) {
+      _journalNames.insert(entry.second);
+    }
+
+    storeSnapshot(_state);
+  }
+
+  publishReplaced(_dirtyVersion);
+
+  VLOG(1) << "current state: " << arangodb::toJson(_state);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief follows the state stored by the leader
+////////////////////////////////////////////////////////////////////////////////
+
+bool ArangoState::tail () {
+  lock_guard<mutex> persistLock(_persistLock);
+
+  string value = _stateStore->fetch(manifestVariableName(_name)).get().value();
+
+  if (value.empty()) {
+    return false;
+  }
+
+  StateManifest manifest;
+
+  if (! manifest.ParseFromString(value)) {
+    LOG(WARNING) << "cannot parse state manifest, trying again later";
+    return false;
+  }
+
+  State state;
+  state.CopyFrom(_state);
+
+  bool changed = false;
+
+  // a new generation: only the shards written in it must be fetched, all
+  // others are still known from the last one
+  if (manifest.generation() != _manifest.generation()) {
+    map<string, string> known;
+
+    for (auto const& shard : _manifest.shards()) {
+      known[shard.key()] = shard.variable();
+    }
+
+    map<string, process::Future<Variable>> fetched;
+
+    for (auto const& shard : manifest.shards()) {
+      if (known[shard.key()] != shard.variable()) {
+        fetched.emplace(shard.key(), _stateStore->fetch(shard.variable()));
+      }
+    }
+
+    map<string, string> values;
+
+    for (auto const& shard : manifest.shards()) {
+      auto it = fetched.find(shard.key());
+
+      if (it == fetched.end()) {
+        values[shard.key()] = _storedShards[shard.key()];
+        continue;
+      }
+
+      string data = it->second.get().value();
+
+      // the leader removes the shards of the previous generation as soon
+      // as the new manifest is written, we just read the next one later
+      if (data.size() != shard.size()) {
+        LOG(INFO)
+        << "state shard " << shard.variable() << " has already been "
+        << "replaced, trying again later";
+        return false;
+      }
+
+      if (shard.compressed()) {
+        if (! decompressShard(data, values[shard.key()])) {
+          LOG(WARNING)
+          << "cannot decompress state shard " << shard.variable();
+          return false;
+        }
+      }
+      else {
+        values[shard.key()].swap(data);
+      }
+    }
+
+    // start from the snapshot alone, deltas replayed so far are contained
+    // in it and optional shards missing from it must not survive
+    state.Clear();
+
+    for (auto const& entry : values) {
+      if (! parseShard(state, entry.first, entry.second)) {
+        LOG(WARNING) << "cannot parse state shard " << entry.first;
+        return false;
+      }
+    }
+
+    if (manifest.has_framework_id()) {
+      state.mutable_framework_id()->CopyFrom(manifest.framework_id());
+    }
+
+    state.mutable_current()->set_cluster_complete(manifest.cluster_complete());
+    state.set_journal_sequence(manifest.journal_sequence());
+    state.set_schema_version(manifest.schema_version());
+
+    _storedShards.swap(values);
+    _manifest.Swap(&manifest);
+    _journalSequence = _manifest.journal_sequence();
+    _journalNames.clear();
+    _journalDeltas = 0;
+    _journalBytes = 0;
+
+    changed = true;
+  }
+
+  // the deltas appended since then, fetched one after the other until the
+  // next sequence number has not been written yet
+  while (true) {
+    string name = journalVariableName(_name, _journalSequence + 1);
+    string data = _stateStore->fetch(name).get().value();
+    StateDelta delta;
+
+    if (data.empty() || ! delta.ParseFromString(data)) {
+      break;
     }
+
+    applyStateDelta(state, delta);
+
+    _journalSequence++;
+    _journalNames.insert(name);
+    _journalDeltas++;
+    _journalBytes += data.size();
+    _persistenceStatistics._replayed++;
+
+    changed = true;
+  }
+
+  if (! changed) {
+    return false;
+  }
+
+  acquireWrite();
+  _state.Swap(&state);
+  _persisted.CopyFrom(_state);
+  _persistedBytes.clear();
+  publishReplaced(_dirtyVersion);
+  releaseWrite();
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief takes over the state followed so far
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::takeOver () {
+  tail();
+
+  if (_manifest.generation() == 0) {
+    // nothing has been stored in the current layout, so there was
+    // nothing to follow
+    load();
+    return;
+  }
+
+  lock_guard<mutex> persistLock(_persistLock);
+
+  verifyTargets();
+
+  bool upgraded = upgradeState(_state);
+  _persisted.CopyFrom(_state);
+  _persistedBytes.clear();
+  _snapshotNeeded = false;
+
+  if (upgraded) {
+    LOG(INFO)
+    << "converted stored state to schema version " << STATE_SCHEMA_VERSION;
+
+    storeSnapshot(_state);
   }
 
-  LOG(INFO) << "current state: " << arangodb::toJson(_state);
+  publishReplaced(_dirtyVersion);
+
+  LOG(INFO)
+  << "took over state generation " << _manifest.generation()
+  << " at journal sequence " << _journalSequence;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -193,11 +471,74 @@ void ArangoState::load () {
 ////////////////////////////////////////////////////////////////////////////////
 
 void ArangoState::destroy () {
-  lock_guard<mutex> lock(_lock);
+  stopPersister();
+
+  lock_guard<mutex> persistLock(_persistLock);
 
   Variable variable = _stateStore->fetch("state_"+_name).get();
   auto r = _stateStore->expunge(variable);
   r.await();  // Wait until state is actually expunged
+
+  // the manifest goes first, so that an interrupted destroy never leaves
+  // a manifest referring to missing shards
+  _stateStore->expunge(
+    _stateStore->fetch(manifestVariableName(_name)).get()).await();
+
+  set<string> names = _stateStore->names().get();
+
+  for (auto const& name : names) {
+    uint64_t sequence;
+
+    uint64_t generation;
+
+    if (parseJournalVariableName(_name, name, sequence) ||
+        parseShardVariableName(_name, name, generation)) {
+      _stateStore->expunge(_stateStore->fetch(name).get()).await();
+    }
+  }
+
+  _journalNames.clear();
+  _journalSequence = 0;
+  _manifest.Clear();
+  _legacyLayout = false;
+  _strayShards = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts the background thread persisting changes of the state
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::startPersister () {
+  lock_guard<mutex> lock(_lock);
+
+  if (_persisterThread != nullptr) {
+    return;
+  }
+
+  _stopPersister = false;
+  _persisterThread = new thread(&ArangoState::persister, this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief stops the background thread, pending changes are persisted
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::stopPersister () {
+  {
+    lock_guard<mutex> lock(_lock);
+
+    if (_persisterThread == nullptr) {
+      return;
+    }
+
+    _stopPersister = true;
+  }
+
+  _persistRequested.notify_one();
+  _persisterThread->join();
+
+  delete _persisterThread;
+  _persisterThread = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -205,6 +546,28 @@ void ArangoState::destroy () {
 ////////////////////////////////////////////////////////////////////////////////
 
 bool ArangoState::createReverseProxyConfig() {
+  lock_guard<mutex> proxyLock(_proxyLock);
+
+  // the embedded proxy has no config but the coordinators
+  if (Global::reverseProxy() != nullptr) {
+    Global::reverseProxy()->setBackends(_coordinatorHAProxyList);
+    return true;
+  }
+
+  // keep some slots in reserve, such that new coordinators can be added
+  // without a reload
+  size_t slots = max(PROXY_MIN_SLOTS, 2 * _coordinatorHAProxyList.size());
+
+  if (_proxyBackends.size() < slots) {
+    _proxyBackends.resize(slots);
+    _proxyBackends.assign(_coordinatorHAProxyList);
+  }
+
+  std::string options = "check";
+  if (!Global::arangoDBSslKeyfile().empty()) {
+    options += " ssl";
+  }
+
   std::ofstream outfile(_proxyConfFilename);
   if (!outfile.is_open()) {
     LOG(ERROR) << "Couldn't open file " << _proxyConfFilename;
@@ -217,7 +580,7 @@ bool ArangoState::createReverseProxyConfig() {
 
     # Stats required for this module to work
     # https://github.com/observing/haproxy#haproxycfg
-    stats socket /tmp/haproxy.sock level admin
+    stats socket )" << HAPROXY_SOCKET << R"( level admin
     ssl-server-verify none
 
 defaults
@@ -243,7 +606,7 @@ defaults
         cookie SERVERID insert indirect nocache
         acl is_adminrouter hdr_reg(x-forwarded-for) .*
         option forwardfor
-        reqadd X-Script-Name:\ /service/)" << Global::frameworkName() << " if is_adminrouter\n" << "        cookie SERVERID insert indirect nocache\n" << _coordinatorHAProxyList;
+        reqadd X-Script-Name:\ /service/)" << Global::frameworkName() << " if is_adminrouter\n" << "        cookie SERVERID insert indirect nocache\n" << _proxyBackends.config(options);
 
   if (outfile.fail()) {
     LOG(ERROR) << "Couldn't write to " << _proxyConfFilename;
@@ -275,26 +638,46 @@ std::string ArangoState::getAgencyURL (ArangoState::Lease& lease) {
 /// @brief find the URL of some coordinator
 ////////////////////////////////////////////////////////////////////////////////
 
-std::string ArangoState::getCoordinatorURL (ArangoState::Lease& lease) {
-  auto const& coordinators = lease.state().current().coordinators();
-  auto nr = coordinators.entries_size();
-  
-  if (nr == 0) {
+static std::string coordinatorURL (arangodb::State const& state) {
+  auto const& plans = state.plan().coordinators();
+  auto const& coordinators = state.current().coordinators();
+  HealthProbes const* probes = Global::healthProbes();
+
+  // coordinators with an endpoint, those the health probes report as
+  // failing are only used, if there are no others
+  std::vector<int> candidates;
+  std::vector<int> failing;
+
+  for (int i = 0;  i < coordinators.entries_size();  ++i) {
+    if (coordinators.entries(i).ports_size() == 0) {
+      continue;
+    }
+
+    if (probes != nullptr && i < plans.entries_size() &&
+        probes->failing(TaskType::COORDINATOR, plans.entries(i).name())) {
+      failing.push_back(i);
+    }
+    else {
+      candidates.push_back(i);
+    }
+  }
+
+  if (candidates.empty()) {
+    candidates.swap(failing);
+  }
+
+  if (candidates.empty()) {
     return std::string("");
   }
+
   long now = chrono::duration_cast<chrono::seconds>(
       chrono::steady_clock::now().time_since_epoch()).count();
   std::default_random_engine generator(now);
-  std::uniform_int_distribution<int> distribution(0, nr-1);
-  int which = distribution(generator);  // generates number of a coordinator
+  std::uniform_int_distribution<int> distribution(0, candidates.size() - 1);
+  int which = candidates[distribution(generator)];  // generates number of a coordinator
   
-  auto coordinator = coordinators.entries(which);
+  auto const& coordinator = coordinators.entries(which);
   std::string hostname = coordinator.hostname();
-  
-  if (coordinator.ports_size() == 0) {
-    return std::string("");
-  }
-
   uint32_t port = coordinator.ports(0);
   
   std::string url;
@@ -308,6 +691,14 @@ std::string ArangoState::getCoordinatorURL (ArangoState::Lease& lease) {
   return url;
 }
 
+std::string ArangoState::getCoordinatorURL (ArangoState::Lease& lease) {
+  return coordinatorURL(lease.state());
+}
+
+std::string ArangoState::getCoordinatorURL (ArangoState::Snapshot const& snapshot) {
+  return coordinatorURL(snapshot.state());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief is the cluster healthy?
 ////////////////////////////////////////////////////////////////////////////////
@@ -316,47 +707,147 @@ bool ArangoState::clusterHealthy(Lease& lease) {
   return lease.state().current().cluster_complete();
 }
 
+bool ArangoState::clusterHealthy(Snapshot const& snapshot) {
+  return snapshot.state().current().cluster_complete();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about waiting for shared leases
+////////////////////////////////////////////////////////////////////////////////
+
+ArangoState::LeaseStatistics ArangoState::readLeaseStatistics () {
+  lock_guard<mutex> lock(_lock);
+  return _readStatistics;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about waiting for exclusive leases
+////////////////////////////////////////////////////////////////////////////////
+
+ArangoState::LeaseStatistics ArangoState::writeLeaseStatistics () {
+  lock_guard<mutex> lock(_lock);
+  return _writeStatistics;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about persisting the state
+////////////////////////////////////////////////////////////////////////////////
+
+ArangoState::PersistenceStatistics ArangoState::persistenceStatistics () {
+  lock_guard<mutex> lock(_lock);
+  return _persistenceStatistics;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts a cycle of the calling thread
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::beginCycle () {
+  lock_guard<mutex> lock(_lock);
+  _cycleThread = this_thread::get_id();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief ends the cycle of the calling thread
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::endCycle () {
+  {
+    lock_guard<mutex> lock(_lock);
+    _cycleThread = thread::id();
+
+    if (_dirtyVersion <= _publishedVersion) {
+      return;
+    }
+  }
+
+  // nobody can change the state while it is copied, the version only
+  // changes under the exclusive lease
+  acquireRead();
+
+  uint64_t version;
+  bool unpublished;
+
+  {
+    lock_guard<mutex> lock(_lock);
+    version = _dirtyVersion;
+    unpublished = _publishedVersion < version;
+  }
+
+  if (unpublished) {
+    publish(version);
+  }
+
+  releaseRead();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief hands over the tasks whose timeouts started anew
+////////////////////////////////////////////////////////////////////////////////
+
+bool ArangoState::takeTimedTasks (vector<TimedTask>& tasks) {
+  lock_guard<mutex> lock(_lock);
+
+  tasks.clear();
+  tasks.swap(_timedTasks);
+
+  bool complete = ! _timedTasksLost;
+  _timedTasksLost = false;
+
+  return complete;
+}
+
 
 // -----------------------------------------------------------------------------
 // --SECTION--                                                   private methods
 // -----------------------------------------------------------------------------
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief saves the state
+/// @brief records that the state has changed and wakes up the persister
 ////////////////////////////////////////////////////////////////////////////////
 
-bool ArangoState::save () {
-  lock_guard<mutex> lock(_lock);
-  assert(_isLeased);
+bool ArangoState::markDirty () {
+  uint64_t version;
 
-  string value;
-  _state.SerializeToString(&value);
+  bool deferred;
 
-  string json;
-  pbjson::pb2json(&_state, json);
-  LOG(INFO) << "State saved: " << json;
+  {
+    lock_guard<mutex> lock(_lock);
+    assert(_isLeased);
 
-  Variable variable = _stateStore->fetch("state_"+_name).get();
-  variable = variable.mutate(value);
-  _stateStore->store(variable);
+    version = ++_dirtyVersion;
+    _persistenceStatistics._changes++;
+    deferred = (_cycleThread == this_thread::get_id());
+  }
 
-  std::string backends = "";
-  auto const coordinators = _state.current().coordinators().entries();
-  
-  std::string options = "check";
-  if (!Global::arangoDBSslKeyfile().empty()) {
-    options += " ssl";
+  // the changes of a cycle are published together at its end
+  if (! deferred) {
+    publish(version);
   }
 
-  int i=0;
-  for (auto const& coordinator: coordinators) {
+  std::vector<ProxyBackend> backends;
+  auto const& plans = _state.plan().coordinators();
+  auto const& coordinators = _state.current().coordinators();
+
+  for (int i = 0;  i < coordinators.entries_size();  ++i) {
+    auto const& coordinator = coordinators.entries(i);
+
     // mop: not yet ready :S
     if (coordinator.ports().size() == 0) {
       continue;
     }
-    std::string serverName = std::to_string(i);
-    backends += "        server coordinator" + std::to_string(i) + " " + coordinator.hostname() + ":" + std::to_string(coordinator.ports(0)) + " " + options + " cookie coordinator" + std::to_string(i) + '\n';
-    i++;
+
+    // a coordinator shutting down only serves the sessions it has
+    bool draining = i < plans.entries_size() &&
+                    plans.entries(i).state() == TASK_STATE_SHUTTING_DOWN;
+
+    ProxyBackend backend = {
+      coordinator.hostname(),
+      coordinator.ports(0),
+      draining ? 0u : PROXY_WEIGHT
+    };
+
+    backends.push_back(backend);
   }
 
   if (backends == _coordinatorHAProxyList) {
@@ -367,8 +858,785 @@ bool ArangoState::save () {
   return true;
 }
 
-void ArangoState::setRestartProxy(int restartOption) {
-  _restartProxy.store(restartOption);
+////////////////////////////////////////////////////////////////////////////////
+/// @brief publishes a new snapshot of the state
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::publish (uint64_t version) {
+  auto snapshot = std::make_shared<Snapshot const>(_state, version);
+
+  {
+    lock_guard<mutex> lock(_lock);
+
+    std::atomic_store(&_snapshot, std::shared_ptr<Snapshot const>(snapshot));
+    _publishedVersion = version;
+  }
+
+  _persistRequested.notify_one();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief rebuilds the index and publishes a replaced state
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::publishReplaced (uint64_t version) {
+  rebuildIndex();
+  publish(version);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief indexes a task again
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::updateIndex (TaskType type, int position) {
+  if (! _index.update(_state, type, position)) {
+    return;
+  }
+
+  TaskPlan const& entry = tasksPlan(_state, type).entries(position);
+  TimedTask task = { type, entry.name(), entry.state(), entry.timestamp() };
+  bool outside;
+
+  {
+    lock_guard<mutex> lock(_lock);
+    _timedTasks.push_back(task);
+    outside = _cycleThread != this_thread::get_id();
+  }
+
+  // the dispatcher looks at the timeouts at the end of its cycle anyway
+  if (outside) {
+    wakeupListener();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief rebuilds the task index
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::rebuildIndex () {
+  _index = TaskIndex(_state);
+  bool outside;
+
+  {
+    lock_guard<mutex> lock(_lock);
+    _timedTasks.clear();
+    _timedTasksLost = true;
+    outside = _cycleThread != this_thread::get_id();
+  }
+
+  if (outside) {
+    wakeupListener();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief persists the state right away
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::flush () {
+  uint64_t version;
+
+  {
+    lock_guard<mutex> lock(_lock);
+    assert(_isLeased);
+
+    version = ++_dirtyVersion;
+    _persistenceStatistics._flushes++;
+  }
+
+  publish(version);
+
+  // we hold the exclusive lease, so nobody can change the state while
+  // it is written, no need for a copy of our own
+  lock_guard<mutex> persistLock(_persistLock);
+  persist(_state, version);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief main loop of the persister thread
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::persister () {
+  while (true) {
+    bool stopping;
+
+    {
+      unique_lock<mutex> lock(_lock);
+
+      _persistRequested.wait(lock, [this] {
+        return _stopPersister || _persistedVersion < _publishedVersion;
+      });
+
+      if (_publishedVersion <= _persistedVersion) {
+        return;
+      }
+
+      stopping = _stopPersister;
+    }
+
+    // give the other changes of the current dispatch round a chance
+    // to come in, they are then written together
+    if (! stopping) {
+      this_thread::sleep_for(
+        chrono::milliseconds(Global::statePersistDelay()));
+    }
+
+    // the latest snapshot always carries the latest version, so there
+    // is no need to wait for a lease or to copy the state
+    auto latest = snapshot();
+
+    lock_guard<mutex> persistLock(_persistLock);
+    persist(latest->state(), latest->version());
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief writes a copy of the state with the given version
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::persist (State const& state, uint64_t version) {
+  uint64_t persistedVersion;
+
+  {
+    lock_guard<mutex> lock(_lock);
+    persistedVersion = _persistedVersion;
+  }
+
+  if (version <= persistedVersion) {
+    return;
+  }
+
+  if (Global::stateJournal()) {
+    storeDelta(state);
+  }
+  else {
+    if (_persistedBytes.empty()) {
+      _persisted.SerializePartialToString(&_persistedBytes);
+    }
+
+    string bytes;
+    state.SerializePartialToString(&bytes);
+
+    if (_snapshotNeeded || bytes != _persistedBytes) {
+      if (storeSnapshot(state)) {
+        _persistedBytes.swap(bytes);
+      }
+    }
+    else {
+      lock_guard<mutex> lock(_lock);
+      _persistenceStatistics._unchanged++;
+    }
+  }
+
+  {
+    lock_guard<mutex> lock(_lock);
+    _persistenceStatistics._coalesced += version - persistedVersion - 1;
+    _persistedVersion = version;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief writes the complete state and truncates the journal
+////////////////////////////////////////////////////////////////////////////////
+
+bool ArangoState::storeSnapshot (State const& state) {
+  StateManifest manifest;
+  manifest.set_generation(_manifest.generation() + 1);
+  manifest.set_cluster_complete(state.current().cluster_complete());
+  manifest.set_journal_sequence(_journalSequence);
+  manifest.set_schema_version(state.schema_version());
+
+  if (state.has_framework_id()) {
+    manifest.mutable_framework_id()->CopyFrom(state.framework_id());
+  }
+
+  map<string, StateShard const*> previous;
+
+  for (auto const& shard : _manifest.shards()) {
+    previous[shard.key()] = &shard;
+  }
+
+  // only shards which differ from the stored ones are written, all
+  // others are taken over from the previous generation
+  bool compress = Global::stateCompression();
+  map<string, string> values;
+  vector<pair<string, string>> writes;
+  uint64_t unchanged = 0;
+
+  for (auto const& key : stateShardKeys()) {
+    string value;
+
+    if (! serializeShard(state, key, value)) {
+      continue;
+    }
+
+    auto it = previous.find(key);
+
+    if (it != previous.end() &&
+        it->second->compressed() == compress &&
+        _storedShards[key] == value) {
+      manifest.add_shards()->CopyFrom(*it->second);
+      values[key].swap(value);
+      ++unchanged;
+      continue;
+    }
+
+    StateShard* shard = manifest.add_shards();
+    shard->set_key(key);
+    shard->set_variable(shardVariableName(_name, key, manifest.generation()));
+
+    string data = value;
+
+    if (compress) {
+      if (compressShard(value, data)) {
+        shard->set_compressed(true);
+      }
+      else {
+        LOG(WARNING) << "cannot compress state shard " << key;
+        data = value;
+      }
+    }
+
+    shard->set_size(data.size());
+    writes.emplace_back(shard->variable(), data);
+    values[key].swap(value);
+  }
+
+  // write all changed shards at once and wait for all of them
+  vector<process::Future<Variable>> fetched;
+
+  for (auto const& write : writes) {
+    fetched.push_back(_stateStore->fetch(write.first));
+  }
+
+  vector<process::Future<Option<Variable>>> stored;
+  uint64_t bytes = 0;
+
+  for (size_t i = 0;  i < writes.size();  ++i) {
+    stored.push_back(
+      _stateStore->store(fetched[i].get().mutate(writes[i].second)));
+    bytes += writes[i].second.size();
+  }
+
+  bool ok = true;
+
+  for (auto& future : stored) {
+    future.await();
+
+    if (! future.isReady() || future.get().isNone()) {
+      ok = false;
+    }
+  }
+
+  // the manifest makes the new generation visible, shards written in
+  // vain are removed after the next successful snapshot
+  if (ok) {
+    string value;
+    manifest.SerializeToString(&value);
+
+    Variable variable
+      = _stateStore->fetch(manifestVariableName(_name)).get();
+    auto future = _stateStore->store(variable.mutate(value));
+    future.await();
+
+    ok = future.isReady() && future.get().isSome();
+    bytes += value.size();
+  }
+
+  if (! ok) {
+    LOG(WARNING) << "cannot store state snapshot, keeping the journal";
+    _snapshotNeeded = true;
+    _strayShards = true;
+    return false;
+  }
+
+  if (VLOG_IS_ON(1)) {
+    string json;
+    pbjson::pb2json(&state, json);
+    VLOG(1) << "State saved: " << json;
+  }
+
+  // shards of the previous generation which have been replaced
+  set<string> referenced;
+
+  for (auto const& shard : manifest.shards()) {
+    referenced.insert(shard.variable());
+  }
+
+  for (auto const& shard : _manifest.shards()) {
+    if (referenced.find(shard.variable()) == referenced.end()) {
+      _stateStore->expunge(_stateStore->fetch(shard.variable()).get());
+    }
+  }
+
+  if (_legacyLayout) {
+    _stateStore->expunge(_stateStore->fetch("state_" + _name).get());
+    _legacyLayout = false;
+  }
+
+  // shards left over by an interrupted or failed save, only those up to
+  // the generation just committed, a later one is still being written
+  if (_strayShards) {
+    set<string> names = _stateStore->names().get();
+
+    for (auto const& name : names) {
+      uint64_t generation;
+
+      if (parseShardVariableName(_name, name, generation) &&
+          generation <= manifest.generation() &&
+          referenced.find(name) == referenced.end()) {
+        _stateStore->expunge(_stateStore->fetch(name).get());
+      }
+    }
+
+    _strayShards = false;
+  }
+
+  {
+    lock_guard<mutex> lock(_lock);
+    _persistenceStatistics._snapshots++;
+    _persistenceStatistics._snapshotBytes += bytes;
+    _persistenceStatistics._shardsWritten += writes.size();
+    _persistenceStatistics._shardsUnchanged += unchanged;
+  }
+
+  _manifest.Swap(&manifest);
+  _storedShards.swap(values);
+  _persisted.CopyFrom(state);
+  _persistedBytes.clear();
+  _snapshotNeeded = false;
+
+  truncateJournal();
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief loads the state from the manifest and its shards
+////////////////////////////////////////////////////////////////////////////////
+
+bool ArangoState::loadShards (set<string> const& names) {
+  string value = _stateStore->fetch(manifestVariableName(_name)).get().value();
+
+  if (value.empty()) {
+    return false;
+  }
+
+  StateManifest manifest;
+
+  if (! manifest.ParseFromString(value)) {
+    LOG(ERROR) << "FATAL cannot parse state manifest";
+    exit(EXIT_FAILURE);
+  }
+
+  // fetch all shards at once
+  vector<process::Future<Variable>> fetched;
+
+  for (auto const& shard : manifest.shards()) {
+    fetched.push_back(_stateStore->fetch(shard.variable()));
+  }
+
+  for (int i = 0;  i < manifest.shards_size();  ++i) {
+    StateShard const& shard = manifest.shards(i);
+    string data = fetched[i].get().value();
+
+    if (data.size() != shard.size()) {
+      LOG(ERROR)
+      << "FATAL state shard " << shard.variable() << " is missing or truncated";
+      exit(EXIT_FAILURE);
+    }
+
+    string value;
+
+    if (shard.compressed()) {
+      if (! decompressShard(data, value)) {
+        LOG(ERROR)
+        << "FATAL cannot decompress state shard " << shard.variable();
+        exit(EXIT_FAILURE);
+      }
+    }
+    else {
+      value.swap(data);
+    }
+
+    if (! parseShard(_state, shard.key(), value)) {
+      LOG(ERROR) << "FATAL cannot parse state shard " << shard.variable();
+      exit(EXIT_FAILURE);
+    }
+
+    _storedShards[shard.key()].swap(value);
+  }
+
+  if (manifest.has_framework_id()) {
+    _state.mutable_framework_id()->CopyFrom(manifest.framework_id());
+  }
+
+  _state.mutable_current()->set_cluster_complete(manifest.cluster_complete());
+  _state.set_journal_sequence(manifest.journal_sequence());
+  _state.set_schema_version(manifest.schema_version());
+
+  LOG(INFO)
+  << "loaded state generation " << manifest.generation()
+  << " from " << manifest.shards_size() << " shards";
+
+  // shards of an interrupted save and the old layout of an interrupted
+  // conversion are only noted here, the next snapshot removes them once
+  // it has been committed
+  set<string> referenced;
+
+  for (auto const& shard : manifest.shards()) {
+    referenced.insert(shard.variable());
+  }
+
+  for (auto const& name : names) {
+    uint64_t generation;
+
+    if (parseShardVariableName(_name, name, generation) &&
+        referenced.find(name) == referenced.end()) {
+      _strayShards = true;
+    }
+    else if (name == "state_" + _name) {
+      _legacyLayout = true;
+    }
+  }
+
+  _manifest.Swap(&manifest);
+  _snapshotNeeded = false;
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks the stored targets against the command line
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::verifyTargets () {
+  if (_state.targets().mode() != Global::modeLC()) {
+    LOG(ERROR)
+    << "FATAL stored state is for mode '"
+    << _state.targets().mode() << "', "
+    << "requested mode is '" << Global::modeLC() << "'";
+
+    exit(EXIT_FAILURE);
+  }
+
+  bool stateAsyncRepl 
+      = _state.targets().has_asynchronous_replication() &&
+        _state.targets().asynchronous_replication();
+  if (stateAsyncRepl != Global::asyncReplication()) {
+    LOG(ERROR)
+    << "FATAL stored state is for asyncReplication flag '"
+    << stateAsyncRepl << "', "
+    << "requested value is '" << Global::asyncReplication() << "'";
+
+    exit(EXIT_FAILURE);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief loads the state stored as a whole by older versions
+////////////////////////////////////////////////////////////////////////////////
+
+bool ArangoState::loadLegacy () {
+  string value = _stateStore->fetch("state_" + _name).get().value();
+
+  if (value.empty()) {
+    return false;
+  }
+
+  _state.ParseFromString(value);
+  _legacyLayout = true;
+
+  LOG(INFO) << "state is stored in the old layout, converting it";
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief appends the difference to the last persisted state to the journal
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::storeDelta (State const& state) {
+  StateDelta delta;
+  delta.set_sequence(_journalSequence + 1);
+
+  if (! diffState(_persisted, state, delta)) {
+    _snapshotNeeded = true;
+  }
+  else if (! _snapshotNeeded && isEmptyDelta(delta)) {
+    lock_guard<mutex> lock(_lock);
+    _persistenceStatistics._unchanged++;
+    return;
+  }
+
+  string value;
+  delta.SerializeToString(&value);
+
+  if (_snapshotNeeded ||
+      Global::stateJournalMaxDeltas() <= _journalDeltas ||
+      Global::stateJournalMaxBytes() < _journalBytes + value.size()) {
+    storeSnapshot(state);
+    return;
+  }
+
+  if (VLOG_IS_ON(1)) {
+    string json;
+    pbjson::pb2json(&delta, json);
+    VLOG(1) << "State delta saved: " << json;
+  }
+
+  string name = journalVariableName(_name, delta.sequence());
+  Variable variable = _stateStore->fetch(name).get();
+  auto stored = _stateStore->store(variable.mutate(value));
+
+  // the sequence number is used up even if the entry is lost, the
+  // snapshot written instead then covers it
+  _journalSequence = delta.sequence();
+  _journalNames.insert(name);
+
+  stored.await();
+
+  if (! stored.isReady() || stored.get().isNone()) {
+    LOG(WARNING) << "cannot store state journal entry, writing snapshot";
+    storeSnapshot(state);
+    return;
+  }
+
+  _journalDeltas++;
+  _journalBytes += value.size();
+
+  {
+    lock_guard<mutex> lock(_lock);
+    _persistenceStatistics._deltas++;
+    _persistenceStatistics._deltaBytes += value.size();
+  }
+
+  _persisted.CopyFrom(state);
+  _persistedBytes.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief removes all journal entries which are contained in the snapshot
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::truncateJournal () {
+  for (auto const& name : _journalNames) {
+    _stateStore->expunge(_stateStore->fetch(name).get());
+  }
+
+  _journalNames.clear();
+  _journalDeltas = 0;
+  _journalBytes = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief records how long somebody had to wait for a lease
+////////////////////////////////////////////////////////////////////////////////
+
+static void recordWait (ArangoState::LeaseStatistics& statistics,
+                        chrono::steady_clock::time_point const& start,
+                        bool waited) {
+  statistics._granted++;
+
+  if (! waited) {
+    return;
+  }
+
+  double wait = chrono::duration<double>(
+      chrono::steady_clock::now() - start).count();
+
+  statistics._contended++;
+  statistics._waitTotal += wait;
+
+  if (statistics._waitMax < wait) {
+    statistics._waitMax = wait;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief blocks until an exclusive lease can be granted
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::acquireWrite () {
+  auto start = chrono::steady_clock::now();
+  unique_lock<mutex> lock(_lock);
+  bool waited = false;
+
+  if (_isLeased || _readLeases > 0) {
+    waited = true;
+    ++_writersWaiting;
+
+    _leaseReleased.wait(lock, [this] {
+      return ! _isLeased && _readLeases == 0;
+    });
+
+    --_writersWaiting;
+  }
+
+  _isLeased = true;
+  recordWait(_writeStatistics, start, waited);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief gives back an exclusive lease
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::releaseWrite () {
+  {
+    lock_guard<mutex> lock(_lock);
+    _isLeased = false;
+  }
+
+  _leaseReleased.notify_all();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief blocks until a shared lease can be granted
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::acquireRead () {
+  auto start = chrono::steady_clock::now();
+  unique_lock<mutex> lock(_lock);
+  bool waited = false;
+
+  if (_isLeased || _writersWaiting > 0) {
+    waited = true;
+
+    _leaseReleased.wait(lock, [this] {
+      return ! _isLeased && _writersWaiting == 0;
+    });
+  }
+
+  ++_readLeases;
+  recordWait(_readStatistics, start, waited);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief gives back a shared lease
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::releaseRead () {
+  bool last;
+
+  {
+    lock_guard<mutex> lock(_lock);
+    last = (--_readLeases == 0);
+  }
+
+  if (last) {
+    _leaseReleased.notify_all();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief assigns the coordinators to proxy slots
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::updateReverseProxy () {
+  if (Global::reverseProxy() != nullptr) {
+    Global::reverseProxy()->setBackends(_coordinatorHAProxyList);
+    return;
+  }
+
+  bool fits;
+
+  {
+    lock_guard<mutex> proxyLock(_proxyLock);
+    fits = _proxyBackends.assign(_coordinatorHAProxyList);
+  }
+
+  if (! fits) {
+    LOG(INFO)
+    << "not enough proxy slots for " << _coordinatorHAProxyList.size()
+    << " coordinators, restarting proxy";
+
+    createReverseProxyConfig();
+    setRestartProxy(RESTART_RESTART);
+    return;
+  }
+
+  // a restart already requested takes care of the update as well
+  int expected = RESTART_KEEP_RUNNING;
+
+  if (_restartProxy.compare_exchange_strong(expected, RESTART_UPDATE)) {
+    wakeupListener();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sends the changed backends to the running proxy
+////////////////////////////////////////////////////////////////////////////////
+
+bool ArangoState::sendReverseProxyCommands () {
+
+  // without a running proxy the changes stay queued, the proxy asks for
+  // them once it has been started
+  if (getProxyPid() == 0) {
+    return true;
+  }
+
+  lock_guard<mutex> proxyLock(_proxyLock);
+  string error;
+
+  if (! _proxyBackends.send(HAPROXY_SOCKET, getIPAddress, error)) {
+    LOG(WARNING) << error;
+    return false;
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief asks the dispatcher to send the queued changes to the proxy
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::requestReverseProxyUpdate () {
+  bool pending;
+
+  {
+    lock_guard<mutex> proxyLock(_proxyLock);
+    pending = _proxyBackends.pending();
+  }
+
+  if (pending) {
+    int expected = RESTART_KEEP_RUNNING;
+
+    if (_restartProxy.compare_exchange_strong(expected, RESTART_UPDATE)) {
+      wakeupListener();
+    }
+  }
+}
+
+void ArangoState::setRestartProxy(int restartOption) {
+  _restartProxy.store(restartOption);
+
+  if (restartOption != RESTART_KEEP_RUNNING) {
+    wakeupListener();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets the wakeup listener
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::setWakeupListener (function<void()> const& listener) {
+  lock_guard<mutex> lock(_lock);
+  _wakeupListener = listener;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief calls the wakeup listener
+////////////////////////////////////////////////////////////////////////////////
+
+void ArangoState::wakeupListener () {
+  function<void()> listener;
+
+  {
+    lock_guard<mutex> lock(_lock);
+    listener = _wakeupListener;
+  }
+
+  if (listener) {
+    listener();
+  }
 }
 
 int ArangoState::getRestartProxy() {
@@ -30,12 +30,21 @@
 
 #include "arangodb.pb.h"
 #include "Global.h"
+#include "ProxyBackends.h"
+#include "TaskIndex.h"
 
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <csignal>
 #include <thread>
 #include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
 
 #include <state/protobuf.hpp>
 
@@ -43,6 +52,7 @@ namespace arangodb {
   const int RESTART_KEEP_RUNNING = 0;
   const int RESTART_FRESH_START = 1;
   const int RESTART_RESTART = 2;
+  const int RESTART_UPDATE = 3;    // backends changed, no reload needed
 
 // -----------------------------------------------------------------------------
 // --SECTION--                                                       ArangoState
@@ -62,6 +72,12 @@ namespace arangodb {
 
       ArangoState (const std::string& name, const std::string& zk);
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief destructor
+////////////////////////////////////////////////////////////////////////////////
+
+      ~ArangoState ();
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                    public methods
 // -----------------------------------------------------------------------------
@@ -80,12 +96,39 @@ namespace arangodb {
 
       void load ();
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief follows the state stored by the leader, used by a standby
+/// instance instead of load, only the shards and journal entries written
+/// since the last call are read, returns true if the state has changed
+////////////////////////////////////////////////////////////////////////////////
+
+      bool tail ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief catches up with the state stored by the leader and takes over,
+/// the journal is not compacted, such that the standby can start at once
+////////////////////////////////////////////////////////////////////////////////
+
+      void takeOver ();
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief removes the state from store
 ////////////////////////////////////////////////////////////////////////////////
 
       void destroy ();
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts the background thread persisting changes of the state
+////////////////////////////////////////////////////////////////////////////////
+
+      void startPersister ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief stops the background thread, pending changes are persisted
+////////////////////////////////////////////////////////////////////////////////
+
+      void stopPersister ();
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief gets filename of the haproxy config
 ////////////////////////////////////////////////////////////////////////////////
@@ -96,6 +139,12 @@ namespace arangodb {
 // --SECTION--                                     state leasing infrastructure
 // -----------------------------------------------------------------------------
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief exclusive lease, when the lease is given back and has been
+/// changed, the state is handed to the persister thread, which writes
+/// it together with other changes made in the meantime
+////////////////////////////////////////////////////////////////////////////////
+
       class Lease {
           ArangoState* _parent;
           bool _changed;
@@ -110,6 +159,29 @@ namespace arangodb {
             _changed = true;
           }
 
+          // The index is kept up to date by the holder of the lease, use
+          // update() after adding a task or changing its name, server id,
+          // persistence id, state, timestamp, slave or task id, and
+          // reindex() after removing tasks.
+          TaskIndex const& index () const {
+            return _parent->_index;
+          }
+
+          void update (TaskType type, int position) {
+            _parent->updateIndex(type, position);
+          }
+
+          void reindex () {
+            _parent->rebuildIndex();
+          }
+
+          // Blocks until the state is persisted as it is now, use this
+          // before telling Mesos about anything we must not forget in
+          // case of a failover, for example reservations and volumes.
+          void flush () {
+            _parent->flush();
+          }
+
           Lease (ArangoState* p, bool write) 
               : _parent(p), _changed(write), _moved(false) {
           }
@@ -120,13 +192,11 @@ namespace arangodb {
             }
             if (_changed) {
               // mop: recreate config
-              if (_parent->save()) {
-                _parent->createReverseProxyConfig();
-                _parent->setRestartProxy(RESTART_RESTART);
+              if (_parent->markDirty()) {
+                _parent->updateReverseProxy();
               }
             }
-            std::lock_guard<std::mutex> lock(_parent->_lock);
-            _parent->_isLeased = false;
+            _parent->releaseWrite();
           }
 
           // Moving is allowed, used in the lease() function below
@@ -142,25 +212,196 @@ namespace arangodb {
           Lease& operator= (Lease&& that) = delete;
       };
 
-      Lease lease (bool write = false) {
-        while (true) {
-          bool ok = false;
-          {
-            std::lock_guard<std::mutex> lock(_lock);
-            if (! _isLeased) {
-              ok = true;
-              _isLeased = true;
+////////////////////////////////////////////////////////////////////////////////
+/// @brief shared lease, any number of readers can hold one at the same time,
+/// the state must not be changed
+////////////////////////////////////////////////////////////////////////////////
+
+      class ReadLease {
+          ArangoState* _parent;
+          bool _moved;
+        public:
+
+          State const& state () const {
+            return _parent->_state;
+          }
+
+          // The index is only rebuilt under an exclusive lease.
+          TaskIndex const& index () const {
+            return _parent->_index;
+          }
+
+          explicit ReadLease (ArangoState* p) 
+              : _parent(p), _moved(false) {
+          }
+
+          ~ReadLease () {
+            if (_moved) {
+              return;
             }
+            _parent->releaseRead();
+          }
+
+          // Moving is allowed, used in the leaseRead() function below
+          ReadLease (ReadLease&& that) 
+              : _parent(that._parent), _moved(false) {
+            that._moved = true;
+          }
+
+          // All other copy or move constructors or assignments are deleted:
+          ReadLease () = delete;
+          ReadLease (ReadLease const& that) = delete;
+          ReadLease& operator= (ReadLease const& that) = delete;
+          ReadLease& operator= (ReadLease&& that) = delete;
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief immutable copy of the state, a new one is published whenever
+/// a changed exclusive lease is given back, readers which only need a
+/// consistent view of the state should use these instead of a lease
+////////////////////////////////////////////////////////////////////////////////
+
+      class Snapshot {
+          State const _state;
+          uint64_t const _version;
+        public:
+
+          Snapshot (State const& state, uint64_t version)
+            : _state(state), _version(version) {
           }
-          if (ok) {
-            Lease result (this, write);
-            return result;
+
+          State const& state () const {
+            return _state;
           }
-          LOG(INFO) << "Did not get lease of state, waiting 1 sec...";
-          std::this_thread::sleep_for(std::chrono::seconds(1));
+
+          uint64_t version () const {
+            return _version;
+          }
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief waiting statistics for one kind of lease
+////////////////////////////////////////////////////////////////////////////////
+
+      struct LeaseStatistics {
+        uint64_t _granted;    // number of leases handed out
+        uint64_t _contended;  // number of leases which had to wait
+        double _waitTotal;    // total waiting time in seconds
+        double _waitMax;      // longest wait in seconds
+
+        LeaseStatistics ()
+          : _granted(0), _contended(0), _waitTotal(0.0), _waitMax(0.0) {
         }
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about persisting the state
+////////////////////////////////////////////////////////////////////////////////
+
+      struct PersistenceStatistics {
+        uint64_t _changes;        // number of changed exclusive leases
+        uint64_t _flushes;        // number of explicit flushes
+        uint64_t _coalesced;      // changes written together with later ones
+        uint64_t _snapshots;      // number of full states written
+        uint64_t _snapshotBytes;  // total size of these states
+        uint64_t _deltas;         // number of deltas appended to the journal
+        uint64_t _deltaBytes;     // total size of these deltas
+        uint64_t _unchanged;      // number of saves without any difference
+        uint64_t _replayed;       // number of deltas replayed during load
+        uint64_t _shardsWritten;  // number of shards written by snapshots
+        uint64_t _shardsUnchanged; // shards taken over by snapshots
+
+        PersistenceStatistics ()
+          : _changes(0), _flushes(0), _coalesced(0),
+            _snapshots(0), _snapshotBytes(0), _deltas(0), _deltaBytes(0),
+            _unchanged(0), _replayed(0),
+            _shardsWritten(0), _shardsUnchanged(0) {
+        }
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief acquires an exclusive lease, blocks until all other leases
+/// are given back
+////////////////////////////////////////////////////////////////////////////////
+
+      Lease lease (bool write = false) {
+        acquireWrite();
+        Lease result (this, write);
+        return result;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief acquires a shared lease, blocks only while an exclusive lease
+/// is held or requested
+////////////////////////////////////////////////////////////////////////////////
+
+      ReadLease leaseRead () {
+        acquireRead();
+        ReadLease result (this);
+        return result;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about waiting for shared leases
+////////////////////////////////////////////////////////////////////////////////
+
+      LeaseStatistics readLeaseStatistics ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the latest published snapshot, never blocks
+////////////////////////////////////////////////////////////////////////////////
+
+      std::shared_ptr<Snapshot const> snapshot () const {
+        return std::atomic_load(&_snapshot);
       }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts a cycle of the calling thread, until the cycle ends the
+/// changes of its leases are not published one by one, other threads
+/// still publish theirs when they give back the lease
+////////////////////////////////////////////////////////////////////////////////
+
+      void beginCycle ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief ends the cycle of the calling thread, publishes its changes
+/// with a single snapshot
+////////////////////////////////////////////////////////////////////////////////
+
+      void endCycle ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a task whose timeout started anew, with the state and the
+/// timestamp of its plan entry at that time
+////////////////////////////////////////////////////////////////////////////////
+
+      struct TimedTask {
+        TaskType _type;
+        std::string _name;
+        TaskPlanState _state;
+        double _timestamp;
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief hands over the tasks whose timeouts started anew since the last
+/// call, returns false if the index has been rebuilt in the meantime, the
+/// caller has to look at all tasks of the state then
+////////////////////////////////////////////////////////////////////////////////
+
+      bool takeTimedTasks (std::vector<TimedTask>& tasks);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about waiting for exclusive leases
+////////////////////////////////////////////////////////////////////////////////
+
+      LeaseStatistics writeLeaseStatistics ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about persisting the state
+////////////////////////////////////////////////////////////////////////////////
+
+      PersistenceStatistics persistenceStatistics ();
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief find the URL of our own agency
 ////////////////////////////////////////////////////////////////////////////////
@@ -173,18 +414,38 @@ namespace arangodb {
 
       std::string getCoordinatorURL (Lease& lease);
 
+      std::string getCoordinatorURL (Snapshot const& snapshot);
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief is the cluster healthy?
 ////////////////////////////////////////////////////////////////////////////////
 
       bool clusterHealthy(Lease& lease);
 
+      bool clusterHealthy(Snapshot const& snapshot);
+
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief create a reverse proxy config from our current state
+/// @brief create a reverse proxy config from our current state, the
+/// embedded proxy just gets the coordinators
 ////////////////////////////////////////////////////////////////////////////////
 
       bool createReverseProxyConfig();
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sends the changed backends to the running proxy, returns false
+/// if this is impossible and the proxy must be restarted, while no proxy
+/// is running, the changes stay queued
+////////////////////////////////////////////////////////////////////////////////
+
+      bool sendReverseProxyCommands();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief asks the dispatcher to send the queued changes to the proxy, if
+/// there are any, called once a proxy has been started
+////////////////////////////////////////////////////////////////////////////////
+
+      void requestReverseProxyUpdate();
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief set proxy pid
 ////////////////////////////////////////////////////////////////////////////////
@@ -201,17 +462,157 @@ namespace arangodb {
       
       int getRestartProxy();
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief called whenever the dispatcher has to look at something it is
+/// not told about otherwise, that is a requested restart or update of the
+/// proxy, or a timeout started outside of its cycle
+////////////////////////////////////////////////////////////////////////////////
+
+      void setWakeupListener (std::function<void()> const& listener);
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                   private methods
 // -----------------------------------------------------------------------------
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief saves the state
+/// @brief records that the state has changed and wakes up the persister,
+/// returns true if the list of coordinators for the proxy has changed
 ////////////////////////////////////////////////////////////////////////////////
 
     private:
 
-      bool save ();
+      bool markDirty ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief assigns the coordinators to proxy slots, if there are not
+/// enough, the config is rewritten and a restart requested, otherwise
+/// an update through the runtime API, the embedded proxy is updated
+/// directly
+////////////////////////////////////////////////////////////////////////////////
+
+      void updateReverseProxy ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief publishes a new snapshot of the state and wakes up the
+/// persister, the caller holds a lease or is the only thread using the
+/// state
+////////////////////////////////////////////////////////////////////////////////
+
+      void publish (uint64_t version);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief rebuilds the task index and publishes the state after it has
+/// been replaced as a whole, the caller holds the exclusive lease or is
+/// the only thread using the state
+////////////////////////////////////////////////////////////////////////////////
+
+      void publishReplaced (uint64_t version);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief indexes a task again, its timeout is recorded if it starts anew,
+/// the caller holds the exclusive lease
+////////////////////////////////////////////////////////////////////////////////
+
+      void updateIndex (TaskType type, int position);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief rebuilds the task index, the caller holds the exclusive lease or
+/// is the only thread using the state
+////////////////////////////////////////////////////////////////////////////////
+
+      void rebuildIndex ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief calls the wakeup listener, the caller does not hold _lock
+////////////////////////////////////////////////////////////////////////////////
+
+      void wakeupListener ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief persists the state right away, the caller holds the exclusive
+/// lease
+////////////////////////////////////////////////////////////////////////////////
+
+      void flush ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief main loop of the persister thread
+////////////////////////////////////////////////////////////////////////////////
+
+      void persister ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief writes a copy of the state with the given version, unless a
+/// newer one has already been written, the caller holds _persistLock
+////////////////////////////////////////////////////////////////////////////////
+
+      void persist (State const& state, uint64_t version);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief writes the changed shards of the state and a new manifest,
+/// waits until they are stored and then truncates the journal, returns
+/// false if the state could not be stored
+////////////////////////////////////////////////////////////////////////////////
+
+      bool storeSnapshot (State const& state);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief loads the state from the manifest and its shards, returns false
+/// if there is no manifest
+////////////////////////////////////////////////////////////////////////////////
+
+      bool loadShards (std::set<std::string> const& names);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks the stored targets against the command line, exits if
+/// they cannot be used
+////////////////////////////////////////////////////////////////////////////////
+
+      void verifyTargets ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief loads the state stored in one variable by older versions,
+/// returns false if there is none
+////////////////////////////////////////////////////////////////////////////////
+
+      bool loadLegacy ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief appends the difference to the last persisted state to the
+/// journal, falls back to a snapshot if the journal is full
+////////////////////////////////////////////////////////////////////////////////
+
+      void storeDelta (State const& state);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief removes all journal entries which are contained in the snapshot
+////////////////////////////////////////////////////////////////////////////////
+
+      void truncateJournal ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief blocks until an exclusive lease can be granted
+////////////////////////////////////////////////////////////////////////////////
+
+      void acquireWrite ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief gives back an exclusive lease
+////////////////////////////////////////////////////////////////////////////////
+
+      void releaseWrite ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief blocks until a shared lease can be granted
+////////////////////////////////////////////////////////////////////////////////
+
+      void acquireRead ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief gives back a shared lease
+////////////////////////////////////////////////////////////////////////////////
+
+      void releaseRead ();
 
 // -----------------------------------------------------------------------------
 // --SECTION--                                                 private variables
@@ -248,17 +649,179 @@ namespace arangodb {
       State _state;
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief flag, whether or not the state is leased out
+/// @brief latest snapshot of the state, only accessed atomically
+////////////////////////////////////////////////////////////////////////////////
+
+      std::shared_ptr<Snapshot const> _snapshot;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief indexes over the tasks of the state, protected by the lease
+////////////////////////////////////////////////////////////////////////////////
+
+      TaskIndex _index;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the state as it was last handed to the store, deltas are
+/// computed against it, this and the journal are protected by _persistLock
+////////////////////////////////////////////////////////////////////////////////
+
+      State _persisted;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief _persisted serialized, empty until persist() needs it
+////////////////////////////////////////////////////////////////////////////////
+
+      std::string _persistedBytes;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sequence number of the last delta written to the journal
+////////////////////////////////////////////////////////////////////////////////
+
+      uint64_t _journalSequence;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief number and total size of deltas since the last snapshot
+////////////////////////////////////////////////////////////////////////////////
+
+      size_t _journalDeltas;
+
+      size_t _journalBytes;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief names of the journal variables not yet removed
+////////////////////////////////////////////////////////////////////////////////
+
+      std::set<std::string> _journalNames;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief flag, whether the next save must write a snapshot, this is the
+/// case before the first snapshot and after a journal entry got lost
+////////////////////////////////////////////////////////////////////////////////
+
+      bool _snapshotNeeded;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the manifest of the stored snapshot and the uncompressed contents
+/// of its shards, protected by _persistLock
+////////////////////////////////////////////////////////////////////////////////
+
+      StateManifest _manifest;
+
+      std::map<std::string, std::string> _storedShards;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief flag, whether the state is still stored in the old layout as
+/// well, which is removed once the first snapshot has been written
+////////////////////////////////////////////////////////////////////////////////
+
+      bool _legacyLayout;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief flag, whether shards no longer referenced by the manifest may be
+/// stored, which are removed once the next snapshot has been written
+////////////////////////////////////////////////////////////////////////////////
+
+      bool _strayShards;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief serializes all writes to the state storage
+////////////////////////////////////////////////////////////////////////////////
+
+      std::mutex _persistLock;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief version of the state, incremented with every change, the
+/// version of the latest snapshot and the last version which has been
+/// written, all protected by _lock
+////////////////////////////////////////////////////////////////////////////////
+
+      uint64_t _dirtyVersion;
+
+      uint64_t _publishedVersion;
+
+      uint64_t _persistedVersion;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the thread in a cycle, see beginCycle, protected by _lock
+////////////////////////////////////////////////////////////////////////////////
+
+      std::thread::id _cycleThread;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief tasks whose timeouts started anew, and whether the index has
+/// been rebuilt, since the last takeTimedTasks, protected by _lock
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<TimedTask> _timedTasks;
+
+      bool _timedTasksLost;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief see setWakeupListener, protected by _lock
+////////////////////////////////////////////////////////////////////////////////
+
+      std::function<void()> _wakeupListener;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the persister thread
+////////////////////////////////////////////////////////////////////////////////
+
+      std::thread* _persisterThread;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief flag, whether the persister thread should terminate
+////////////////////////////////////////////////////////////////////////////////
+
+      bool _stopPersister;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief signalled whenever the state has changed or the persister
+/// should terminate
+////////////////////////////////////////////////////////////////////////////////
+
+      std::condition_variable _persistRequested;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief flag, whether or not the state is leased out exclusively
 ////////////////////////////////////////////////////////////////////////////////
 
       bool _isLeased;
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief number of shared leases currently held
+////////////////////////////////////////////////////////////////////////////////
+
+      int _readLeases;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief number of threads waiting for an exclusive lease, readers
+/// queue up behind them so that writers cannot starve
+////////////////////////////////////////////////////////////////////////////////
+
+      int _writersWaiting;
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief mutex for state
 ////////////////////////////////////////////////////////////////////////////////
 
       std::mutex _lock;
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief signalled whenever a lease is given back
+////////////////////////////////////////////////////////////////////////////////
+
+      std::condition_variable _leaseReleased;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief waiting statistics, protected by _lock
+////////////////////////////////////////////////////////////////////////////////
+
+      LeaseStatistics _readStatistics;
+
+      LeaseStatistics _writeStatistics;
+
+      PersistenceStatistics _persistenceStatistics;
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief the proxy config filename
 ////////////////////////////////////////////////////////////////////////////////
@@ -266,10 +829,22 @@ namespace arangodb {
       std::string _proxyConfFilename;
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief list of all coordinators for haproxy
+/// @brief list of all coordinators for the reverse proxy
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<ProxyBackend> _coordinatorHAProxyList;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief protects the proxy slots and config
+////////////////////////////////////////////////////////////////////////////////
+
+      std::mutex _proxyLock;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief slots of the haproxy backend
 ////////////////////////////////////////////////////////////////////////////////
 
-      std::string _coordinatorHAProxyList;
+      ProxyBackends _proxyBackends;
 
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief proxy pid
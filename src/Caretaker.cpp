@@ -48,62 +48,59 @@ using namespace std;
 // --SECTION--                                                 private functions
 // -----------------------------------------------------------------------------
 
-////////////////////////////////////////////////////////////////////////////////
-/// @brief checks the number of ports, if the given role is empty, all ports
-/// in the offer are taken, otherwise, only ports with that role are counted.
-////////////////////////////////////////////////////////////////////////////////
-
-static bool checkPorts (size_t numberOfPorts, const mesos::Offer& offer,
-                        std::string const& role) {
-  if (numberPorts(offer, role) < numberOfPorts) {
-    return false;
-  }
-
-  return true;
-}
-
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief checks if the minimum resources are satisfied
 /// the offer as well as the minimum resources are
 /// flattened to our role before the comparison and ports for all roles
 /// in the offer are counted. 
 /// For the ports we do not care about reservations, we simply see whether
-/// any ports for our role or "*" are included in the offer.
+/// any ports for our role or "*" are included in the offer. If the offer
+/// is not suitable, reason tells what it lacks.
 ////////////////////////////////////////////////////////////////////////////////
 
-static bool isSuitableOffer (Target const& target,
-                             mesos::Offer const& offer) {
+static bool isSuitableOffer (TargetMatcher const& matcher,
+                             mesos::Offer const& offer,
+                             OfferSummary const& summary,
+                             DeclineReason& reason) {
   // Note that we do not care whether or not ports are reserved for us
   // or are role "*".
-  std::string offerString;
-  if (! checkPorts(target.number_ports(), offer, "" )) {
-    pbjson::pb2json(&offer, offerString);
+  if (summary._ports < matcher.ports()) {
     LOG(INFO) 
     << "DEBUG isSuitableOffer: "
     << "offer " << offer.id().value() << " does not have " 
-    << target.number_ports() << " ports"
-    << "\noffer: " << offerString;
+    << matcher.ports() << " ports";
+    reason = DeclineReason::NO_PORTS;
     return false;
   }
 
-  // Never need to flatten the offered resources, since we use find:
-  mesos::Resources offered = offer.resources();
+  // Most offers which are too small are already rejected by their totals,
+  // only for the others we look at the single resources:
+  if (! matcher.mightFit(summary)) {
+    LOG(INFO) 
+    << "DEBUG isSuitableOffer: "
+    << "offer " << offer.id().value() << " does not have " 
+    << "minimal resource requirements " << matcher.minimum();
+    reason = DeclineReason::NO_RESOURCES;
+    return false;
+  }
 
-  // Always flatten the minimal resources with our role, because find is 
+  // Never need to flatten the offered resources, since we use find, the
+  // minimal resources are flattened with our role, because find is 
   // flexible:
-  mesos::Resources minimum = target.minimal_resources();
-  minimum = minimum.flatten(Global::role());
+  mesos::Resources offered = offer.resources();
 
-  Option<mesos::Resources> found = offered.find(minimum);
+  Option<mesos::Resources> found = offered.find(matcher.minimum());
   if (! found.isSome()) {
+    std::string offerString;
     pbjson::pb2json(&offer, offerString);
      
     LOG(INFO) 
     << "DEBUG isSuitableOffer: "
     << "offer " << offer.id().value() << " does not have " 
-    << "minimal resource requirements " << minimum
+    << "minimal resource requirements " << matcher.minimum()
     << "\noffer: " << offerString;
 
+    reason = DeclineReason::NO_RESOURCES;
     return false;
   }
   return true;
@@ -114,18 +111,20 @@ static bool isSuitableOffer (Target const& target,
 ////////////////////////////////////////////////////////////////////////////////
 
 static bool isSuitableReservedOffer (mesos::Offer const& offer,
-                                     Target const& target,
+                                     OfferSummary const& summary,
+                                     TargetMatcher const& matcher,
                                      mesos::Resources& toMakePersistent) {
   // mop: this will check the ports
-  if (!isSuitableOffer(target, offer)) {
+  DeclineReason reason;
+
+  if (!isSuitableOffer(matcher, offer, summary, reason)) {
     return false;
   }
 
   // mop: now we check our reserved resources (role dependent)
   mesos::Resources offered = offer.resources();
   mesos::Resources reserved = offered.reserved(Global::role());
-  mesos::Resources required = target.minimal_resources();
-  required = required.flatten(Global::role());
+  mesos::Resources const& required = matcher.minimum();
 
   LOG(INFO) << "Reserved: " << reserved;
   LOG(INFO) << "Target: " << required;
@@ -140,104 +139,18 @@ static bool isSuitableReservedOffer (mesos::Offer const& offer,
   return result;
 }
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief finds free ports from a ranges
-///////////////////////////////////////////////////////////////////////////////
-
-static void findFreePortsFromRange (mesos::Resources& result,
-                                    vector<mesos::Value::Range> const& ranges,
-                                    vector<bool> const& isDynRes,
-                                    bool reserved,
-                                    size_t& found,
-                                    size_t len) {
-  for (size_t rangeChoice = 0; rangeChoice < ranges.size(); rangeChoice++) {
-
-    const auto& resource = ranges.at(rangeChoice);
-
-    for (uint32_t port = resource.begin(); port <= resource.end(); port++) {
-      if (found >= len) {
-        return;
-      }
-      mesos::Resource onePort;
-      onePort.set_name("ports");
-      onePort.set_type(mesos::Value::RANGES);
-      auto* r = onePort.mutable_ranges()->add_range();
-      r->set_begin(port);
-      r->set_end(port);
-      if (! reserved) {
-        onePort.set_role("*");
-      }
-      else {
-        onePort.set_role(Global::role());
-        if (isDynRes[rangeChoice]) {
-          onePort.mutable_reservation()->CopyFrom(Global::createReservation());
-        }
-      }
-      result += onePort;
-      found++;
-    }
-  }
-}
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief finds free ports from an offer
-///////////////////////////////////////////////////////////////////////////////
-
-static mesos::Resources findFreePorts (const mesos::Offer& offer, size_t len) {
-  vector<mesos::Value::Range> resources;
-  vector<mesos::Value::Range> reserved;
-  vector<bool>                isDynamicallyReserved;
-
-  for (int i = 0; i < offer.resources_size(); ++i) {
-    const auto& resource = offer.resources(i);
-
-    if (resource.name() == "ports" && resource.type() == mesos::Value::RANGES) {
-      const auto& ranges = resource.ranges();
-
-      for (int j = 0; j < ranges.range_size(); ++j) {
-        const auto& range = ranges.range(j);
-
-        // reserved resources: they must either be statically or
-        // dynamically with matching principal
-        if (mesos::Resources::isReserved(resource, Option<std::string>())) {
-          if (mesos::Resources::isDynamicallyReserved(resource)) {
-            if (resource.reservation().principal() == Global::principal()) {
-              reserved.push_back(range);
-              isDynamicallyReserved.push_back(true);
-            }
-          }
-          else {
-            reserved.push_back(range);
-            isDynamicallyReserved.push_back(false);
-          }
-        }
-
-        // unreserved
-        else if (mesos::Resources::isUnreserved(resource)) {
-          resources.push_back(range);
-        }
-      }
-    }
-  }
-
-  mesos::Resources result;
-  size_t found = 0;
-  findFreePortsFromRange(result, reserved, isDynamicallyReserved, true, 
-                         found, len);
-  findFreePortsFromRange(result, resources, isDynamicallyReserved, false, 
-                         found, len);
-
-  return result;
-}
-
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief resources required for the start of an ephemeral task
 ////////////////////////////////////////////////////////////////////////////////
 
-static mesos::Resources resourcesForStartEphemeral (mesos::Offer const& offer,
-                                                    Target const& target) {
+static mesos::Resources resourcesForStartEphemeral (
+                                    mesos::Offer const& offer,
+                                    TargetMatcher const& matcher,
+                                    PortAllocator const& ports,
+                                    TaskPlan const& task,
+                                    TaskCurrent const& taskCur) {
   mesos::Resources offered = offer.resources();
-  mesos::Resources minimum = target.minimal_resources();
+  mesos::Resources minimum = matcher.target().minimal_resources();
   
   // We know that the minimal resources fit into the offered resources,
   // when we ignore roles. We now have to grab as much as the minimal 
@@ -261,7 +174,7 @@ static mesos::Resources resourcesForStartEphemeral (mesos::Offer const& offer,
   // toUse will be empty, when it does not fit, we will run into an error later.
 
   // Add ports with the role we actually found in the resource offer:
-  toUse += findFreePorts(offer, target.number_ports());
+  toUse += ports.allocate(offer, matcher.ports(), task, taskCur);
 
   // TODO(fc) check if we could use additional resources
 
@@ -274,22 +187,24 @@ static mesos::Resources resourcesForStartEphemeral (mesos::Offer const& offer,
 
 static mesos::Resources resourcesForRequestReservation (
                                     mesos::Offer const& offer,
-                                    Target const& target) {
+                                    TargetMatcher const& matcher,
+                                    PortAllocator const& allocator,
+                                    TaskPlan const& task,
+                                    TaskCurrent const& taskCur) {
   mesos::Resources offered = offer.resources();
-  mesos::Resources minimum = target.minimal_resources();
+  mesos::Resources const& minimum = matcher.minimum();
   
   // We know that the minimal resources fit into the offered resources,
   // when we ignore roles. We now have to reserve that part of the 
   // resources with role "*" that is necessary to have all of the minimal
   // resources with our role.
-  minimum = minimum.flatten(Global::role());
   mesos::Resources roleSpecificPart 
       = arangodb::intersectResources(offered, minimum);
   mesos::Resources defaultPart = minimum - roleSpecificPart;
   defaultPart = defaultPart.flatten(Global::role(), Global::createReservation());
 
   // Now add a port reservation:
-  mesos::Resources ports = findFreePorts(offer, 1);
+  mesos::Resources ports = allocator.allocate(offer, 1, task, taskCur);
   ports = ports.flatten(Global::role(), Global::createReservation());
   defaultPart += ports;
 
@@ -304,7 +219,10 @@ static mesos::Resources resourcesForRequestReservation (
 
 static mesos::Resources suitablePersistent (string const& name,
                                             mesos::Offer const& offer,
-                                            Target const& target,
+                                            TargetMatcher const& matcher,
+                                            PortAllocator const& ports,
+                                            TaskPlan const& task,
+                                            TaskCurrent const& taskCur,
                                             string const& persistenceId,
                                             string& containerPath) {
 
@@ -321,10 +239,8 @@ static mesos::Resources suitablePersistent (string const& name,
   mesos::Resources offeredDisk = filterIsDisk(offered);
   offered = filterNotIsDisk(offered);
 
-  mesos::Resources minimum = target.minimal_resources();
-  minimum = minimum.flatten(Global::role());
-  mesos::Resources minimumDisk = filterIsDisk(minimum);
-  minimum = filterNotIsDisk(minimum);
+  mesos::Resources const& minimum = matcher.minimumNotDisk();
+  mesos::Resources const& minimumDisk = matcher.minimumDisk();
 
   Option<mesos::Resources> toUseOpt = offered.find(minimum);
   if (! toUseOpt.isSome()) {
@@ -340,7 +256,7 @@ static mesos::Resources suitablePersistent (string const& name,
   mesos::Resources toUse = toUseOpt.get();
 
   // Now look at the disk resources:
-  size_t mds = diskspace(minimumDisk);
+  size_t mds = matcher.disk();
 
   bool found = false;
 
@@ -384,7 +300,7 @@ static mesos::Resources suitablePersistent (string const& name,
   }
 
   // Add ports with the role we actually found in the resource offer:
-  toUse += findFreePorts(offer, target.number_ports());
+  toUse += ports.allocate(offer, matcher.ports(), task, taskCur);
 
   LOG(INFO)
   << "DEBUG suitablePersistent(" << name << "): SUCCESS";
@@ -396,10 +312,13 @@ static mesos::Resources suitablePersistent (string const& name,
 /// @brief helper to get rid of an offer
 ////////////////////////////////////////////////////////////////////////////////
 
-static bool notInterested (mesos::Offer const& offer, bool doDecline) {
+static bool notInterested (mesos::Offer const& offer, bool doDecline,
+                           DeclineReason reason = DeclineReason::NOT_NEEDED) {
   if (doDecline) {
-    LOG(INFO) << "Declining offer " << offer.id().value();
-    Global::scheduler().declineOffer(offer.id());
+    LOG(INFO)
+    << "Declining offer " << offer.id().value()
+    << " (" << declineReasonName(reason) << ")";
+    Global::scheduler().declineOffer(offer.id(), reason);
     return true;
   }
   else {
@@ -407,47 +326,6 @@ static bool notInterested (mesos::Offer const& offer, bool doDecline) {
   }
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/// @brief do IP address lookup
-////////////////////////////////////////////////////////////////////////////////
-
-static string getIPAddress (string hostname) {
-  struct addrinfo hints;
-  struct addrinfo* ai;
-  hints.ai_family = AF_INET;
-  hints.ai_socktype = SOCK_STREAM;
-  hints.ai_protocol = 0;
-  hints.ai_flags = AI_ADDRCONFIG;
-  int res = getaddrinfo(hostname.c_str(), nullptr, &hints, &ai);
-
-  if (res != 0) {
-    LOG(WARNING) << "Alarm: res=" << res;
-    return hostname;
-  }
-
-  struct addrinfo* b = ai;
-  std::string result = hostname;
-
-  while (b != nullptr) {
-    auto q = reinterpret_cast<struct sockaddr_in*>(ai->ai_addr);
-    char buffer[INET_ADDRSTRLEN+5];
-    char const* p = inet_ntop(AF_INET, &q->sin_addr, buffer, sizeof(buffer));
-
-    if (p != nullptr) {
-      if (p[0] != '1' || p[1] != '2' || p[2] != '7') {
-        result = p;
-      }
-    }
-    else {
-      LOG(WARNING) << "error in inet_ntop";
-    }
-
-    b = b->ai_next;
-  }
-
-  return result;
-}
-
 static bool allEndpointsAvailable(google::protobuf::RepeatedPtrField<arangodb::TaskCurrent> const& tasks) {
   for (const auto &task : tasks) {
     if (task.ports().size() == 0) {
@@ -503,22 +381,16 @@ static std::string arangoDBImageName() {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief starts a new arangodb task
+/// @brief builds the task info an arangodb task is launched with, everything
+/// but the resources, which are not kept once the task is running
 ////////////////////////////////////////////////////////////////////////////////
 
-static void startArangoDBTask (ArangoState::Lease& lease,
-                               TaskType taskType, int pos,
-                               TaskPlan const& task,
-                               TaskCurrent const& info) {
-  
-  LOG(INFO) << "Starting number " << pos;
-  string taskId = UUID::random().toString();
-
-  if (info.ports_size() != 1) {
-    LOG(WARNING)
-    << "expected one port, got " << info.ports_size();
-    return;
-  }
+static mesos::TaskInfo launchTemplate (State const& state,
+                                       TaskType taskType, int pos,
+                                       TaskPlan const& task,
+                                       TaskCurrent const& info,
+                                       string const& taskId,
+                                       bool withVolume) {
 
   // use docker to run the task
   mesos::ContainerInfo container;
@@ -542,8 +414,6 @@ static void startArangoDBTask (ArangoState::Lease& lease,
   mesos::Environment::Variable* roleEnv = environment.add_variables();
   roleEnv->set_name("CLUSTER_ROLE");
 
-  auto& state = lease.state();
-
   switch (taskType) {
     case TaskType::AGENT: {
         roleEnv->set_value("agency");
@@ -596,9 +466,6 @@ static void startArangoDBTask (ArangoState::Lease& lease,
 
   switch (taskType) {
     case TaskType::AGENT: {
-      auto current = state.current();
-      auto plan = state.plan();
-
       // mop: must keep this flag because up to 3.1.8 the entrypoint expects
       // this to be present even though it is not used
       // remove for 3.2
@@ -608,7 +475,7 @@ static void startArangoDBTask (ArangoState::Lease& lease,
 
       auto agencySize = environment.add_variables();
       agencySize->set_name("AGENCY_SIZE");
-      agencySize->set_value(std::to_string(plan.agents().entries().size()));
+      agencySize->set_value(std::to_string(state.plan().agents().entries().size()));
 
       auto endpoints = environment.add_variables();
       endpoints->set_name("AGENCY_ENDPOINTS");
@@ -623,11 +490,9 @@ static void startArangoDBTask (ArangoState::Lease& lease,
     case TaskType::COORDINATOR: {
       // mop: standalone will simply execute the image in default mode
       if (Global::mode() != OperationMode::STANDALONE) {
-        auto agents = state.current().agents();
-
         auto agencyEndpoints = environment.add_variables();
         agencyEndpoints->set_name("AGENCY_ENDPOINTS");
-        agencyEndpoints->set_value(getEndpointsList(agents.entries()));
+        agencyEndpoints->set_value(getEndpointsList(state.current().agents().entries()));
       }
 
       if (taskType == TaskType::PRIMARY_DBSERVER) {
@@ -670,72 +535,113 @@ static void startArangoDBTask (ArangoState::Lease& lease,
   mesos::ContainerInfo::DockerInfo::PortMapping* mapping = docker->add_port_mappings();
   mapping->set_host_port(info.ports(0));
   mapping->set_container_port(8529);
-
-  if (taskType == TaskType::UNKNOWN) {
-    assert(false);
-  }
   mapping->set_protocol("tcp");
 
   // volume
-  mesos::Resources res = info.resources();
-  res = arangodb::filterIsDisk(res);
-  const mesos::Resource& disk = *(res.begin());
-  if (disk.has_disk() && disk.disk().has_volume()) {
+  if (withVolume) {
     mesos::Volume* volume = container.add_volumes();
     volume->set_container_path("/var/lib/arangodb3");
     volume->set_host_path("myPersistentVolume");
     volume->set_mode(mesos::Volume::RW);
   }
 
-  mesos::TaskID tid;
-  tid.set_value(taskId);
-
-  Global::caretaker().setTaskId(lease, taskType, pos, tid);
-
-  // and start
-  mesos::TaskInfo taskInfo = Global::scheduler().startInstance(
-    taskId,
-    myName,
-    info,
-    container,
-    command);
+  mesos::TaskInfo taskInfo;
+
+  taskInfo.set_name(myName);
+  taskInfo.mutable_task_id()->set_value(taskId);
+  taskInfo.mutable_slave_id()->CopyFrom(info.slave_id());
+  taskInfo.mutable_container()->CopyFrom(container);
+  taskInfo.mutable_command()->CopyFrom(command);
+
+  mesos::DiscoveryInfo di;
+  di.set_visibility(mesos::DiscoveryInfo::CLUSTER);
+  string lower = myName;
+  std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+  di.set_name(lower);
+  mesos::Ports po;
+  auto port = po.add_ports();
+  port->set_number(info.ports(0));
+  port->set_name("ArangoDB");
+  port->set_protocol("tcp");
+  di.mutable_ports()->CopyFrom(po);
+  taskInfo.mutable_discovery()->CopyFrom(di);
+
+  return taskInfo;
+}
 
-  Global::manager().registerNewTask(taskId, taskType, pos);
+////////////////////////////////////////////////////////////////////////////////
+/// @brief what is done with an offer before a task is launched with it
+////////////////////////////////////////////////////////////////////////////////
 
-  Global::caretaker().setTaskInfo(lease, taskType, pos, taskInfo);
-}
+struct OfferPreparation {
+  mesos::Resources _reservation;
+  mesos::Resources _volumes;
+};
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief request to make offer persistent
+/// @brief starts a new arangodb task, if preparation is given, the
+/// reservation and the volumes are requested together with the launch
 ////////////////////////////////////////////////////////////////////////////////
 
-static bool requestPersistent (string const& upper,
-                               mesos::Offer const& offer,
-                               Target const& target,
-                               TaskPlan* task,
-                               TaskCurrent* taskCur,
-                               bool doDecline,
-                               TaskType taskType,
-                               int pos) {
-  mesos::Resources resources;
+static void startArangoDBTask (ArangoState::Lease& lease,
+                               TaskType taskType, int pos,
+                               TaskPlan const& task,
+                               TaskCurrent const& info,
+                               mesos::Resources const& resources,
+                               OfferPreparation const* preparation) {
+  
+  LOG(INFO) << "Starting number " << pos;
+  string taskId = UUID::random().toString();
 
-  if (! isSuitableReservedOffer(offer, target, resources)) {
-    return notInterested(offer, doDecline);
+  if (info.ports_size() != 1) {
+    LOG(WARNING)
+    << "expected one port, got " << info.ports_size();
+    return;
   }
 
-  double now = chrono::duration_cast<chrono::seconds>(
-    chrono::steady_clock::now().time_since_epoch()).count();
+  if (taskType == TaskType::UNKNOWN) {
+    assert(false);
+  }
 
-  string persistentId = upper + "_" + UUID::random().toString();
+  // volume
+  mesos::Resources disks = arangodb::filterIsDisk(resources);
+  bool withVolume = false;
 
-  task->set_state(TASK_STATE_TRYING_TO_PERSIST);
-  task->set_timestamp(now);
-  task->set_persistence_id(persistentId);
+  if (! disks.empty()) {
+    const mesos::Resource& disk = *(disks.begin());
+    withVolume = disk.has_disk() && disk.disk().has_volume();
+  }
 
-  taskCur->mutable_offer_id()->CopyFrom(offer.id());
+  mesos::TaskInfo taskInfo = launchTemplate(
+    lease.state(), taskType, pos, task, info, taskId, withVolume);
 
-  // resources is a single disk resource with our role and principal
-  mesos::Resource disk = *resources.begin();
+  string hash = Caretaker::launchHash(taskInfo);
+
+  taskInfo.mutable_resources()->CopyFrom(resources);
+
+  mesos::TaskID tid;
+  tid.set_value(taskId);
+
+  Global::caretaker().setTaskId(lease, taskType, pos, tid);
+  Global::caretaker().setLaunchHash(lease, taskType, pos, hash);
+
+  // and start, the task id is persisted before the batch is accepted
+  if (preparation == nullptr) {
+    Global::scheduler().startInstance(info.offer_id(), taskInfo);
+  }
+  else {
+    Global::scheduler().startPersistentInstance(
+      info.offer_id(), preparation->_reservation, preparation->_volumes,
+      taskInfo);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief turns a reserved disk into a persistent volume
+////////////////////////////////////////////////////////////////////////////////
+
+static mesos::Resources persistentVolume (mesos::Resource disk,
+                                          string const& persistentId) {
   mesos::Resource::DiskInfo diskInfo;
   diskInfo.mutable_persistence()->set_id(persistentId);
   diskInfo.mutable_persistence()->set_principal(Global::principal());
@@ -750,64 +656,54 @@ static bool requestPersistent (string const& upper,
   mesos::Resources persistent;
   persistent += disk;
 
-  LOG(INFO)
-  << "DEBUG requestPersistent(" << upper << "): "
-  << "trying to make " << offer.id().value()
-  << " persistent for " << persistent;
-
-  // Store for later:
-  taskCur->mutable_resources()->CopyFrom(persistent);
-
-  Global::scheduler().makePersistent(offer, persistent);
-
-  return true;  // Offer was used
+  return persistent;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief request to make a reservation
+/// @brief request to make offer persistent
 ////////////////////////////////////////////////////////////////////////////////
 
-static bool requestReservation (std::string const& upper,
-                                mesos::Offer const& offer,
-                                Target const& target,
-                                TaskPlan* task,
-                                TaskCurrent* taskCur,
-                                bool doDecline,
-                                TaskType taskType,
-                                int pos) {
-  mesos::Resources resources
-        = resourcesForRequestReservation(offer, target);
+static bool requestPersistent (ArangoState::Lease& lease,
+                               string const& upper,
+                               mesos::Offer const& offer,
+                               OfferSummary const& summary,
+                               TargetMatcher const& matcher,
+                               TaskPlan* task,
+                               TaskCurrent* taskCur,
+                               bool doDecline,
+                               TaskType taskType,
+                               int pos) {
+  mesos::Resources resources;
 
-  if (resources.empty()) {
-    // We have everything needed reserved for our role, so we can
-    // directly move on to the persistent volume:
-    return requestPersistent(upper, offer, target, task, taskCur, doDecline,
-                             taskType, pos);
+  if (! isSuitableReservedOffer(offer, summary, matcher, resources)) {
+    return notInterested(offer, doDecline);
   }
 
-  // First update our own state with the intention of making 
-  // a dynamic reservation:
-  double now = chrono::duration_cast<chrono::seconds>(
+  double now = chrono::duration<double>(
     chrono::steady_clock::now().time_since_epoch()).count();
 
-  task->set_state(TASK_STATE_TRYING_TO_RESERVE);
+  string persistentId = upper + "_" + UUID::random().toString();
+
+  task->set_state(TASK_STATE_TRYING_TO_PERSIST);
   task->set_timestamp(now);
+  task->set_persistence_id(persistentId);
 
-  taskCur->mutable_slave_id()->CopyFrom(offer.slave_id());
   taskCur->mutable_offer_id()->CopyFrom(offer.id());
-  taskCur->mutable_resources()->CopyFrom(resources);
-  taskCur->set_hostname(offer.hostname());
+  lease.update(taskType, pos);
+  lease.changed();
 
-  taskCur->clear_ports();
+  // resources is a single disk resource with our role and principal
+  mesos::Resources persistent
+    = persistentVolume(*resources.begin(), persistentId);
 
-  // Now use the scheduler to actually try to make the dynamic reservation:
   LOG(INFO)
-  << "DEBUG requestReservation: "
-  << "trying to reserve " << offer.id().value()
-  << " with " << resources;
+  << "DEBUG requestPersistent(" << upper << "): "
+  << "trying to make " << offer.id().value()
+  << " persistent for " << persistent;
 
-  Global::scheduler().reserveDynamically(offer, resources);
-  return true;  // offer was used
+  Global::scheduler().makePersistent(offer, persistent);
+
+  return true;  // Offer was used
 }
 
 static bool startWithResources(ArangoState::Lease& lease,
@@ -817,53 +713,74 @@ static bool startWithResources(ArangoState::Lease& lease,
                                TaskType taskType,
                                int pos,
                                TaskPlan* task,
-                               TaskCurrent* taskCur) {
+                               TaskCurrent* taskCur,
+                               OfferPreparation const* preparation = nullptr) {
   if (! resources.empty()) {
-    double now = chrono::duration_cast<chrono::seconds>(
-      chrono::steady_clock::now().time_since_epoch()).count();
-
-    task->set_state(state);
-    task->set_timestamp(now);
-
-    taskCur->set_hostname(offer.hostname());
-    taskCur->mutable_slave_id()->CopyFrom(offer.slave_id());
-    taskCur->mutable_offer_id()->CopyFrom(offer.id());
-    taskCur->mutable_resources()->CopyFrom(resources);
-    
-    TaskCurrent oldTask;
-    oldTask.CopyFrom(*taskCur);
-    size_t oldPortsSize = oldTask.ports_size();
-
-    std::vector<uint64_t> ports;
+    std::vector<uint32_t> offered;
     for (auto& res : resources) {
       if (res.name() == "ports" && res.type() == mesos::Value::RANGES) {
         auto const& ranges = res.ranges();
         for (int r = 0; r < ranges.range_size(); r++) {
           for (uint64_t i = ranges.range(r).begin();
                i <= ranges.range(r).end(); i++) {
-            // mop: megaspecial case...we are restarting the cluster...as we hardcode the ports in some places
-            // we must absolutely make sure that the port we got is the same as before
-            if (state == TASK_STATE_TRYING_TO_RESTART
-                && taskType == TaskType::AGENT) {
-              if (oldPortsSize > i && oldTask.ports(i) != i) {
-                return false;
-              }
-            }
-            ports.emplace_back(i);
+            offered.emplace_back(i);
           }
         }
       }
     }
 
+    // The previous ports keep their place, such that the endpoints of the
+    // task stay the same. An agent is only restarted with the ports it had
+    // before, as the others know it by them:
+    std::vector<uint32_t> ports;
+    for (auto port : taskCur->ports()) {
+      if (find(offered.begin(), offered.end(), port) != offered.end()) {
+        ports.emplace_back(port);
+      }
+      else if (state == TASK_STATE_TRYING_TO_RESTART
+               && taskType == TaskType::AGENT) {
+        LOG(INFO)
+        << "cannot restart " << task->name() << " without its port " << port;
+        return false;
+      }
+    }
+
+    for (auto port : offered) {
+      if (find(ports.begin(), ports.end(), port) == ports.end()) {
+        ports.emplace_back(port);
+      }
+    }
+
+    double now = chrono::duration<double>(
+      chrono::steady_clock::now().time_since_epoch()).count();
+
+    task->set_state(state);
+    task->set_timestamp(now);
+
+    taskCur->set_hostname(offer.hostname());
+    taskCur->mutable_slave_id()->CopyFrom(offer.slave_id());
+    taskCur->mutable_offer_id()->CopyFrom(offer.id());
+
     taskCur->clear_ports();
     for (auto& port: ports) {
       taskCur->add_ports(port);
     }
 
+    if (preparation == nullptr) {
+      taskCur->clear_single_offer();
+    }
+    else {
+      taskCur->set_single_offer(true);
+    }
+
+    lease.update(taskType, pos);
+    lease.changed();
+
     LOG(INFO) << "Trying to start(" << state << ") with resources:\n"
               << resources;
 
-    startArangoDBTask(lease, taskType, pos, *task, *taskCur);
+    startArangoDBTask(lease, taskType, pos, *task, *taskCur, resources,
+                      preparation);
 
     return true;  // offer was used
   }
@@ -871,31 +788,178 @@ static bool startWithResources(ArangoState::Lease& lease,
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief request to start with persistent volume
+/// @brief request to reserve, to create the volume and to start with a
+/// single offer, returns false if the offer cannot be used like this, the
+/// caller then falls back to doing it step by step with an offer each
 ////////////////////////////////////////////////////////////////////////////////
 
-static bool requestStartPersistent (ArangoState::Lease& lease,
-                                    string const& upper,
-                                    mesos::Offer const& offer,
-                                    Target const& target,
-                                    TaskPlan* task,
-                                    TaskCurrent* taskCur,
-                                    bool doDecline,
-                                    TaskType taskType,
-                                    int pos) {
-  string persistenceId = task->persistence_id();
-  string containerPath;
+static bool requestSingleOffer (ArangoState::Lease& lease,
+                                string const& upper,
+                                mesos::Offer const& offer,
+                                OfferSummary const& summary,
+                                TargetMatcher const& matcher,
+                                PortAllocator const& ports,
+                                mesos::Resources const& reservation,
+                                TaskPlan* task,
+                                TaskCurrent* taskCur,
+                                TaskType taskType,
+                                int pos) {
 
-  mesos::Resources resources = suitablePersistent(
-    upper, offer, target, persistenceId, containerPath);
-  taskCur->set_container_path(containerPath);
+  // The operations are applied one after the other, so we work out how
+  // the offer looks after the reservation and after the creation of the
+  // volume, and pick the resources to launch with from the latter, as
+  // the next offers would have them in the step by step way:
+  mesos::Resources offered = offer.resources();
+  mesos::Resources unreserved = reservation.flatten();
 
-  if (startWithResources(lease, resources, offer, TASK_STATE_TRYING_TO_START, taskType, pos, task, taskCur)) {
-    return true;
-  } else {
-    return notInterested(offer, doDecline);
+  if (! offered.contains(unreserved)) {
+    return false;
   }
-}                                  
+
+  offered -= unreserved;
+  offered += reservation;
+
+  mesos::Offer prepared;
+  prepared.CopyFrom(offer);
+  prepared.mutable_resources()->CopyFrom(offered);
+
+  mesos::Resources disks;
+
+  // reserving and creating a volume keeps the totals of the offer
+  if (! isSuitableReservedOffer(prepared, summary, matcher, disks) ||
+      disks.empty()) {
+    return false;
+  }
+
+  mesos::Resource const& disk = *disks.begin();
+
+  if (disk.has_disk() && disk.disk().has_persistence()) {
+    return false;
+  }
+
+  string persistentId = upper + "_" + UUID::random().toString();
+  mesos::Resources volumes = persistentVolume(disk, persistentId);
+
+  offered -= disk;
+  offered += volumes;
+  prepared.mutable_resources()->CopyFrom(offered);
+
+  string containerPath;
+  mesos::Resources resources = suitablePersistent(
+    upper, prepared, matcher, ports, *task, *taskCur, persistentId,
+    containerPath);
+
+  if (resources.empty()) {
+    return false;
+  }
+
+  LOG(INFO)
+  << "DEBUG requestSingleOffer(" << upper << "): "
+  << "trying to reserve, persist and start with " << offer.id().value();
+
+  task->set_persistence_id(persistentId);
+  taskCur->set_container_path(containerPath);
+  lease.update(taskType, pos);
+  lease.changed();
+
+  OfferPreparation preparation;
+  preparation._reservation = reservation;
+  preparation._volumes = volumes;
+
+  return startWithResources(lease, resources, offer, TASK_STATE_TRYING_TO_START,
+                            taskType, pos, task, taskCur, &preparation);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief request to make a reservation
+////////////////////////////////////////////////////////////////////////////////
+
+static bool requestReservation (ArangoState::Lease& lease,
+                                std::string const& upper,
+                                mesos::Offer const& offer,
+                                OfferSummary const& summary,
+                                TargetMatcher const& matcher,
+                                PortAllocator const& ports,
+                                TaskPlan* task,
+                                TaskCurrent* taskCur,
+                                bool doDecline,
+                                TaskType taskType,
+                                int pos) {
+  mesos::Resources resources
+        = resourcesForRequestReservation(offer, matcher, ports, *task,
+                                         *taskCur);
+
+  // If the offer has everything, the reservation, the volume and the
+  // launch are requested at once, unless this has failed for the task
+  // before:
+  if (! task->stepwise() && Global::singleOfferLaunch() &&
+      requestSingleOffer(lease, upper, offer, summary, matcher, ports,
+                         resources, task, taskCur, taskType, pos)) {
+    return true;
+  }
+
+  if (resources.empty()) {
+    // We have everything needed reserved for our role, so we can
+    // directly move on to the persistent volume:
+    return requestPersistent(lease, upper, offer, summary, matcher, task,
+                             taskCur, doDecline, taskType, pos);
+  }
+
+  // First update our own state with the intention of making 
+  // a dynamic reservation:
+  double now = chrono::duration<double>(
+    chrono::steady_clock::now().time_since_epoch()).count();
+
+  task->set_state(TASK_STATE_TRYING_TO_RESERVE);
+  task->set_timestamp(now);
+
+  taskCur->mutable_slave_id()->CopyFrom(offer.slave_id());
+  taskCur->mutable_offer_id()->CopyFrom(offer.id());
+  taskCur->set_hostname(offer.hostname());
+
+  taskCur->clear_ports();
+  lease.update(taskType, pos);
+  lease.changed();
+
+  // Now use the scheduler to actually try to make the dynamic reservation:
+  LOG(INFO)
+  << "DEBUG requestReservation: "
+  << "trying to reserve " << offer.id().value()
+  << " with " << resources;
+
+  Global::scheduler().reserveDynamically(offer, resources);
+  return true;  // offer was used
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief request to start with persistent volume
+////////////////////////////////////////////////////////////////////////////////
+
+static bool requestStartPersistent (ArangoState::Lease& lease,
+                                    string const& upper,
+                                    mesos::Offer const& offer,
+                                    TargetMatcher const& matcher,
+                                    PortAllocator const& ports,
+                                    TaskPlan* task,
+                                    TaskCurrent* taskCur,
+                                    bool doDecline,
+                                    TaskType taskType,
+                                    int pos) {
+  string persistenceId = task->persistence_id();
+  string containerPath;
+
+  mesos::Resources resources = suitablePersistent(
+    upper, offer, matcher, ports, *task, *taskCur, persistenceId,
+    containerPath);
+  taskCur->set_container_path(containerPath);
+  lease.changed();
+
+  if (startWithResources(lease, resources, offer, TASK_STATE_TRYING_TO_START, taskType, pos, task, taskCur)) {
+    return true;
+  } else {
+    return notInterested(offer, doDecline);
+  }
+}                                  
 
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief request to start without persistent volume
@@ -903,14 +967,15 @@ static bool requestStartPersistent (ArangoState::Lease& lease,
 
 static bool requestStartEphemeral (ArangoState::Lease& lease,
                                    mesos::Offer const& offer,
-                                   Target const& target,
+                                   TargetMatcher const& matcher,
+                                   PortAllocator const& ports,
                                    TaskPlan* task,
                                    TaskCurrent* taskCur,
                                    TaskType taskType,
                                    int pos) {
 
   mesos::Resources resources 
-      = resourcesForStartEphemeral(offer, target);
+      = resourcesForStartEphemeral(offer, matcher, ports, *task, *taskCur);
   
 
   startWithResources(lease, resources, offer, TASK_STATE_TRYING_TO_START, taskType, pos, task, taskCur);
@@ -925,7 +990,8 @@ static bool requestStartEphemeral (ArangoState::Lease& lease,
 static bool requestRestartPersistent (ArangoState::Lease& lease,
                                       string const& upper,
                                       mesos::Offer const& offer,
-                                      Target const& target,
+                                      TargetMatcher const& matcher,
+                                      PortAllocator const& ports,
                                       TaskPlan* task,
                                       TaskCurrent* taskCur,
                                       bool doDecline,
@@ -936,8 +1002,10 @@ static bool requestRestartPersistent (ArangoState::Lease& lease,
   string containerPath;
 
   mesos::Resources resources = suitablePersistent(
-    upper, offer, target, persistenceId, containerPath);
+    upper, offer, matcher, ports, *task, *taskCur, persistenceId,
+    containerPath);
   taskCur->set_container_path(containerPath);
+  lease.changed();
   
   if (startWithResources(lease, resources, offer, TASK_STATE_TRYING_TO_RESTART, taskType, pos, task, taskCur)) {
     return true;
@@ -953,14 +1021,15 @@ static bool requestRestartPersistent (ArangoState::Lease& lease,
 static bool requestRestartEphemeral (ArangoState::Lease& lease,
                                      string const& upper,
                                      mesos::Offer const& offer,
-                                     Target const& target,
+                                     TargetMatcher const& matcher,
+                                     PortAllocator const& ports,
                                      TaskPlan* task,
                                      TaskCurrent* taskCur,
                                      TaskType taskType,
                                      int pos) {
 
   mesos::Resources resources 
-      = resourcesForStartEphemeral(offer, target);
+      = resourcesForStartEphemeral(offer, matcher, ports, *task, *taskCur);
 
   startWithResources(lease, resources, offer, TASK_STATE_TRYING_TO_RESTART, taskType, pos, task, taskCur);
   return true;   // offer was used
@@ -970,6 +1039,72 @@ static bool requestRestartEphemeral (ArangoState::Lease& lease,
 // --Section--                                                   class Caretaker
 // -----------------------------------------------------------------------------
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a task to put into a restart bucket
+////////////////////////////////////////////////////////////////////////////////
+
+struct RestartCandidate {
+  TaskType _type;
+  std::string _name;
+  std::string _slave;     // failure domain
+  std::string _pair;      // name of the primary of a primary or secondary
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief fills restart buckets, each with up to perType tasks of each
+/// list, never two tasks on the same slave nor two of the same pair of
+/// primary and secondary, unless the bucket would be empty otherwise
+////////////////////////////////////////////////////////////////////////////////
+
+static void addRestartBuckets (Restart* restart,
+                               std::vector<std::vector<RestartCandidate>>& lists,
+                               uint32_t perType) {
+  auto remaining = [&] () -> bool {
+    for (auto const& list : lists) {
+      if (! list.empty()) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  while (remaining()) {
+    RestartBucket* bucket = restart->add_buckets();
+    std::unordered_set<std::string> slaves;
+    std::unordered_set<std::string> pairs;
+
+    for (auto& list : lists) {
+      uint32_t taken = 0;
+
+      for (auto it = list.begin();  it != list.end() && taken < perType;) {
+        bool conflict =
+             (! it->_slave.empty() && slaves.find(it->_slave) != slaves.end())
+          || (! it->_pair.empty() && pairs.find(it->_pair) != pairs.end());
+
+        if (conflict && 0 < bucket->restart_tasks_size()) {
+          ++it;
+          continue;
+        }
+
+        RestartTaskInfo* restartTaskInfo = bucket->add_restart_tasks();
+        restartTaskInfo->set_task_type(static_cast<int>(it->_type));
+        restartTaskInfo->set_task_name(it->_name);
+
+        if (! it->_slave.empty()) {
+          slaves.insert(it->_slave);
+        }
+
+        if (! it->_pair.empty()) {
+          pairs.insert(it->_pair);
+        }
+
+        ++taken;
+        it = list.erase(it);
+      }
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                      constructors and destructors
 // -----------------------------------------------------------------------------
@@ -992,6 +1127,30 @@ Caretaker::~Caretaker () {
 // --SECTION--                                                   private methods
 // -----------------------------------------------------------------------------
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief at most this many tasks are launched with one offer, since two
+/// tasks of a type never share a slave, this is one of each type
+////////////////////////////////////////////////////////////////////////////////
+
+static size_t const MaxTasksPerOffer = 4;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether the last operations collected for an offer
+/// since the given number of them launch a task, updates the number
+////////////////////////////////////////////////////////////////////////////////
+
+static bool launchedWith (mesos::OfferID const& offerId, size_t& seen) {
+  auto operations = Global::scheduler().batchOperations(offerId);
+
+  if (operations.size() <= seen) {
+    return false;
+  }
+
+  seen = operations.size();
+
+  return operations.back().type() == mesos::Offer::Operation::LAUNCH;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief isPartnerOnThisSlave, checks, whether the partner of a given
 /// secondary dbserver happens to be on a certain slave
@@ -1011,14 +1170,8 @@ static bool isPartnerOnThisSlave (ArangoState::Lease& lease,
     partner = tp.sync_partner();
   }
   // Find the actual partner among the primaries:
-  TasksPlan const& dbservers = plan.dbservers();
-  int j;
-  for (j = 0; j < dbservers.entries_size(); j++) {
-    if (dbservers.entries(j).name() == partner) {
-      break;
-    }
-  }
-  if (j < dbservers.entries_size()) {
+  int j = lease.index().findByName(TaskType::PRIMARY_DBSERVER, partner);
+  if (j >= 0) {
     // Found him:
     Current const& current = lease.state().current();
     TaskCurrent const& primaryResEntry
@@ -1040,12 +1193,22 @@ static bool isPartnerOnThisSlave (ArangoState::Lease& lease,
 bool Caretaker::checkOfferOneType (ArangoState::Lease& lease,
                                    const string& name,
                                    bool persistent,
-                                   Target const& target,
                                    TasksPlan* tasks,
                                    TasksCurrent* current,
                                    mesos::Offer const& offer,
+                                   OfferSummary const& summary,
                                    bool doDecline,
-                                   TaskType taskType) {
+                                   TaskType taskType,
+                                   OfferPlacement const& placement) {
+  TargetMatcher const& matcher = _matchers.matcher(taskType);
+
+  // What is left of an offer is never declined here, a type which has
+  // just launched a task with it or cannot use it lets the next type have
+  // a go, the caller declines the rest at the end:
+  if (placement._rest) {
+    doDecline = false;
+  }
+
   string upper = name;
   for (auto& c : upper) { 
     c = toupper(c);
@@ -1094,65 +1257,78 @@ bool Caretaker::checkOfferOneType (ArangoState::Lease& lease,
   }
 
   for (int i = 0; i < p; ++i) {
-    TaskPlan* task = tasks->mutable_entries(i);
-    TaskCurrent* taskCur = current->mutable_entries(i);
-    
-    if (task->state() == TASK_STATE_NEW) {
+    if (tasks->entries(i).state() == TASK_STATE_NEW) {
       required.push_back(i);
-      continue;
     }
+  }
 
-    // mop: evil edge case...slave went down and was restarted after
-    // it was declared as lost...task did not yet find a suitable new
-    // slave and we are reoffered our original persistent volume...
-    // Upon restart the slave will have a new slave_id...Sync the
-    // new slave_id back to our internal structure so we can restart
-    // it on the new slave
-    if (!offerPersistenceId.empty() && task->persistence_id() == offerPersistenceId) {
-      taskCur->mutable_slave_id()->CopyFrom(offer.slave_id());
+  // mop: evil edge case...slave went down and was restarted after
+  // it was declared as lost...task did not yet find a suitable new
+  // slave and we are reoffered our original persistent volume...
+  // Upon restart the slave will have a new slave_id...Sync the
+  // new slave_id back to our internal structure so we can restart
+  // it on the new slave
+  if (! offerPersistenceId.empty()) {
+    int i = lease.index().findByPersistenceId(taskType, offerPersistenceId);
+
+    if (0 <= i && tasks->entries(i).state() != TASK_STATE_NEW &&
+        current->entries(i).slave_id().value() != offerSlaveId) {
+      current->mutable_entries(i)->mutable_slave_id()->CopyFrom(offer.slave_id());
+      lease.update(taskType, i);
+      lease.changed();
     }
+  }
 
-    if (taskCur->slave_id().value() == offerSlaveId) {
-      switch (task->state()) {
-        case TASK_STATE_TRYING_TO_RESERVE:
-          if ((Global::ignoreOffers() & 4) == 4) {
-            LOG(INFO) << "Ignoring offer because of 0x4 flag.";
-            return notInterested(offer, doDecline);
-          }
-          return requestPersistent(upper, offer, target, task, taskCur, 
-                                   doDecline, taskType, i);
+  for (int i : lease.index().findBySlaveId(taskType, offerSlaveId)) {
+    TaskPlan* task = tasks->mutable_entries(i);
+    TaskCurrent* taskCur = current->mutable_entries(i);
 
-        case TASK_STATE_TRYING_TO_PERSIST:
-          if ((Global::ignoreOffers() & 8) == 8) {
-            LOG(INFO) << "Ignoring offer because of 0x8 flag.";
-            return notInterested(offer, doDecline);
-          }
-          return requestStartPersistent(lease, upper, offer, target, task,
-                                        taskCur, doDecline, taskType, i);
-
-        case TASK_STATE_KILLED:
-        case TASK_STATE_FAILED_OVER:
-          if ((Global::ignoreOffers() & 0x10) == 0x10) {
-            LOG(INFO) << "Ignoring offer because of 0x10 flag.";
-            return notInterested(offer, doDecline);
-          }
-          if (taskType == TaskType::COORDINATOR) {
-            return requestRestartEphemeral(lease, upper, offer, target, task,
-                                           taskCur, taskType, i);
-          }
-          else {
-            return requestRestartPersistent(lease, upper, offer, target, task, 
-                                            taskCur, doDecline, taskType, i);
-          }
+    if (task->state() == TASK_STATE_NEW) {
+      continue;
+    }
 
-        case TASK_STATE_RUNNING:
-          // mop: there was some special logic here that tried to cover an unknown edge case
-          // removed as it completely spammed the logfile and makes one look into a completely
-          // wrong direction
+    switch (task->state()) {
+      case TASK_STATE_TRYING_TO_RESERVE:
+        if ((Global::ignoreOffers() & 4) == 4) {
+          LOG(INFO) << "Ignoring offer because of 0x4 flag.";
           return notInterested(offer, doDecline);
-        default:
+        }
+        return requestPersistent(lease, upper, offer, summary, matcher,
+                                 task, taskCur, doDecline, taskType, i);
+
+      case TASK_STATE_TRYING_TO_PERSIST:
+        if ((Global::ignoreOffers() & 8) == 8) {
+          LOG(INFO) << "Ignoring offer because of 0x8 flag.";
           return notInterested(offer, doDecline);
-      }
+        }
+        return requestStartPersistent(lease, upper, offer, matcher,
+                                      _portAllocator, task, taskCur,
+                                      doDecline, taskType, i);
+
+      case TASK_STATE_KILLED:
+      case TASK_STATE_FAILED_OVER:
+        if ((Global::ignoreOffers() & 0x10) == 0x10) {
+          LOG(INFO) << "Ignoring offer because of 0x10 flag.";
+          return notInterested(offer, doDecline);
+        }
+        if (taskType == TaskType::COORDINATOR) {
+          return requestRestartEphemeral(lease, upper, offer, matcher,
+                                         _portAllocator, task, taskCur,
+                                         taskType, i);
+        }
+        else {
+          return requestRestartPersistent(lease, upper, offer, matcher,
+                                          _portAllocator, task, taskCur,
+                                          doDecline, taskType, i);
+        }
+
+      case TASK_STATE_RUNNING:
+        // mop: there was some special logic here that tried to cover an unknown edge case
+        // removed as it completely spammed the logfile and makes one look into a completely
+        // wrong direction
+        return notInterested(offer, doDecline);
+      default:
+        return notInterested(offer, doDecline);
     }
   }
 
@@ -1165,18 +1341,34 @@ bool Caretaker::checkOfferOneType (ArangoState::Lease& lease,
     return notInterested(offer, doDecline);
   }
 
+  // ...........................................................................
+  // an offer planned for another type is kept for that type
+  // ...........................................................................
+
+  if (placement.planned() && placement._type != taskType) {
+    return false;
+  }
+
   // ...........................................................................
   // check whether the offer is suitable:
   // ...........................................................................
-  if (! isSuitableOffer(target, offer)) {
-    return notInterested(offer, doDecline);
+  DeclineReason reason;
+
+  if (! isSuitableOffer(matcher, offer, summary, reason)) {
+    return notInterested(offer, doDecline, reason);
   }
 
   // ...........................................................................
   // now decide for whom to use the offer:
   // ...........................................................................
   int decision = required[0];   // this is the default
-  if (required.size() == 2) {
+
+  if (placement.planned() &&
+      find(required.begin(), required.end(), placement._position)
+        != required.end()) {
+    decision = placement._position;
+  }
+  else if (required.size() == 2) {
     // Here we have to be a bit cleverer: We must not make it so that the
     // last instance requiring a task would be forced to run on the same
     // slave as its primary.
@@ -1230,7 +1422,7 @@ bool Caretaker::checkOfferOneType (ArangoState::Lease& lease,
     if (isPartnerOnThisSlave(lease, decision, offer.slave_id().value())) {
       // we decline this offer, there will be another one
       LOG(INFO) << "secondary not on same slave as its primary";
-      return notInterested(offer, doDecline);
+      return notInterested(offer, doDecline, DeclineReason::ANTI_AFFINITY);
     }
   }
 
@@ -1240,24 +1432,13 @@ bool Caretaker::checkOfferOneType (ArangoState::Lease& lease,
   // ...........................................................................
 
   if (Global::secondariesWithDBservers() && name == "secondary") {
-    Current globalCurrent = lease.state().current();
-    TasksCurrent const& primaryResEntries = globalCurrent.dbservers();
-
-    int found = -1;
+    bool found = ! lease.index().findBySlaveId(TaskType::PRIMARY_DBSERVER,
+                                               offerSlaveId).empty();
 
-    for (int i = 0; i < primaryResEntries.entries_size(); i++) {
-      if (primaryResEntries.entries(i).has_slave_id() &&
-          offer.slave_id().value()
-          == primaryResEntries.entries(i).slave_id().value()) {
-        found = i;
-        break;
-      }
-    }
-
-    if (found == -1) {
+    if (! found) {
       // we decline this offer, there will be another one
       LOG(INFO) << "secondary not alone on a slave";
-      return notInterested(offer, doDecline);
+      return notInterested(offer, doDecline, DeclineReason::ANTI_AFFINITY);
     }
   }
 
@@ -1267,24 +1448,13 @@ bool Caretaker::checkOfferOneType (ArangoState::Lease& lease,
   // ...........................................................................
 
   if (Global::coordinatorsWithDBservers() && name == "coordinator") {
-    Current globalCurrent = lease.state().current();
-    TasksCurrent const& primaryResEntries = globalCurrent.dbservers();
-
-    int found = -1;
+    bool found = ! lease.index().findBySlaveId(TaskType::PRIMARY_DBSERVER,
+                                               offerSlaveId).empty();
 
-    for (int i = 0; i < primaryResEntries.entries_size(); i++) {
-      if (primaryResEntries.entries(i).has_slave_id() &&
-          offer.slave_id().value()
-          == primaryResEntries.entries(i).slave_id().value()) {
-        found = i;
-        break;
-      }
-    }
-
-    if (found == -1) {
+    if (! found) {
       // we decline this offer, there will be another one
       LOG(INFO) << "coordinator not alone on a slave";
-      return notInterested(offer, doDecline);
+      return notInterested(offer, doDecline, DeclineReason::ANTI_AFFINITY);
     }
   }
 
@@ -1300,8 +1470,8 @@ bool Caretaker::checkOfferOneType (ArangoState::Lease& lease,
       LOG(INFO) << "Ignoring offer because of 0x20 flag.";
       return notInterested(offer, doDecline);
     }
-    return requestStartEphemeral(lease, offer, target, task, taskCur, 
-                                 taskType, decision);
+    return requestStartEphemeral(lease, offer, matcher, _portAllocator,
+                                 task, taskCur, taskType, decision);
   }
 
   // ...........................................................................
@@ -1312,7 +1482,8 @@ bool Caretaker::checkOfferOneType (ArangoState::Lease& lease,
     LOG(INFO) << "Ignoring offer because of 0x40 flag.";
     return notInterested(offer, doDecline);
   }
-  return requestReservation(upper, offer, target, task, taskCur, doDecline,
+  return requestReservation(lease, upper, offer, summary, matcher,
+                            _portAllocator, task, taskCur, doDecline,
                             taskType, decision);
 }
 
@@ -1321,25 +1492,132 @@ bool Caretaker::checkOfferOneType (ArangoState::Lease& lease,
 // -----------------------------------------------------------------------------
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief checks if we can use a resource offer
+/// @brief checks all offers of a batch
 ////////////////////////////////////////////////////////////////////////////////
 
-void Caretaker::checkOffer (const mesos::Offer& offer) {
+void Caretaker::checkOffers (vector<mesos::Offer> const& offers) {
+  if (offers.empty()) {
+    return;
+  }
+
   auto lease = Global::state().lease();
 
-  Targets targets = lease.state().targets();
-  Plan plan = lease.state().plan();
-  Current current = lease.state().current();
+  // the targets are compiled only when they have changed, the offers are
+  // summed up once for the whole batch, and the ports our tasks have on
+  // each agent are collected once as well
+  _matchers.update(lease.state().targets(), Global::role());
+  _portAllocator.update(lease.state());
+
+  vector<OfferSummary> summaries;
+  summaries.reserve(offers.size());
+
+  for (auto const& offer : offers) {
+    summaries.emplace_back(offer);
+  }
+
+  vector<OfferPlacement> placements
+    = planOffers(lease.state(), lease.index(), offers, summaries, _matchers);
+
+  // the planned offers first, such that the remaining offers only see
+  // the tasks for which no offer was planned
+  vector<size_t> order;
+
+  for (size_t i = 0;  i < offers.size();  ++i) {
+    if (placements[i].planned()) {
+      order.push_back(i);
+    }
+  }
+
+  for (size_t i = 0;  i < offers.size();  ++i) {
+    if (! placements[i].planned()) {
+      order.push_back(i);
+    }
+  }
+
+  // the number of operations collected for each offer so far
+  vector<size_t> operations(offers.size(), 0);
+  vector<size_t> launched;
 
-  checkOfferOneType(lease, "primary", true,
-                    targets.dbservers(),
-                    plan.mutable_dbservers(),
-                    current.mutable_dbservers(),
-                    offer, true, TaskType::PRIMARY_DBSERVER);
+  for (size_t i : order) {
+    checkOffer(lease, offers[i], summaries[i], placements[i]);
+
+    if (launchedWith(offers[i].id(), operations[i])) {
+      launched.push_back(i);
+    }
+  }
+
+  // ...........................................................................
+  // what is left of an offer a task was launched with is offered again,
+  // as long as there are tasks to launch with it, all tasks go out with
+  // a single acceptance of the offer at the end of the batch
+  // ...........................................................................
+
+  for (size_t round = 1;
+       round < MaxTasksPerOffer && ! launched.empty();
+       ++round) {
+    vector<size_t> next;
+
+    for (size_t i : launched) {
+      mesos::Offer rest;
+      rest.CopyFrom(offers[i]);
+      rest.mutable_resources()->CopyFrom(
+        Global::scheduler().remainingResources(offers[i]));
+
+      OfferPlacement placement;
+      placement._rest = true;
+
+      checkOffer(lease, rest, OfferSummary(rest), placement);
+
+      if (launchedWith(offers[i].id(), operations[i])) {
+        next.push_back(i);
+      }
+    }
+
+    launched.swap(next);
+  }
+
+  // ...........................................................................
+  // task ids and persistence ids must survive a failover, otherwise the
+  // status updates of the new tasks cannot be assigned and the volumes
+  // are never found again, so the state is written once for the whole
+  // batch before the caller sends the acceptances
+  // ...........................................................................
+
+  for (auto n : operations) {
+    if (0 < n) {
+      lease.flush();
+      break;
+    }
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief sets the task id, clears the task info and status
+/// @brief checks if we can use a resource offer
+////////////////////////////////////////////////////////////////////////////////
+
+void Caretaker::checkOffer (ArangoState::Lease& lease,
+                            const mesos::Offer& offer,
+                            OfferSummary const& summary,
+                            OfferPlacement const& placement) {
+  Plan* plan = lease.state().mutable_plan();
+  Current* current = lease.state().mutable_current();
+
+  bool offerUsed = checkOfferOneType(lease, "primary", true,
+                                     plan->mutable_dbservers(),
+                                     current->mutable_dbservers(),
+                                     offer, summary, true,
+                                     TaskType::PRIMARY_DBSERVER,
+                                     placement);
+
+  // the helpers mark the lease as changed themselves, whenever they
+  // modify the task, also if the offer is not used in the end
+  if (offerUsed) {
+    lease.changed();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets the task id, clears the launch hash
 ////////////////////////////////////////////////////////////////////////////////
 
 void Caretaker::setTaskId (ArangoState::Lease& lease,
@@ -1347,95 +1625,146 @@ void Caretaker::setTaskId (ArangoState::Lease& lease,
                            mesos::TaskID const& taskId) {
   Current* current = lease.state().mutable_current();
 
-  mesos::SlaveID slaveId;
-  slaveId.set_value("");
-
-  mesos::TaskInfo info;
-  info.set_name("embryo");
-  info.mutable_task_id()->CopyFrom(taskId);
-  info.mutable_slave_id()->CopyFrom(slaveId);
-
   TaskCurrent* taskCur = nullptr;
 
   switch (taskType) {
     case TaskType::AGENT:
       taskCur = current->mutable_agents()->mutable_entries(p);
-      taskCur->mutable_task_info()->CopyFrom(info);
       break;
 
     case TaskType::PRIMARY_DBSERVER:
       taskCur = current->mutable_dbservers()->mutable_entries(p);
-      taskCur->mutable_task_info()->CopyFrom(info);
       break;
 
     case TaskType::SECONDARY_DBSERVER:
       taskCur = current->mutable_secondaries()->mutable_entries(p);
-      taskCur->mutable_task_info()->CopyFrom(info);
       break;
 
     case TaskType::COORDINATOR:
       taskCur = current->mutable_coordinators()->mutable_entries(p);
-      taskCur->mutable_task_info()->CopyFrom(info);
       break;
 
     case TaskType::UNKNOWN:
       LOG(INFO)
       << "unknown task type " << (int) taskType
       << " for " << taskId.value();
-      break;
+      return;
   }
 
+  taskCur->set_task_id(taskId.value());
+  taskCur->clear_launch_hash();
+
+  lease.update(taskType, p);
   lease.changed();   // make sure that the state is persisted later
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief sets the task info
+/// @brief sets the hash of the launch template
 ////////////////////////////////////////////////////////////////////////////////
 
-void Caretaker::setTaskInfo (ArangoState::Lease& lease,
-                             TaskType taskType, int p,
-                             mesos::TaskInfo const& taskInfo) {
+void Caretaker::setLaunchHash (ArangoState::Lease& lease,
+                               TaskType taskType, int p,
+                               string const& hash) {
   Current* current = lease.state().mutable_current();
 
   switch (taskType) {
     case TaskType::AGENT:
-      current->mutable_agents()
-        ->mutable_entries(p)
-        ->mutable_task_info()
-        ->CopyFrom(taskInfo);
+      current->mutable_agents()->mutable_entries(p)->set_launch_hash(hash);
       break;
 
     case TaskType::PRIMARY_DBSERVER:
-      current->mutable_dbservers()
-        ->mutable_entries(p)
-        ->mutable_task_info()
-        ->CopyFrom(taskInfo);
+      current->mutable_dbservers()->mutable_entries(p)->set_launch_hash(hash);
       break;
 
     case TaskType::SECONDARY_DBSERVER:
-      current->mutable_secondaries()
-        ->mutable_entries(p)
-        ->mutable_task_info()
-        ->CopyFrom(taskInfo);
+      current->mutable_secondaries()->mutable_entries(p)->set_launch_hash(hash);
       break;
 
     case TaskType::COORDINATOR:
-      current->mutable_coordinators()
-        ->mutable_entries(p)
-        ->mutable_task_info()
-        ->CopyFrom(taskInfo);
+      current->mutable_coordinators()->mutable_entries(p)->set_launch_hash(hash);
       break;
 
     case TaskType::UNKNOWN:
       LOG(INFO)
       << "unknown task type " << (int) taskType
-      << " for " << taskInfo.task_id().value();
+      << " for launch hash " << hash;
       break;
   }
 
   lease.changed();  // make sure the state is persisted later
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief regenerates the task info a task was launched with
+////////////////////////////////////////////////////////////////////////////////
+
+mesos::TaskInfo Caretaker::taskInfo (State const& state,
+                                     TaskType taskType, int p) {
+  TasksPlan const& plan = tasksPlan(state, taskType);
+  TasksCurrent const& current = tasksCurrent(state, taskType);
+
+  if (p < 0 || plan.entries_size() <= p || current.entries_size() <= p) {
+    return mesos::TaskInfo();
+  }
+
+  TaskPlan const& task = plan.entries(p);
+  TaskCurrent const& info = current.entries(p);
+
+  if (info.task_id().empty() || info.ports_size() != 1) {
+    return mesos::TaskInfo();
+  }
+
+  return launchTemplate(state, taskType, p, task, info, info.task_id(),
+                        ! task.persistence_id().empty());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief hash of a launch template
+////////////////////////////////////////////////////////////////////////////////
+
+string Caretaker::launchHash (mesos::TaskInfo const& taskInfo) {
+  mesos::TaskInfo copy;
+  copy.CopyFrom(taskInfo);
+
+  // the task id differs for each launch, the resources are not kept
+  copy.clear_task_id();
+  copy.clear_resources();
+
+  // the server id and the agency endpoints are only known after the
+  // launch, a later template must not differ because of them
+  auto variables = copy.mutable_command()->mutable_environment()
+                   ->mutable_variables();
+
+  for (int i = 0;  i < variables->size();) {
+    string const& name = variables->Get(i).name();
+
+    if (name == "CLUSTER_ID" || name == "AGENCY_ENDPOINTS") {
+      variables->SwapElements(i, variables->size() - 1);
+      variables->RemoveLast();
+    }
+    else {
+      ++i;
+    }
+  }
+
+  string data;
+  copy.SerializePartialToString(&data);
+
+  // FNV-1a, 64 bit
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (unsigned char c : data) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+
+  char buffer[17];
+  snprintf(buffer, sizeof(buffer), "%016llx",
+           static_cast<unsigned long long>(hash));
+
+  return buffer;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief sets the task plan state
 ////////////////////////////////////////////////////////////////////////////////
@@ -1481,14 +1810,83 @@ void Caretaker::setTaskPlanState (ArangoState::Lease& lease,
   } else if (tp->state() != TASK_STATE_DEAD) {
     // Do not overwrite a TASK_STATE_DEAD, because we do not want zombies:
     tp->set_state(taskPlanState);
-    double now = chrono::duration_cast<chrono::seconds>(
+
+    // The stepwise launch has worked, the next one can try a single
+    // offer again:
+    if (taskPlanState == TASK_STATE_RUNNING) {
+      tp->clear_stepwise();
+    }
+
+    double now = chrono::duration<double>(
       chrono::steady_clock::now().time_since_epoch()).count();
     tp->set_timestamp(now);
     tc->set_start_time(now);
+    lease.update(taskType, p);
     lease.changed();   // make sure state will be persisted later
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts a task over step by step, if its single offer launch failed
+////////////////////////////////////////////////////////////////////////////////
+
+bool Caretaker::startStepwise (ArangoState::Lease& lease,
+                               TaskType taskType, int p) {
+  Plan* plan = lease.state().mutable_plan();
+  Current* current = lease.state().mutable_current();
+  TaskPlan* tp = nullptr;
+  TaskCurrent* tc = nullptr;
+
+  switch (taskType) {
+    case TaskType::AGENT:
+      tp = plan->mutable_agents()->mutable_entries(p);
+      tc = current->mutable_agents()->mutable_entries(p);
+      break;
+
+    case TaskType::PRIMARY_DBSERVER:
+      tp = plan->mutable_dbservers()->mutable_entries(p);
+      tc = current->mutable_dbservers()->mutable_entries(p);
+      break;
+
+    case TaskType::SECONDARY_DBSERVER:
+      tp = plan->mutable_secondaries()->mutable_entries(p);
+      tc = current->mutable_secondaries()->mutable_entries(p);
+      break;
+
+    case TaskType::COORDINATOR:
+      tp = plan->mutable_coordinators()->mutable_entries(p);
+      tc = current->mutable_coordinators()->mutable_entries(p);
+      break;
+
+    case TaskType::UNKNOWN:
+      return false;
+  }
+
+  if (tp->state() != TASK_STATE_TRYING_TO_START || ! tc->single_offer()) {
+    return false;
+  }
+
+  // the reservation or the volume might not exist, so we cannot restart
+  // the task with its persistence id, rather we go back to the start and
+  // take an offer for each step
+  LOG(INFO)
+  << "single offer launch of " << tp->name() << " failed, "
+  << "going back to state TASK_STATE_NEW to start step by step";
+
+  double now = chrono::duration<double>(
+    chrono::steady_clock::now().time_since_epoch()).count();
+
+  tp->set_state(TASK_STATE_NEW);
+  tp->clear_persistence_id();
+  tp->set_timestamp(now);
+  tp->set_stepwise(true);
+  tc->clear_single_offer();
+
+  lease.update(taskType, p);
+  lease.changed();   // make sure state will be persisted later
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                          static protected methods
 // -----------------------------------------------------------------------------
@@ -1521,56 +1919,121 @@ void Caretaker::updateTarget() {
   // mop: do nothing by default :S
 }
 
-void Caretaker::restart() {
-  size_t restartBucketCount = 0;
-  {
-    auto lease = Global::state().lease();
-    Plan plan = lease.state().plan();
-    
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts a restart job, returns its id
+////////////////////////////////////////////////////////////////////////////////
+
+std::string Caretaker::restart (uint32_t parallelism) {
+  if (parallelism == 0) {
+    parallelism = 1;
+  }
+
+  auto lease = Global::state().lease();
+
+  // a job already running is not started again
+  if (lease.state().has_restart()) {
     Restart* restart = lease.state().mutable_restart();
-    if (plan.agents().entries_size() > 0) {
-      RestartBucket* bucket = restart->add_buckets();
-      
-      for (size_t i=0;i<plan.agents().entries_size();i++) {
-        RestartTaskInfo* restartTaskInfo = bucket->add_restart_tasks();
-        restartTaskInfo->set_task_type(static_cast<int>(TaskType::AGENT));
-        restartTaskInfo->set_task_name(plan.agents().entries(i).name());
-      }
+
+    if (! restart->has_id()) {
+      restart->set_id(UUID::random().toString());
+      lease.changed();
     }
 
-    auto taskGroups = {
-      std::make_pair(plan.coordinators(), TaskType::COORDINATOR),
-      std::make_pair(plan.dbservers(), TaskType::PRIMARY_DBSERVER),
-      std::make_pair(plan.secondaries(), TaskType::SECONDARY_DBSERVER),
-    };
-    
-    RestartBucket* bucket;
-    do {
-      bucket = nullptr;
-      for (auto const& it: taskGroups) {
-        TasksPlan const& plan = it.first;
-        if (restartBucketCount >= plan.entries_size()) {
-          continue;
-        }
+    LOG(INFO) << "Restart " << restart->id() << " is already running";
+    return restart->id();
+  }
 
-        if (bucket == nullptr) {
-          bucket = restart->add_buckets();
-        }
-        RestartTaskInfo* restartTaskInfo = bucket->add_restart_tasks();
-        restartTaskInfo->set_task_type(static_cast<int>(it.second));
-        restartTaskInfo->set_task_name(plan.entries(restartBucketCount).name());
-      }
-      restartBucketCount++;
-    } while (bucket != nullptr);
-    restart->set_timestamp(chrono::duration_cast<chrono::seconds>(
-      chrono::steady_clock::now().time_since_epoch()).count());
-    lease.changed();
+  State const& state = lease.state();
+  Plan const& plan = state.plan();
+
+  // the primary a secondary belongs to, by name or server id of the primary
+  std::unordered_map<std::string, std::string> pairs;
+
+  for (auto const& primary : plan.dbservers().entries()) {
+    pairs[primary.name()] = primary.name();
+
+    if (! primary.server_id().empty()) {
+      pairs[primary.server_id()] = primary.name();
+    }
   }
-  LOG(INFO) << "Restarting initiated with " << restartBucketCount << " restart buckets";
-  
-  while (Global::state().lease().state().has_restart()) {
-    usleep(20000);
+
+  std::unordered_map<std::string, std::string> secondaryPairs;
+
+  for (auto const& primary : plan.dbservers().entries()) {
+    if (! primary.sync_partner().empty()) {
+      secondaryPairs[primary.sync_partner()] = primary.name();
+    }
   }
+
+  for (auto const& secondary : plan.secondaries().entries()) {
+    auto it = pairs.find(secondary.sync_partner());
+
+    if (it != pairs.end()) {
+      secondaryPairs[secondary.name()] = it->second;
+    }
+  }
+
+  auto candidates = [&] (TaskType type) -> std::vector<RestartCandidate> {
+    TasksPlan const& tasks = tasksPlan(state, type);
+    TasksCurrent const& current = tasksCurrent(state, type);
+    std::vector<RestartCandidate> result;
+
+    for (int i = 0;  i < tasks.entries_size();  ++i) {
+      RestartCandidate candidate;
+      candidate._type = type;
+      candidate._name = tasks.entries(i).name();
+
+      if (i < current.entries_size()) {
+        candidate._slave = current.entries(i).slave_id().value();
+      }
+
+      if (type == TaskType::PRIMARY_DBSERVER) {
+        candidate._pair = candidate._name;
+      }
+      else if (type == TaskType::SECONDARY_DBSERVER) {
+        auto it = secondaryPairs.find(candidate._name);
+
+        if (it != secondaryPairs.end()) {
+          candidate._pair = it->second;
+        }
+      }
+
+      result.push_back(candidate);
+    }
+
+    return result;
+  };
+
+  Restart* restart = lease.state().mutable_restart();
+
+  // the agents first, never so many at once that the agency loses its
+  // majority
+  auto agents = candidates(TaskType::AGENT);
+  uint32_t agentParallelism = std::max<uint32_t>(
+    1, std::min<uint32_t>(parallelism, (agents.size() - 1) / 2));
+
+  std::vector<std::vector<RestartCandidate>> agentLists = { agents };
+  addRestartBuckets(restart, agentLists, agentParallelism);
+
+  std::vector<std::vector<RestartCandidate>> lists = {
+    candidates(TaskType::COORDINATOR),
+    candidates(TaskType::PRIMARY_DBSERVER),
+    candidates(TaskType::SECONDARY_DBSERVER)
+  };
+  addRestartBuckets(restart, lists, parallelism);
+
+  restart->set_id(UUID::random().toString());
+  restart->set_parallelism(parallelism);
+  restart->set_total_buckets(restart->buckets_size());
+  restart->set_timestamp(chrono::duration<double>(
+    chrono::steady_clock::now().time_since_epoch()).count());
+  lease.changed();
+
+  LOG(INFO) << "Restart " << restart->id() << " initiated with "
+            << restart->buckets_size() << " restart buckets, "
+            << parallelism << " tasks per type at once";
+
+  return restart->id();
 }
 
 // -----------------------------------------------------------------------------
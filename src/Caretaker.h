@@ -30,23 +30,14 @@
 
 #include "arangodb.pb.h"
 #include "ArangoState.h"
+#include "OfferPlanner.h"
+#include "PortAllocator.h"
+#include "TargetMatcher.h"
 
 #include <mesos/resources.hpp>
 
 namespace arangodb {
 
-// -----------------------------------------------------------------------------
-// --SECTION--                                               enum class TaskType
-// -----------------------------------------------------------------------------
-
-  enum class TaskType {
-    UNKNOWN,
-    AGENT,
-    COORDINATOR,
-    PRIMARY_DBSERVER,
-    SECONDARY_DBSERVER
-  };
-
 // -----------------------------------------------------------------------------
 // --SECTION--                                                   class Caretaker
 // -----------------------------------------------------------------------------
@@ -112,23 +103,42 @@ namespace arangodb {
     public:
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief checks if we can use a resource offer, 
+/// @brief checks all offers of a batch, the offers are planned together
+/// and then checked one by one under the same lease
 ////////////////////////////////////////////////////////////////////////////////
 
-      virtual void checkOffer (mesos::Offer const&);
+      void checkOffers (std::vector<mesos::Offer> const&);
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief sets the task id, clears the task info and status
+/// @brief checks if we can use a resource offer, a planned offer is only
+/// used for the task it is planned for, if that task still needs it, the
+/// summary holds the scalar totals of the offer
+////////////////////////////////////////////////////////////////////////////////
+
+      virtual void checkOffer (ArangoState::Lease&,
+                               mesos::Offer const&,
+                               OfferSummary const&,
+                               OfferPlacement const&);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets the task id, clears the launch hash
 ////////////////////////////////////////////////////////////////////////////////
 
       void setTaskId (ArangoState::Lease&, TaskType, int, mesos::TaskID const&);
 
 ////////////////////////////////////////////////////////////////////////////////
-/// @brief sets the task info
+/// @brief sets the hash of the launch template
 ////////////////////////////////////////////////////////////////////////////////
 
-      void setTaskInfo (ArangoState::Lease&, TaskType, int,
-                        mesos::TaskInfo const&);
+      void setLaunchHash (ArangoState::Lease&, TaskType, int,
+                          std::string const&);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief regenerates the task info a task was launched with, without the
+/// resources, from the current launch template
+////////////////////////////////////////////////////////////////////////////////
+
+      mesos::TaskInfo taskInfo (State const&, TaskType, int);
 
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief sets the task plan state
@@ -137,7 +147,34 @@ namespace arangodb {
       void setTaskPlanState (ArangoState::Lease&, TaskType, int,
                              TaskPlanState const, bool&);
 
-      void restart();
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sends a task launched together with its reservation and volume
+/// back to TASK_STATE_NEW, such that it is started step by step with an
+/// offer each, returns false if the task is not waiting for such a launch
+////////////////////////////////////////////////////////////////////////////////
+
+      bool startStepwise (ArangoState::Lease&, TaskType, int);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts a job restarting all tasks, with up to parallelism tasks
+/// of each type at once, returns the id of the job, or of the job already
+/// running, the job is driven by ArangoManager::manageClusterRestart
+////////////////////////////////////////////////////////////////////////////////
+
+      std::string restart (uint32_t parallelism);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                             static public methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief hash of a launch template, the task id, the resources, the
+/// server id and the agency endpoints are not part of the hash
+////////////////////////////////////////////////////////////////////////////////
+
+      static std::string launchHash (mesos::TaskInfo const&);
 
 
 // -----------------------------------------------------------------------------
@@ -152,18 +189,22 @@ namespace arangodb {
 /// if it is not useful for this task type. Returns true if the offer
 /// was put to some use (or declined) and false, if somebody else can
 /// have a go. Note that this method has to return true if it changed
-/// the global state (or call lease.changed() explicitly).
+/// the global state (or call lease.changed() explicitly). An offer
+/// planned for another task type is left to that type, one planned for
+/// this type is used for the planned task. The offer is matched against
+/// the compiled target of the task type.
 ////////////////////////////////////////////////////////////////////////////////
 
       bool checkOfferOneType (ArangoState::Lease& lease,
                               std::string const& name,
                               bool persistent,
-                              Target const& target,
                               TasksPlan* plan,
                               TasksCurrent* current,
                               mesos::Offer const& offer,
+                              OfferSummary const& summary,
                               bool doDecline,
-                              TaskType taskType);
+                              TaskType taskType,
+                              OfferPlacement const& placement);
 
     protected:
 ////////////////////////////////////////////////////////////////////////////////
@@ -173,6 +214,24 @@ namespace arangodb {
       static void setStandardMinimum (Target* te, int size = 1);
       
       bool taskWasRestarted(ArangoState::Lease&, TaskPlan*, TaskCurrent*);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                               protected variables
+// -----------------------------------------------------------------------------
+
+    protected:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the compiled targets, refreshed with each batch of offers
+////////////////////////////////////////////////////////////////////////////////
+
+      TargetMatchers _matchers;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the ports of our tasks by agent, refreshed with each batch
+////////////////////////////////////////////////////////////////////////////////
+
+      PortAllocator _portAllocator;
   };
 }
 
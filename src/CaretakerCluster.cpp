@@ -264,6 +264,7 @@ void CaretakerCluster::updatePlan (std::vector<std::string> const& cleanedServer
 
       TasksCurrent* agents = current->mutable_agents();
       agents->add_entries();
+      lease.update(TaskType::AGENT, tasks->entries_size() - 1);
     }
   }
 
@@ -276,7 +277,10 @@ void CaretakerCluster::updatePlan (std::vector<std::string> const& cleanedServer
       auto const& currentDbServer = current->dbservers().entries(i);
       if (planDbServer->state() != TASK_STATE_SHUTTING_DOWN && planDbServer->server_id() == serverId) {
         shutdownSecondary(lease, planDbServer);
-        shutdownServer(planDbServer, currentDbServer);
+
+        if (shutdownServer(planDbServer, currentDbServer)) {
+          lease.update(TaskType::PRIMARY_DBSERVER, i);
+        }
       }
     }
   }
@@ -288,7 +292,9 @@ void CaretakerCluster::updatePlan (std::vector<std::string> const& cleanedServer
     << "DEBUG reducing dbservers by " << (p - t) << " in plan";
     auto tasksCurrent = current->mutable_dbservers();
     // mop: try to kill dbservers which have not yet been started
-    removeNewTasks(tasks, tasksCurrent, p - t);
+    if (0 < removeNewTasks(tasks, tasksCurrent, p - t)) {
+      lease.reindex();
+    }
     // mop: if there are still more dbservers than planned the supervision is
     // supposed to clean out some existing dbservers....we remain helpless
     // here :)
@@ -307,6 +313,7 @@ void CaretakerCluster::updatePlan (std::vector<std::string> const& cleanedServer
       // mop: by convention Current and Plan arrays have to have equal size
       TasksCurrent* dbservers = current->mutable_dbservers();
       dbservers->add_entries();
+      lease.update(TaskType::PRIMARY_DBSERVER, tasks->entries_size() - 1);
     }
   }
 
@@ -321,12 +328,18 @@ void CaretakerCluster::updatePlan (std::vector<std::string> const& cleanedServer
 
     int toShutdown = p - t;
 
-    double now = chrono::duration_cast<chrono::seconds>(
+    double now = chrono::duration<double>(
       chrono::steady_clock::now().time_since_epoch()).count();
 
     auto tasksCurrent = current->mutable_coordinators();
     // mop: first remove "hanging" tasks which are trying to start right now
-    toShutdown -= removeNewTasks(tasks, tasksCurrent, toShutdown);
+    int removed = removeNewTasks(tasks, tasksCurrent, toShutdown);
+
+    if (0 < removed) {
+      toShutdown -= removed;
+      lease.reindex();
+    }
+
     int shuttingDown = 0;
     // mop: finally if still necessary kill the newest tasks
     for (int i=tasks->entries_size() - 1;i>=0 && shuttingDown < toShutdown;i--) {
@@ -335,6 +348,7 @@ void CaretakerCluster::updatePlan (std::vector<std::string> const& cleanedServer
 
       if (planCoordinator->has_server_id()) {
         if (shutdownServer(planCoordinator, currentCoordinator)) {
+          lease.update(TaskType::COORDINATOR, i);
           shuttingDown++;
         }
       }
@@ -354,6 +368,7 @@ void CaretakerCluster::updatePlan (std::vector<std::string> const& cleanedServer
 
       TasksCurrent* coordinators = current->mutable_coordinators();
       coordinators->add_entries();
+      lease.update(TaskType::COORDINATOR, tasks->entries_size() - 1);
     }
   }
 }
@@ -368,10 +383,12 @@ void CaretakerCluster::shutdownSecondary(ArangoState::Lease& lease, TaskPlan* db
   TasksPlan* secondaries = plan->mutable_secondaries();
   TaskPlan* foundPlan = nullptr;
   TaskCurrent foundCurrent;
+  int foundPosition = -1;
   for (int i=0;i<secondaries->entries_size();i++) {
     TaskPlan* secondary = secondaries->mutable_entries(i);
     if (secondary->state() != TASK_STATE_SHUTTING_DOWN && secondary->server_id() == dbserver->sync_partner()) {
       foundPlan = secondary;
+      foundPosition = i;
       foundCurrent = lease.state().current().secondaries().entries(i);
       break;
     }
@@ -398,7 +415,9 @@ void CaretakerCluster::shutdownSecondary(ArangoState::Lease& lease, TaskPlan* db
         << "of primary " << dbserver->server_id() << " from "
         << foundPlan->server_id() << " to new \"none\"";
     }
-    shutdownServer(foundPlan, foundCurrent);
+    if (shutdownServer(foundPlan, foundCurrent)) {
+      lease.update(TaskType::SECONDARY_DBSERVER, foundPosition);
+    }
   }
 }
 
@@ -417,7 +436,7 @@ bool CaretakerCluster::shutdownServer(TaskPlan* taskPlan, TaskCurrent const& tas
     long httpCode = 0;
     LOG(INFO) << "Shutting down " << taskPlan->server_id();
 
-    double now = chrono::duration_cast<chrono::seconds>(
+    double now = chrono::duration<double>(
         chrono::steady_clock::now().time_since_epoch()).count();
     doClusterHTTPDelete(endpoint + "/_admin/shutdown?remove_from_cluster=1", body, httpCode);
 
@@ -435,7 +454,10 @@ bool CaretakerCluster::shutdownServer(TaskPlan* taskPlan, TaskCurrent const& tas
 /// @brief check an incoming offer against a certain kind of server
 ////////////////////////////////////////////////////////////////////////////////
 
-void CaretakerCluster::checkOffer (const mesos::Offer& offer) {
+void CaretakerCluster::checkOffer (ArangoState::Lease& lease,
+                                   const mesos::Offer& offer,
+                                   OfferSummary const& summary,
+                                   OfferPlacement const& placement) {
   // We proceed as follows:
   //   If not all agencies are up and running, then we check whether
   //   this offer is good for an agency.
@@ -447,8 +469,6 @@ void CaretakerCluster::checkOffer (const mesos::Offer& offer) {
   //   we check whether all secondaries are up, lastly, we check with
   //   the coordinators. If all is well, we decline politely.
 
-  auto lease = Global::state().lease();
-
   Targets* targets = lease.state().mutable_targets();
   Plan* plan = lease.state().mutable_plan();
   Current* current = lease.state().mutable_current();
@@ -478,11 +498,11 @@ void CaretakerCluster::checkOffer (const mesos::Offer& offer) {
     << "running agent instances: " << runningInstances;
     // Try to use the offer for a new agent:
     offerUsed = checkOfferOneType(lease, "agency", true,
-                                  targets->agents(),
                                   plan->mutable_agents(),
                                   current->mutable_agents(),
-                                  offer, ! current->cluster_complete(),
-                                  TaskType::AGENT);
+                                  offer, summary, ! current->cluster_complete(),
+                                  TaskType::AGENT,
+                                  placement);
 
     if (offerUsed) {
       lease.changed();   // save new state
@@ -503,11 +523,11 @@ void CaretakerCluster::checkOffer (const mesos::Offer& offer) {
     << "running DBServer instances: " << runningInstances;
     // Try to use the offer for a new DBserver:
     offerUsed = checkOfferOneType(lease, "primary", true,
-                                  targets->dbservers(),
                                   plan->mutable_dbservers(),
                                   current->mutable_dbservers(),
-                                  offer, ! current->cluster_complete(),
-                                  TaskType::PRIMARY_DBSERVER);
+                                  offer, summary, ! current->cluster_complete(),
+                                  TaskType::PRIMARY_DBSERVER,
+                                  placement);
 
     if (offerUsed) {
       lease.changed();  // make sure new state is saved
@@ -527,11 +547,11 @@ void CaretakerCluster::checkOffer (const mesos::Offer& offer) {
     << "running coordinator instances: " << runningInstances;
     // Try to use the offer for a new coordinator:
     if (checkOfferOneType(lease, "coordinator", false,
-                          targets->coordinators(),
                           plan->mutable_coordinators(),
                           current->mutable_coordinators(),
-                          offer, ! current->cluster_complete(),
-                          TaskType::COORDINATOR)) {
+                          offer, summary, ! current->cluster_complete(),
+                          TaskType::COORDINATOR,
+                          placement)) {
       lease.changed();  // make sure that the new state is saved
       return;   // if we have used or declined the offer, we will not
                 // want to run cluster init and will no longer have to
@@ -554,8 +574,10 @@ void CaretakerCluster::checkOffer (const mesos::Offer& offer) {
       for (int i=0;i<plan->mutable_dbservers()->entries_size();i++) {
         if (!plan->mutable_dbservers()->mutable_entries(i)->has_sync_partner()) {
 
+          // the agency is told later, without the lease, the secondary
+          // shows up in the plan once it has answered
           if (!Global::manager().registerNewSecondary(lease, plan->mutable_dbservers()->mutable_entries(i))) {
-            // mop: reconfiguration failed...decline and retry on next offer
+            // mop: server id not yet known...decline and retry on next offer
             Global::scheduler().declineOffer(offer.id());
             return;
           }
@@ -564,11 +586,11 @@ void CaretakerCluster::checkOffer (const mesos::Offer& offer) {
 
       // Try to use the offer for a new DBserver:
       offerUsed = checkOfferOneType(lease, "secondary", true,
-                                    targets->secondaries(),
                                     plan->mutable_secondaries(),
                                     current->mutable_secondaries(),
-                                    offer, ! current->cluster_complete(),
-                                    TaskType::SECONDARY_DBSERVER);
+                                    offer, summary, ! current->cluster_complete(),
+                                    TaskType::SECONDARY_DBSERVER,
+                                    placement);
 
       if (offerUsed) {
         lease.changed();  // make sure new state is saved
@@ -608,6 +630,13 @@ void CaretakerCluster::checkOffer (const mesos::Offer& offer) {
     }
   }
 
+  // What is left of an offer we have just launched tasks with is given
+  // back, its volumes and reservations are looked at when offered again:
+  if (placement._rest) {
+    Global::scheduler().declineOffer(offer.id());
+    return;
+  }
+
   // Nobody wanted this offer, see whether there is a persistent disk
   // in there and destroy it:
   mesos::Resources offered = offer.resources();
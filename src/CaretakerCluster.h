@@ -76,7 +76,10 @@ namespace arangodb {
 /// {@inheritDoc}
 ////////////////////////////////////////////////////////////////////////////////
 
-      virtual void checkOffer (const mesos::Offer& offer) override;
+      virtual void checkOffer (ArangoState::Lease&,
+                               const mesos::Offer& offer,
+                               OfferSummary const&,
+                               OfferPlacement const&) override;
     
     private:
       void shutdownSecondary(ArangoState::Lease&, TaskPlan*);
@@ -129,13 +129,14 @@ void CaretakerStandalone::updatePlan (std::vector<std::string> const& cleanedSer
 
     dbservers->clear_entries();
     dbservers->add_entries()->CopyFrom(entry);
+    lease.reindex();
   }
 
   else if (p < 1) {
     LOG(INFO)
     << "DEBUG creating one db-server in plan";
 
-    double now = chrono::duration_cast<chrono::seconds>(
+    double now = chrono::duration<double>(
       chrono::steady_clock::now().time_since_epoch()).count();
 
     TaskPlan* task = dbservers->add_entries();
@@ -143,6 +144,7 @@ void CaretakerStandalone::updatePlan (std::vector<std::string> const& cleanedSer
     task->set_timestamp(now);
 
     current->mutable_dbservers()->add_entries();
+    lease.update(TaskType::PRIMARY_DBSERVER, 0);
   }
 }
 
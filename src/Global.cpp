@@ -29,6 +29,12 @@
 
 #include "CaretakerStandalone.h"
 
+#include "logging/logging.hpp"
+
+#include <sys/wait.h>
+
+#include <thread>
+
 using namespace arangodb;
 using namespace std;
 
@@ -60,6 +66,18 @@ static ArangoState* STATE = nullptr;
 
 static ArangoScheduler* SCHEDULER = nullptr;
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief embedded reverse proxy
+////////////////////////////////////////////////////////////////////////////////
+
+static ReverseProxy* REVERSE_PROXY = nullptr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief health probes
+////////////////////////////////////////////////////////////////////////////////
+
+static HealthProbes* HEALTH_PROBES = nullptr;
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief mode
 ////////////////////////////////////////////////////////////////////////////////
@@ -215,6 +233,18 @@ static std::string ARANGODB_ADDITIONAL_SECONDARY_ARGS = "";
 static std::string ARANGODB_ADDITIONAL_COORDINATOR_ARGS = "";
 
 static size_t ARANGODB_OFFER_LIMIT = 10;
+static double ARANGODB_OFFER_RETENTION = 5.0;
+
+static std::string ARANGODB_TASK_TIMEOUTS = "";
+static bool ARANGODB_SINGLE_OFFER_LAUNCH = true;
+
+static bool ARANGODB_STATE_JOURNAL = false;
+static size_t ARANGODB_STATE_JOURNAL_MAX_DELTAS = 100;
+static size_t ARANGODB_STATE_JOURNAL_MAX_BYTES = 1024 * 1024;
+static int ARANGODB_STATE_PERSIST_DELAY = 100;
+static bool ARANGODB_STATE_COMPRESSION = false;
+static bool ARANGODB_STANDBY = false;
+static double ARANGODB_STANDBY_SESSION_TIMEOUT = 10.0;
 
 // -----------------------------------------------------------------------------
 // --SECTION--                                             static public methods
@@ -284,6 +314,38 @@ void Global::setScheduler (ArangoScheduler* scheduler) {
   SCHEDULER = scheduler;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief embedded reverse proxy
+////////////////////////////////////////////////////////////////////////////////
+
+ReverseProxy* Global::reverseProxy () {
+  return REVERSE_PROXY;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets the embedded reverse proxy
+////////////////////////////////////////////////////////////////////////////////
+
+void Global::setReverseProxy (ReverseProxy* reverseProxy) {
+  REVERSE_PROXY = reverseProxy;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief health probes
+////////////////////////////////////////////////////////////////////////////////
+
+HealthProbes* Global::healthProbes () {
+  return HEALTH_PROBES;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets the health probes
+////////////////////////////////////////////////////////////////////////////////
+
+void Global::setHealthProbes (HealthProbes* healthProbes) {
+  HEALTH_PROBES = healthProbes;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief minimal resources for an agent, mesos string specification
 ////////////////////////////////////////////////////////////////////////////////
@@ -703,6 +765,23 @@ bool Global::startReverseProxy() {
     exit(0);
   } else {
     Global::state().setProxyPid(pid);
+
+    // a proxy which fails is started again, the restart wakes up the
+    // dispatcher, which is why this is not done in a signal handler
+    thread([pid] () {
+      int status = 0;
+      waitpid(pid, &status, 0);
+
+      LOG(INFO) << "old haproxy(" << pid << ") exited with status " << status;
+
+      if (status != 0) {
+        LOG(INFO) << "Scheduling restart";
+        Global::state().setRestartProxy(RESTART_FRESH_START);
+      }
+    }).detach();
+
+    // changes queued since the config was written go to the new proxy
+    Global::state().requestReverseProxyUpdate();
     return true;
   }
 }
@@ -787,6 +866,86 @@ size_t Global::offerLimit() {
   return ARANGODB_OFFER_LIMIT;
 }
 
+void Global::setOfferRetention(double offerRetention) {
+  ARANGODB_OFFER_RETENTION = offerRetention;
+}
+
+double Global::offerRetention() {
+  return ARANGODB_OFFER_RETENTION;
+}
+
+void Global::setTaskTimeouts(std::string const& taskTimeouts) {
+  ARANGODB_TASK_TIMEOUTS = taskTimeouts;
+}
+
+std::string Global::taskTimeouts() {
+  return ARANGODB_TASK_TIMEOUTS;
+}
+
+void Global::setSingleOfferLaunch(bool singleOfferLaunch) {
+  ARANGODB_SINGLE_OFFER_LAUNCH = singleOfferLaunch;
+}
+
+bool Global::singleOfferLaunch() {
+  return ARANGODB_SINGLE_OFFER_LAUNCH;
+}
+
+void Global::setStateJournal(bool stateJournal) {
+  ARANGODB_STATE_JOURNAL = stateJournal;
+}
+
+bool Global::stateJournal() {
+  return ARANGODB_STATE_JOURNAL;
+}
+
+void Global::setStateJournalMaxDeltas(size_t stateJournalMaxDeltas) {
+  ARANGODB_STATE_JOURNAL_MAX_DELTAS = stateJournalMaxDeltas;
+}
+
+size_t Global::stateJournalMaxDeltas() {
+  return ARANGODB_STATE_JOURNAL_MAX_DELTAS;
+}
+
+void Global::setStateJournalMaxBytes(size_t stateJournalMaxBytes) {
+  ARANGODB_STATE_JOURNAL_MAX_BYTES = stateJournalMaxBytes;
+}
+
+size_t Global::stateJournalMaxBytes() {
+  return ARANGODB_STATE_JOURNAL_MAX_BYTES;
+}
+
+void Global::setStatePersistDelay(int statePersistDelay) {
+  ARANGODB_STATE_PERSIST_DELAY = statePersistDelay;
+}
+
+int Global::statePersistDelay() {
+  return ARANGODB_STATE_PERSIST_DELAY;
+}
+
+void Global::setStateCompression(bool stateCompression) {
+  ARANGODB_STATE_COMPRESSION = stateCompression;
+}
+
+bool Global::stateCompression() {
+  return ARANGODB_STATE_COMPRESSION;
+}
+
+void Global::setStandby(bool standby) {
+  ARANGODB_STANDBY = standby;
+}
+
+bool Global::standby() {
+  return ARANGODB_STANDBY;
+}
+
+void Global::setStandbySessionTimeout(double standbySessionTimeout) {
+  ARANGODB_STANDBY_SESSION_TIMEOUT = standbySessionTimeout;
+}
+
+double Global::standbySessionTimeout() {
+  return ARANGODB_STANDBY_SESSION_TIMEOUT;
+}
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                       END-OF-FILE
 // -----------------------------------------------------------------------------
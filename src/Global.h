@@ -36,6 +36,8 @@ namespace arangodb {
   class ArangoManager;
   class ArangoState;
   class ArangoScheduler;
+  class ReverseProxy;
+  class HealthProbes;
 
 // -----------------------------------------------------------------------------
 // --SECTION--                                               class OperationMode
@@ -106,6 +108,30 @@ namespace arangodb {
 
       static void setScheduler (ArangoScheduler*);
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief embedded reverse proxy, nullptr if haproxy is used
+////////////////////////////////////////////////////////////////////////////////
+
+      static ReverseProxy* reverseProxy ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets the embedded reverse proxy
+////////////////////////////////////////////////////////////////////////////////
+
+      static void setReverseProxy (ReverseProxy*);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief health probes of the tasks, nullptr if not running
+////////////////////////////////////////////////////////////////////////////////
+
+      static HealthProbes* healthProbes ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets the health probes
+////////////////////////////////////////////////////////////////////////////////
+
+      static void setHealthProbes (HealthProbes*);
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief mode
 ////////////////////////////////////////////////////////////////////////////////
@@ -423,6 +449,36 @@ namespace arangodb {
       
       static void setOfferLimit(size_t offerLimit);
       static size_t offerLimit();
+
+      static void setOfferRetention(double offerRetention);
+      static double offerRetention();
+
+      static void setTaskTimeouts(std::string const& taskTimeouts);
+      static std::string taskTimeouts();
+
+      static void setSingleOfferLaunch(bool singleOfferLaunch);
+      static bool singleOfferLaunch();
+
+      static void setStateJournal(bool stateJournal);
+      static bool stateJournal();
+
+      static void setStateJournalMaxDeltas(size_t stateJournalMaxDeltas);
+      static size_t stateJournalMaxDeltas();
+
+      static void setStateJournalMaxBytes(size_t stateJournalMaxBytes);
+      static size_t stateJournalMaxBytes();
+
+      static void setStatePersistDelay(int statePersistDelay);
+      static int statePersistDelay();
+
+      static void setStateCompression(bool stateCompression);
+      static bool stateCompression();
+
+      static void setStandby(bool standby);
+      static bool standby();
+
+      static void setStandbySessionTimeout(double standbySessionTimeout);
+      static double standbySessionTimeout();
   };
 }
 
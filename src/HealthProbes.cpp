@@ -0,0 +1,481 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief active health checks of the tasks
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "HealthProbes.h"
+
+#include "ArangoState.h"
+#include "Global.h"
+#include "ReverseProxy.h"
+#include "utils.h"
+
+#include "logging/logging.hpp"
+
+#include <curl/curl.h>
+
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+
+using namespace arangodb;
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private constants
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief timeout of a probe and pause between two rounds
+////////////////////////////////////////////////////////////////////////////////
+
+static const long PROBE_TIMEOUT_MS = 2000;
+static const auto PROBE_INTERVAL = chrono::seconds(5);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief failed probes in a row after which a task is failing
+////////////////////////////////////////////////////////////////////////////////
+
+static const uint64_t FAILING_STREAK = 3;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief how often the prober looks for finished probes, in ms
+////////////////////////////////////////////////////////////////////////////////
+
+static const int PROBE_POLL_MS = 100;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief curl callback, the body of a probe is not needed
+////////////////////////////////////////////////////////////////////////////////
+
+static size_t discardBody (void*, size_t size, size_t nmemb, void*) {
+  return size * nmemb;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief names of the task types in log messages
+////////////////////////////////////////////////////////////////////////////////
+
+static string typeName (TaskType type) {
+  switch (type) {
+    case TaskType::AGENT:              return "agent";
+    case TaskType::COORDINATOR:        return "coordinator";
+    case TaskType::PRIMARY_DBSERVER:   return "dbserver";
+    case TaskType::SECONDARY_DBSERVER: return "secondary";
+    case TaskType::UNKNOWN:            break;
+  }
+
+  return "unknown";
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                class HealthProbes
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor
+////////////////////////////////////////////////////////////////////////////////
+
+HealthProbes::HealthProbes ()
+  : _stopping(false) {
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief destructor
+////////////////////////////////////////////////////////////////////////////////
+
+HealthProbes::~HealthProbes () {
+  stop();
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts probing
+////////////////////////////////////////////////////////////////////////////////
+
+void HealthProbes::start () {
+  _prober = thread(&HealthProbes::run, this);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief stops probing
+////////////////////////////////////////////////////////////////////////////////
+
+void HealthProbes::stop () {
+  {
+    lock_guard<mutex> guard(_probeLock);
+    _stopping = true;
+  }
+
+  _probeCondition.notify_all();
+
+  if (_prober.joinable()) {
+    _prober.join();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief what is known about all probed tasks
+////////////////////////////////////////////////////////////////////////////////
+
+vector<TaskHealth> HealthProbes::health () const {
+  lock_guard<mutex> guard(_lock);
+
+  vector<TaskHealth> result;
+  result.reserve(_health.size());
+
+  for (auto const& it : _health) {
+    result.push_back(it.second);
+  }
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief what is known about a task
+////////////////////////////////////////////////////////////////////////////////
+
+bool HealthProbes::find (TaskType type,
+                         string const& name,
+                         TaskHealth& health) const {
+  lock_guard<mutex> guard(_lock);
+
+  auto it = _health.find(make_pair(type, name));
+
+  if (it == _health.end()) {
+    return false;
+  }
+
+  health = it->second;
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief whether the last few probes of a task have all failed
+////////////////////////////////////////////////////////////////////////////////
+
+bool HealthProbes::failing (TaskType type, string const& name) const {
+  lock_guard<mutex> guard(_lock);
+
+  auto it = _health.find(make_pair(type, name));
+
+  return it != _health.end() && FAILING_STREAK <= it->second._failureStreak;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                             public static methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief upper bounds of the latency buckets in ms
+////////////////////////////////////////////////////////////////////////////////
+
+vector<double> const& HealthProbes::latencyBuckets () {
+  static const vector<double> buckets = {
+    1, 2, 5, 10, 25, 50, 100, 250, 500, 1000
+  };
+
+  return buckets;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the running tasks of the published state
+////////////////////////////////////////////////////////////////////////////////
+
+vector<HealthProbes::Probe> HealthProbes::runningTasks () {
+  static const TaskType types[] = {
+    TaskType::AGENT,
+    TaskType::COORDINATOR,
+    TaskType::PRIMARY_DBSERVER,
+    TaskType::SECONDARY_DBSERVER
+  };
+
+  auto snapshot = Global::state().snapshot();
+  State const& state = snapshot->state();
+
+  string scheme = Global::arangoDBSslKeyfile().empty() ? "http://" : "https://";
+  vector<Probe> probes;
+
+  for (auto type : types) {
+    TasksPlan const& plan = tasksPlan(state, type);
+    TasksCurrent const& current = tasksCurrent(state, type);
+
+    string path = type == TaskType::AGENT
+                ? "/_api/agency/config"
+                : "/_admin/server/availability";
+
+    for (int i = 0;  i < plan.entries_size() && i < current.entries_size();  ++i) {
+      TaskPlan const& entry = plan.entries(i);
+      TaskCurrent const& task = current.entries(i);
+
+      if (entry.state() != TASK_STATE_RUNNING || task.ports_size() == 0) {
+        continue;
+      }
+
+      Probe probe;
+      probe._type = type;
+      probe._name = entry.name();
+      probe._endpoint = scheme + task.hostname() + ":" + to_string(task.ports(0));
+      probe._url = probe._endpoint + path;
+
+      probes.push_back(probe);
+    }
+  }
+
+  return probes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief probes until stopped
+////////////////////////////////////////////////////////////////////////////////
+
+void HealthProbes::run () {
+  unique_lock<mutex> probeLock(_probeLock);
+
+  while (! _stopping) {
+    probeLock.unlock();
+
+    auto probes = runningTasks();
+
+    probeAll(probes);
+    retain(probes);
+
+    // the embedded reverse proxy skips the coordinators failing here
+    if (Global::reverseProxy() != nullptr) {
+      Global::reverseProxy()->updateHealth(health());
+    }
+
+    probeLock.lock();
+
+    _probeCondition.wait_for(probeLock, PROBE_INTERVAL, [this] () -> bool {
+      return _stopping;
+    });
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief probes all tasks in parallel and waits for the answers
+////////////////////////////////////////////////////////////////////////////////
+
+void HealthProbes::probeAll (vector<Probe> const& probes) {
+  if (probes.empty()) {
+    return;
+  }
+
+  CURLM* multi = curl_multi_init();
+
+  if (multi == nullptr) {
+    LOG(WARNING) << "health probes: cannot initialize libcurl";
+    return;
+  }
+
+  struct curl_slist* headers = nullptr;
+  string authorization = clusterAuthorization();
+
+  if (! authorization.empty()) {
+    string header = "Authorization: " + authorization;
+    headers = curl_slist_append(headers, header.c_str());
+  }
+
+  unordered_map<CURL*, size_t> running;
+
+  for (size_t i = 0;  i < probes.size();  ++i) {
+    CURL* handle = curl_easy_init();
+
+    if (handle == nullptr) {
+      record(probes[i], -1, 0, 0.0);
+      continue;
+    }
+
+    curl_easy_setopt(handle, CURLOPT_URL, probes[i]._url.c_str());
+    curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, PROBE_TIMEOUT_MS);
+    curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, discardBody);
+    curl_easy_setopt(handle, CURLOPT_SSL_VERIFYPEER, 0L);
+    curl_easy_setopt(handle, CURLOPT_SSL_VERIFYHOST, 0L);
+
+    if (headers != nullptr) {
+      curl_easy_setopt(handle, CURLOPT_HTTPHEADER, headers);
+    }
+
+    curl_multi_add_handle(multi, handle);
+    running[handle] = i;
+  }
+
+  int active = static_cast<int>(running.size());
+
+  while (0 < active) {
+    curl_multi_perform(multi, &active);
+
+    CURLMsg* msg;
+    int left;
+
+    while ((msg = curl_multi_info_read(multi, &left)) != nullptr) {
+      if (msg->msg != CURLMSG_DONE) {
+        continue;
+      }
+
+      CURL* handle = msg->easy_handle;
+      CURLcode res = msg->data.result;
+      long code = 0;
+      double seconds = 0.0;
+
+      if (res == CURLE_OK) {
+        curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &code);
+        curl_easy_getinfo(handle, CURLINFO_TOTAL_TIME, &seconds);
+      }
+
+      auto it = running.find(handle);
+
+      if (it != running.end()) {
+        record(probes[it->second], res, code, seconds * 1000.0);
+        running.erase(it);
+      }
+
+      curl_multi_remove_handle(multi, handle);
+      curl_easy_cleanup(handle);
+    }
+
+    if (0 < active) {
+      curl_multi_wait(multi, nullptr, 0, PROBE_POLL_MS, nullptr);
+    }
+  }
+
+  // handles libcurl has never reported as done
+  for (auto const& it : running) {
+    curl_multi_remove_handle(multi, it.first);
+    curl_easy_cleanup(it.first);
+  }
+
+  curl_multi_cleanup(multi);
+
+  if (headers != nullptr) {
+    curl_slist_free_all(headers);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief records the outcome of one probe
+////////////////////////////////////////////////////////////////////////////////
+
+void HealthProbes::record (Probe const& probe,
+                           int result,
+                           long code,
+                           double latency) {
+  lock_guard<mutex> guard(_lock);
+
+  auto& health = _health[make_pair(probe._type, probe._name)];
+
+  // a task restarted elsewhere starts over
+  if (health._endpoint != probe._endpoint) {
+    health = TaskHealth();
+    health._type = probe._type;
+    health._name = probe._name;
+    health._endpoint = probe._endpoint;
+    health._healthy = false;
+    health._probes = 0;
+    health._failures = 0;
+    health._failureStreak = 0;
+    health._latencies.assign(latencyBuckets().size() + 1, 0);
+  }
+
+  bool healthy = result == 0 && code == 200;
+
+  ++health._probes;
+  health._healthy = healthy;
+  health._lastResult = result;
+  health._lastCode = code;
+  health._lastLatency = latency;
+  health._lastProbe = chrono::system_clock::now();
+
+  if (result == 0) {
+    auto const& buckets = latencyBuckets();
+    size_t bucket = lower_bound(buckets.begin(), buckets.end(), latency)
+                  - buckets.begin();
+
+    ++health._latencies[bucket];
+  }
+
+  if (healthy) {
+    if (FAILING_STREAK <= health._failureStreak) {
+      LOG(INFO) << "health probes: " << typeName(probe._type) << " "
+                << probe._name << " is healthy again";
+    }
+
+    health._failureStreak = 0;
+    return;
+  }
+
+  ++health._failures;
+
+  if (++health._failureStreak == FAILING_STREAK) {
+    LOG(WARNING) << "health probes: " << typeName(probe._type) << " "
+                 << probe._name << " at " << probe._endpoint
+                 << " failed " << FAILING_STREAK << " probes in a row"
+                 << ", curl error: " << result << ", HTTP code: " << code;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief forgets the tasks no longer probed
+////////////////////////////////////////////////////////////////////////////////
+
+void HealthProbes::retain (vector<Probe> const& probes) {
+  set<pair<TaskType, string>> keys;
+
+  for (auto const& probe : probes) {
+    keys.emplace(probe._type, probe._name);
+  }
+
+  lock_guard<mutex> guard(_lock);
+
+  for (auto it = _health.begin();  it != _health.end();) {
+    if (keys.find(it->first) == keys.end()) {
+      it = _health.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
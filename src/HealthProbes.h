@@ -0,0 +1,240 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief active health checks of the tasks
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_HEALTH_PROBES_H
+#define ARANGO_HEALTH_PROBES_H 1
+
+#include "TaskIndex.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace arangodb {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  struct TaskHealth
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief what the probes know about one task, latencies are in ms
+////////////////////////////////////////////////////////////////////////////////
+
+  struct TaskHealth {
+    TaskType _type;
+    std::string _name;              // name in the plan
+    std::string _endpoint;
+    bool _healthy;                  // the last probe was answered with 200
+    uint64_t _probes;
+    uint64_t _failures;
+    uint64_t _failureStreak;        // failed probes since the last success
+    int _lastResult;                // libcurl error code of the last probe
+    long _lastCode;                 // HTTP code of the last probe
+    double _lastLatency;
+    std::chrono::system_clock::time_point _lastProbe;
+    std::vector<uint64_t> _latencies;   // answers per latency bucket
+  };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                class HealthProbes
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief probes all running tasks regularly
+///
+/// Every few seconds each agent is asked for /_api/agency/config and
+/// each coordinator, DBserver and secondary for /_admin/server/availability.
+/// All probes of a round run in parallel in the thread of the prober,
+/// each with a short timeout. A task is healthy if its last probe was
+/// answered with 200, it is failing after a few failed probes in a row.
+/// The latencies of the answers are counted in buckets.
+///
+/// The tasks are taken from the published state, statistics are reset
+/// when the endpoint of a task changes and dropped when it is no longer
+/// running. All public methods are thread-safe.
+////////////////////////////////////////////////////////////////////////////////
+
+  class HealthProbes {
+    HealthProbes (HealthProbes const&) = delete;
+    HealthProbes& operator= (HealthProbes const&) = delete;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor
+////////////////////////////////////////////////////////////////////////////////
+
+      HealthProbes ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief destructor
+////////////////////////////////////////////////////////////////////////////////
+
+      ~HealthProbes ();
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts probing
+////////////////////////////////////////////////////////////////////////////////
+
+      void start ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief stops probing
+////////////////////////////////////////////////////////////////////////////////
+
+      void stop ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief what is known about all probed tasks, ordered by type and name
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<TaskHealth> health () const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief what is known about a task, returns false if it was not probed
+////////////////////////////////////////////////////////////////////////////////
+
+      bool find (TaskType, std::string const& name, TaskHealth&) const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief whether the last few probes of a task have all failed, a task
+/// not probed yet is not failing
+////////////////////////////////////////////////////////////////////////////////
+
+      bool failing (TaskType, std::string const& name) const;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                             public static methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief upper bounds of the latency buckets in ms, the last bucket of a
+/// task counts all slower answers
+////////////////////////////////////////////////////////////////////////////////
+
+      static std::vector<double> const& latencyBuckets ();
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                     private types
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a task to probe
+////////////////////////////////////////////////////////////////////////////////
+
+      struct Probe {
+        TaskType _type;
+        std::string _name;
+        std::string _endpoint;
+        std::string _url;
+      };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the running tasks of the published state
+////////////////////////////////////////////////////////////////////////////////
+
+      static std::vector<Probe> runningTasks ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief probes until stopped
+////////////////////////////////////////////////////////////////////////////////
+
+      void run ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief probes all tasks in parallel and waits for the answers
+////////////////////////////////////////////////////////////////////////////////
+
+      void probeAll (std::vector<Probe> const&);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief records the outcome of one probe
+////////////////////////////////////////////////////////////////////////////////
+
+      void record (Probe const&, int result, long code, double latency);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief forgets the tasks no longer probed
+////////////////////////////////////////////////////////////////////////////////
+
+      void retain (std::vector<Probe> const&);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private variables
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the health of the tasks by type and name
+////////////////////////////////////////////////////////////////////////////////
+
+      mutable std::mutex _lock;
+      std::map<std::pair<TaskType, std::string>, TaskHealth> _health;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the prober
+////////////////////////////////////////////////////////////////////////////////
+
+      std::thread _prober;
+      std::mutex _probeLock;
+      std::condition_variable _probeCondition;
+      bool _stopping;
+  };
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
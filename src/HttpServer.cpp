@@ -30,6 +30,8 @@
 #include "ArangoManager.h"
 #include "Caretaker.h"
 #include "Global.h"
+#include "HealthProbes.h"
+#include "ReverseProxy.h"
 #include "utils.h"
 
 #include <string.h>
@@ -110,17 +112,22 @@ class arangodb::HttpServerImpl {
   public:
     string POST_V1_DESTROY (const string&, const string&);
     string POST_V1_RESTART (const string&, const string&);
-    string PUT_V1_IGNOREOFFERS (const string&, const string&);
+    string PUT_V1_IGNOREOFFERS (const string&, const string&, unsigned int&);
+    string PUT_V1_TIMEOUTS (const string&, const string&, unsigned int&);
 
     string GET_V1_STATE (const string&);
     string GET_V1_MODE (const string&);
     string GET_V1_HEALTH (const string&);
     string GET_V1_ENDPOINTS (const string&);
+    string GET_V1_TIMEOUTS (const string&);
+    string GET_V1_RESTART (const string&);
 
     string GET_DEBUG_TARGET (const string&);
     string GET_DEBUG_PLAN (const string&);
     string GET_DEBUG_CURRENT (const string&);
     string GET_DEBUG_OVERVIEW (const string&);
+    string GET_DEBUG_STATISTICS (const string&);
+    string GET_DEBUG_TASKS (const string&);
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -148,19 +155,77 @@ string HttpServerImpl::POST_V1_DESTROY (const string& name, const string& body)
 
 string HttpServerImpl::POST_V1_RESTART(const string& name, const string& body) {
   LOG(INFO) << "Got POST to restart cluster and framework...";
-  Global::manager().restart();
-  // std::thread killer(doDestroy);
-  // killer.detach();
 
-  picojson::value result = picojson::value(true);
-  return result.serialize();
+  uint32_t parallelism = 1;
+  picojson::value b;
+
+  if (! body.empty() && picojson::parse(b, body).empty() &&
+      b.is<picojson::object>()) {
+    auto& o = b.get<picojson::object>();
+    auto it = o.find("parallelism");
+
+    if (it != o.end() && it->second.is<double>() && 1 <= it->second.get<double>()) {
+      parallelism = static_cast<uint32_t>(it->second.get<double>());
+    }
+  }
+
+  // the restart runs in the background, its progress is shown by
+  // GET /v1/restart.json
+  string id = Global::manager().restart(parallelism);
+
+  picojson::object result;
+  result["id"] = picojson::value(id);
+
+  return picojson::value(result).serialize();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief GET /v1/restart.json
+////////////////////////////////////////////////////////////////////////////////
+
+string HttpServerImpl::GET_V1_RESTART (const string&) {
+  auto snapshot = Global::state().snapshot();
+  State const& state = snapshot->state();
+
+  picojson::object result;
+  result["running"] = picojson::value(state.has_restart());
+  result["finished"] = picojson::value(Global::manager().finishedRestart());
+
+  if (! state.has_restart()) {
+    return picojson::value(result).serialize();
+  }
+
+  Restart const& restart = state.restart();
+
+  picojson::array tasks;
+
+  if (0 < restart.buckets_size()) {
+    for (auto const& task : restart.buckets(0).restart_tasks()) {
+      picojson::object entry;
+      entry["type"] = picojson::value(static_cast<double>(task.task_type()));
+      entry["name"] = picojson::value(task.task_name());
+      entry["restarted"] = picojson::value(task.restarted());
+
+      tasks.push_back(picojson::value(entry));
+    }
+  }
+
+  result["id"] = picojson::value(restart.id());
+  result["parallelism"] = picojson::value(static_cast<double>(restart.parallelism()));
+  result["buckets"] = picojson::value(static_cast<double>(restart.total_buckets()));
+  result["remaining"] = picojson::value(static_cast<double>(restart.buckets_size()));
+  result["tasks"] = picojson::value(tasks);
+
+  return picojson::value(result).serialize();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief PUT /v1/ignoreOffers
 ////////////////////////////////////////////////////////////////////////////////
 
-string HttpServerImpl::PUT_V1_IGNOREOFFERS (const string& name, const string& body) {
+string HttpServerImpl::PUT_V1_IGNOREOFFERS (const string& name,
+                                            const string& body,
+                                            unsigned int& status) {
   int ignore = 0;
   picojson::value b;
   std::string err = picojson::parse(b, body);
@@ -176,6 +241,7 @@ string HttpServerImpl::PUT_V1_IGNOREOFFERS (const string& name, const string& bo
 
   LOG(INFO) << "Got PUT for ignoreOffers flags, new value " << ignore;
   Global::setIgnoreOffers(ignore);
+  Global::manager().wakeup(ArangoManager::Wakeup::ADMIN);
 
   picojson::object result;
   result["ignoreOffers"] = picojson::value(static_cast<double>(ignore));
@@ -183,17 +249,91 @@ string HttpServerImpl::PUT_V1_IGNOREOFFERS (const string& name, const string& bo
   return picojson::value(result).serialize();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief timeouts of the task states
+////////////////////////////////////////////////////////////////////////////////
+
+static picojson::object taskTimeouts () {
+  picojson::object timeouts;
+
+  for (auto const& entry : Global::manager().timeouts().entries()) {
+    timeouts[entry._name] = picojson::value(entry._seconds);
+  }
+
+  return timeouts;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief PUT /v1/timeouts.json
+////////////////////////////////////////////////////////////////////////////////
+
+string HttpServerImpl::PUT_V1_TIMEOUTS (const string& name,
+                                        const string& body,
+                                        unsigned int& status) {
+  picojson::value b;
+  std::string err = picojson::parse(b, body);
+
+  if (err.empty() && ! b.is<picojson::object>()) {
+    err = "expecting an object with timeouts";
+  }
+
+  // all entries are checked before any is applied
+  vector<TaskTimeouts::Entry> entries;
+
+  if (err.empty()) {
+    for (auto const& entry : b.get<picojson::object>()) {
+      if (! entry.second.is<double>()) {
+        err = "expecting a number of seconds for '" + entry.first + "'";
+        break;
+      }
+
+      TaskTimeouts::Entry timeout = { entry.first, entry.second.get<double>() };
+      entries.push_back(timeout);
+    }
+  }
+
+  if (err.empty() && Global::manager().timeouts().set(entries, err)) {
+    for (auto const& entry : entries) {
+      LOG(INFO) << "Got PUT for timeout " << entry._name
+                << ", new value " << entry._seconds;
+    }
+
+    Global::manager().wakeup(ArangoManager::Wakeup::ADMIN);
+  }
+
+  picojson::object result;
+  result["timeouts"] = picojson::value(taskTimeouts());
+
+  if (! err.empty()) {
+    status = MHD_HTTP_BAD_REQUEST;
+    result["error"] = picojson::value(err);
+  }
+
+  return picojson::value(result).serialize();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief GET /v1/timeouts.json
+////////////////////////////////////////////////////////////////////////////////
+
+string HttpServerImpl::GET_V1_TIMEOUTS (const string&) {
+  picojson::object result;
+  result["timeouts"] = picojson::value(taskTimeouts());
+
+  return picojson::value(result).serialize();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief GET /v1/state.json
 ////////////////////////////////////////////////////////////////////////////////
 
 string HttpServerImpl::GET_V1_STATE (const string&) {
-  auto lease = Global::state().lease();
+  auto snapshot = Global::state().snapshot();
   
   picojson::object result;
   result["mode"] = picojson::value(Global::modeLC());
   result["asyncReplication"] = picojson::value(Global::asyncReplication());
-  result["health"] = picojson::value(Global::state().clusterHealthy(lease));
+  result["health"] = picojson::value(Global::state().clusterHealthy(*snapshot));
   result["role"] = picojson::value(Global::role());
   result["framework_name"] = picojson::value(Global::frameworkName());
   result["master_url"] = picojson::value(Global::masterUrl());
@@ -244,7 +384,53 @@ string HttpServerImpl::GET_V1_ENDPOINTS (const string&) {
 ////////////////////////////////////////////////////////////////////////////////
 
 string HttpServerImpl::GET_V1_HEALTH (const string&) {
-  return "null";
+  auto snapshot = Global::state().snapshot();
+
+  picojson::object result;
+  result["health"] = picojson::value(Global::state().clusterHealthy(*snapshot));
+
+  HealthProbes* probes = Global::healthProbes();
+
+  if (probes == nullptr) {
+    return picojson::value(result).serialize();
+  }
+
+  picojson::array buckets;
+
+  for (auto bound : HealthProbes::latencyBuckets()) {
+    buckets.push_back(picojson::value(bound));
+  }
+
+  picojson::array tasks;
+
+  for (auto const& health : probes->health()) {
+    picojson::array latencies;
+
+    for (auto count : health._latencies) {
+      latencies.push_back(picojson::value(static_cast<double>(count)));
+    }
+
+    picojson::object task;
+    task["type"] = picojson::value(static_cast<double>(static_cast<int>(health._type)));
+    task["name"] = picojson::value(health._name);
+    task["endpoint"] = picojson::value(health._endpoint);
+    task["healthy"] = picojson::value(health._healthy);
+    task["probes"] = picojson::value(static_cast<double>(health._probes));
+    task["failures"] = picojson::value(static_cast<double>(health._failures));
+    task["failureStreak"] = picojson::value(static_cast<double>(health._failureStreak));
+    task["lastCode"] = picojson::value(static_cast<double>(health._lastCode));
+    task["lastError"] = picojson::value(static_cast<double>(health._lastResult));
+    task["lastLatency"] = picojson::value(health._lastLatency);
+    task["lastProbe"] = picojson::value(toStringSystemTime(health._lastProbe));
+    task["latencies"] = picojson::value(latencies);
+
+    tasks.push_back(picojson::value(task));
+  }
+
+  result["latencyBuckets"] = picojson::value(buckets);
+  result["tasks"] = picojson::value(tasks);
+
+  return picojson::value(result).serialize();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -252,8 +438,8 @@ string HttpServerImpl::GET_V1_HEALTH (const string&) {
 ////////////////////////////////////////////////////////////////////////////////
 
 string HttpServerImpl::GET_DEBUG_TARGET (const string& name) {
-  auto lease = Global::state().lease();
-  return arangodb::toJson(lease.state().targets());
+  auto snapshot = Global::state().snapshot();
+  return arangodb::toJson(snapshot->state().targets());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -261,8 +447,8 @@ string HttpServerImpl::GET_DEBUG_TARGET (const string& name) {
 ////////////////////////////////////////////////////////////////////////////////
 
 string HttpServerImpl::GET_DEBUG_PLAN (const string& name) {
-  auto lease = Global::state().lease();
-  return arangodb::toJson(lease.state().plan());
+  auto snapshot = Global::state().snapshot();
+  return arangodb::toJson(snapshot->state().plan());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -270,8 +456,8 @@ string HttpServerImpl::GET_DEBUG_PLAN (const string& name) {
 ////////////////////////////////////////////////////////////////////////////////
 
 string HttpServerImpl::GET_DEBUG_CURRENT (const string& name) {
-  auto lease = Global::state().lease();
-  return arangodb::toJson(lease.state().current());
+  auto snapshot = Global::state().snapshot();
+  return arangodb::toJson(snapshot->state().current());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -279,16 +465,228 @@ string HttpServerImpl::GET_DEBUG_CURRENT (const string& name) {
 ////////////////////////////////////////////////////////////////////////////////
 
 string HttpServerImpl::GET_DEBUG_OVERVIEW (const string& name) {
-  auto lease = Global::state().lease();
+  auto snapshot = Global::state().snapshot();
+  State const& state = snapshot->state();
 
-  return "{ \"frameworkId\" : \"" + lease.state().framework_id().value() + "\""
+  return "{ \"frameworkId\" : \"" + state.framework_id().value() + "\""
        + ", \"frameworkName\" : \"" + Global::frameworkName() + "\""
-       + ", \"target\" : " + arangodb::toJson(lease.state().targets())
-       + ", \"plan\" : " + arangodb::toJson(lease.state().plan())
-       + ", \"current\" : " + arangodb::toJson(lease.state().current()) + " }";
+       + ", \"target\" : " + arangodb::toJson(state.targets())
+       + ", \"plan\" : " + arangodb::toJson(state.plan())
+       + ", \"current\" : " + arangodb::toJson(state.current()) + " }";
   
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief GET /debug/tasks
+////////////////////////////////////////////////////////////////////////////////
+
+string HttpServerImpl::GET_DEBUG_TASKS (const string& name) {
+  static const TaskType types[] = {
+    TaskType::AGENT,
+    TaskType::COORDINATOR,
+    TaskType::PRIMARY_DBSERVER,
+    TaskType::SECONDARY_DBSERVER
+  };
+
+  auto snapshot = Global::state().snapshot();
+  State const& state = snapshot->state();
+
+  string result = "[";
+  string sep = "";
+
+  for (auto type : types) {
+    TasksPlan const& plan = tasksPlan(state, type);
+    TasksCurrent const& current = tasksCurrent(state, type);
+
+    for (int i = 0;  i < current.entries_size() && i < plan.entries_size();  ++i) {
+      TaskCurrent const& entry = current.entries(i);
+
+      if (entry.task_id().empty()) {
+        continue;
+      }
+
+      // the task info is not stored, but regenerated from the template
+      mesos::TaskInfo info = Global::caretaker().taskInfo(state, type, i);
+      string hash = Caretaker::launchHash(info);
+
+      // this endpoint is not authenticated, never show the secret
+      auto variables = info.mutable_command()->mutable_environment()
+                       ->mutable_variables();
+
+      for (auto& variable : *variables) {
+        if (variable.name() == "JWT_SECRET") {
+          variable.set_value("<redacted>");
+        }
+      }
+
+      result += sep
+        + "{ \"name\" : " + picojson::value(plan.entries(i).name()).serialize()
+        + ", \"taskId\" : " + picojson::value(entry.task_id()).serialize()
+        + ", \"launchHash\" : \"" + entry.launch_hash() + "\""
+        + ", \"templateHash\" : \"" + hash + "\""
+        + ", \"changed\" : " + (hash == entry.launch_hash() ? "false" : "true")
+        + ", \"taskInfo\" : " + arangodb::toJson(info) + " }";
+      sep = ", ";
+    }
+  }
+
+  return result + "]";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief converts lease statistics into json
+////////////////////////////////////////////////////////////////////////////////
+
+static picojson::value leaseStatisticsJson (
+    ArangoState::LeaseStatistics const& statistics) {
+  picojson::object result;
+
+  result["granted"] = picojson::value(static_cast<double>(statistics._granted));
+  result["contended"] = picojson::value(static_cast<double>(statistics._contended));
+  result["waitTotal"] = picojson::value(statistics._waitTotal);
+  result["waitMax"] = picojson::value(statistics._waitMax);
+  result["waitAverage"] = picojson::value(
+    statistics._contended == 0 
+      ? 0.0 
+      : statistics._waitTotal / statistics._contended);
+
+  return picojson::value(result);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief GET /debug/statistics
+////////////////////////////////////////////////////////////////////////////////
+
+string HttpServerImpl::GET_DEBUG_STATISTICS (const string& name) {
+  picojson::object leases;
+  leases["read"] = leaseStatisticsJson(Global::state().readLeaseStatistics());
+  leases["write"] = leaseStatisticsJson(Global::state().writeLeaseStatistics());
+
+  auto const persistence = Global::state().persistenceStatistics();
+
+  picojson::object state;
+  state["journal"] = picojson::value(Global::stateJournal());
+  state["changes"] = picojson::value(static_cast<double>(persistence._changes));
+  state["flushes"] = picojson::value(static_cast<double>(persistence._flushes));
+  state["coalesced"] = picojson::value(static_cast<double>(persistence._coalesced));
+  state["snapshots"] = picojson::value(static_cast<double>(persistence._snapshots));
+  state["snapshotBytes"] = picojson::value(static_cast<double>(persistence._snapshotBytes));
+  state["deltas"] = picojson::value(static_cast<double>(persistence._deltas));
+  state["deltaBytes"] = picojson::value(static_cast<double>(persistence._deltaBytes));
+  state["unchanged"] = picojson::value(static_cast<double>(persistence._unchanged));
+  state["replayed"] = picojson::value(static_cast<double>(persistence._replayed));
+  state["compression"] = picojson::value(Global::stateCompression());
+  state["shardsWritten"] = picojson::value(static_cast<double>(persistence._shardsWritten));
+  state["shardsUnchanged"] = picojson::value(static_cast<double>(persistence._shardsUnchanged));
+
+  auto const cycles = Global::manager().dispatcherStatistics();
+
+  picojson::object wakeups;
+  wakeups["offers"] = picojson::value(static_cast<double>(cycles._offers));
+  wakeups["rescinds"] = picojson::value(static_cast<double>(cycles._rescinds));
+  wakeups["statusUpdates"] = picojson::value(static_cast<double>(cycles._statusUpdates));
+  wakeups["registered"] = picojson::value(static_cast<double>(cycles._registered));
+  wakeups["admin"] = picojson::value(static_cast<double>(cycles._admin));
+  wakeups["requests"] = picojson::value(static_cast<double>(cycles._requests));
+  wakeups["deadlines"] = picojson::value(static_cast<double>(cycles._deadlines));
+
+  picojson::object dispatcher;
+  dispatcher["cycles"] = picojson::value(static_cast<double>(cycles._cycles));
+  dispatcher["wakeups"] = picojson::value(wakeups);
+  dispatcher["cycleLast"] = picojson::value(cycles._cycleLast);
+  dispatcher["cycleMax"] = picojson::value(cycles._cycleMax);
+  dispatcher["cycleAverage"] = picojson::value(
+    cycles._cycles == 0
+      ? 0.0
+      : cycles._cycleTotal / cycles._cycles);
+  dispatcher["latencyLast"] = picojson::value(cycles._latencyLast);
+  dispatcher["latencyMax"] = picojson::value(cycles._latencyMax);
+  dispatcher["queueWaits"] = picojson::value(static_cast<double>(cycles._queueWaits));
+
+  auto const inventory = Global::manager().offerStatistics();
+
+  picojson::object declined;
+  declined["noPorts"] = picojson::value(static_cast<double>(inventory._noPorts));
+  declined["noResources"] = picojson::value(static_cast<double>(inventory._noResources));
+  declined["antiAffinity"] = picojson::value(static_cast<double>(inventory._antiAffinity));
+  declined["notNeeded"] = picojson::value(static_cast<double>(inventory._notNeeded));
+  declined["limit"] = picojson::value(static_cast<double>(inventory._limit));
+
+  picojson::object offers;
+  offers["held"] = picojson::value(static_cast<double>(inventory._held));
+  offers["agents"] = picojson::value(static_cast<double>(inventory._agents));
+  offers["received"] = picojson::value(static_cast<double>(inventory._received));
+  offers["merged"] = picojson::value(static_cast<double>(inventory._merged));
+  offers["used"] = picojson::value(static_cast<double>(inventory._used));
+  offers["retained"] = picojson::value(static_cast<double>(inventory._retained));
+  offers["rescinded"] = picojson::value(static_cast<double>(inventory._rescinded));
+  offers["declined"] = picojson::value(declined);
+
+  auto const reconciliation = Global::manager().reconciliationStatistics();
+
+  picojson::object implicitReconciliation;
+  implicitReconciliation["requests"] = picojson::value(static_cast<double>(reconciliation._implicit));
+  implicitReconciliation["answers"] = picojson::value(static_cast<double>(reconciliation._implicitAnswers));
+  implicitReconciliation["latencyLast"] = picojson::value(reconciliation._implicitLatencyLast);
+  implicitReconciliation["latencyMax"] = picojson::value(reconciliation._implicitLatencyMax);
+
+  picojson::object explicitReconciliation;
+  explicitReconciliation["requests"] = picojson::value(static_cast<double>(reconciliation._explicit));
+  explicitReconciliation["tasks"] = picojson::value(static_cast<double>(reconciliation._explicitTasks));
+  explicitReconciliation["answers"] = picojson::value(static_cast<double>(reconciliation._explicitAnswers));
+  explicitReconciliation["latencyLast"] = picojson::value(reconciliation._explicitLatencyLast);
+  explicitReconciliation["latencyMax"] = picojson::value(reconciliation._explicitLatencyMax);
+  explicitReconciliation["latencyAverage"] = picojson::value(
+    reconciliation._explicitAnswers == 0
+      ? 0.0
+      : reconciliation._explicitLatencyTotal / reconciliation._explicitAnswers);
+
+  picojson::object reconcile;
+  reconcile["pending"] = picojson::value(static_cast<double>(reconciliation._pending));
+  reconcile["implicit"] = picojson::value(implicitReconciliation);
+  reconcile["explicit"] = picojson::value(explicitReconciliation);
+
+  auto const targetSync = Global::manager().targetStatistics();
+
+  picojson::object targets;
+  targets["requests"] = picojson::value(static_cast<double>(targetSync._requests));
+  targets["notModified"] = picojson::value(static_cast<double>(targetSync._notModified));
+  targets["unchanged"] = picojson::value(static_cast<double>(targetSync._unchanged));
+  targets["changes"] = picojson::value(static_cast<double>(targetSync._changes));
+  targets["failures"] = picojson::value(static_cast<double>(targetSync._failures));
+
+  picojson::object result;
+  result["leases"] = picojson::value(leases);
+  result["persistence"] = picojson::value(state);
+  result["dispatcher"] = picojson::value(dispatcher);
+  result["offers"] = picojson::value(offers);
+  result["reconciliation"] = picojson::value(reconcile);
+  result["targets"] = picojson::value(targets);
+
+  if (Global::reverseProxy() != nullptr) {
+    picojson::array proxy;
+
+    for (auto const& stats : Global::reverseProxy()->statistics()) {
+      picojson::object coordinator;
+      coordinator["name"] = picojson::value(stats._name);
+      coordinator["healthy"] = picojson::value(stats._healthy);
+      coordinator["draining"] = picojson::value(stats._draining);
+      coordinator["outstanding"] = picojson::value(static_cast<double>(stats._outstanding));
+      coordinator["requests"] = picojson::value(static_cast<double>(stats._requests));
+      coordinator["failures"] = picojson::value(static_cast<double>(stats._failures));
+      coordinator["connections"] = picojson::value(static_cast<double>(stats._connections));
+      coordinator["latency"] = picojson::value(stats._latency);
+      coordinator["probeLatency"] = picojson::value(stats._probeLatency);
+
+      proxy.push_back(picojson::value(coordinator));
+    }
+
+    result["proxy"] = picojson::value(proxy);
+  }
+
+  return picojson::value(result).serialize();
+}
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                  class HttpServer
 // -----------------------------------------------------------------------------
@@ -327,7 +725,8 @@ struct ConnectionInfo {
 
   string (HttpServerImpl::*getMethod)(const string&);
   string (HttpServerImpl::*postMethod)(const string&, const string&);
-  string (HttpServerImpl::*putMethod)(const string&, const string&);
+  string (HttpServerImpl::*putMethod)(const string&, const string&,
+                                      unsigned int&);
 
   string prefix;
   string body;
@@ -390,14 +789,20 @@ static int answerRequest (
       }
       else if (0 == strcmp(url, "/v1/health.json")) {
         conInfo->getMethod = &HttpServerImpl::GET_V1_HEALTH;
-        auto lease = Global::state().lease();
-        if (!Global::state().clusterHealthy(lease)) {
+        auto snapshot = Global::state().snapshot();
+        if (!Global::state().clusterHealthy(*snapshot)) {
           conInfo->status = MHD_HTTP_SERVICE_UNAVAILABLE;
         }
       }
       else if (0 == strcmp(url, "/v1/endpoints.json")) {
         conInfo->getMethod = &HttpServerImpl::GET_V1_ENDPOINTS;
       }
+      else if (0 == strcmp(url, "/v1/timeouts.json")) {
+        conInfo->getMethod = &HttpServerImpl::GET_V1_TIMEOUTS;
+      }
+      else if (0 == strcmp(url, "/v1/restart.json")) {
+        conInfo->getMethod = &HttpServerImpl::GET_V1_RESTART;
+      }
       else if (0 == strcmp(url, "/debug/target.json")) {
         conInfo->getMethod = &HttpServerImpl::GET_DEBUG_TARGET;
       }
@@ -410,6 +815,12 @@ static int answerRequest (
       else if (0 == strcmp(url, "/debug/overview.json")) {
         conInfo->getMethod = &HttpServerImpl::GET_DEBUG_OVERVIEW;
       }
+      else if (0 == strcmp(url, "/debug/statistics.json")) {
+        conInfo->getMethod = &HttpServerImpl::GET_DEBUG_STATISTICS;
+      }
+      else if (0 == strcmp(url, "/debug/tasks.json")) {
+        conInfo->getMethod = &HttpServerImpl::GET_DEBUG_TASKS;
+      }
       else {
         conInfo->filename = "assets/";
 
@@ -436,6 +847,9 @@ static int answerRequest (
       if (0 == strcmp(url, "/v1/ignoreOffers")) {
         conInfo->putMethod = &HttpServerImpl::PUT_V1_IGNOREOFFERS;
       }
+      else if (0 == strcmp(url, "/v1/timeouts.json")) {
+        conInfo->putMethod = &HttpServerImpl::PUT_V1_TIMEOUTS;
+      }
     }
 
     if (conInfo->getMethod == nullptr && conInfo->postMethod == nullptr && conInfo->putMethod == nullptr && conInfo->filename.empty()) {
@@ -510,7 +924,8 @@ static int answerRequest (
     LOG(INFO)
     << "handling http request '" << method << " " << url << "'";
 
-    const string r = (me->*(conInfo->putMethod))(conInfo->prefix, conInfo->body);
+    const string r = (me->*(conInfo->putMethod))(
+      conInfo->prefix, conInfo->body, conInfo->status);
 
     response = MHD_create_response_from_buffer(
       r.length(), (void *) r.c_str(),
@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief election of the active framework instance
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "LeaderElection.h"
+
+#include <zookeeper/url.hpp>
+
+#include <stout/net.hpp>
+
+#include "logging/logging.hpp"
+
+#include <unistd.h>
+
+using namespace arangodb;
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                              class LeaderElection
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor
+////////////////////////////////////////////////////////////////////////////////
+
+LeaderElection::LeaderElection (string const& name,
+                                string const& zk,
+                                double sessionTimeout)
+  : _name(name),
+    _zk(zk),
+    _sessionTimeout(sessionTimeout),
+    _leading(false) {
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief destructor
+////////////////////////////////////////////////////////////////////////////////
+
+LeaderElection::~LeaderElection () {
+  _detector.reset();
+  _group.reset();
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief joins the group of candidates
+////////////////////////////////////////////////////////////////////////////////
+
+void LeaderElection::join () {
+  Try<zookeeper::URL> url = zookeeper::URL::parse(_zk);
+
+  if (url.isError()) {
+    LOG(ERROR) << "FATAL cannot parse zookeeper '" << _zk << "'";
+    exit(EXIT_FAILURE);
+  }
+
+  // the candidates live next to the state, not below it, such that they
+  // do not show up as variables of the state
+  string znode = url.get().path + "-leader/" + _name;
+
+  _detector.reset();
+  _group.reset(new zookeeper::Group(url.get().servers,
+                                    Seconds(_sessionTimeout),
+                                    znode,
+                                    url.get().authentication));
+  _detector.reset(new zookeeper::LeaderDetector(_group.get()));
+
+  Try<string> hostname = net::hostname();
+  string data = (hostname.isSome() ? hostname.get() : string("unknown"))
+              + ":" + to_string(getpid());
+
+  auto membership = _group->join(data);
+
+  if (! membership.await(Seconds(3 * _sessionTimeout)) ||
+      ! membership.isReady()) {
+    LOG(ERROR)
+    << "FATAL cannot join leader election at " << znode;
+    exit(EXIT_FAILURE);
+  }
+
+  _membership = membership.get();
+  _leader = None();
+  _detection = _detector->detect(None());
+
+  LOG(INFO)
+  << "joined leader election at " << znode
+  << " as candidate " << _membership.get().id();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief waits for a change of the leader
+////////////////////////////////////////////////////////////////////////////////
+
+bool LeaderElection::awaitLeadership (double seconds) {
+  if (_leading) {
+    return true;
+  }
+
+  // the session of a standby can expire as well, it simply joins again
+  if (! _membership.get().cancelled().isPending()) {
+    LOG(WARNING) << "lost candidacy in leader election, joining again";
+    join();
+  }
+
+  if (! _detection.await(Seconds(seconds))) {
+    return false;
+  }
+
+  if (_detection.isReady()) {
+    _leader = _detection.get();
+
+    if (_leader.isSome() && _leader.get() == _membership.get()) {
+      lead();
+      return true;
+    }
+
+    if (_leader.isSome()) {
+      LOG(INFO)
+      << "standing by, leader is candidate " << _leader.get().id();
+    }
+  }
+  else {
+    LOG(WARNING) << "cannot detect leader, trying again";
+  }
+
+  _detection = _detector->detect(_leader);
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief called once this instance has become the leader
+////////////////////////////////////////////////////////////////////////////////
+
+void LeaderElection::lead () {
+  _leading = true;
+
+  LOG(INFO)
+  << "candidate " << _membership.get().id() << " is now the leader";
+
+  // once the session has expired, the next candidate takes over, so we
+  // must not touch the state or the cluster any longer
+  _membership.get().cancelled().onReady([] (bool) {
+    LOG(ERROR) << "FATAL lost leadership, exiting";
+    exit(EXIT_FAILURE);
+  });
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief election of the active framework instance
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_LEADER_ELECTION_H
+#define ARANGO_LEADER_ELECTION_H 1
+
+#include <zookeeper/detector.hpp>
+#include <zookeeper/group.hpp>
+
+#include <memory>
+#include <string>
+
+namespace arangodb {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                              class LeaderElection
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief election of the framework instance in charge
+///
+/// All instances of a framework started in standby mode join a zookeeper
+/// group next to the state. The member with the lowest sequence number
+/// is the leader, all others stand by. When the zookeeper session of the
+/// leader expires, its membership vanishes and the next member takes
+/// over. A leader which loses its membership exits right away, such that
+/// there is never more than one instance acting on the state.
+////////////////////////////////////////////////////////////////////////////////
+
+  class LeaderElection {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor
+////////////////////////////////////////////////////////////////////////////////
+
+      LeaderElection (std::string const& name,
+                      std::string const& zk,
+                      double sessionTimeout);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief destructor
+////////////////////////////////////////////////////////////////////////////////
+
+      ~LeaderElection ();
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief joins the group of candidates, exits if this is impossible
+////////////////////////////////////////////////////////////////////////////////
+
+      void join ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief waits at most the given number of seconds for a change of the
+/// leader, returns true if this instance is the leader
+////////////////////////////////////////////////////////////////////////////////
+
+      bool awaitLeadership (double seconds);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief whether this instance is the leader
+////////////////////////////////////////////////////////////////////////////////
+
+      bool isLeader () const {
+        return _leading;
+      }
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief called once this instance has become the leader
+////////////////////////////////////////////////////////////////////////////////
+
+      void lead ();
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private variables
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief name of the framework
+////////////////////////////////////////////////////////////////////////////////
+
+      std::string const _name;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief zookeeper url of the state
+////////////////////////////////////////////////////////////////////////////////
+
+      std::string const _zk;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief zookeeper session timeout in seconds
+////////////////////////////////////////////////////////////////////////////////
+
+      double const _sessionTimeout;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief group of candidates
+////////////////////////////////////////////////////////////////////////////////
+
+      std::unique_ptr<zookeeper::Group> _group;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief detector for the leader of the group
+////////////////////////////////////////////////////////////////////////////////
+
+      std::unique_ptr<zookeeper::LeaderDetector> _detector;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief our own membership
+////////////////////////////////////////////////////////////////////////////////
+
+      Option<zookeeper::Group::Membership> _membership;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the leader last detected
+////////////////////////////////////////////////////////////////////////////////
+
+      Option<zookeeper::Group::Membership> _leader;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief pending detection of a leader change
+////////////////////////////////////////////////////////////////////////////////
+
+      process::Future<Option<zookeeper::Group::Membership>> _detection;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief true once this instance is the leader
+////////////////////////////////////////////////////////////////////////////////
+
+      bool _leading;
+  };
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,219 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief bounded lock-free queue with many producers and one consumer
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_MPSC_QUEUE_H
+#define ARANGO_MPSC_QUEUE_H 1
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace arangodb {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  class MpscQueue
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief bounded lock-free queue with many producers and one consumer
+///
+/// A ring of cells, each with a sequence number telling whether it is free
+/// for the producer of a position or filled for the consumer. Producers
+/// claim a position with a compare-and-swap on the tail, the only consumer
+/// owns the head. Neither side ever blocks, push fails if the queue is
+/// full and pop if it is empty. The capacity is rounded up to a power of
+/// two.
+////////////////////////////////////////////////////////////////////////////////
+
+  template<typename T>
+  class MpscQueue {
+    MpscQueue (MpscQueue const&) = delete;
+    MpscQueue& operator= (MpscQueue const&) = delete;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor
+////////////////////////////////////////////////////////////////////////////////
+
+      explicit MpscQueue (size_t capacity)
+        : _cells(),
+          _mask(0),
+          _tail(0),
+          _head(0) {
+        size_t size = 2;
+
+        while (size < capacity) {
+          size *= 2;
+        }
+
+        _cells.reset(new Cell[size]);
+        _mask = size - 1;
+
+        for (size_t i = 0;  i < size;  ++i) {
+          _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+      }
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief appends a value, returns false if the queue is full, may be
+/// called by any thread
+////////////////////////////////////////////////////////////////////////////////
+
+      bool push (T const& value) {
+        Cell* cell;
+        size_t pos = _tail.load(std::memory_order_relaxed);
+
+        while (true) {
+          cell = &_cells[pos & _mask];
+
+          size_t sequence = cell->_sequence.load(std::memory_order_acquire);
+          intptr_t diff = static_cast<intptr_t>(sequence)
+                        - static_cast<intptr_t>(pos);
+
+          if (diff == 0) {
+            if (_tail.compare_exchange_weak(pos, pos + 1,
+                                            std::memory_order_relaxed)) {
+              break;
+            }
+          }
+          else if (diff < 0) {
+            return false;
+          }
+          else {
+            pos = _tail.load(std::memory_order_relaxed);
+          }
+        }
+
+        cell->_value = value;
+        cell->_sequence.store(pos + 1, std::memory_order_release);
+
+        return true;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief removes the first value, returns false if the queue is empty,
+/// must only be called by the consumer
+////////////////////////////////////////////////////////////////////////////////
+
+      bool pop (T& value) {
+        Cell* cell = &_cells[_head & _mask];
+
+        size_t sequence = cell->_sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence)
+                      - static_cast<intptr_t>(_head + 1);
+
+        if (diff < 0) {
+          return false;
+        }
+
+        value = std::move(cell->_value);
+        cell->_value = T();
+        cell->_sequence.store(_head + _mask + 1, std::memory_order_release);
+        ++_head;
+
+        return true;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the number of values the queue can hold
+////////////////////////////////////////////////////////////////////////////////
+
+      size_t capacity () const {
+        return _mask + 1;
+      }
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                     private types
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a cell of the ring, the sequence equals the position for a free
+/// cell and the position plus one for a filled one
+////////////////////////////////////////////////////////////////////////////////
+
+      struct Cell {
+        std::atomic<size_t> _sequence;
+        T _value;
+      };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private variables
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the ring
+////////////////////////////////////////////////////////////////////////////////
+
+      std::unique_ptr<Cell[]> _cells;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief size of the ring minus one
+////////////////////////////////////////////////////////////////////////////////
+
+      size_t _mask;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief next position to fill, shared by the producers
+////////////////////////////////////////////////////////////////////////////////
+
+      std::atomic<size_t> _tail;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief keeps the head off the cache line the producers write to
+////////////////////////////////////////////////////////////////////////////////
+
+      char _padding[64];
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief next position to take, owned by the consumer
+////////////////////////////////////////////////////////////////////////////////
+
+      size_t _head;
+  };
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,478 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief inventory of the offers received but not yet used
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "OfferInventory.h"
+
+#include "Global.h"
+#include "utils.h"
+
+#include "logging/logging.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+
+using namespace arangodb;
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private constants
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the longest refuse time as multiple of the configured one
+////////////////////////////////////////////////////////////////////////////////
+
+static const int MAX_REFUSE_FACTOR = 16;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief how long an unsuitable offer is kept
+////////////////////////////////////////////////////////////////////////////////
+
+static chrono::steady_clock::duration retention () {
+  return chrono::duration_cast<chrono::steady_clock::duration>(
+    chrono::duration<double>(Global::offerRetention()));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief compares two demands
+////////////////////////////////////////////////////////////////////////////////
+
+static bool sameDemand (vector<OfferDemand> const& left,
+                        vector<OfferDemand> const& right) {
+  if (left.size() != right.size()) {
+    return false;
+  }
+
+  for (size_t i = 0;  i < left.size();  ++i) {
+    if (left[i]._type != right[i]._type ||
+        left[i]._ports != right[i]._ports ||
+        left[i]._minimum != right[i]._minimum) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  public functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief name of a decline reason
+////////////////////////////////////////////////////////////////////////////////
+
+string arangodb::declineReasonName (DeclineReason reason) {
+  switch (reason) {
+    case DeclineReason::NOT_NEEDED:    return "not needed";
+    case DeclineReason::NO_PORTS:      return "no ports";
+    case DeclineReason::NO_RESOURCES:  return "no resources";
+    case DeclineReason::ANTI_AFFINITY: return "anti-affinity";
+    case DeclineReason::OFFER_LIMIT:   return "offer limit";
+  }
+
+  return "unknown";
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                              class OfferInventory
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor
+////////////////////////////////////////////////////////////////////////////////
+
+OfferInventory::OfferInventory () {
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets the tasks waiting for an offer
+////////////////////////////////////////////////////////////////////////////////
+
+bool OfferInventory::setDemand (vector<OfferDemand> const& demand) {
+  if (sameDemand(_demand, demand)) {
+    return false;
+  }
+
+  _demand = demand;
+
+  for (auto& entry : _offers) {
+    entry.second._score = score(entry.second._offer);
+  }
+
+  // the agents refused for long may well be suitable for the new tasks
+  bool refused = ! _backoff.empty();
+  _backoff.clear();
+
+  return refused;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief adds an offer
+////////////////////////////////////////////////////////////////////////////////
+
+vector<OfferInventory::Decline> OfferInventory::add (mesos::Offer const& offer,
+                                                     time_point now) {
+  vector<Decline> result;
+  string const& id = offer.id().value();
+
+  ++_statistics._received;
+
+  Entry entry = { offer, now, false, score(offer) };
+
+  if (_offers.find(id) != _offers.end()) {
+    _offers[id] = entry;
+    return result;
+  }
+
+  if (Global::offerLimit() <= _offers.size()) {
+    auto worst = _offers.end();
+
+    for (auto it = _offers.begin();  it != _offers.end();  ++it) {
+      if (worst == _offers.end() || it->second._score < worst->second._score) {
+        worst = it;
+      }
+    }
+
+    ++_statistics._limit;
+
+    if (worst == _offers.end() || entry._score <= worst->second._score) {
+      result.push_back({ offer.id(),
+                         refuseSeconds(offer.slave_id().value(),
+                                       DeclineReason::OFFER_LIMIT) });
+      return result;
+    }
+
+    mesos::Offer const& evicted = worst->second._offer;
+
+    result.push_back({ evicted.id(),
+                       refuseSeconds(evicted.slave_id().value(),
+                                     DeclineReason::OFFER_LIMIT) });
+    _offers.erase(worst);
+  }
+
+  _offers.emplace(id, entry);
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief removes a rescinded offer
+////////////////////////////////////////////////////////////////////////////////
+
+void OfferInventory::remove (mesos::OfferID const& offerId) {
+  if (_offers.erase(offerId.value()) != 0) {
+    ++_statistics._rescinded;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the offers held, merged by agent and best first
+////////////////////////////////////////////////////////////////////////////////
+
+vector<mesos::Offer> OfferInventory::take (
+    unordered_map<string, vector<mesos::OfferID>>& merged) {
+  merged.clear();
+
+  // oldest first, such that the id of a merged offer is the one of the
+  // offer held the longest
+  vector<Entry const*> entries;
+
+  for (auto const& entry : _offers) {
+    entries.push_back(&entry.second);
+  }
+
+  sort(entries.begin(), entries.end(),
+       [] (Entry const* left, Entry const* right) -> bool {
+    return left->_received < right->_received;
+  });
+
+  vector<mesos::Offer> offers;
+  unordered_map<string, size_t> agents;
+
+  for (auto entry : entries) {
+    mesos::Offer const& offer = entry->_offer;
+    auto it = agents.find(offer.slave_id().value());
+
+    if (it == agents.end()) {
+      agents.emplace(offer.slave_id().value(), offers.size());
+      offers.push_back(offer);
+      continue;
+    }
+
+    mesos::Offer& first = offers[it->second];
+    auto& ids = merged[first.id().value()];
+
+    if (ids.empty()) {
+      ids.push_back(first.id());
+      ++_statistics._merged;
+    }
+
+    ids.push_back(offer.id());
+    ++_statistics._merged;
+
+    first.mutable_resources()->MergeFrom(offer.resources());
+  }
+
+  vector<pair<double, size_t>> scores;
+
+  for (size_t i = 0;  i < offers.size();  ++i) {
+    scores.emplace_back(score(offers[i]), i);
+  }
+
+  stable_sort(scores.begin(), scores.end(),
+              [] (pair<double, size_t> const& left,
+                  pair<double, size_t> const& right) -> bool {
+    return left.first > right.first;
+  });
+
+  vector<mesos::Offer> result;
+
+  for (auto const& s : scores) {
+    result.push_back(offers[s.second]);
+  }
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief settles a batch handed out by take
+////////////////////////////////////////////////////////////////////////////////
+
+vector<OfferInventory::Decline> OfferInventory::settle (
+    vector<mesos::Offer> const& batch,
+    unordered_map<string, vector<mesos::OfferID>> const& merged,
+    unordered_set<string> const& accepted,
+    vector<pair<mesos::OfferID, DeclineReason>> const& declined,
+    time_point now) {
+  unordered_map<string, DeclineReason> reasons;
+
+  for (auto const& d : declined) {
+    reasons[d.first.value()] = d.second;
+  }
+
+  auto keep = retention();
+  vector<Decline> result;
+
+  for (auto const& offer : batch) {
+    string const& slaveId = offer.slave_id().value();
+    vector<mesos::OfferID> ids = { offer.id() };
+
+    auto m = merged.find(offer.id().value());
+
+    if (m != merged.end()) {
+      ids = m->second;
+    }
+
+    // used, an offer rescinded in the meantime is already gone
+    if (accepted.find(offer.id().value()) != accepted.end()) {
+      for (auto const& id : ids) {
+        _statistics._used += _offers.erase(id.value());
+      }
+
+      _backoff.erase(slaveId);
+      continue;
+    }
+
+    // an offer which was neither used nor declined is not needed either,
+    // it must not stay with us unnoticed
+    auto r = reasons.find(offer.id().value());
+    DeclineReason reason
+      = (r == reasons.end()) ? DeclineReason::NOT_NEEDED : r->second;
+
+    double refuse = -1.0;
+
+    for (auto const& id : ids) {
+      auto it = _offers.find(id.value());
+
+      if (it == _offers.end()) {
+        continue;
+      }
+
+      if (now - it->second._received < keep) {
+        it->second._kept = true;
+        ++_statistics._retained;
+        continue;
+      }
+
+      if (refuse < 0.0) {
+        refuse = refuseSeconds(slaveId, reason);
+
+        LOG(INFO)
+        << "declining offers of " << offer.hostname()
+        << " (" << declineReasonName(reason) << ")"
+        << " for " << refuse << " seconds";
+      }
+
+      switch (reason) {
+        case DeclineReason::NOT_NEEDED:    ++_statistics._notNeeded;    break;
+        case DeclineReason::NO_PORTS:      ++_statistics._noPorts;      break;
+        case DeclineReason::NO_RESOURCES:  ++_statistics._noResources;  break;
+        case DeclineReason::ANTI_AFFINITY: ++_statistics._antiAffinity; break;
+        case DeclineReason::OFFER_LIMIT:   ++_statistics._limit;        break;
+      }
+
+      result.push_back({ id, refuse });
+      _offers.erase(it);
+    }
+  }
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the time the retention of the first kept offer is over
+////////////////////////////////////////////////////////////////////////////////
+
+OfferInventory::time_point OfferInventory::nextExpiry () const {
+  auto keep = retention();
+  auto result = time_point::max();
+
+  for (auto const& entry : _offers) {
+    if (entry.second._kept && entry.second._received + keep < result) {
+      result = entry.second._received + keep;
+    }
+  }
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the inventory
+////////////////////////////////////////////////////////////////////////////////
+
+OfferInventory::Statistics OfferInventory::statistics () const {
+  Statistics result = _statistics;
+  unordered_set<string> agents;
+
+  for (auto const& entry : _offers) {
+    agents.insert(entry.second._offer.slave_id().value());
+  }
+
+  result._held = _offers.size();
+  result._agents = agents.size();
+
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief scores an offer against the waiting tasks
+///
+/// 3 if it contains resources reserved for our role, these may belong to
+/// a task waiting for its volume or restart, between 1 and 2 if it fits
+/// a waiting task, the higher the less it leaves unused, 0 otherwise.
+////////////////////////////////////////////////////////////////////////////////
+
+double OfferInventory::score (mesos::Offer const& offer) const {
+  mesos::Resources offered = offer.resources();
+
+  if (! offered.reserved(Global::role()).empty()) {
+    return 3.0;
+  }
+
+  double best = 0.0;
+
+  for (auto const& demand : _demand) {
+    if (numberPorts(offer, "") < demand._ports) {
+      continue;
+    }
+
+    if (! offered.find(demand._minimum).isSome()) {
+      continue;
+    }
+
+    best = max(best, 2.0 - offerWaste(offer, demand._minimum));
+  }
+
+  return best;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the refuse time for a decline
+///
+/// Offers not needed right now are refused for the configured time. An
+/// agent excluded by anti-affinity starts with twice that time, one too
+/// small for the waiting tasks with four times. Both are doubled with
+/// every further decline of the agent for the same reason.
+////////////////////////////////////////////////////////////////////////////////
+
+double OfferInventory::refuseSeconds (string const& slaveId,
+                                      DeclineReason reason) {
+  double base = Global::declineOfferRefuseSeconds();
+  int factor = 1;
+
+  switch (reason) {
+    case DeclineReason::NOT_NEEDED:
+    case DeclineReason::OFFER_LIMIT:
+      return base;
+
+    case DeclineReason::ANTI_AFFINITY:
+      factor = 2;
+      break;
+
+    case DeclineReason::NO_PORTS:
+    case DeclineReason::NO_RESOURCES:
+      factor = 4;
+      break;
+  }
+
+  Backoff& backoff = _backoff[slaveId];
+
+  if (backoff._count == 0 || backoff._reason != reason) {
+    backoff._reason = reason;
+    backoff._count = 1;
+  }
+  else {
+    for (int i = 0;  i < backoff._count && factor < MAX_REFUSE_FACTOR;  ++i) {
+      factor *= 2;
+    }
+
+    ++backoff._count;
+  }
+
+  return base * min(factor, MAX_REFUSE_FACTOR);
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,292 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief inventory of the offers received but not yet used
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_OFFER_INVENTORY_H
+#define ARANGO_OFFER_INVENTORY_H 1
+
+#include "OfferPlanner.h"
+
+#include <mesos/resources.hpp>
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace arangodb {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 enum DeclineReason
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief why an offer is declined, this decides how long the master is
+/// asked not to offer the resources of the agent again
+////////////////////////////////////////////////////////////////////////////////
+
+  enum class DeclineReason {
+    NOT_NEEDED,           // nothing to do with it right now
+    NO_PORTS,             // not enough ports for a waiting task
+    NO_RESOURCES,         // too little cpus, memory or disk for a waiting task
+    ANTI_AFFINITY,        // the agent is excluded for a waiting task
+    OFFER_LIMIT           // more offers held than allowed
+  };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief name of a decline reason
+////////////////////////////////////////////////////////////////////////////////
+
+  std::string declineReasonName (DeclineReason);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                              class OfferInventory
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief inventory of the offers received but not yet used
+///
+/// Offers are held until they are used, rescinded or their retention time
+/// is over. An offer the caretaker cannot use stays in the inventory and
+/// is looked at again in the next cycles, the tasks may have changed in
+/// the meantime. Only when its retention time is over it is declined.
+///
+/// The offers of one agent are handed out as one merged offer, its id is
+/// the id of the first of them, all its ids can be looked up in the map
+/// filled by take. Offers are scored against the tasks waiting for an
+/// offer: offers with resources reserved for our role come first, then
+/// the ones which fit a waiting task, the less they leave unused the
+/// better, then all the others. If more offers are held than allowed,
+/// the one with the lowest score is declined.
+///
+/// The refuse time of a decline depends on the reason. If the offers of
+/// an agent are declined again and again for not being suitable for the
+/// waiting tasks, the refuse time for the agent is doubled each time,
+/// up to a limit. It starts anew once an offer of the agent is used or
+/// the waiting tasks change.
+///
+/// The inventory is not thread-safe, the manager protects it.
+////////////////////////////////////////////////////////////////////////////////
+
+  class OfferInventory {
+    OfferInventory (OfferInventory const&) = delete;
+    OfferInventory& operator= (OfferInventory const&) = delete;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                      public types
+// -----------------------------------------------------------------------------
+
+    public:
+
+      typedef std::chrono::steady_clock::time_point time_point;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief an offer to decline and for how long to refuse its agent
+////////////////////////////////////////////////////////////////////////////////
+
+      struct Decline {
+        mesos::OfferID _offerId;
+        double _refuseSeconds;
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the inventory
+////////////////////////////////////////////////////////////////////////////////
+
+      struct Statistics {
+        uint64_t _held;           // offers currently held
+        uint64_t _agents;         // agents with offers currently held
+        uint64_t _received;       // offers received
+        uint64_t _merged;         // offers handed out merged with others
+        uint64_t _used;           // offers used
+        uint64_t _retained;       // times an unsuitable offer was kept
+        uint64_t _rescinded;      // offers rescinded
+        uint64_t _noPorts;        // declined for lack of ports
+        uint64_t _noResources;    // declined for lack of resources
+        uint64_t _antiAffinity;   // declined for anti-affinity
+        uint64_t _notNeeded;      // declined as not needed
+        uint64_t _limit;          // declined because of the offer limit
+
+        Statistics ()
+          : _held(0), _agents(0), _received(0), _merged(0), _used(0),
+            _retained(0), _rescinded(0), _noPorts(0), _noResources(0),
+            _antiAffinity(0), _notNeeded(0), _limit(0) {
+        }
+      };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor
+////////////////////////////////////////////////////////////////////////////////
+
+      OfferInventory ();
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets the tasks waiting for an offer, returns true if they
+/// changed while some agent was refused for longer than usual
+////////////////////////////////////////////////////////////////////////////////
+
+      bool setDemand (std::vector<OfferDemand> const&);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief adds an offer, returns the offers to decline to stay within the
+/// offer limit, which may include the new offer
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<Decline> add (mesos::Offer const&, time_point now);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief removes a rescinded offer
+////////////////////////////////////////////////////////////////////////////////
+
+      void remove (mesos::OfferID const&);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the offers held, merged by agent and best first, the offers
+/// stay in the inventory until the batch is settled
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<mesos::Offer> take (
+        std::unordered_map<std::string, std::vector<mesos::OfferID>>& merged);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief settles a batch handed out by take, the accepted merged offers
+/// are used, all others are kept until their retention time is over,
+/// returns the offers to decline now
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<Decline> settle (
+        std::vector<mesos::Offer> const& batch,
+        std::unordered_map<std::string, std::vector<mesos::OfferID>> const& merged,
+        std::unordered_set<std::string> const& accepted,
+        std::vector<std::pair<mesos::OfferID, DeclineReason>> const& declined,
+        time_point now);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the time the retention of the first kept offer is over
+////////////////////////////////////////////////////////////////////////////////
+
+      time_point nextExpiry () const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the inventory
+////////////////////////////////////////////////////////////////////////////////
+
+      Statistics statistics () const;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief scores an offer against the waiting tasks
+////////////////////////////////////////////////////////////////////////////////
+
+      double score (mesos::Offer const&) const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the refuse time for a decline, counts the declines of the agent
+////////////////////////////////////////////////////////////////////////////////
+
+      double refuseSeconds (std::string const& slaveId, DeclineReason);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                     private types
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief an offer held
+////////////////////////////////////////////////////////////////////////////////
+
+      struct Entry {
+        mesos::Offer _offer;
+        time_point _received;
+        bool _kept;
+        double _score;
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the declines of an agent in a row for the same reason
+////////////////////////////////////////////////////////////////////////////////
+
+      struct Backoff {
+        DeclineReason _reason;
+        int _count;
+      };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private variables
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief offers held by offer id
+////////////////////////////////////////////////////////////////////////////////
+
+      std::unordered_map<std::string, Entry> _offers;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief declines in a row by agent
+////////////////////////////////////////////////////////////////////////////////
+
+      std::unordered_map<std::string, Backoff> _backoff;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the tasks waiting for an offer
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<OfferDemand> _demand;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics
+////////////////////////////////////////////////////////////////////////////////
+
+      Statistics _statistics;
+  };
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,398 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief assignment of a batch of offers to the tasks needing resources
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "OfferPlanner.h"
+
+#include "Global.h"
+#include "utils.h"
+
+#include "logging/logging.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace arangodb;
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief target of a task type
+////////////////////////////////////////////////////////////////////////////////
+
+static Target const& taskTarget (State const& state, TaskType type) {
+  switch (type) {
+    case TaskType::AGENT:              return state.targets().agents();
+    case TaskType::COORDINATOR:        return state.targets().coordinators();
+    case TaskType::PRIMARY_DBSERVER:   return state.targets().dbservers();
+    case TaskType::SECONDARY_DBSERVER: return state.targets().secondaries();
+    case TaskType::UNKNOWN:            break;
+  }
+
+  return Target::default_instance();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether a type still misses instances, the same counting
+/// as in the caretaker
+////////////////////////////////////////////////////////////////////////////////
+
+static bool missesInstances (TasksPlan const& plan) {
+  int planned = 0;
+  int running = 0;
+
+  for (auto const& entry : plan.entries()) {
+    if (entry.state() != TASK_STATE_DEAD &&
+        entry.state() != TASK_STATE_SHUTTING_DOWN) {
+      ++planned;
+    }
+
+    if (entry.state() == TASK_STATE_RUNNING ||
+        entry.state() == TASK_STATE_TRYING_TO_START ||
+        entry.state() == TASK_STATE_TRYING_TO_RESTART) {
+      ++running;
+    }
+  }
+
+  return running < planned;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether an offer is kept for a task bound to its slave
+////////////////////////////////////////////////////////////////////////////////
+
+static bool boundToTask (State const& state,
+                         TaskIndex const& index,
+                         mesos::Offer const& offer) {
+  mesos::Resources disks = filterIsDisk(offer.resources());
+
+  for (auto const& disk : disks) {
+    if (disk.has_disk() && disk.disk().has_persistence()) {
+      return true;
+    }
+  }
+
+  static const TaskType types[] = {
+    TaskType::AGENT,
+    TaskType::COORDINATOR,
+    TaskType::PRIMARY_DBSERVER,
+    TaskType::SECONDARY_DBSERVER
+  };
+
+  for (auto type : types) {
+    TasksPlan const& plan = tasksPlan(state, type);
+
+    for (int i : index.findBySlaveId(type, offer.slave_id().value())) {
+      switch (plan.entries(i).state()) {
+        case TASK_STATE_TRYING_TO_RESERVE:
+        case TASK_STATE_TRYING_TO_PERSIST:
+        case TASK_STATE_KILLED:
+        case TASK_STATE_FAILED_OVER:
+          return true;
+
+        default:
+          break;
+      }
+    }
+  }
+
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether a task of a type already lives on a slave
+////////////////////////////////////////////////////////////////////////////////
+
+static bool slaveInUse (State const& state,
+                        TaskIndex const& index,
+                        TaskType type,
+                        string const& slaveId) {
+  TasksPlan const& plan = tasksPlan(state, type);
+
+  for (int i : index.findBySlaveId(type, slaveId)) {
+    if (plan.entries(i).state() != TASK_STATE_NEW) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sum of a scalar resource
+////////////////////////////////////////////////////////////////////////////////
+
+static double scalarSum (mesos::Resources const& resources,
+                         string const& name) {
+  double sum = 0.0;
+
+  for (auto const& resource : resources) {
+    if (resource.name() == name &&
+        resource.type() == mesos::Value::SCALAR) {
+      sum += resource.scalar().value();
+    }
+  }
+
+  return sum;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  public functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief share of the offered resources left unused
+////////////////////////////////////////////////////////////////////////////////
+
+double arangodb::offerWaste (mesos::Offer const& offer,
+                             mesos::Resources const& minimum) {
+  static const string names[] = { "cpus", "mem", "disk" };
+
+  mesos::Resources offered = offer.resources();
+  double waste = 0.0;
+  int n = 0;
+
+  for (auto const& name : names) {
+    double available = scalarSum(offered, name);
+
+    if (0.0 < available) {
+      double needed = scalarSum(minimum, name);
+      waste += (available - needed) / available;
+      ++n;
+    }
+  }
+
+  return n == 0 ? 0.0 : waste / n;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief share of the offered resources left unused, from the totals
+////////////////////////////////////////////////////////////////////////////////
+
+double arangodb::offerWaste (OfferSummary const& summary,
+                             TargetMatcher const& matcher) {
+  double const available[] = { summary._cpus, summary._mem, summary._disk };
+  double const needed[] = { matcher.cpus(), matcher.mem(), matcher.disk() };
+
+  double waste = 0.0;
+  int n = 0;
+
+  for (size_t i = 0;  i < 3;  ++i) {
+    if (0.0 < available[i]) {
+      waste += (available[i] - needed[i]) / available[i];
+      ++n;
+    }
+  }
+
+  return n == 0 ? 0.0 : waste / n;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief plans all offers of a batch at once
+////////////////////////////////////////////////////////////////////////////////
+
+vector<OfferPlacement> arangodb::planOffers (
+    State const& state,
+    TaskIndex const& index,
+    vector<mesos::Offer> const& offers,
+    vector<OfferSummary> const& summaries,
+    TargetMatchers const& matchers) {
+  vector<OfferPlacement> result(offers.size());
+
+  if ((Global::ignoreOffers() & 2) == 2) {
+    return result;
+  }
+
+  vector<bool> open(offers.size());
+
+  for (size_t i = 0;  i < offers.size();  ++i) {
+    open[i] = ! boundToTask(state, index, offers[i]);
+  }
+
+  // where the primaries are, including the ones planned in this batch
+  unordered_map<string, string> primarySlaves;
+  unordered_set<string> dbserverSlaves;
+
+  {
+    TasksPlan const& plan = state.plan().dbservers();
+    TasksCurrent const& current = state.current().dbservers();
+
+    for (int i = 0;  i < plan.entries_size() && i < current.entries_size();  ++i) {
+      if (current.entries(i).has_slave_id()) {
+        string const& slaveId = current.entries(i).slave_id().value();
+
+        primarySlaves[plan.entries(i).name()] = slaveId;
+        dbserverSlaves.insert(slaveId);
+      }
+    }
+  }
+
+  vector<TaskType> types = {
+    TaskType::AGENT,
+    TaskType::PRIMARY_DBSERVER,
+    TaskType::COORDINATOR
+  };
+
+  if (Global::asyncReplication()) {
+    types.push_back(TaskType::SECONDARY_DBSERVER);
+  }
+
+  bool complete = state.current().cluster_complete();
+
+  for (auto type : types) {
+    TasksPlan const& plan = tasksPlan(state, type);
+    TargetMatcher const& matcher = matchers.matcher(type);
+
+    unordered_set<string> planned;
+
+    for (int pos = 0;  pos < plan.entries_size();  ++pos) {
+      TaskPlan const& task = plan.entries(pos);
+
+      if (task.state() != TASK_STATE_NEW) {
+        continue;
+      }
+
+      int best = -1;
+      double bestWaste = 0.0;
+
+      for (size_t i = 0;  i < offers.size();  ++i) {
+        if (! open[i]) {
+          continue;
+        }
+
+        mesos::Offer const& offer = offers[i];
+        string const& slaveId = offer.slave_id().value();
+
+        if (planned.find(slaveId) != planned.end() ||
+            slaveInUse(state, index, type, slaveId)) {
+          continue;
+        }
+
+        if (type == TaskType::SECONDARY_DBSERVER &&
+            ! Global::secondarySameServer()) {
+          auto partner = primarySlaves.find(task.sync_partner());
+
+          if (partner != primarySlaves.end() && partner->second == slaveId) {
+            continue;
+          }
+        }
+
+        if (((type == TaskType::SECONDARY_DBSERVER &&
+              Global::secondariesWithDBservers()) ||
+             (type == TaskType::COORDINATOR &&
+              Global::coordinatorsWithDBservers())) &&
+            dbserverSlaves.find(slaveId) == dbserverSlaves.end()) {
+          continue;
+        }
+
+        if (! matcher.mightFit(summaries[i])) {
+          continue;
+        }
+
+        mesos::Resources offered = offer.resources();
+
+        if (! offered.find(matcher.minimum()).isSome()) {
+          continue;
+        }
+
+        double waste = offerWaste(summaries[i], matcher);
+
+        if (best < 0 || waste < bestWaste) {
+          best = static_cast<int>(i);
+          bestWaste = waste;
+        }
+      }
+
+      if (best < 0) {
+        continue;
+      }
+
+      string const& slaveId = offers[best].slave_id().value();
+
+      result[best] = OfferPlacement(type, pos);
+      open[best] = false;
+      planned.insert(slaveId);
+
+      if (type == TaskType::PRIMARY_DBSERVER) {
+        primarySlaves[task.name()] = slaveId;
+        dbserverSlaves.insert(slaveId);
+      }
+
+      LOG(INFO)
+      << "planned offer " << offers[best].id().value()
+      << " for " << task.name() << " (unused share " << bestWaste << ")";
+    }
+
+    // the caretaker declines offers for the later types, as long as one
+    // type still misses instances during the initial startup
+    if (! complete && missesInstances(plan)) {
+      break;
+    }
+  }
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the task types with tasks waiting for an offer
+////////////////////////////////////////////////////////////////////////////////
+
+vector<OfferDemand> arangodb::offerDemand (State const& state) {
+  static const TaskType types[] = {
+    TaskType::AGENT,
+    TaskType::PRIMARY_DBSERVER,
+    TaskType::COORDINATOR,
+    TaskType::SECONDARY_DBSERVER
+  };
+
+  vector<OfferDemand> result;
+
+  for (auto type : types) {
+    TasksPlan const& plan = tasksPlan(state, type);
+
+    for (auto const& task : plan.entries()) {
+      if (task.state() == TASK_STATE_NEW) {
+        Target const& target = taskTarget(state, type);
+        mesos::Resources minimum = target.minimal_resources();
+
+        result.push_back({ type,
+                           minimum.flatten(Global::role()),
+                           target.number_ports() });
+        break;
+      }
+    }
+  }
+
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief assignment of a batch of offers to the tasks needing resources
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_OFFER_PLANNER_H
+#define ARANGO_OFFER_PLANNER_H 1
+
+#include "arangodb.pb.h"
+#include "TargetMatcher.h"
+#include "TaskIndex.h"
+
+#include <mesos/resources.hpp>
+
+#include <vector>
+
+namespace arangodb {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                              struct OfferPlacement
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the task an offer is planned for, the type is UNKNOWN if the
+/// offer is not planned for any new task. An offer with _rest set is
+/// what is left of an offer a task has just been launched with.
+////////////////////////////////////////////////////////////////////////////////
+
+  struct OfferPlacement {
+    TaskType _type;
+    int _position;
+    bool _rest;
+
+    OfferPlacement ()
+      : _type(TaskType::UNKNOWN), _position(-1), _rest(false) {
+    }
+
+    OfferPlacement (TaskType type, int position)
+      : _type(type), _position(position), _rest(false) {
+    }
+
+    bool planned () const {
+      return _type != TaskType::UNKNOWN;
+    }
+  };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                struct OfferDemand
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief what a task still waiting for an offer needs, the minimal
+/// resources are flattened to our role
+////////////////////////////////////////////////////////////////////////////////
+
+  struct OfferDemand {
+    TaskType _type;
+    mesos::Resources _minimum;
+    uint32_t _ports;
+  };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  public functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief plans all offers of a batch at once
+///
+/// The tasks in state TASK_STATE_NEW are taken in the order the caretaker
+/// serves them, agents, primaries, coordinators and secondaries, and each
+/// gets the suitable offer which leaves the smallest share of its cpus,
+/// memory and disk unused. No two tasks of a type are planned on one
+/// slave and secondaries are kept away from their primaries. As long as
+/// the cluster is not complete, the types after the first one still
+/// missing instances are not planned, like in the caretaker.
+///
+/// Offers for a slave on which a task is waiting for its reservation,
+/// volume or restart are left alone, these belong to that task.
+///
+/// The summaries are those of the offers, an offer whose summary cannot
+/// hold the compiled target of a type is skipped without looking at its
+/// resources.
+////////////////////////////////////////////////////////////////////////////////
+
+  std::vector<OfferPlacement> planOffers (
+    State const& state,
+    TaskIndex const& index,
+    std::vector<mesos::Offer> const& offers,
+    std::vector<OfferSummary> const& summaries,
+    TargetMatchers const& matchers);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief share of the offered cpus, memory and disk left unused, if the
+/// minimal resources are taken from the offer
+////////////////////////////////////////////////////////////////////////////////
+
+  double offerWaste (mesos::Offer const& offer,
+                     mesos::Resources const& minimum);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief share of the offered cpus, memory and disk left unused, computed
+/// from the summary of the offer and the totals of a compiled target
+////////////////////////////////////////////////////////////////////////////////
+
+  double offerWaste (OfferSummary const& summary,
+                     TargetMatcher const& matcher);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the task types with tasks in TASK_STATE_NEW, one entry per type
+////////////////////////////////////////////////////////////////////////////////
+
+  std::vector<OfferDemand> offerDemand (State const& state);
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
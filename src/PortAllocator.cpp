@@ -0,0 +1,305 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief allocation of ports from offers
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "PortAllocator.h"
+
+#include "Global.h"
+#include "TaskIndex.h"
+
+#include <limits>
+#include <vector>
+
+using namespace arangodb;
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private classes
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a range of offered ports, and the reservation it came with
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+  struct PortSpan {
+    uint64_t _begin;
+    uint64_t _end;
+    bool _reserved;
+    bool _dynamic;
+
+    PortSpan ()
+      : _begin(0), _end(0), _reserved(false), _dynamic(false) {
+    }
+
+    PortSpan (uint64_t begin, uint64_t end, bool reserved, bool dynamic)
+      : _begin(begin), _end(end), _reserved(reserved), _dynamic(dynamic) {
+    }
+  };
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the port ranges of an offer we may use, the ones reserved for
+/// us first, these must either be reserved statically or dynamically with
+/// our principal
+////////////////////////////////////////////////////////////////////////////////
+
+static vector<PortSpan> offeredPorts (mesos::Offer const& offer) {
+  vector<PortSpan> reserved;
+  vector<PortSpan> unreserved;
+
+  for (int i = 0;  i < offer.resources_size();  ++i) {
+    auto const& resource = offer.resources(i);
+
+    if (resource.name() != "ports" ||
+        resource.type() != mesos::Value::RANGES) {
+      continue;
+    }
+
+    bool isReserved = false;
+    bool isDynamic = false;
+
+    if (mesos::Resources::isReserved(resource, Option<std::string>())) {
+      isReserved = true;
+      isDynamic = mesos::Resources::isDynamicallyReserved(resource);
+
+      if (isDynamic &&
+          resource.reservation().principal() != Global::principal()) {
+        continue;
+      }
+    }
+    else if (! mesos::Resources::isUnreserved(resource)) {
+      continue;
+    }
+
+    vector<PortSpan>& spans = isReserved ? reserved : unreserved;
+    auto const& ranges = resource.ranges();
+
+    for (int j = 0;  j < ranges.range_size();  ++j) {
+      spans.emplace_back(ranges.range(j).begin(), ranges.range(j).end(),
+                         isReserved, isDynamic);
+    }
+  }
+
+  reserved.insert(reserved.end(), unreserved.begin(), unreserved.end());
+  return reserved;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the first port from port on which is already taken or held by
+/// another task, the maximum if there is none
+////////////////////////////////////////////////////////////////////////////////
+
+static uint64_t nextBlocked (uint64_t port,
+                             vector<PortSpan> const& taken,
+                             map<uint32_t, string> const* held,
+                             string const& name) {
+  uint64_t result = numeric_limits<uint64_t>::max();
+
+  for (auto const& span : taken) {
+    if (port <= span._end) {
+      result = min(result, max(port, span._begin));
+    }
+  }
+
+  if (held != nullptr) {
+    for (auto it = held->lower_bound(static_cast<uint32_t>(port));
+         it != held->end() && it->first < result;
+         ++it) {
+      if (it->second != name) {
+        result = it->first;
+        break;
+      }
+    }
+  }
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief cuts up to number ports from the spans, which are neither taken
+/// nor held by another task
+////////////////////////////////////////////////////////////////////////////////
+
+static void cutPorts (vector<PortSpan> const& spans,
+                      vector<PortSpan>& taken,
+                      size_t& number,
+                      map<uint32_t, string> const* held,
+                      string const& name) {
+  for (auto const& span : spans) {
+    uint64_t port = span._begin;
+
+    while (0 < number && port <= span._end) {
+      uint64_t blocked = nextBlocked(port, taken, held, name);
+
+      if (blocked == port) {
+        ++port;
+        continue;
+      }
+
+      uint64_t end = min(span._end, port + number - 1);
+
+      if (blocked <= end) {
+        end = blocked - 1;
+      }
+
+      taken.emplace_back(port, end, span._reserved, span._dynamic);
+      number -= end - port + 1;
+      port = end + 1;
+    }
+
+    if (number == 0) {
+      return;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief collects the ports of all tasks by agent
+////////////////////////////////////////////////////////////////////////////////
+
+void PortAllocator::update (State const& state) {
+  static const TaskType types[] = {
+    TaskType::AGENT,
+    TaskType::COORDINATOR,
+    TaskType::PRIMARY_DBSERVER,
+    TaskType::SECONDARY_DBSERVER
+  };
+
+  _held.clear();
+
+  for (auto type : types) {
+    TasksPlan const& plan = tasksPlan(state, type);
+    TasksCurrent const& current = tasksCurrent(state, type);
+
+    for (int i = 0;  i < plan.entries_size() && i < current.entries_size();  ++i) {
+      TaskPlan const& task = plan.entries(i);
+      TaskCurrent const& taskCur = current.entries(i);
+
+      if (task.state() == TASK_STATE_DEAD || ! taskCur.has_slave_id()) {
+        continue;
+      }
+
+      auto& ports = _held[taskCur.slave_id().value()];
+
+      for (auto port : taskCur.ports()) {
+        ports[port] = task.name();
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief allocates ports for a task from an offer
+////////////////////////////////////////////////////////////////////////////////
+
+mesos::Resources PortAllocator::allocate (mesos::Offer const& offer,
+                                          size_t number,
+                                          TaskPlan const& task,
+                                          TaskCurrent const& taskCur) const {
+  vector<PortSpan> spans = offeredPorts(offer);
+  vector<PortSpan> taken;
+
+  auto it = _held.find(offer.slave_id().value());
+  auto held = it == _held.end() ? nullptr : &it->second;
+
+  // the previous ports of the task first, unless another task has them
+  for (auto port : taskCur.ports()) {
+    if (number == 0) {
+      break;
+    }
+
+    for (auto const& span : spans) {
+      if (span._begin <= port && port <= span._end) {
+        if (nextBlocked(port, taken, held, task.name()) != port) {
+          taken.emplace_back(port, port, span._reserved, span._dynamic);
+          --number;
+        }
+
+        break;
+      }
+    }
+  }
+
+  // then the ports no other task of ours had on the agent, and only if
+  // these are not enough, those as well
+  cutPorts(spans, taken, number, held, task.name());
+
+  if (0 < number && held != nullptr) {
+    cutPorts(spans, taken, number, nullptr, task.name());
+  }
+
+  // one resource for each role and reservation
+  mesos::Resources result;
+
+  for (int kind = 0;  kind < 3;  ++kind) {
+    bool reserved = 0 < kind;
+    bool dynamic = kind == 2;
+
+    mesos::Resource ports;
+    ports.set_name("ports");
+    ports.set_type(mesos::Value::RANGES);
+
+    for (auto const& span : taken) {
+      if (span._reserved == reserved && span._dynamic == dynamic) {
+        auto range = ports.mutable_ranges()->add_range();
+        range->set_begin(span._begin);
+        range->set_end(span._end);
+      }
+    }
+
+    if (ports.ranges().range_size() == 0) {
+      continue;
+    }
+
+    if (! reserved) {
+      ports.set_role("*");
+    }
+    else {
+      ports.set_role(Global::role());
+
+      if (dynamic) {
+        ports.mutable_reservation()->CopyFrom(Global::createReservation());
+      }
+    }
+
+    result += ports;
+  }
+
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief allocation of ports from offers
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_PORT_ALLOCATOR_H
+#define ARANGO_PORT_ALLOCATOR_H 1
+
+#include "arangodb.pb.h"
+
+#include <mesos/resources.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+namespace arangodb {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                               class PortAllocator
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief allocates the ports of a task from an offer
+///
+/// The allocator knows for each agent which ports our tasks have been
+/// given there. A task gets its previous ports again, if they are in the
+/// offer, such that a restarted task keeps its endpoint. All other ports
+/// are cut from the offered ranges, leaving out the ports of the other
+/// tasks on the agent as long as there are enough others, and are
+/// returned as one ranges resource for each role and reservation.
+////////////////////////////////////////////////////////////////////////////////
+
+  class PortAllocator {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief collects the ports of all tasks by agent
+////////////////////////////////////////////////////////////////////////////////
+
+      void update (State const&);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief allocates ports for a task from an offer, the result has less
+/// ports, if the offer has less
+////////////////////////////////////////////////////////////////////////////////
+
+      mesos::Resources allocate (mesos::Offer const& offer,
+                                 size_t number,
+                                 TaskPlan const& task,
+                                 TaskCurrent const& taskCur) const;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private variables
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the ports of our tasks by agent, with the name of the task
+////////////////////////////////////////////////////////////////////////////////
+
+      std::unordered_map<std::string, std::map<uint32_t, std::string>> _held;
+  };
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,375 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief backends of the reverse proxy
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ProxyBackends.h"
+
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <unordered_map>
+
+using namespace arangodb;
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief name of the server in a slot
+////////////////////////////////////////////////////////////////////////////////
+
+static string slotName (size_t i) {
+  return "coordinator" + to_string(i);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief key of a backend, the weight may change for the same slot
+////////////////////////////////////////////////////////////////////////////////
+
+static string backendKey (ProxyBackend const& backend) {
+  return backend._host + ":" + to_string(backend._port);
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                               class ProxyBackends
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor
+////////////////////////////////////////////////////////////////////////////////
+
+ProxyBackends::ProxyBackends () {
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief adds slots
+////////////////////////////////////////////////////////////////////////////////
+
+void ProxyBackends::resize (size_t slots) {
+  while (_slots.size() < slots) {
+    Slot slot = { false, true, { "", 0, 0 } };
+    _slots.push_back(slot);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief assigns the backends to slots
+////////////////////////////////////////////////////////////////////////////////
+
+bool ProxyBackends::assign (vector<ProxyBackend> const& backends) {
+  unordered_map<string, size_t> wanted;
+
+  for (size_t i = 0;  i < backends.size();  ++i) {
+    wanted.emplace(backendKey(backends[i]), i);
+  }
+
+  if (_slots.size() < wanted.size()) {
+    return false;
+  }
+
+  // now change the slots, first free the ones no longer wanted
+  vector<bool> done(backends.size(), false);
+
+  for (auto& slot : _slots) {
+    if (! slot._used) {
+      continue;
+    }
+
+    auto it = wanted.find(backendKey(slot._backend));
+
+    if (it == wanted.end() || done[it->second]) {
+      slot._used = false;
+      slot._changed = true;
+      continue;
+    }
+
+    done[it->second] = true;
+    ProxyBackend const& backend = backends[it->second];
+
+    if (slot._backend != backend) {
+      slot._backend = backend;
+      slot._changed = true;
+    }
+  }
+
+  // then fill in the new ones
+  size_t next = 0;
+
+  for (size_t i = 0;  i < backends.size();  ++i) {
+    auto it = wanted.find(backendKey(backends[i]));
+
+    if (it->second != i || done[i]) {
+      continue;   // a duplicate or already in its slot
+    }
+
+    while (_slots[next]._used) {
+      ++next;
+    }
+
+    Slot& slot = _slots[next];
+    slot._used = true;
+    slot._changed = true;
+    slot._backend = backends[i];
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the server lines of all slots for the config
+////////////////////////////////////////////////////////////////////////////////
+
+string ProxyBackends::config (string const& options) {
+  string result;
+
+  for (size_t i = 0;  i < _slots.size();  ++i) {
+    Slot& slot = _slots[i];
+    string name = slotName(i);
+
+    result += "        server " + name + " ";
+
+    if (slot._used) {
+      result += backendKey(slot._backend) + " " + options
+              + " cookie " + name
+              + " weight " + to_string(slot._backend._weight) + "\n";
+    }
+    else {
+      result += "127.0.0.1:1 " + options
+              + " cookie " + name + " disabled\n";
+    }
+
+    slot._changed = false;
+  }
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief runtime commands for all slots changed and not sent yet
+////////////////////////////////////////////////////////////////////////////////
+
+vector<string> ProxyBackends::commands (
+    function<string(string const&)> const& resolve) const {
+  vector<string> result;
+
+  for (size_t i = 0;  i < _slots.size();  ++i) {
+    if (_slots[i]._changed) {
+      vector<string> commands = slotCommands(i, resolve);
+      result.insert(result.end(), commands.begin(), commands.end());
+    }
+  }
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether there are changes not sent yet
+////////////////////////////////////////////////////////////////////////////////
+
+bool ProxyBackends::pending () const {
+  for (auto const& slot : _slots) {
+    if (slot._changed) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sends the commands of all changed slots
+////////////////////////////////////////////////////////////////////////////////
+
+bool ProxyBackends::send (string const& socket,
+                          function<string(string const&)> const& resolve,
+                          string& error) {
+  for (size_t i = 0;  i < _slots.size();  ++i) {
+    Slot& slot = _slots[i];
+
+    if (! slot._changed) {
+      continue;
+    }
+
+    for (auto const& command : slotCommands(i, resolve)) {
+      string response;
+
+      if (! haproxyCommand(socket, command, response)) {
+        error = "proxy refused '" + command + "': " + response;
+        return false;
+      }
+    }
+
+    slot._changed = false;
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief runtime commands of one slot
+////////////////////////////////////////////////////////////////////////////////
+
+vector<string> ProxyBackends::slotCommands (
+    size_t i,
+    function<string(string const&)> const& resolve) const {
+  Slot const& slot = _slots[i];
+  string server = "arangodb/" + slotName(i);
+  vector<string> result;
+
+  if (! slot._used) {
+    result.push_back("set server " + server + " state maint");
+    return result;
+  }
+
+  ProxyBackend const& backend = slot._backend;
+
+  result.push_back("set server " + server
+                   + " addr " + resolve(backend._host)
+                   + " port " + to_string(backend._port));
+
+  if (backend._weight == 0) {
+    result.push_back("set server " + server + " state drain");
+  }
+  else {
+    result.push_back("set weight " + server + " "
+                     + to_string(backend._weight));
+    result.push_back("set server " + server + " state ready");
+  }
+
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  public functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sends one command to the haproxy runtime API
+////////////////////////////////////////////////////////////////////////////////
+
+bool arangodb::haproxyCommand (string const& socket,
+                               string const& command,
+                               string& response) {
+  response.clear();
+
+  struct sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+
+  if (sizeof(address.sun_path) <= socket.size()) {
+    return false;
+  }
+
+  strncpy(address.sun_path, socket.c_str(), sizeof(address.sun_path) - 1);
+
+  int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+  if (fd < 0) {
+    return false;
+  }
+
+  // haproxy answers at once, never wait long while holding up the
+  // dispatcher
+  struct timeval timeout;
+  timeout.tv_sec = 1;
+  timeout.tv_usec = 0;
+
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+  if (connect(fd, (struct sockaddr*) &address, sizeof(address)) != 0) {
+    close(fd);
+    return false;
+  }
+
+  string line = command + "\n";
+  size_t sent = 0;
+
+  while (sent < line.size()) {
+    ssize_t n = write(fd, line.c_str() + sent, line.size() - sent);
+
+    if (n <= 0) {
+      close(fd);
+      return false;
+    }
+
+    sent += n;
+  }
+
+  // without an interactive prompt, haproxy closes the connection after
+  // the answer
+  char buffer[1024];
+
+  while (true) {
+    ssize_t n = read(fd, buffer, sizeof(buffer));
+
+    if (n < 0) {
+      close(fd);
+      return false;
+    }
+
+    if (n == 0) {
+      break;
+    }
+
+    response.append(buffer, n);
+  }
+
+  close(fd);
+
+  static const char* errors[] = {
+    "No such", "Unknown", "Require", "Invalid", "Permission denied"
+  };
+
+  for (auto error : errors) {
+    if (response.compare(0, strlen(error), error) == 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,210 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief backends of the reverse proxy
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_PROXY_BACKENDS_H
+#define ARANGO_PROXY_BACKENDS_H 1
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace arangodb {
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief socket of the haproxy runtime API, set up in its config
+////////////////////////////////////////////////////////////////////////////////
+
+  const char* const HAPROXY_SOCKET = "/tmp/haproxy.sock";
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                struct ProxyBackend
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a coordinator the reverse proxy forwards requests to
+////////////////////////////////////////////////////////////////////////////////
+
+  struct ProxyBackend {
+    std::string _host;
+    uint32_t _port;
+    uint32_t _weight;   // 0 drains the backend
+
+    bool operator== (ProxyBackend const& that) const {
+      return _host == that._host && _port == that._port
+          && _weight == that._weight;
+    }
+
+    bool operator!= (ProxyBackend const& that) const {
+      return ! (*this == that);
+    }
+  };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                               class ProxyBackends
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a pool of server slots in the haproxy backend
+///
+/// The config declares a fixed number of servers, most of them in
+/// maintenance. A coordinator is assigned to a free slot and keeps it,
+/// and with it its cookie, as long as it is around. Changes are sent
+/// through the runtime API, the config must only be rewritten and haproxy
+/// reloaded when there are more coordinators than slots.
+////////////////////////////////////////////////////////////////////////////////
+
+  class ProxyBackends {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor, no slots
+////////////////////////////////////////////////////////////////////////////////
+
+      ProxyBackends ();
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief number of slots
+////////////////////////////////////////////////////////////////////////////////
+
+      size_t size () const {
+        return _slots.size();
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief adds slots, existing assignments are kept
+////////////////////////////////////////////////////////////////////////////////
+
+      void resize (size_t slots);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief assigns the backends to slots, backends already known keep their
+/// slot, returns false and changes nothing if there are not enough slots
+////////////////////////////////////////////////////////////////////////////////
+
+      bool assign (std::vector<ProxyBackend> const& backends);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the server lines of all slots for the config, as the config
+/// contains all assignments, no runtime commands are pending afterwards
+////////////////////////////////////////////////////////////////////////////////
+
+      std::string config (std::string const& options);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief runtime commands for all slots changed and not sent yet, the
+/// hosts are turned into addresses with the given function
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<std::string> commands (
+        std::function<std::string(std::string const&)> const& resolve) const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether there are changes not sent yet
+////////////////////////////////////////////////////////////////////////////////
+
+      bool pending () const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sends the commands of all changed slots to the haproxy runtime
+/// API, a slot counts as sent once haproxy has taken all its commands,
+/// returns false and describes the failure in error, if a command is
+/// refused or the socket cannot be used
+////////////////////////////////////////////////////////////////////////////////
+
+      bool send (std::string const& socket,
+                 std::function<std::string(std::string const&)> const& resolve,
+                 std::string& error);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief runtime commands of one slot
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<std::string> slotCommands (
+        size_t i,
+        std::function<std::string(std::string const&)> const& resolve) const;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                     private types
+// -----------------------------------------------------------------------------
+
+    private:
+
+      struct Slot {
+        bool _used;
+        bool _changed;
+        ProxyBackend _backend;
+      };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private variables
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the slots, slot i is the server "coordinator<i>"
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<Slot> _slots;
+  };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  public functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sends one command to the haproxy runtime API, returns false if
+/// the socket cannot be used or haproxy refuses the command
+////////////////////////////////////////////////////////////////////////////////
+
+  bool haproxyCommand (std::string const& socket,
+                       std::string const& command,
+                       std::string& response);
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
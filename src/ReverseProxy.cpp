@@ -0,0 +1,854 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief embedded reverse proxy in front of the coordinators
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ReverseProxy.h"
+
+#include "logging/logging.hpp"
+
+#include <curl/curl.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <strings.h>
+
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+using namespace arangodb;
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private constants
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief name of the cookie binding a client to a coordinator
+////////////////////////////////////////////////////////////////////////////////
+
+static const string COOKIE_NAME = "SERVERID";
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief timeouts, the same as in the haproxy config
+////////////////////////////////////////////////////////////////////////////////
+
+static const long CONNECT_TIMEOUT_MS = 5000;
+static const long SERVER_TIMEOUT_MS = 50000;
+static const unsigned int CLIENT_TIMEOUT = 50;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief idle upstream connections kept per coordinator
+////////////////////////////////////////////////////////////////////////////////
+
+static const size_t MAX_IDLE_CONNECTIONS = 32;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief largest request or answer body held in memory
+////////////////////////////////////////////////////////////////////////////////
+
+static const size_t MAX_BODY_SIZE = 64 * 1024 * 1024;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief weight of a new answer time in the moving average
+////////////////////////////////////////////////////////////////////////////////
+
+static const double LATENCY_ALPHA = 0.2;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                            struct ReverseProxy::*
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief an upstream server with its idle connections, a curl handle
+/// keeps its connection open after a transfer, so pooling the handles
+/// pools the connections
+////////////////////////////////////////////////////////////////////////////////
+
+struct ReverseProxy::Upstream {
+  Upstream (ProxyBackend const& backend, bool ssl)
+    : _name(backend._host + ":" + to_string(backend._port)),
+      _host(backend._host),
+      _port(backend._port),
+      _base((ssl ? "https://" : "http://") + _name),
+      _weight(backend._weight),
+      _healthy(true),
+      _outstanding(0),
+      _requests(0),
+      _failures(0),
+      _latency(0.0),
+      _probeLatency(0.0) {
+  }
+
+  ~Upstream () {
+    for (auto handle : _idle) {
+      curl_easy_cleanup(handle);
+    }
+  }
+
+  CURL* acquire () {
+    {
+      lock_guard<mutex> guard(_lock);
+
+      if (! _idle.empty()) {
+        CURL* handle = _idle.back();
+        _idle.pop_back();
+        return handle;
+      }
+    }
+
+    return curl_easy_init();
+  }
+
+  void release (CURL* handle, bool reuse) {
+    if (reuse) {
+      // keeps the connection, only the options are reset
+      curl_easy_reset(handle);
+
+      lock_guard<mutex> guard(_lock);
+
+      if (_idle.size() < MAX_IDLE_CONNECTIONS) {
+        _idle.push_back(handle);
+        return;
+      }
+    }
+
+    curl_easy_cleanup(handle);
+  }
+
+  void record (double ms, bool failed) {
+    lock_guard<mutex> guard(_lock);
+
+    uint64_t requests = ++_requests;
+
+    if (failed) {
+      ++_failures;
+    }
+
+    _latency = (requests == 1)
+             ? ms
+             : (1.0 - LATENCY_ALPHA) * _latency + LATENCY_ALPHA * ms;
+  }
+
+  string const _name;
+  string const _host;
+  uint32_t const _port;
+  string const _base;
+
+  atomic<uint32_t> _weight;
+  atomic<bool> _healthy;
+  atomic<uint64_t> _outstanding;
+  atomic<uint64_t> _requests;
+  atomic<uint64_t> _failures;
+
+  mutex _lock;
+  vector<CURL*> _idle;
+  double _latency;
+  double _probeLatency;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a request in flight, microhttpd hands over the body in pieces
+////////////////////////////////////////////////////////////////////////////////
+
+struct ReverseProxy::Request {
+  Request (string const& uri)
+    : _uri(uri), _seen(false), _tooLarge(false) {
+  }
+
+  string _uri;      // with the query string
+  string _method;
+  string _body;
+  bool _seen;
+  bool _tooLarge;   // the rest of the body is dropped
+};
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief headers which only concern one connection and are not forwarded,
+/// microhttpd and curl set the length and the framing themselves
+////////////////////////////////////////////////////////////////////////////////
+
+static bool isHopByHop (char const* name) {
+  static char const* const names[] = {
+    "Connection", "Keep-Alive", "Proxy-Connection", "TE", "Trailer",
+    "Transfer-Encoding", "Upgrade", "Content-Length", "Expect"
+  };
+
+  for (auto n : names) {
+    if (strcasecmp(name, n) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief removes our cookie from a Cookie header, the coordinators have
+/// no use for it
+////////////////////////////////////////////////////////////////////////////////
+
+static string stripCookie (string const& value) {
+  string result;
+  size_t pos = 0;
+
+  while (pos < value.size()) {
+    size_t end = value.find(';', pos);
+
+    if (end == string::npos) {
+      end = value.size();
+    }
+
+    string cookie = value.substr(pos, end - pos);
+    size_t start = cookie.find_first_not_of(' ');
+
+    if (start != string::npos &&
+        cookie.compare(start, COOKIE_NAME.size() + 1, COOKIE_NAME + "=") != 0) {
+      if (! result.empty()) {
+        result += "; ";
+      }
+
+      result += cookie.substr(start);
+    }
+
+    pos = end + 1;
+  }
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief collects the request headers to forward
+////////////////////////////////////////////////////////////////////////////////
+
+static int collectHeader (void* cls,
+                          enum MHD_ValueKind kind,
+                          const char* key,
+                          const char* value) {
+  auto headers = static_cast<vector<pair<string, string>>*>(cls);
+
+  if (! isHopByHop(key)) {
+    headers->emplace_back(key, value == nullptr ? "" : value);
+  }
+
+  return MHD_YES;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief collects the answer body
+////////////////////////////////////////////////////////////////////////////////
+
+static size_t writeBody (void* contents, size_t size, size_t nmemb,
+                         void* userp) {
+  size_t realsize = size * nmemb;
+  string* body = static_cast<string*>(userp);
+
+  // anything but realsize aborts the transfer
+  if (MAX_BODY_SIZE - body->size() < realsize) {
+    return 0;
+  }
+
+  body->append((char*) contents, realsize);
+
+  return realsize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief collects the answer headers, a new status line (after a 100
+/// continue) starts over
+////////////////////////////////////////////////////////////////////////////////
+
+static size_t writeHeader (char* contents, size_t size, size_t nmemb,
+                           void* userp) {
+  size_t realsize = size * nmemb;
+  auto headers = static_cast<vector<pair<string, string>>*>(userp);
+  string line(contents, realsize);
+
+  if (line.compare(0, 5, "HTTP/") == 0) {
+    headers->clear();
+    return realsize;
+  }
+
+  size_t colon = line.find(':');
+
+  if (colon == string::npos) {
+    return realsize;
+  }
+
+  size_t start = line.find_first_not_of(" \t", colon + 1);
+  size_t end = line.find_last_not_of(" \t\r\n");
+
+  headers->emplace_back(
+    line.substr(0, colon),
+    (start == string::npos || end < start) ? "" : line.substr(start, end - start + 1));
+
+  return realsize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief address of the client of a connection
+////////////////////////////////////////////////////////////////////////////////
+
+static string clientAddress (struct MHD_Connection* connection) {
+  const union MHD_ConnectionInfo* info = MHD_get_connection_info(
+    connection, MHD_CONNECTION_INFO_CLIENT_ADDRESS);
+
+  if (info == nullptr || info->client_addr == nullptr) {
+    return "";
+  }
+
+  char buffer[INET6_ADDRSTRLEN] = { 0 };
+  auto addr = info->client_addr;
+
+  if (addr->sa_family == AF_INET) {
+    inet_ntop(AF_INET, &((struct sockaddr_in*) addr)->sin_addr,
+              buffer, sizeof(buffer));
+  }
+  else if (addr->sa_family == AF_INET6) {
+    inet_ntop(AF_INET6, &((struct sockaddr_in6*) addr)->sin6_addr,
+              buffer, sizeof(buffer));
+  }
+
+  return buffer;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief queues a short answer generated by the proxy itself
+////////////////////////////////////////////////////////////////////////////////
+
+static int answerError (struct MHD_Connection* connection,
+                        unsigned int status,
+                        string const& message) {
+  struct MHD_Response* response = MHD_create_response_from_buffer(
+    message.size(), (void*) message.c_str(), MHD_RESPMEM_MUST_COPY);
+
+  MHD_add_response_header(response, "Content-Type", "text/plain");
+
+  int ret = MHD_queue_response(connection, status, response);
+  MHD_destroy_response(response);
+
+  return ret;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                class ReverseProxy
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor
+////////////////////////////////////////////////////////////////////////////////
+
+ReverseProxy::ReverseProxy (int port,
+                            int frameworkPort,
+                            bool ssl,
+                            string const& scriptName)
+  : _port(port),
+    _ssl(ssl),
+    _scriptName(scriptName),
+    _next(0),
+    _daemon(nullptr) {
+  ProxyBackend framework = {
+    "127.0.0.1", static_cast<uint32_t>(frameworkPort), 1
+  };
+
+  // the framework's own server never speaks ssl
+  _framework = make_shared<Upstream>(framework, false);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief destructor
+////////////////////////////////////////////////////////////////////////////////
+
+ReverseProxy::~ReverseProxy () {
+  stop();
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts listening
+////////////////////////////////////////////////////////////////////////////////
+
+bool ReverseProxy::start () {
+  // a thread per connection, a forwarded request blocks until the
+  // coordinator has answered
+  _daemon = MHD_start_daemon(
+    MHD_USE_THREAD_PER_CONNECTION,
+    _port,
+    nullptr, nullptr,
+    &ReverseProxy::answer, (void*) this,
+    MHD_OPTION_CONNECTION_TIMEOUT, CLIENT_TIMEOUT,
+    MHD_OPTION_URI_LOG_CALLBACK, &ReverseProxy::logUri, (void*) this,
+    MHD_OPTION_NOTIFY_COMPLETED, &ReverseProxy::completed, (void*) this,
+    MHD_OPTION_END);
+
+  if (_daemon == nullptr) {
+    LOG(ERROR) << "cannot start the reverse proxy on port " << _port;
+    return false;
+  }
+
+  LOG(INFO) << "reverse proxy listening on port " << _port;
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief stops the proxy
+////////////////////////////////////////////////////////////////////////////////
+
+void ReverseProxy::stop () {
+  if (_daemon != nullptr) {
+    MHD_stop_daemon(_daemon);
+    _daemon = nullptr;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief replaces the coordinators
+////////////////////////////////////////////////////////////////////////////////
+
+void ReverseProxy::setBackends (vector<ProxyBackend> const& backends) {
+  lock_guard<mutex> guard(_lock);
+
+  vector<shared_ptr<Upstream>> upstreams;
+
+  for (auto const& backend : backends) {
+    shared_ptr<Upstream> upstream;
+
+    for (auto const& known : _upstreams) {
+      if (known->_host == backend._host && known->_port == backend._port) {
+        upstream = known;
+        break;
+      }
+    }
+
+    if (upstream == nullptr) {
+      upstream = make_shared<Upstream>(backend, _ssl);
+      LOG(INFO) << "reverse proxy: added coordinator " << upstream->_name;
+    }
+    else if (upstream->_weight != backend._weight) {
+      LOG(INFO) << "reverse proxy: coordinator " << upstream->_name
+                << (backend._weight == 0 ? " draining" : " ready");
+    }
+
+    upstream->_weight = backend._weight;
+    upstreams.push_back(upstream);
+  }
+
+  // requests still running on a removed coordinator keep it alive until
+  // they are done
+  _upstreams.swap(upstreams);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics of all coordinators
+////////////////////////////////////////////////////////////////////////////////
+
+vector<ProxyStatistics> ReverseProxy::statistics () const {
+  vector<shared_ptr<Upstream>> upstreams;
+
+  {
+    lock_guard<mutex> guard(_lock);
+    upstreams = _upstreams;
+  }
+
+  vector<ProxyStatistics> result;
+
+  for (auto const& upstream : upstreams) {
+    ProxyStatistics stats;
+
+    stats._name = upstream->_name;
+    stats._host = upstream->_host;
+    stats._port = upstream->_port;
+    stats._healthy = upstream->_healthy;
+    stats._draining = upstream->_weight == 0;
+    stats._outstanding = upstream->_outstanding;
+    stats._requests = upstream->_requests;
+    stats._failures = upstream->_failures;
+
+    {
+      lock_guard<mutex> guard(upstream->_lock);
+
+      stats._connections = upstream->_idle.size();
+      stats._latency = upstream->_latency;
+      stats._probeLatency = upstream->_probeLatency;
+    }
+
+    result.push_back(stats);
+  }
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief takes over the outcome of a round of health probes
+////////////////////////////////////////////////////////////////////////////////
+
+void ReverseProxy::updateHealth (vector<TaskHealth> const& health) {
+  vector<shared_ptr<Upstream>> upstreams;
+
+  {
+    lock_guard<mutex> guard(_lock);
+    upstreams = _upstreams;
+  }
+
+  for (auto const& upstream : upstreams) {
+    for (auto const& task : health) {
+      if (task._type != TaskType::COORDINATOR ||
+          task._endpoint != upstream->_base ||
+          task._probes == 0) {
+        continue;
+      }
+
+      {
+        lock_guard<mutex> guard(upstream->_lock);
+        upstream->_probeLatency = task._lastLatency;
+      }
+
+      if (upstream->_healthy.exchange(task._healthy) != task._healthy) {
+        LOG(INFO) << "reverse proxy: coordinator " << upstream->_name
+                  << (task._healthy ? " is healthy" : " failed its health check");
+      }
+
+      break;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief keeps the uri with its query string, microhttpd only passes the
+/// path to the access handler
+////////////////////////////////////////////////////////////////////////////////
+
+void* ReverseProxy::logUri (void* cls,
+                            const char* uri,
+                            struct MHD_Connection* connection) {
+  return new Request(uri);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief collects a request and forwards it once it is complete
+////////////////////////////////////////////////////////////////////////////////
+
+int ReverseProxy::answer (void* cls,
+                          struct MHD_Connection* connection,
+                          const char* url,
+                          const char* method,
+                          const char* version,
+                          const char* upload_data,
+                          size_t* upload_data_size,
+                          void** ptr) {
+  ReverseProxy* me = reinterpret_cast<ReverseProxy*>(cls);
+  Request* request = reinterpret_cast<Request*>(*ptr);
+
+  if (request == nullptr) {
+    request = new Request(url);
+    *ptr = request;
+  }
+
+  // the first call only has the headers
+  if (! request->_seen) {
+    request->_seen = true;
+    request->_method = method;
+    return MHD_YES;
+  }
+
+  if (*upload_data_size != 0) {
+    if (MAX_BODY_SIZE - request->_body.size() < *upload_data_size) {
+      request->_tooLarge = true;
+      request->_body.clear();
+    }
+
+    if (! request->_tooLarge) {
+      request->_body.append(upload_data, *upload_data_size);
+    }
+
+    *upload_data_size = 0;
+    return MHD_YES;
+  }
+
+  if (request->_tooLarge) {
+    return answerError(connection, MHD_HTTP_REQUEST_ENTITY_TOO_LARGE,
+                       "request body too large\n");
+  }
+
+  return me->forward(connection, *request);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief frees a request
+////////////////////////////////////////////////////////////////////////////////
+
+void ReverseProxy::completed (void* cls,
+                              struct MHD_Connection* connection,
+                              void** ptr,
+                              enum MHD_RequestTerminationCode toe) {
+  delete reinterpret_cast<Request*>(*ptr);
+  *ptr = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief forwards a complete request and queues the answer
+////////////////////////////////////////////////////////////////////////////////
+
+int ReverseProxy::forward (struct MHD_Connection* connection,
+                           Request& request) {
+  vector<pair<string, string>> headers;
+  MHD_get_connection_values(connection, MHD_HEADER_KIND,
+                            &collectHeader, &headers);
+
+  const char* method = request._method.c_str();
+
+  // everything below /framework/ goes to our own server, without the
+  // prefix, like the reqrep in the haproxy config
+  static const string FRAMEWORK_PREFIX = "/framework/";
+  bool toFramework =
+    request._uri.compare(0, FRAMEWORK_PREFIX.size(), FRAMEWORK_PREFIX) == 0;
+
+  string path = toFramework
+              ? request._uri.substr(FRAMEWORK_PREFIX.size() - 1)
+              : request._uri;
+
+  const char* cookieValue = MHD_lookup_connection_value(
+    connection, MHD_COOKIE_KIND, COOKIE_NAME.c_str());
+  string cookie = cookieValue == nullptr ? "" : cookieValue;
+
+  bool forwarded = false;
+  struct curl_slist* requestHeaders = nullptr;
+
+  for (auto const& header : headers) {
+    if (strcasecmp(header.first.c_str(), "X-Forwarded-For") == 0) {
+      forwarded = true;
+    }
+
+    string value = header.second;
+
+    if (! toFramework && strcasecmp(header.first.c_str(), "Cookie") == 0) {
+      value = stripCookie(value);
+
+      if (value.empty()) {
+        continue;
+      }
+    }
+
+    requestHeaders = curl_slist_append(
+      requestHeaders, (header.first + ": " + value).c_str());
+  }
+
+  // no 100 continue round trip, the body is already complete
+  requestHeaders = curl_slist_append(requestHeaders, "Expect:");
+
+  string client = clientAddress(connection);
+
+  if (! client.empty()) {
+    requestHeaders = curl_slist_append(
+      requestHeaders, ("X-Forwarded-For: " + client).c_str());
+  }
+
+  // a request forwarded to us came through the admin router
+  if (! toFramework && forwarded) {
+    requestHeaders = curl_slist_append(
+      requestHeaders, ("X-Script-Name: " + _scriptName).c_str());
+  }
+
+  // a coordinator which cannot be connected to has not seen the request,
+  // so it is safe to try another one
+  shared_ptr<Upstream> upstream;
+  CURLcode res = CURLE_COULDNT_CONNECT;
+  long code = 0;
+  string body;
+  vector<pair<string, string>> answerHeaders;
+
+  for (int attempt = 0;  attempt < 2 && res == CURLE_COULDNT_CONNECT;  ++attempt) {
+    upstream = toFramework ? _framework : select(cookie);
+
+    if (upstream == nullptr) {
+      break;
+    }
+
+    CURL* handle = upstream->acquire();
+
+    if (handle == nullptr) {
+      upstream.reset();
+      break;
+    }
+
+    string url = upstream->_base + path;
+
+    body.clear();
+    answerHeaders.clear();
+
+    curl_easy_setopt(handle, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, method);
+    curl_easy_setopt(handle, CURLOPT_HTTPHEADER, requestHeaders);
+    curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT_MS, CONNECT_TIMEOUT_MS);
+    curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, SERVER_TIMEOUT_MS);
+    curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, writeBody);
+    curl_easy_setopt(handle, CURLOPT_WRITEDATA, (void*) &body);
+    curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, writeHeader);
+    curl_easy_setopt(handle, CURLOPT_HEADERDATA, (void*) &answerHeaders);
+    curl_easy_setopt(handle, CURLOPT_SSL_VERIFYPEER, 0L);
+    curl_easy_setopt(handle, CURLOPT_SSL_VERIFYHOST, 0L);
+
+    if (strcmp(method, MHD_HTTP_METHOD_HEAD) == 0) {
+      curl_easy_setopt(handle, CURLOPT_NOBODY, 1L);
+    }
+    else if (! request._body.empty()) {
+      curl_easy_setopt(handle, CURLOPT_POSTFIELDS, request._body.data());
+      curl_easy_setopt(handle, CURLOPT_POSTFIELDSIZE_LARGE,
+                       (curl_off_t) request._body.size());
+    }
+
+    ++upstream->_outstanding;
+
+    auto start = chrono::steady_clock::now();
+    res = curl_easy_perform(handle);
+    double ms = chrono::duration<double, milli>(
+      chrono::steady_clock::now() - start).count();
+
+    --upstream->_outstanding;
+
+    if (res == CURLE_OK) {
+      curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &code);
+    }
+    else if (res == CURLE_COULDNT_CONNECT && ! toFramework) {
+      // the next health check decides when it is back
+      upstream->_healthy = false;
+      LOG(WARNING) << "reverse proxy: cannot connect to coordinator "
+                   << upstream->_name;
+    }
+
+    upstream->record(ms, res != CURLE_OK || 500 <= code);
+    upstream->release(handle, res == CURLE_OK);
+
+    // the framework cannot be replaced by another one
+    if (toFramework) {
+      break;
+    }
+  }
+
+  curl_slist_free_all(requestHeaders);
+
+  if (upstream == nullptr) {
+    return answerError(connection, MHD_HTTP_SERVICE_UNAVAILABLE,
+                       "no coordinator available\n");
+  }
+
+  if (res != CURLE_OK) {
+    if (res == CURLE_OPERATION_TIMEDOUT) {
+      return answerError(connection, MHD_HTTP_GATEWAY_TIMEOUT,
+                         "coordinator did not answer in time\n");
+    }
+
+    if (res == CURLE_WRITE_ERROR) {
+      return answerError(connection, MHD_HTTP_BAD_GATEWAY,
+                         "answer of the coordinator too large\n");
+    }
+
+    return answerError(connection, MHD_HTTP_BAD_GATEWAY,
+                       string("cannot forward request: ")
+                       + curl_easy_strerror(res) + "\n");
+  }
+
+  struct MHD_Response* response = MHD_create_response_from_buffer(
+    body.size(), (void*) body.c_str(), MHD_RESPMEM_MUST_COPY);
+
+  for (auto const& header : answerHeaders) {
+    if (! isHopByHop(header.first.c_str())) {
+      MHD_add_response_header(response, header.first.c_str(),
+                              header.second.c_str());
+    }
+  }
+
+  if (! toFramework && cookie != upstream->_name) {
+    MHD_add_response_header(
+      response, "Set-Cookie",
+      (COOKIE_NAME + "=" + upstream->_name + "; path=/").c_str());
+    MHD_add_response_header(response, "Cache-Control", "private");
+  }
+
+  int ret = MHD_queue_response(connection, static_cast<unsigned int>(code),
+                               response);
+  MHD_destroy_response(response);
+
+  return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief picks the coordinator for a request
+////////////////////////////////////////////////////////////////////////////////
+
+shared_ptr<ReverseProxy::Upstream> ReverseProxy::select (string const& cookie) {
+  lock_guard<mutex> guard(_lock);
+
+  // a client sticks to its coordinator as long as it is healthy, even if
+  // it is draining
+  if (! cookie.empty()) {
+    for (auto const& upstream : _upstreams) {
+      if (upstream->_name == cookie && upstream->_healthy) {
+        return upstream;
+      }
+    }
+  }
+
+  // otherwise the fewest outstanding requests win, ties are broken round
+  // robin, such that an idle cluster is not served by one coordinator
+  size_t n = _upstreams.size();
+  shared_ptr<Upstream> best;
+
+  for (size_t i = 0;  i < n;  ++i) {
+    auto const& upstream = _upstreams[(_next + i) % n];
+
+    if (! upstream->_healthy || upstream->_weight == 0) {
+      continue;
+    }
+
+    if (best == nullptr || upstream->_outstanding < best->_outstanding) {
+      best = upstream;
+    }
+  }
+
+  ++_next;
+  return best;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
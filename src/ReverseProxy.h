@@ -0,0 +1,238 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief embedded reverse proxy in front of the coordinators
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_REVERSE_PROXY_H
+#define ARANGO_REVERSE_PROXY_H 1
+
+#include "HealthProbes.h"
+#include "ProxyBackends.h"
+
+#include <microhttpd.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace arangodb {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                             struct ProxyStatistics
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief what the embedded proxy knows about one coordinator
+////////////////////////////////////////////////////////////////////////////////
+
+  struct ProxyStatistics {
+    std::string _name;          // value of the SERVERID cookie
+    std::string _host;
+    uint32_t _port;
+    bool _healthy;
+    bool _draining;
+    uint64_t _outstanding;      // requests currently forwarded
+    uint64_t _requests;
+    uint64_t _failures;         // connection errors and 5xx answers
+    uint64_t _connections;      // idle upstream connections in the pool
+    double _latency;            // moving average of the answer time, in ms
+    double _probeLatency;       // answer time of the last health check, in ms
+  };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                class ReverseProxy
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief HTTP reverse proxy in front of the coordinators
+///
+/// An alternative to running haproxy. It listens on the webui port, sends
+/// everything below /framework/ to the framework's own HTTP server with
+/// the prefix removed, and everything else to a coordinator. A client
+/// sticks to its coordinator by the SERVERID cookie like with haproxy,
+/// new clients go to the healthy coordinator with the fewest outstanding
+/// requests. Upstream connections are kept alive and reused. The health
+/// probes of the framework tell the proxy after each round which
+/// coordinators answer, such that a dead one is skipped before a client
+/// runs into it.
+////////////////////////////////////////////////////////////////////////////////
+
+  class ReverseProxy {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor
+////////////////////////////////////////////////////////////////////////////////
+
+      ReverseProxy (int port, int frameworkPort, bool ssl,
+                    std::string const& scriptName);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief destructor
+////////////////////////////////////////////////////////////////////////////////
+
+      ~ReverseProxy ();
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief starts listening, returns false if the port cannot be bound
+////////////////////////////////////////////////////////////////////////////////
+
+      bool start ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief stops the proxy
+////////////////////////////////////////////////////////////////////////////////
+
+      void stop ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief replaces the coordinators, known ones keep their connections and
+/// statistics, a weight of 0 drains a coordinator: it keeps the clients
+/// sticking to it, but gets no new ones
+////////////////////////////////////////////////////////////////////////////////
+
+      void setBackends (std::vector<ProxyBackend> const& backends);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics of all coordinators
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<ProxyStatistics> statistics () const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief takes over the outcome of a round of health probes, coordinators
+/// not probed yet keep their state
+////////////////////////////////////////////////////////////////////////////////
+
+      void updateHealth (std::vector<TaskHealth> const& health);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                     private types
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief an upstream server with its idle connections
+////////////////////////////////////////////////////////////////////////////////
+
+      struct Upstream;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a request in flight
+////////////////////////////////////////////////////////////////////////////////
+
+      struct Request;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief microhttpd callbacks
+////////////////////////////////////////////////////////////////////////////////
+
+      static void* logUri (void*, const char*, struct MHD_Connection*);
+
+      static int answer (void*, struct MHD_Connection*, const char*,
+                         const char*, const char*, const char*,
+                         size_t*, void**);
+
+      static void completed (void*, struct MHD_Connection*, void**,
+                             enum MHD_RequestTerminationCode);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief forwards a complete request and queues the answer
+////////////////////////////////////////////////////////////////////////////////
+
+      int forward (struct MHD_Connection*, Request&);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief picks the coordinator for a request, nullptr if there is none
+////////////////////////////////////////////////////////////////////////////////
+
+      std::shared_ptr<Upstream> select (std::string const& cookie);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private variables
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief ports and options
+////////////////////////////////////////////////////////////////////////////////
+
+      int const _port;
+      bool const _ssl;
+      std::string const _scriptName;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the framework's own HTTP server
+////////////////////////////////////////////////////////////////////////////////
+
+      std::shared_ptr<Upstream> _framework;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the coordinators, the vector is replaced as a whole
+////////////////////////////////////////////////////////////////////////////////
+
+      mutable std::mutex _lock;
+      std::vector<std::shared_ptr<Upstream>> _upstreams;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief where the next search for the least busy coordinator starts
+////////////////////////////////////////////////////////////////////////////////
+
+      size_t _next;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief http daemon
+////////////////////////////////////////////////////////////////////////////////
+
+      MHD_Daemon* _daemon;
+  };
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,338 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief journal of state deltas
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "StateJournal.h"
+
+#include "TaskIndex.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace arangodb;
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief plan entries for a task type
+////////////////////////////////////////////////////////////////////////////////
+
+static TasksPlan const& planList (State const& state, uint32_t type) {
+  switch (type) {
+    case 1: return state.plan().agents();
+    case 2: return state.plan().coordinators();
+    case 3: return state.plan().dbservers();
+    default: return state.plan().secondaries();
+  }
+}
+
+static TasksPlan* mutablePlanList (State& state, uint32_t type) {
+  switch (type) {
+    case 1: return state.mutable_plan()->mutable_agents();
+    case 2: return state.mutable_plan()->mutable_coordinators();
+    case 3: return state.mutable_plan()->mutable_dbservers();
+    default: return state.mutable_plan()->mutable_secondaries();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief current entries for a task type
+////////////////////////////////////////////////////////////////////////////////
+
+static TasksCurrent const& currentList (State const& state, uint32_t type) {
+  switch (type) {
+    case 1: return state.current().agents();
+    case 2: return state.current().coordinators();
+    case 3: return state.current().dbservers();
+    default: return state.current().secondaries();
+  }
+}
+
+static TasksCurrent* mutableCurrentList (State& state, uint32_t type) {
+  switch (type) {
+    case 1: return state.mutable_current()->mutable_agents();
+    case 2: return state.mutable_current()->mutable_coordinators();
+    case 3: return state.mutable_current()->mutable_dbservers();
+    default: return state.mutable_current()->mutable_secondaries();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief compares two messages by their serialization
+////////////////////////////////////////////////////////////////////////////////
+
+static bool sameMessage (::google::protobuf::Message const& a,
+                         ::google::protobuf::Message const& b) {
+  return a.SerializePartialAsString() == b.SerializePartialAsString();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief truncates or extends a list of entries to the given size
+////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static void resizeEntries (T* list, int size) {
+  while (list->entries_size() > size) {
+    list->mutable_entries()->RemoveLast();
+  }
+
+  while (list->entries_size() < size) {
+    list->add_entries();
+  }
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  public functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief computes the delta which turns before into after
+////////////////////////////////////////////////////////////////////////////////
+
+bool arangodb::diffState (State const& before,
+                          State const& after,
+                          StateDelta& delta) {
+  uint64_t sequence = delta.sequence();
+  delta.Clear();
+  delta.set_sequence(sequence);
+
+  // the framework id is only ever set, never removed
+  if (before.has_framework_id() && ! after.has_framework_id()) {
+    return false;
+  }
+
+  if (after.has_framework_id() &&
+      (! before.has_framework_id() ||
+       ! sameMessage(before.framework_id(), after.framework_id()))) {
+    delta.mutable_framework_id()->CopyFrom(after.framework_id());
+  }
+
+  if (! sameMessage(before.targets(), after.targets())) {
+    delta.mutable_targets()->CopyFrom(after.targets());
+  }
+
+  bool planResized = false;
+  bool currentResized = false;
+
+  for (uint32_t type = 1;  type < NUMBER_TASK_TYPES;  ++type) {
+    TasksPlan const& planBefore = planList(before, type);
+    TasksPlan const& planAfter = planList(after, type);
+    TasksCurrent const& currentBefore = currentList(before, type);
+    TasksCurrent const& currentAfter = currentList(after, type);
+
+    if (planBefore.entries_size() != planAfter.entries_size()) {
+      planResized = true;
+    }
+
+    if (currentBefore.entries_size() != currentAfter.entries_size()) {
+      currentResized = true;
+    }
+
+    int n = max(planAfter.entries_size(), currentAfter.entries_size());
+
+    for (int pos = 0;  pos < n;  ++pos) {
+      bool planChanged
+        = pos < planAfter.entries_size() &&
+          (pos >= planBefore.entries_size() ||
+           ! sameMessage(planBefore.entries(pos), planAfter.entries(pos)));
+
+      bool currentChanged
+        = pos < currentAfter.entries_size() &&
+          (pos >= currentBefore.entries_size() ||
+           ! sameMessage(currentBefore.entries(pos), currentAfter.entries(pos)));
+
+      if (! planChanged && ! currentChanged) {
+        continue;
+      }
+
+      TaskDelta* task = delta.add_tasks();
+      task->set_task_type(type);
+      task->set_position(pos);
+
+      if (planChanged) {
+        task->mutable_plan()->CopyFrom(planAfter.entries(pos));
+      }
+
+      if (currentChanged) {
+        task->mutable_current()->CopyFrom(currentAfter.entries(pos));
+      }
+    }
+  }
+
+  if (planResized) {
+    for (uint32_t type = 1;  type < NUMBER_TASK_TYPES;  ++type) {
+      delta.add_plan_sizes(planList(after, type).entries_size());
+    }
+  }
+
+  if (currentResized) {
+    for (uint32_t type = 1;  type < NUMBER_TASK_TYPES;  ++type) {
+      delta.add_current_sizes(currentList(after, type).entries_size());
+    }
+  }
+
+  if (after.has_restart()) {
+    if (! before.has_restart() ||
+        ! sameMessage(before.restart(), after.restart())) {
+      delta.mutable_restart()->CopyFrom(after.restart());
+    }
+  }
+  else if (before.has_restart()) {
+    delta.set_clear_restart(true);
+  }
+
+  if (before.current().cluster_complete()
+      != after.current().cluster_complete()) {
+    delta.set_cluster_complete(after.current().cluster_complete());
+  }
+
+  if (! sameMessage(before.failovers(), after.failovers())) {
+    delta.mutable_failovers()->CopyFrom(after.failovers());
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether a delta changes anything at all
+////////////////////////////////////////////////////////////////////////////////
+
+bool arangodb::isEmptyDelta (StateDelta const& delta) {
+  return ! delta.has_framework_id()
+      && ! delta.has_targets()
+      && delta.tasks_size() == 0
+      && delta.plan_sizes_size() == 0
+      && delta.current_sizes_size() == 0
+      && ! delta.has_restart()
+      && ! delta.has_clear_restart()
+      && ! delta.has_cluster_complete()
+      && ! delta.has_failovers();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief applies a delta to a state
+////////////////////////////////////////////////////////////////////////////////
+
+void arangodb::applyStateDelta (State& state, StateDelta const& delta) {
+  if (delta.has_framework_id()) {
+    state.mutable_framework_id()->CopyFrom(delta.framework_id());
+  }
+
+  if (delta.has_targets()) {
+    state.mutable_targets()->CopyFrom(delta.targets());
+  }
+
+  for (int i = 0;  i < delta.plan_sizes_size();  ++i) {
+    resizeEntries(mutablePlanList(state, i + 1), delta.plan_sizes(i));
+  }
+
+  for (int i = 0;  i < delta.current_sizes_size();  ++i) {
+    resizeEntries(mutableCurrentList(state, i + 1), delta.current_sizes(i));
+  }
+
+  for (auto const& task : delta.tasks()) {
+    uint32_t type = task.task_type();
+    int pos = static_cast<int>(task.position());
+
+    if (task.has_plan()) {
+      TasksPlan* plan = mutablePlanList(state, type);
+
+      if (plan->entries_size() <= pos) {
+        resizeEntries(plan, pos + 1);
+      }
+
+      plan->mutable_entries(pos)->CopyFrom(task.plan());
+    }
+
+    if (task.has_current()) {
+      TasksCurrent* current = mutableCurrentList(state, type);
+
+      if (current->entries_size() <= pos) {
+        resizeEntries(current, pos + 1);
+      }
+
+      current->mutable_entries(pos)->CopyFrom(task.current());
+    }
+  }
+
+  if (delta.has_restart()) {
+    state.mutable_restart()->CopyFrom(delta.restart());
+  }
+  else if (delta.clear_restart()) {
+    state.clear_restart();
+  }
+
+  if (delta.has_cluster_complete()) {
+    state.mutable_current()->set_cluster_complete(delta.cluster_complete());
+  }
+
+  if (delta.has_failovers()) {
+    state.mutable_failovers()->CopyFrom(delta.failovers());
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief name of the variable holding a journal entry
+////////////////////////////////////////////////////////////////////////////////
+
+string arangodb::journalVariableName (string const& name, uint64_t sequence) {
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%020llu",
+           static_cast<unsigned long long>(sequence));
+
+  return "state_" + name + "_journal_" + buffer;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief extracts the sequence number from the name of a journal variable
+////////////////////////////////////////////////////////////////////////////////
+
+bool arangodb::parseJournalVariableName (string const& name,
+                                         string const& variable,
+                                         uint64_t& sequence) {
+  string prefix = "state_" + name + "_journal_";
+
+  if (variable.size() != prefix.size() + 20 ||
+      variable.compare(0, prefix.size(), prefix) != 0) {
+    return false;
+  }
+
+  string digits = variable.substr(prefix.size());
+
+  if (digits.find_first_not_of("0123456789") != string::npos) {
+    return false;
+  }
+
+  sequence = strtoull(digits.c_str(), nullptr, 10);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
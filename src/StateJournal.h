@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief journal of state deltas
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_STATE_JOURNAL_H
+#define ARANGO_STATE_JOURNAL_H 1
+
+#include "arangodb.pb.h"
+
+#include <string>
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  public functions
+// -----------------------------------------------------------------------------
+
+namespace arangodb {
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief computes the delta which turns before into after, the sequence
+/// number of the delta is not touched, returns false if the difference
+/// cannot be expressed as a delta and a snapshot must be written instead
+////////////////////////////////////////////////////////////////////////////////
+
+  bool diffState (State const& before,
+                  State const& after,
+                  StateDelta& delta);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether a delta changes anything at all
+////////////////////////////////////////////////////////////////////////////////
+
+  bool isEmptyDelta (StateDelta const& delta);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief applies a delta to a state
+////////////////////////////////////////////////////////////////////////////////
+
+  void applyStateDelta (State& state, StateDelta const& delta);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief name of the variable holding the journal entry with the given
+/// sequence number, the number is zero padded such that the names sort
+/// in sequence order
+////////////////////////////////////////////////////////////////////////////////
+
+  std::string journalVariableName (std::string const& name,
+                                   uint64_t sequence);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief extracts the sequence number from the name of a journal variable,
+/// returns false if the variable is not a journal entry of the given state
+////////////////////////////////////////////////////////////////////////////////
+
+  bool parseJournalVariableName (std::string const& name,
+                                 std::string const& variable,
+                                 uint64_t& sequence);
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,284 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief layout of the stored state
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "StateLayout.h"
+
+#include <stout/gzip.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace arangodb;
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the message stored under a shard key, nullptr if the key is
+/// unknown or the state has nothing to store under it
+////////////////////////////////////////////////////////////////////////////////
+
+static ::google::protobuf::Message const* shardMessage (State const& state,
+                                                        string const& key) {
+  if (key == "targets")              return &state.targets();
+  if (key == "plan_agents")          return &state.plan().agents();
+  if (key == "plan_coordinators")    return &state.plan().coordinators();
+  if (key == "plan_dbservers")       return &state.plan().dbservers();
+  if (key == "plan_secondaries")     return &state.plan().secondaries();
+  if (key == "current_agents")       return &state.current().agents();
+  if (key == "current_coordinators") return &state.current().coordinators();
+  if (key == "current_dbservers")    return &state.current().dbservers();
+  if (key == "current_secondaries")  return &state.current().secondaries();
+
+  if (key == "restart") {
+    return state.has_restart() ? &state.restart() : nullptr;
+  }
+
+  if (key == "failovers") {
+    return state.has_failovers() ? &state.failovers() : nullptr;
+  }
+
+  return nullptr;
+}
+
+static ::google::protobuf::Message* mutableShardMessage (State& state,
+                                                         string const& key) {
+  if (key == "targets")              return state.mutable_targets();
+  if (key == "plan_agents")          return state.mutable_plan()->mutable_agents();
+  if (key == "plan_coordinators")    return state.mutable_plan()->mutable_coordinators();
+  if (key == "plan_dbservers")       return state.mutable_plan()->mutable_dbservers();
+  if (key == "plan_secondaries")     return state.mutable_plan()->mutable_secondaries();
+  if (key == "current_agents")       return state.mutable_current()->mutable_agents();
+  if (key == "current_coordinators") return state.mutable_current()->mutable_coordinators();
+  if (key == "current_dbservers")    return state.mutable_current()->mutable_dbservers();
+  if (key == "current_secondaries")  return state.mutable_current()->mutable_secondaries();
+  if (key == "restart")              return state.mutable_restart();
+  if (key == "failovers")            return state.mutable_failovers();
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  public functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief keys of all shards a state is split into
+////////////////////////////////////////////////////////////////////////////////
+
+vector<string> const& arangodb::stateShardKeys () {
+  static const vector<string> keys = {
+    "targets",
+    "plan_agents",
+    "plan_coordinators",
+    "plan_dbservers",
+    "plan_secondaries",
+    "current_agents",
+    "current_coordinators",
+    "current_dbservers",
+    "current_secondaries",
+    "restart",
+    "failovers"
+  };
+
+  return keys;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief serializes one shard of a state
+////////////////////////////////////////////////////////////////////////////////
+
+bool arangodb::serializeShard (State const& state,
+                               string const& key,
+                               string& value) {
+  auto message = shardMessage(state, key);
+
+  if (message == nullptr) {
+    return false;
+  }
+
+  value.clear();
+  return message->SerializePartialToString(&value);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief replaces one shard of a state
+////////////////////////////////////////////////////////////////////////////////
+
+bool arangodb::parseShard (State& state,
+                           string const& key,
+                           string const& value) {
+  auto message = mutableShardMessage(state, key);
+
+  if (message == nullptr) {
+    return false;
+  }
+
+  return message->ParsePartialFromString(value);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief compresses a shard
+////////////////////////////////////////////////////////////////////////////////
+
+bool arangodb::compressShard (string const& value, string& compressed) {
+  Try<string> result = gzip::compress(value);
+
+  if (result.isError()) {
+    return false;
+  }
+
+  compressed = result.get();
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief decompresses a shard
+////////////////////////////////////////////////////////////////////////////////
+
+bool arangodb::decompressShard (string const& compressed, string& value) {
+  Try<string> result = gzip::decompress(compressed);
+
+  if (result.isError()) {
+    return false;
+  }
+
+  value = result.get();
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief converts a state written with an older schema
+////////////////////////////////////////////////////////////////////////////////
+
+bool arangodb::upgradeState (State& state) {
+  if (STATE_SCHEMA_VERSION <= state.schema_version()) {
+    return false;
+  }
+
+  // version 1 kept the complete task info and the resources of each task,
+  // only the task id and the slave id are still needed
+  Current* current = state.mutable_current();
+
+  TasksCurrent* lists[] = {
+    current->mutable_agents(),
+    current->mutable_coordinators(),
+    current->mutable_dbservers(),
+    current->mutable_secondaries()
+  };
+
+  for (auto list : lists) {
+    for (auto& entry : *list->mutable_entries()) {
+      if (entry.has_task_info()) {
+        mesos::TaskInfo const& info = entry.task_info();
+
+        if (entry.task_id().empty()) {
+          entry.set_task_id(info.task_id().value());
+        }
+
+        if (! entry.has_slave_id() && ! info.slave_id().value().empty()) {
+          entry.mutable_slave_id()->CopyFrom(info.slave_id());
+        }
+
+        entry.clear_task_info();
+      }
+
+      entry.clear_resources();
+    }
+  }
+
+  state.set_schema_version(STATE_SCHEMA_VERSION);
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief name of the variable holding the manifest
+////////////////////////////////////////////////////////////////////////////////
+
+string arangodb::manifestVariableName (string const& name) {
+  return "state_" + name + "_manifest";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief name of the variable holding a shard written in a generation
+////////////////////////////////////////////////////////////////////////////////
+
+string arangodb::shardVariableName (string const& name,
+                                    string const& key,
+                                    uint64_t generation) {
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%020llu",
+           static_cast<unsigned long long>(generation));
+
+  return "state_" + name + "_shard_" + key + "_" + buffer;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief parses the name of a variable holding a shard of the given state
+////////////////////////////////////////////////////////////////////////////////
+
+bool arangodb::parseShardVariableName (string const& name,
+                                       string const& variable,
+                                       uint64_t& generation) {
+  string prefix = "state_" + name + "_shard_";
+
+  // the name of the state itself may contain "_shard_", so the key and
+  // the generation must match exactly
+  if (variable.size() < prefix.size() + 22 ||
+      variable.compare(0, prefix.size(), prefix) != 0) {
+    return false;
+  }
+
+  size_t sep = variable.size() - 21;
+
+  if (variable[sep] != '_') {
+    return false;
+  }
+
+  string key = variable.substr(prefix.size(), sep - prefix.size());
+  auto const& keys = stateShardKeys();
+
+  if (find(keys.begin(), keys.end(), key) == keys.end()) {
+    return false;
+  }
+
+  string digits = variable.substr(sep + 1);
+
+  if (digits.find_first_not_of("0123456789") != string::npos) {
+    return false;
+  }
+
+  generation = strtoull(digits.c_str(), nullptr, 10);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
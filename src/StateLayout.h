@@ -0,0 +1,119 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief layout of the stored state
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_STATE_LAYOUT_H
+#define ARANGO_STATE_LAYOUT_H 1
+
+#include "arangodb.pb.h"
+
+#include <string>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  public functions
+// -----------------------------------------------------------------------------
+
+namespace arangodb {
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief version of the schema of the state written by this version
+////////////////////////////////////////////////////////////////////////////////
+
+  const uint32_t STATE_SCHEMA_VERSION = 2;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief keys of all shards a state is split into
+////////////////////////////////////////////////////////////////////////////////
+
+  std::vector<std::string> const& stateShardKeys ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief serializes one shard of a state, returns false if the state has
+/// nothing to store under this key
+////////////////////////////////////////////////////////////////////////////////
+
+  bool serializeShard (State const& state,
+                       std::string const& key,
+                       std::string& value);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief replaces one shard of a state, returns false if the key is
+/// unknown or the value cannot be parsed
+////////////////////////////////////////////////////////////////////////////////
+
+  bool parseShard (State& state,
+                   std::string const& key,
+                   std::string const& value);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief compresses a shard, returns false on error
+////////////////////////////////////////////////////////////////////////////////
+
+  bool compressShard (std::string const& value, std::string& compressed);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief decompresses a shard, returns false on error
+////////////////////////////////////////////////////////////////////////////////
+
+  bool decompressShard (std::string const& compressed, std::string& value);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief converts a state written with an older schema, returns false if
+/// the state is already up to date
+////////////////////////////////////////////////////////////////////////////////
+
+  bool upgradeState (State& state);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief name of the variable holding the manifest
+////////////////////////////////////////////////////////////////////////////////
+
+  std::string manifestVariableName (std::string const& name);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief name of the variable holding a shard written in a generation
+////////////////////////////////////////////////////////////////////////////////
+
+  std::string shardVariableName (std::string const& name,
+                                 std::string const& key,
+                                 uint64_t generation);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief parses the name of a variable holding a shard of the given state,
+/// returns false if the variable is not such a shard
+////////////////////////////////////////////////////////////////////////////////
+
+  bool parseShardVariableName (std::string const& name,
+                               std::string const& variable,
+                               uint64_t& generation);
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief targets compiled for matching offers
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "TargetMatcher.h"
+
+#include "utils.h"
+
+using namespace arangodb;
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                struct OfferSummary
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief summarizes an offer in a single pass over its resources
+////////////////////////////////////////////////////////////////////////////////
+
+OfferSummary::OfferSummary (mesos::Offer const& offer)
+  : _cpus(0.0), _mem(0.0), _disk(0.0), _ports(0) {
+  for (int i = 0;  i < offer.resources_size();  ++i) {
+    auto const& resource = offer.resources(i);
+
+    if (resource.type() == mesos::Value::SCALAR) {
+      string const& name = resource.name();
+
+      if (name == "cpus") {
+        _cpus += resource.scalar().value();
+      }
+      else if (name == "mem") {
+        _mem += resource.scalar().value();
+      }
+      else if (name == "disk") {
+        _disk += resource.scalar().value();
+      }
+    }
+    else if (resource.type() == mesos::Value::RANGES &&
+             resource.name() == "ports") {
+      auto const& ranges = resource.ranges();
+
+      for (int j = 0;  j < ranges.range_size();  ++j) {
+        _ports += ranges.range(j).end() - ranges.range(j).begin() + 1;
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                               class TargetMatcher
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor
+////////////////////////////////////////////////////////////////////////////////
+
+TargetMatcher::TargetMatcher ()
+  : _cpus(0.0), _mem(0.0), _disk(0.0), _ports(0) {
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor
+////////////////////////////////////////////////////////////////////////////////
+
+TargetMatcher::TargetMatcher (Target const& target, string const& role)
+  : TargetMatcher() {
+  update(target, role);
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief compiles the target again, if it has changed
+////////////////////////////////////////////////////////////////////////////////
+
+bool TargetMatcher::update (Target const& target, string const& role) {
+  string source = target.SerializePartialAsString();
+
+  if (source == _source && role == _role) {
+    return false;
+  }
+
+  _target.CopyFrom(target);
+  _source.swap(source);
+  _role = role;
+
+  mesos::Resources minimum = target.minimal_resources();
+
+  _minimum = minimum.flatten(role);
+  _minimumDisk = filterIsDisk(_minimum);
+  _minimumNotDisk = filterNotIsDisk(_minimum);
+
+  _cpus = arangodb::cpus(_minimum);
+  _mem = arangodb::memory(_minimum);
+  _disk = arangodb::diskspace(_minimum);
+  _ports = target.number_ports();
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                              class TargetMatchers
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief compiles the targets which have changed
+////////////////////////////////////////////////////////////////////////////////
+
+void TargetMatchers::update (Targets const& targets, string const& role) {
+  _matchers[static_cast<int>(TaskType::AGENT)]
+    .update(targets.agents(), role);
+  _matchers[static_cast<int>(TaskType::COORDINATOR)]
+    .update(targets.coordinators(), role);
+  _matchers[static_cast<int>(TaskType::PRIMARY_DBSERVER)]
+    .update(targets.dbservers(), role);
+  _matchers[static_cast<int>(TaskType::SECONDARY_DBSERVER)]
+    .update(targets.secondaries(), role);
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,266 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief targets compiled for matching offers
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_TARGET_MATCHER_H
+#define ARANGO_TARGET_MATCHER_H 1
+
+#include "arangodb.pb.h"
+#include "TaskIndex.h"
+
+#include <mesos/resources.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace arangodb {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                struct OfferSummary
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the totals of an offer, the cpus, memory and disk of all roles
+/// and the number of ports of all roles
+////////////////////////////////////////////////////////////////////////////////
+
+  struct OfferSummary {
+    double _cpus;
+    double _mem;
+    double _disk;
+    uint64_t _ports;
+
+    OfferSummary ()
+      : _cpus(0.0), _mem(0.0), _disk(0.0), _ports(0) {
+    }
+
+    explicit OfferSummary (mesos::Offer const&);
+  };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                               class TargetMatcher
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a target compiled for matching offers
+///
+/// The minimal resources are flattened to our role once, and split into
+/// the disk and all other resources. Their totals are kept, such that an
+/// offer which cannot hold them is rejected by comparing its summary,
+/// before mesos::Resources::find is run. The matcher is only compiled
+/// again, if the target changes.
+////////////////////////////////////////////////////////////////////////////////
+
+  class TargetMatcher {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor, the matcher needs nothing
+////////////////////////////////////////////////////////////////////////////////
+
+      TargetMatcher ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor, compiles a target for the given role
+////////////////////////////////////////////////////////////////////////////////
+
+      TargetMatcher (Target const&, std::string const& role);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief compiles the target again, if it has changed, returns true
+/// if it had
+////////////////////////////////////////////////////////////////////////////////
+
+      bool update (Target const&, std::string const& role);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief checks whether an offer might hold the minimal resources and
+/// the ports, if not, it certainly does not
+////////////////////////////////////////////////////////////////////////////////
+
+      bool mightFit (OfferSummary const& summary) const {
+        return _ports <= summary._ports &&
+               _cpus <= summary._cpus &&
+               _mem <= summary._mem &&
+               _disk <= summary._disk;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the target
+////////////////////////////////////////////////////////////////////////////////
+
+      Target const& target () const {
+        return _target;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the minimal resources flattened to our role
+////////////////////////////////////////////////////////////////////////////////
+
+      mesos::Resources const& minimum () const {
+        return _minimum;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the disk of the minimal resources flattened to our role
+////////////////////////////////////////////////////////////////////////////////
+
+      mesos::Resources const& minimumDisk () const {
+        return _minimumDisk;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief all but the disk of the minimal resources flattened to our role
+////////////////////////////////////////////////////////////////////////////////
+
+      mesos::Resources const& minimumNotDisk () const {
+        return _minimumNotDisk;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the cpus needed
+////////////////////////////////////////////////////////////////////////////////
+
+      double cpus () const {
+        return _cpus;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the memory needed
+////////////////////////////////////////////////////////////////////////////////
+
+      double mem () const {
+        return _mem;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the disk space needed
+////////////////////////////////////////////////////////////////////////////////
+
+      double disk () const {
+        return _disk;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the number of ports needed
+////////////////////////////////////////////////////////////////////////////////
+
+      uint32_t ports () const {
+        return _ports;
+      }
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private variables
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the target, its serialization and the role it was compiled for
+////////////////////////////////////////////////////////////////////////////////
+
+      Target _target;
+      std::string _source;
+      std::string _role;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the compiled minimal resources
+////////////////////////////////////////////////////////////////////////////////
+
+      mesos::Resources _minimum;
+      mesos::Resources _minimumDisk;
+      mesos::Resources _minimumNotDisk;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the totals of the minimal resources
+////////////////////////////////////////////////////////////////////////////////
+
+      double _cpus;
+      double _mem;
+      double _disk;
+      uint32_t _ports;
+  };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                              class TargetMatchers
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the matchers of the targets of all task types
+////////////////////////////////////////////////////////////////////////////////
+
+  class TargetMatchers {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief compiles the targets which have changed
+////////////////////////////////////////////////////////////////////////////////
+
+      void update (Targets const&, std::string const& role);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the matcher of a task type, must not be TaskType::UNKNOWN
+////////////////////////////////////////////////////////////////////////////////
+
+      TargetMatcher const& matcher (TaskType type) const {
+        return _matchers[static_cast<int>(type)];
+      }
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private variables
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the matchers by task type
+////////////////////////////////////////////////////////////////////////////////
+
+      TargetMatcher _matchers[NUMBER_TASK_TYPES];
+  };
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
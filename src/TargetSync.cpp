@@ -0,0 +1,178 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief synchronization of the cluster targets with the coordinators
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "TargetSync.h"
+
+#include "utils.h"
+
+#include "logging/logging.hpp"
+
+#include <picojson.h>
+
+#include <cmath>
+
+using namespace arangodb;
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  class TargetSync
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor, the targets are not known yet
+////////////////////////////////////////////////////////////////////////////////
+
+TargetSync::TargetSync ()
+  : _known(false), _dbservers(0), _coordinators(0) {
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief asks a coordinator for the targets
+////////////////////////////////////////////////////////////////////////////////
+
+TargetSync::Response TargetSync::fetch (string const& coordinatorURL,
+                                        string const& etag,
+                                        double timeout) {
+  Response response;
+
+  response._httpCode = 0;
+  response._etag = etag;
+  response._result = doConditionalClusterHTTPGet(
+    coordinatorURL + "/_admin/cluster/numberOfServers",
+    response._etag, response._body, response._httpCode, timeout);
+
+  return response;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief applies an answer
+////////////////////////////////////////////////////////////////////////////////
+
+bool TargetSync::apply (Response const& response) {
+  ++_statistics._requests;
+
+  if (response._result == 0 && response._httpCode == 304) {
+    ++_statistics._notModified;
+    return false;
+  }
+
+  if (response._result != 0 || response._httpCode != 200) {
+    LOG(ERROR) << "Couldn't retrieve cluster targets. HTTP Code: "
+               << response._httpCode;
+    ++_statistics._failures;
+    return false;
+  }
+
+  // the entity tag is only kept with a body which could be used, else
+  // the coordinator would answer 304 to a body never understood
+  if (_known && response._body == _body) {
+    _etag = response._etag;
+    ++_statistics._unchanged;
+    return false;
+  }
+
+  picojson::value value;
+  std::string err = picojson::parse(value, response._body);
+  
+  if (!err.empty()) {
+    LOG(WARNING) << "Couldn't parse json(cluster targets): " << err
+                 << ". Body was: " << response._body;
+    ++_statistics._failures;
+    return false;
+  }
+  
+  if (!value.is<picojson::object>()) {
+    LOG(WARNING) << "Root result is not an object for cluster targets. Body was: "
+                 << response._body;
+    ++_statistics._failures;
+    return false;
+  }
+
+  vector<string> cleanedServers;
+  auto cleanedServersValue = value.get("cleanedServers");
+  
+  if (cleanedServersValue.is<picojson::array>()) {
+    for (auto const& it : cleanedServersValue.get<picojson::array>()) {
+      if (it.is<std::string>()) {
+        cleanedServers.push_back(it.get<std::string>());
+      }
+    }
+  }
+
+  int dbservers = 0;
+  int coordinators = 0;
+
+  auto propertyPairs = {
+    std::make_pair("numberOfDBServers", &dbservers),
+    std::make_pair("numberOfCoordinators", &coordinators),
+  };
+
+  for (auto const& it: propertyPairs) {
+    auto nrValue = value.get(it.first);
+
+    if (!nrValue.is<double>()) {
+      LOG(ERROR) << it.first << " in cluster target is not a number but "
+                 << nrValue.to_str();
+      ++_statistics._failures;
+      return false;
+    }
+
+    *it.second = static_cast<int>(std::round(nrValue.get<double>()));
+  }
+
+  bool changed = ! _known
+              || dbservers != _dbservers
+              || coordinators != _coordinators;
+
+  _etag = response._etag;
+  _body = response._body;
+  _known = true;
+  _dbservers = dbservers;
+  _coordinators = coordinators;
+  _cleanedServers.swap(cleanedServers);
+
+  if (changed) {
+    ++_statistics._changes;
+  }
+  else {
+    ++_statistics._unchanged;
+  }
+
+  return changed;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
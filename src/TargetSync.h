@@ -0,0 +1,212 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief synchronization of the cluster targets with the coordinators
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_TARGET_SYNC_H
+#define ARANGO_TARGET_SYNC_H 1
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace arangodb {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  class TargetSync
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the number of servers the cluster wants
+///
+/// The numbers of DBservers and coordinators and the servers cleaned out
+/// are kept by the agency and read from /_admin/cluster/numberOfServers
+/// of a coordinator. The request is conditional on the entity tag of the
+/// last answer which could be parsed. If the coordinator does not send
+/// one, an answer with the same body as the last one is not parsed
+/// again. The targets are only reported as changed, if one of the numbers
+/// differs from the last one.
+///
+/// fetch can run in any thread, the other methods are only used by the
+/// dispatcher.
+////////////////////////////////////////////////////////////////////////////////
+
+  class TargetSync {
+    TargetSync (TargetSync const&) = delete;
+    TargetSync& operator= (TargetSync const&) = delete;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                      public types
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief an answer of a coordinator
+////////////////////////////////////////////////////////////////////////////////
+
+      struct Response {
+        int _result;            // libcurl error code, 0 if OK
+        long _httpCode;
+        std::string _etag;
+        std::string _body;
+      };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the requests, an unchanged answer has the
+/// same body as the last one, a change is a new number of servers
+////////////////////////////////////////////////////////////////////////////////
+
+      struct Statistics {
+        uint64_t _requests;
+        uint64_t _notModified;
+        uint64_t _unchanged;
+        uint64_t _changes;
+        uint64_t _failures;
+
+        Statistics ()
+          : _requests(0), _notModified(0), _unchanged(0), _changes(0),
+            _failures(0) {
+        }
+      };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor, the targets are not known yet
+////////////////////////////////////////////////////////////////////////////////
+
+      TargetSync ();
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief asks a coordinator for the targets, conditional on the entity
+/// tag given
+////////////////////////////////////////////////////////////////////////////////
+
+      static Response fetch (std::string const& coordinatorURL,
+                             std::string const& etag,
+                             double timeout);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief entity tag of the last answer which could be parsed
+////////////////////////////////////////////////////////////////////////////////
+
+      std::string const& etag () const {
+        return _etag;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief applies an answer, returns true if the number of DBservers or
+/// coordinators has changed
+////////////////////////////////////////////////////////////////////////////////
+
+      bool apply (Response const&);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief whether the targets are known
+////////////////////////////////////////////////////////////////////////////////
+
+      bool known () const {
+        return _known;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the number of DBservers wanted
+////////////////////////////////////////////////////////////////////////////////
+
+      int dbservers () const {
+        return _dbservers;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the number of coordinators wanted
+////////////////////////////////////////////////////////////////////////////////
+
+      int coordinators () const {
+        return _coordinators;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the servers cleaned out, as of the last answer
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<std::string> const& cleanedServers () const {
+        return _cleanedServers;
+      }
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the requests
+////////////////////////////////////////////////////////////////////////////////
+
+      Statistics const& statistics () const {
+        return _statistics;
+      }
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private variables
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief entity tag and body of the last answer
+////////////////////////////////////////////////////////////////////////////////
+
+      std::string _etag;
+      std::string _body;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the targets of the last answer
+////////////////////////////////////////////////////////////////////////////////
+
+      bool _known;
+      int _dbservers;
+      int _coordinators;
+      std::vector<std::string> _cleanedServers;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics about the requests
+////////////////////////////////////////////////////////////////////////////////
+
+      Statistics _statistics;
+  };
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -0,0 +1,336 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief secondary indexes over the tasks in plan and current
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "TaskIndex.h"
+
+#include <algorithm>
+
+using namespace arangodb;
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief all task types with entries in plan and current
+////////////////////////////////////////////////////////////////////////////////
+
+static const TaskType ALL_TASK_TYPES[] = {
+  TaskType::AGENT,
+  TaskType::COORDINATOR,
+  TaskType::PRIMARY_DBSERVER,
+  TaskType::SECONDARY_DBSERVER
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief looks up a key, -1 if it is unknown
+////////////////////////////////////////////////////////////////////////////////
+
+static int lookup (unordered_map<string, int> const& index,
+                   string const& key) {
+  auto it = index.find(key);
+
+  return it == index.end() ? -1 : it->second;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   class TaskIndex
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor, empty index
+////////////////////////////////////////////////////////////////////////////////
+
+TaskIndex::TaskIndex () {
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor, indexes all tasks of a state
+////////////////////////////////////////////////////////////////////////////////
+
+TaskIndex::TaskIndex (State const& state) {
+  for (auto type : ALL_TASK_TYPES) {
+    int n = max(tasksPlan(state, type).entries_size(),
+                tasksCurrent(state, type).entries_size());
+
+    for (int i = 0;  i < n;  ++i) {
+      update(state, type, i);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief indexes a task again
+////////////////////////////////////////////////////////////////////////////////
+
+bool TaskIndex::update (State const& state, TaskType type, int position) {
+  if (type == TaskType::UNKNOWN || position < 0) {
+    return false;
+  }
+
+  TasksPlan const& plan = tasksPlan(state, type);
+  TasksCurrent const& current = tasksCurrent(state, type);
+  Keys keys;
+
+  if (position < plan.entries_size()) {
+    TaskPlan const& entry = plan.entries(position);
+
+    keys._name = entry.name();
+    keys._serverId = entry.server_id();
+    keys._persistenceId = entry.persistence_id();
+    keys._timed = entry.has_timestamp();
+    keys._state = entry.state();
+    keys._timestamp = entry.timestamp();
+  }
+
+  if (position < current.entries_size()) {
+    TaskCurrent const& entry = current.entries(position);
+
+    keys._slaveId = entry.slave_id().value();
+    keys._taskId = entry.task_id();
+  }
+
+  auto& indexed = _keys[static_cast<int>(type)];
+
+  if (indexed.size() <= static_cast<size_t>(position)) {
+    indexed.resize(position + 1);
+  }
+
+  Keys const& old = indexed[position];
+
+  bool restarted = keys._timed &&
+    (! old._timed || old._state != keys._state ||
+     old._timestamp != keys._timestamp);
+
+  remove(type, position, old);
+  insert(type, position, keys);
+
+  indexed[position] = keys;
+
+  return restarted;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief position of the task with the given name
+////////////////////////////////////////////////////////////////////////////////
+
+int TaskIndex::findByName (TaskType type, string const& name) const {
+  if (type == TaskType::UNKNOWN) {
+    return -1;
+  }
+
+  return lookup(_names[static_cast<int>(type)], name);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief position of the task with the given server id
+////////////////////////////////////////////////////////////////////////////////
+
+int TaskIndex::findByServerId (TaskType type, string const& serverId) const {
+  if (type == TaskType::UNKNOWN) {
+    return -1;
+  }
+
+  return lookup(_serverIds[static_cast<int>(type)], serverId);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief position of the task with the given persistence id
+////////////////////////////////////////////////////////////////////////////////
+
+int TaskIndex::findByPersistenceId (TaskType type,
+                                    string const& persistenceId) const {
+  if (type == TaskType::UNKNOWN) {
+    return -1;
+  }
+
+  return lookup(_persistenceIds[static_cast<int>(type)], persistenceId);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief type and position of the task with the given Mesos task id
+////////////////////////////////////////////////////////////////////////////////
+
+TaskIndex::Position TaskIndex::findByTaskId (string const& taskId) const {
+  auto it = _taskIds.find(taskId);
+
+  if (it == _taskIds.end()) {
+    return make_pair(TaskType::UNKNOWN, -1);
+  }
+
+  return it->second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief positions of all tasks of a type on a slave
+////////////////////////////////////////////////////////////////////////////////
+
+vector<int> TaskIndex::findBySlaveId (TaskType type,
+                                      string const& slaveId) const {
+  if (type == TaskType::UNKNOWN) {
+    return {};
+  }
+
+  auto const& index = _slaveIds[static_cast<int>(type)];
+  auto it = index.find(slaveId);
+
+  if (it == index.end()) {
+    return {};
+  }
+
+  return it->second;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief adds the keys of a task
+////////////////////////////////////////////////////////////////////////////////
+
+void TaskIndex::insert (TaskType type, int position, Keys const& keys) {
+  int t = static_cast<int>(type);
+
+  if (! keys._name.empty()) {
+    _names[t].emplace(keys._name, position);
+  }
+
+  if (! keys._serverId.empty()) {
+    _serverIds[t].emplace(keys._serverId, position);
+  }
+
+  if (! keys._persistenceId.empty()) {
+    _persistenceIds[t].emplace(keys._persistenceId, position);
+  }
+
+  if (! keys._slaveId.empty()) {
+    auto& positions = _slaveIds[t][keys._slaveId];
+    auto it = lower_bound(positions.begin(), positions.end(), position);
+
+    if (it == positions.end() || *it != position) {
+      positions.insert(it, position);
+    }
+  }
+
+  if (! keys._taskId.empty()) {
+    _taskIds[keys._taskId] = make_pair(type, position);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief removes the keys of a task
+////////////////////////////////////////////////////////////////////////////////
+
+void TaskIndex::remove (TaskType type, int position, Keys const& keys) {
+  int t = static_cast<int>(type);
+
+  auto removeKey = [position] (unordered_map<string, int>& index,
+                               string const& key) {
+    auto it = index.find(key);
+
+    if (it != index.end() && it->second == position) {
+      index.erase(it);
+    }
+  };
+
+  removeKey(_names[t], keys._name);
+  removeKey(_serverIds[t], keys._serverId);
+  removeKey(_persistenceIds[t], keys._persistenceId);
+
+  if (! keys._slaveId.empty()) {
+    auto it = _slaveIds[t].find(keys._slaveId);
+
+    if (it != _slaveIds[t].end()) {
+      auto& positions = it->second;
+      positions.erase(
+        std::remove(positions.begin(), positions.end(), position),
+        positions.end());
+
+      if (positions.empty()) {
+        _slaveIds[t].erase(it);
+      }
+    }
+  }
+
+  if (! keys._taskId.empty()) {
+    auto it = _taskIds.find(keys._taskId);
+
+    if (it != _taskIds.end() && it->second == make_pair(type, position)) {
+      _taskIds.erase(it);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  public functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief plan entries of a task type
+////////////////////////////////////////////////////////////////////////////////
+
+TasksPlan const& arangodb::tasksPlan (State const& state, TaskType type) {
+  switch (type) {
+    case TaskType::AGENT:              return state.plan().agents();
+    case TaskType::COORDINATOR:        return state.plan().coordinators();
+    case TaskType::PRIMARY_DBSERVER:   return state.plan().dbservers();
+    case TaskType::SECONDARY_DBSERVER: return state.plan().secondaries();
+    case TaskType::UNKNOWN:            break;
+  }
+
+  return TasksPlan::default_instance();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief current entries of a task type
+////////////////////////////////////////////////////////////////////////////////
+
+TasksCurrent const& arangodb::tasksCurrent (State const& state, TaskType type) {
+  switch (type) {
+    case TaskType::AGENT:              return state.current().agents();
+    case TaskType::COORDINATOR:        return state.current().coordinators();
+    case TaskType::PRIMARY_DBSERVER:   return state.current().dbservers();
+    case TaskType::SECONDARY_DBSERVER: return state.current().secondaries();
+    case TaskType::UNKNOWN:            break;
+  }
+
+  return TasksCurrent::default_instance();
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
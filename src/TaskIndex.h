@@ -0,0 +1,247 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief secondary indexes over the tasks in plan and current
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_TASK_INDEX_H
+#define ARANGO_TASK_INDEX_H 1
+
+#include "arangodb.pb.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace arangodb {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                               enum class TaskType
+// -----------------------------------------------------------------------------
+
+  enum class TaskType {
+    UNKNOWN,
+    AGENT,
+    COORDINATOR,
+    PRIMARY_DBSERVER,
+    SECONDARY_DBSERVER
+  };
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief number of task types, TaskType can be used as index into arrays
+////////////////////////////////////////////////////////////////////////////////
+
+  const int NUMBER_TASK_TYPES = 5;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   class TaskIndex
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief maps names, server ids, task ids, slave ids and persistence ids
+/// to the position of the task in plan and current
+///
+/// The index is built from a state, whoever changes a task afterwards
+/// updates its entries with update(), which only touches the keys of
+/// this task, so the lookups need not look at the state.
+/// Names, server ids and persistence ids are unique per task type, if
+/// there are duplicates, the first entry indexed wins.
+////////////////////////////////////////////////////////////////////////////////
+
+  class TaskIndex {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                      public types
+// -----------------------------------------------------------------------------
+
+    public:
+
+      typedef std::pair<TaskType, int> Position;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor, empty index
+////////////////////////////////////////////////////////////////////////////////
+
+      TaskIndex ();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor, indexes all tasks of a state
+////////////////////////////////////////////////////////////////////////////////
+
+      explicit TaskIndex (State const& state);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief indexes a task again after its plan or current entry has changed,
+/// a task added at the end is indexed like this as well, returns true if
+/// the task has a timestamp and its state or timestamp have changed, that
+/// is, if a timeout of the task starts anew
+////////////////////////////////////////////////////////////////////////////////
+
+      bool update (State const&, TaskType, int position);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief position of the task with the given name, -1 if unknown
+////////////////////////////////////////////////////////////////////////////////
+
+      int findByName (TaskType, std::string const&) const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief position of the task with the given server id, -1 if unknown
+////////////////////////////////////////////////////////////////////////////////
+
+      int findByServerId (TaskType, std::string const&) const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief position of the task with the given persistence id, -1 if unknown
+////////////////////////////////////////////////////////////////////////////////
+
+      int findByPersistenceId (TaskType, std::string const&) const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief type and position of the task with the given Mesos task id,
+/// the type is TaskType::UNKNOWN if the task is unknown
+////////////////////////////////////////////////////////////////////////////////
+
+      Position findByTaskId (std::string const&) const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief positions of all tasks of a type on a slave, in ascending order
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<int> findBySlaveId (TaskType, std::string const&) const;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                     private types
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the keys a task is indexed under
+////////////////////////////////////////////////////////////////////////////////
+
+      struct Keys {
+        std::string _name;
+        std::string _serverId;
+        std::string _persistenceId;
+        std::string _slaveId;
+        std::string _taskId;
+        bool _timed;
+        TaskPlanState _state;
+        double _timestamp;
+
+        Keys ()
+          : _timed(false), _state(TASK_STATE_NEW), _timestamp(0.0) {
+        }
+      };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   private methods
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief adds the keys of a task
+////////////////////////////////////////////////////////////////////////////////
+
+      void insert (TaskType, int position, Keys const&);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief removes the keys of a task
+////////////////////////////////////////////////////////////////////////////////
+
+      void remove (TaskType, int position, Keys const&);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private variables
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief per task type the keys each task is indexed under, by position
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<Keys> _keys[NUMBER_TASK_TYPES];
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief per task type indexes over plan entries
+////////////////////////////////////////////////////////////////////////////////
+
+      std::unordered_map<std::string, int> _names[NUMBER_TASK_TYPES];
+
+      std::unordered_map<std::string, int> _serverIds[NUMBER_TASK_TYPES];
+
+      std::unordered_map<std::string, int> _persistenceIds[NUMBER_TASK_TYPES];
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief per task type index over the slaves of current entries, the
+/// positions are in ascending order
+////////////////////////////////////////////////////////////////////////////////
+
+      std::unordered_map<std::string, std::vector<int>> _slaveIds[NUMBER_TASK_TYPES];
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief index over the Mesos task ids of current entries
+////////////////////////////////////////////////////////////////////////////////
+
+      std::unordered_map<std::string, Position> _taskIds;
+  };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                  public functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief plan entries of a task type, must not be TaskType::UNKNOWN
+////////////////////////////////////////////////////////////////////////////////
+
+  TasksPlan const& tasksPlan (State const&, TaskType);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief current entries of a task type, must not be TaskType::UNKNOWN
+////////////////////////////////////////////////////////////////////////////////
+
+  TasksCurrent const& tasksCurrent (State const&, TaskType);
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
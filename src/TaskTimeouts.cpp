@@ -0,0 +1,306 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief timeouts of the task plan states
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "TaskTimeouts.h"
+
+#include <cstdlib>
+
+using namespace arangodb;
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private functions
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief names of the task types in timeout names
+////////////////////////////////////////////////////////////////////////////////
+
+static string typeName (TaskType type) {
+  switch (type) {
+    case TaskType::AGENT:              return "agent";
+    case TaskType::COORDINATOR:        return "coordinator";
+    case TaskType::PRIMARY_DBSERVER:   return "dbserver";
+    case TaskType::SECONDARY_DBSERVER: return "secondary";
+    case TaskType::UNKNOWN:            break;
+  }
+
+  return "unknown";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief names of the timed states in timeout names
+////////////////////////////////////////////////////////////////////////////////
+
+static string stateName (TaskPlanState state) {
+  switch (state) {
+    case TASK_STATE_TRYING_TO_RESERVE: return "reserve";
+    case TASK_STATE_TRYING_TO_PERSIST: return "persist";
+    case TASK_STATE_TRYING_TO_START:   return "start";
+    case TASK_STATE_TRYING_TO_RESTART: return "restart";
+    case TASK_STATE_KILLED:            return "killed";
+    case TASK_STATE_FAILED_OVER:       return "failed_over";
+    case TASK_STATE_SHUTTING_DOWN:     return "shutdown";
+    default:                           break;
+  }
+
+  return "";
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                class TaskTimeouts
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor, sets the default timeouts
+////////////////////////////////////////////////////////////////////////////////
+
+TaskTimeouts::TaskTimeouts ()
+  : _version(0) {
+  for (int t = 0;  t < NUMBER_TASK_TYPES;  ++t) {
+    for (int s = 0;  s < TaskPlanState_ARRAYSIZE;  ++s) {
+      _timeouts[t][s] = 0.0;
+    }
+
+    _timeouts[t][TASK_STATE_TRYING_TO_RESERVE] = 30;
+    _timeouts[t][TASK_STATE_TRYING_TO_PERSIST] = 30;
+    _timeouts[t][TASK_STATE_TRYING_TO_START] = 600;   // docker pull might take
+    _timeouts[t][TASK_STATE_TRYING_TO_RESTART] = 600;
+    _timeouts[t][TASK_STATE_KILLED] = 60;
+    _timeouts[t][TASK_STATE_FAILED_OVER] = 60;
+    _timeouts[t][TASK_STATE_SHUTTING_DOWN] = 120;     // then kill the task
+  }
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief timeout in seconds of a type in a state
+////////////////////////////////////////////////////////////////////////////////
+
+double TaskTimeouts::timeout (TaskType type, TaskPlanState state) const {
+  lock_guard<mutex> lock(_lock);
+  return _timeouts[static_cast<int>(type)][state];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets a timeout by name
+////////////////////////////////////////////////////////////////////////////////
+
+bool TaskTimeouts::set (string const& name, double seconds, string& error) {
+  Entry entry = { name, seconds };
+  return set(vector<Entry>{ entry }, error);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets several timeouts by name at once
+////////////////////////////////////////////////////////////////////////////////
+
+bool TaskTimeouts::set (vector<Entry> const& entries, string& error) {
+  vector<pair<vector<TaskType>, TaskPlanState>> resolved;
+
+  for (auto const& entry : entries) {
+    string const& name = entry._name;
+    string type;
+    string state = name;
+    size_t dot = name.find('.');
+
+    if (dot != string::npos) {
+      type = name.substr(0, dot);
+      state = name.substr(dot + 1);
+    }
+
+    vector<TaskType> types;
+
+    for (auto t : timedTypes()) {
+      if (type.empty() || typeName(t) == type) {
+        types.push_back(t);
+      }
+    }
+
+    if (types.empty()) {
+      error = "unknown task type '" + type + "' in timeout '" + name + "'";
+      return false;
+    }
+
+    TaskPlanState found = TASK_STATE_NEW;
+
+    for (auto s : timedStates()) {
+      if (stateName(s) == state) {
+        found = s;
+      }
+    }
+
+    if (found == TASK_STATE_NEW) {
+      error = "unknown state '" + state + "' in timeout '" + name + "'";
+      return false;
+    }
+
+    if (entry._seconds < 0) {
+      error = "negative timeout '" + name + "'";
+      return false;
+    }
+
+    resolved.emplace_back(types, found);
+  }
+
+  lock_guard<mutex> lock(_lock);
+
+  for (size_t i = 0;  i < entries.size();  ++i) {
+    for (auto t : resolved[i].first) {
+      _timeouts[static_cast<int>(t)][resolved[i].second] = entries[i]._seconds;
+    }
+  }
+
+  ++_version;
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets the timeouts of a comma separated list
+////////////////////////////////////////////////////////////////////////////////
+
+bool TaskTimeouts::parse (string const& spec, string& error) {
+  vector<Entry> entries;
+  size_t pos = 0;
+
+  while (pos < spec.size()) {
+    size_t comma = spec.find(',', pos);
+
+    if (comma == string::npos) {
+      comma = spec.size();
+    }
+
+    string entry = spec.substr(pos, comma - pos);
+    pos = comma + 1;
+
+    if (entry.empty()) {
+      continue;
+    }
+
+    size_t equal = entry.find('=');
+
+    if (equal == string::npos) {
+      error = "expecting name=seconds, got '" + entry + "'";
+      return false;
+    }
+
+    string value = entry.substr(equal + 1);
+    char* end = nullptr;
+    double seconds = strtod(value.c_str(), &end);
+
+    if (value.empty() || *end != '\0') {
+      error = "expecting a number of seconds, got '" + entry + "'";
+      return false;
+    }
+
+    Entry timeout = { entry.substr(0, equal), seconds };
+    entries.push_back(timeout);
+  }
+
+  return set(entries, error);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the timeouts of all types and timed states
+////////////////////////////////////////////////////////////////////////////////
+
+vector<TaskTimeouts::Entry> TaskTimeouts::entries () const {
+  vector<Entry> result;
+
+  lock_guard<mutex> lock(_lock);
+
+  for (auto type : timedTypes()) {
+    for (auto state : timedStates()) {
+      Entry entry = {
+        typeName(type) + "." + stateName(state),
+        _timeouts[static_cast<int>(type)][state]
+      };
+
+      result.push_back(entry);
+    }
+  }
+
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief number of changes
+////////////////////////////////////////////////////////////////////////////////
+
+uint64_t TaskTimeouts::version () const {
+  lock_guard<mutex> lock(_lock);
+  return _version;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                             public static methods
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the task types with a timeout
+////////////////////////////////////////////////////////////////////////////////
+
+vector<TaskType> const& TaskTimeouts::timedTypes () {
+  static const vector<TaskType> types = {
+    TaskType::AGENT,
+    TaskType::COORDINATOR,
+    TaskType::PRIMARY_DBSERVER,
+    TaskType::SECONDARY_DBSERVER
+  };
+
+  return types;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the states with a timeout
+////////////////////////////////////////////////////////////////////////////////
+
+vector<TaskPlanState> const& TaskTimeouts::timedStates () {
+  static const vector<TaskPlanState> states = {
+    TASK_STATE_TRYING_TO_RESERVE,
+    TASK_STATE_TRYING_TO_PERSIST,
+    TASK_STATE_TRYING_TO_START,
+    TASK_STATE_TRYING_TO_RESTART,
+    TASK_STATE_KILLED,
+    TASK_STATE_FAILED_OVER,
+    TASK_STATE_SHUTTING_DOWN
+  };
+
+  return states;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
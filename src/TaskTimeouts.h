@@ -0,0 +1,182 @@
+///////////////////////////////////////////////////////////////////////////////
+/// @brief timeouts of the task plan states
+///
+/// @file
+///
+/// DISCLAIMER
+///
+/// Copyright 2015 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+///
+/// @author Dr. Frank Celler
+/// @author Copyright 2015, ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ARANGO_TASK_TIMEOUTS_H
+#define ARANGO_TASK_TIMEOUTS_H 1
+
+#include "TaskIndex.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace arangodb {
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                class TaskTimeouts
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief how long a task may stay in a state of the plan
+///
+/// A task which has been in a timed state for longer than its timeout is
+/// handled by ArangoManager::checkTimeouts, the time in a state is taken
+/// from the timestamp of the plan entry. A timeout is set for a state,
+/// which applies to all task types, or for a type and a state, named
+/// like "start" or "coordinator.killed". The states are reserve, persist,
+/// start, restart, killed, failed_over and shutdown, the types agent,
+/// coordinator, dbserver and secondary. A timeout of 0 never expires.
+///
+/// The timeouts can be changed while the dispatcher reads them, all
+/// methods are thread-safe.
+////////////////////////////////////////////////////////////////////////////////
+
+  class TaskTimeouts {
+    TaskTimeouts (TaskTimeouts const&) = delete;
+    TaskTimeouts& operator= (TaskTimeouts const&) = delete;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                      public types
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a timeout of one type and state
+////////////////////////////////////////////////////////////////////////////////
+
+      struct Entry {
+        std::string _name;      // like "coordinator.killed"
+        double _seconds;
+      };
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                      constructors and destructors
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief constructor, sets the default timeouts
+////////////////////////////////////////////////////////////////////////////////
+
+      TaskTimeouts ();
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                    public methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief timeout in seconds of a type in a state, 0 if it never expires
+////////////////////////////////////////////////////////////////////////////////
+
+      double timeout (TaskType, TaskPlanState) const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets a timeout by name, returns false and an error message if
+/// the name is unknown or the timeout is negative
+////////////////////////////////////////////////////////////////////////////////
+
+      bool set (std::string const& name, double seconds, std::string& error);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets several timeouts by name at once, in order, returns false
+/// and an error message at the first invalid entry, no timeout is changed
+/// then
+////////////////////////////////////////////////////////////////////////////////
+
+      bool set (std::vector<Entry> const& entries, std::string& error);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief sets the timeouts of a comma separated list like
+/// "start=900,coordinator.killed=30", in order, returns false and an
+/// error message at the first invalid entry, no timeout is changed then
+////////////////////////////////////////////////////////////////////////////////
+
+      bool parse (std::string const& spec, std::string& error);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the timeouts of all types and timed states
+////////////////////////////////////////////////////////////////////////////////
+
+      std::vector<Entry> entries () const;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief number of changes of the timeouts, such that a reader can tell
+/// whether any has changed since it last looked at them
+////////////////////////////////////////////////////////////////////////////////
+
+      uint64_t version () const;
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                             public static methods
+// -----------------------------------------------------------------------------
+
+    public:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the task types and the states with a timeout
+////////////////////////////////////////////////////////////////////////////////
+
+      static std::vector<TaskType> const& timedTypes ();
+
+      static std::vector<TaskPlanState> const& timedStates ();
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                 private variables
+// -----------------------------------------------------------------------------
+
+    private:
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief protects the timeouts
+////////////////////////////////////////////////////////////////////////////////
+
+      mutable std::mutex _lock;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief timeouts in seconds by type and state
+////////////////////////////////////////////////////////////////////////////////
+
+      double _timeouts[NUMBER_TASK_TYPES][TaskPlanState_ARRAYSIZE];
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief number of changes
+////////////////////////////////////////////////////////////////////////////////
+
+      uint64_t _version;
+  };
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                       END-OF-FILE
+// -----------------------------------------------------------------------------
@@ -53,10 +53,29 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* Current_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   Current_reflection_ = NULL;
+const ::google::protobuf::Descriptor* Failover_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  Failover_reflection_ = NULL;
+const ::google::protobuf::Descriptor* Failovers_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  Failovers_reflection_ = NULL;
 const ::google::protobuf::Descriptor* State_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   State_reflection_ = NULL;
+const ::google::protobuf::Descriptor* TaskDelta_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  TaskDelta_reflection_ = NULL;
+const ::google::protobuf::Descriptor* StateDelta_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  StateDelta_reflection_ = NULL;
+const ::google::protobuf::Descriptor* StateShard_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  StateShard_reflection_ = NULL;
+const ::google::protobuf::Descriptor* StateManifest_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  StateManifest_reflection_ = NULL;
 const ::google::protobuf::EnumDescriptor* TaskPlanState_descriptor_ = NULL;
+const ::google::protobuf::EnumDescriptor* FailoverState_descriptor_ = NULL;
 
 }  // namespace
 
@@ -68,9 +87,12 @@ void protobuf_AssignDesc_arangodb_2eproto() {
       "arangodb.proto");
   GOOGLE_CHECK(file != NULL);
   Restart_descriptor_ = file->message_type(0);
-  static const int Restart_offsets_[2] = {
+  static const int Restart_offsets_[5] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Restart, buckets_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Restart, timestamp_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Restart, id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Restart, parallelism_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Restart, total_buckets_),
   };
   Restart_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -99,9 +121,10 @@ void protobuf_AssignDesc_arangodb_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(RestartBucket));
   RestartTaskInfo_descriptor_ = file->message_type(2);
-  static const int RestartTaskInfo_offsets_[2] = {
+  static const int RestartTaskInfo_offsets_[3] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RestartTaskInfo, task_type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RestartTaskInfo, task_name_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RestartTaskInfo, restarted_),
   };
   RestartTaskInfo_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -153,13 +176,14 @@ void protobuf_AssignDesc_arangodb_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(Targets));
   TaskPlan_descriptor_ = file->message_type(5);
-  static const int TaskPlan_offsets_[6] = {
+  static const int TaskPlan_offsets_[7] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskPlan, state_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskPlan, persistence_id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskPlan, timestamp_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskPlan, name_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskPlan, sync_partner_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskPlan, server_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskPlan, stepwise_),
   };
   TaskPlan_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -206,7 +230,7 @@ void protobuf_AssignDesc_arangodb_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(Plan));
   TaskCurrent_descriptor_ = file->message_type(8);
-  static const int TaskCurrent_offsets_[9] = {
+  static const int TaskCurrent_offsets_[12] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskCurrent, slave_id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskCurrent, offer_id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskCurrent, resources_),
@@ -216,6 +240,9 @@ void protobuf_AssignDesc_arangodb_2eproto() {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskCurrent, task_info_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskCurrent, start_time_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskCurrent, kill_time_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskCurrent, task_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskCurrent, launch_hash_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskCurrent, single_offer_),
   };
   TaskCurrent_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -262,13 +289,50 @@ void protobuf_AssignDesc_arangodb_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(Current));
-  State_descriptor_ = file->message_type(11);
-  static const int State_offsets_[5] = {
+  Failover_descriptor_ = file->message_type(11);
+  static const int Failover_offsets_[5] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Failover, primary_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Failover, secondary_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Failover, state_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Failover, timestamp_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Failover, attempts_),
+  };
+  Failover_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      Failover_descriptor_,
+      Failover::default_instance_,
+      Failover_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Failover, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Failover, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(Failover));
+  Failovers_descriptor_ = file->message_type(12);
+  static const int Failovers_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Failovers, entries_),
+  };
+  Failovers_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      Failovers_descriptor_,
+      Failovers::default_instance_,
+      Failovers_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Failovers, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Failovers, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(Failovers));
+  State_descriptor_ = file->message_type(13);
+  static const int State_offsets_[8] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(State, framework_id_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(State, targets_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(State, plan_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(State, current_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(State, restart_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(State, journal_sequence_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(State, schema_version_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(State, failovers_),
   };
   State_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -281,7 +345,88 @@ void protobuf_AssignDesc_arangodb_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(State));
+  TaskDelta_descriptor_ = file->message_type(14);
+  static const int TaskDelta_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskDelta, task_type_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskDelta, position_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskDelta, plan_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskDelta, current_),
+  };
+  TaskDelta_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      TaskDelta_descriptor_,
+      TaskDelta::default_instance_,
+      TaskDelta_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskDelta, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TaskDelta, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(TaskDelta));
+  StateDelta_descriptor_ = file->message_type(15);
+  static const int StateDelta_offsets_[10] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateDelta, sequence_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateDelta, framework_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateDelta, targets_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateDelta, tasks_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateDelta, plan_sizes_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateDelta, current_sizes_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateDelta, restart_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateDelta, clear_restart_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateDelta, cluster_complete_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateDelta, failovers_),
+  };
+  StateDelta_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      StateDelta_descriptor_,
+      StateDelta::default_instance_,
+      StateDelta_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateDelta, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateDelta, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(StateDelta));
+  StateShard_descriptor_ = file->message_type(16);
+  static const int StateShard_offsets_[4] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateShard, key_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateShard, variable_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateShard, compressed_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateShard, size_),
+  };
+  StateShard_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      StateShard_descriptor_,
+      StateShard::default_instance_,
+      StateShard_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateShard, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateShard, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(StateShard));
+  StateManifest_descriptor_ = file->message_type(17);
+  static const int StateManifest_offsets_[6] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateManifest, generation_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateManifest, framework_id_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateManifest, cluster_complete_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateManifest, journal_sequence_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateManifest, shards_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateManifest, schema_version_),
+  };
+  StateManifest_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      StateManifest_descriptor_,
+      StateManifest::default_instance_,
+      StateManifest_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateManifest, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StateManifest, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(StateManifest));
   TaskPlanState_descriptor_ = file->enum_type(0);
+  FailoverState_descriptor_ = file->enum_type(1);
 }
 
 namespace {
@@ -316,8 +461,20 @@ void protobuf_RegisterTypes(const ::std::string&) {
     TasksCurrent_descriptor_, &TasksCurrent::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     Current_descriptor_, &Current::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Failover_descriptor_, &Failover::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Failovers_descriptor_, &Failovers::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     State_descriptor_, &State::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    TaskDelta_descriptor_, &TaskDelta::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    StateDelta_descriptor_, &StateDelta::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    StateShard_descriptor_, &StateShard::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    StateManifest_descriptor_, &StateManifest::default_instance());
 }
 
 }  // namespace
@@ -345,8 +502,20 @@ void protobuf_ShutdownFile_arangodb_2eproto() {
   delete TasksCurrent_reflection_;
   delete Current::default_instance_;
   delete Current_reflection_;
+  delete Failover::default_instance_;
+  delete Failover_reflection_;
+  delete Failovers::default_instance_;
+  delete Failovers_reflection_;
   delete State::default_instance_;
   delete State_reflection_;
+  delete TaskDelta::default_instance_;
+  delete TaskDelta_reflection_;
+  delete StateDelta::default_instance_;
+  delete StateDelta_reflection_;
+  delete StateShard::default_instance_;
+  delete StateShard_reflection_;
+  delete StateManifest::default_instance_;
+  delete StateManifest_reflection_;
 }
 
 void protobuf_AddDesc_arangodb_2eproto() {
@@ -358,55 +527,87 @@ void protobuf_AddDesc_arangodb_2eproto() {
   ::mesos::protobuf_AddDesc_mesos_2fmesos_2eproto();
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
     "\n\016arangodb.proto\022\010arangodb\032\021mesos/mesos."
-    "proto\"F\n\007Restart\022(\n\007buckets\030\001 \003(\0132\027.aran"
-    "godb.RestartBucket\022\021\n\ttimestamp\030\002 \002(\001\"A\n"
-    "\rRestartBucket\0220\n\rrestart_tasks\030\001 \003(\0132\031."
-    "arangodb.RestartTaskInfo\"7\n\017RestartTaskI"
-    "nfo\022\021\n\ttask_type\030\001 \002(\r\022\021\n\ttask_name\030\002 \002("
-    "\t\"\214\001\n\006Target\022\021\n\tinstances\030\001 \002(\r\022*\n\021minim"
-    "al_resources\030\002 \003(\0132\017.mesos.Resource\022-\n\024a"
-    "dditional_resources\030\003 \003(\0132\017.mesos.Resour"
-    "ce\022\024\n\014number_ports\030\004 \002(\r\"\317\001\n\007Targets\022\014\n\004"
-    "mode\030\001 \002(\t\022 \n\006agents\030\002 \002(\0132\020.arangodb.Ta"
-    "rget\022&\n\014coordinators\030\003 \002(\0132\020.arangodb.Ta"
-    "rget\022#\n\tdbservers\030\004 \002(\0132\020.arangodb.Targe"
-    "t\022%\n\013secondaries\030\005 \002(\0132\020.arangodb.Target"
-    "\022 \n\030asynchronous_replication\030\006 \001(\010\"\244\001\n\010T"
-    "askPlan\0226\n\005state\030\001 \002(\0162\027.arangodb.TaskPl"
-    "anState:\016TASK_STATE_NEW\022\026\n\016persistence_i"
-    "d\030\002 \001(\t\022\021\n\ttimestamp\030\003 \001(\001\022\014\n\004name\030\004 \002(\t"
-    "\022\024\n\014sync_partner\030\005 \001(\t\022\021\n\tserver_id\030\006 \001("
-    "\t\"0\n\tTasksPlan\022#\n\007entries\030\001 \003(\0132\022.arango"
-    "db.TaskPlan\"\250\001\n\004Plan\022#\n\006agents\030\001 \002(\0132\023.a"
-    "rangodb.TasksPlan\022)\n\014coordinators\030\002 \002(\0132"
-    "\023.arangodb.TasksPlan\022&\n\tdbservers\030\003 \002(\0132"
-    "\023.arangodb.TasksPlan\022(\n\013secondaries\030\004 \002("
-    "\0132\023.arangodb.TasksPlan\"\371\001\n\013TaskCurrent\022 "
-    "\n\010slave_id\030\001 \001(\0132\016.mesos.SlaveID\022 \n\010offe"
-    "r_id\030\002 \001(\0132\016.mesos.OfferID\022\"\n\tresources\030"
-    "\003 \003(\0132\017.mesos.Resource\022\r\n\005ports\030\004 \003(\r\022\020\n"
-    "\010hostname\030\005 \001(\t\022\026\n\016container_path\030\006 \001(\t\022"
-    "\"\n\ttask_info\030\007 \001(\0132\017.mesos.TaskInfo\022\022\n\ns"
-    "tart_time\030\010 \001(\001\022\021\n\tkill_time\030\t \001(\001\"6\n\014Ta"
-    "sksCurrent\022&\n\007entries\030\001 \003(\0132\025.arangodb.T"
-    "askCurrent\"\321\001\n\007Current\022&\n\006agents\030\001 \002(\0132\026"
-    ".arangodb.TasksCurrent\022,\n\014coordinators\030\002"
-    " \002(\0132\026.arangodb.TasksCurrent\022)\n\tdbserver"
-    "s\030\003 \002(\0132\026.arangodb.TasksCurrent\022+\n\013secon"
-    "daries\030\004 \002(\0132\026.arangodb.TasksCurrent\022\030\n\020"
-    "cluster_complete\030\005 \002(\010\"\273\001\n\005State\022(\n\014fram"
-    "ework_id\030\001 \001(\0132\022.mesos.FrameworkID\022\"\n\007ta"
-    "rgets\030\002 \002(\0132\021.arangodb.Targets\022\034\n\004plan\030\003"
-    " \002(\0132\016.arangodb.Plan\022\"\n\007current\030\004 \002(\0132\021."
-    "arangodb.Current\022\"\n\007restart\030\005 \001(\0132\021.aran"
-    "godb.Restart*\247\002\n\rTaskPlanState\022\022\n\016TASK_S"
-    "TATE_NEW\020\001\022 \n\034TASK_STATE_TRYING_TO_RESER"
-    "VE\020\002\022 \n\034TASK_STATE_TRYING_TO_PERSIST\020\003\022\036"
-    "\n\032TASK_STATE_TRYING_TO_START\020\004\022 \n\034TASK_S"
-    "TATE_TRYING_TO_RESTART\020\005\022\026\n\022TASK_STATE_R"
-    "UNNING\020\006\022\025\n\021TASK_STATE_KILLED\020\007\022\032\n\026TASK_"
-    "STATE_FAILED_OVER\020\010\022\023\n\017TASK_STATE_DEAD\020\t"
-    "\022\034\n\030TASK_STATE_SHUTTING_DOWN\020\n", 1990);
+    "proto\"~\n\007Restart\022(\n\007buckets\030\001 \003(\0132\027.aran"
+    "godb.RestartBucket\022\021\n\ttimestamp\030\002 \002(\001\022\n\n"
+    "\002id\030\003 \001(\t\022\023\n\013parallelism\030\004 \001(\r\022\025\n\rtotal_"
+    "buckets\030\005 \001(\r\"A\n\rRestartBucket\0220\n\rrestar"
+    "t_tasks\030\001 \003(\0132\031.arangodb.RestartTaskInfo"
+    "\"J\n\017RestartTaskInfo\022\021\n\ttask_type\030\001 \002(\r\022\021"
+    "\n\ttask_name\030\002 \002(\t\022\021\n\trestarted\030\003 \001(\010\"\214\001\n"
+    "\006Target\022\021\n\tinstances\030\001 \002(\r\022*\n\021minimal_re"
+    "sources\030\002 \003(\0132\017.mesos.Resource\022-\n\024additi"
+    "onal_resources\030\003 \003(\0132\017.mesos.Resource\022\024\n"
+    "\014number_ports\030\004 \002(\r\"\317\001\n\007Targets\022\014\n\004mode\030"
+    "\001 \002(\t\022 \n\006agents\030\002 \002(\0132\020.arangodb.Target\022"
+    "&\n\014coordinators\030\003 \002(\0132\020.arangodb.Target\022"
+    "#\n\tdbservers\030\004 \002(\0132\020.arangodb.Target\022%\n\013"
+    "secondaries\030\005 \002(\0132\020.arangodb.Target\022 \n\030a"
+    "synchronous_replication\030\006 \001(\010\"\266\001\n\010TaskPl"
+    "an\0226\n\005state\030\001 \002(\0162\027.arangodb.TaskPlanSta"
+    "te:\016TASK_STATE_NEW\022\026\n\016persistence_id\030\002 \001"
+    "(\t\022\021\n\ttimestamp\030\003 \001(\001\022\014\n\004name\030\004 \002(\t\022\024\n\014s"
+    "ync_partner\030\005 \001(\t\022\021\n\tserver_id\030\006 \001(\t\022\020\n\010"
+    "stepwise\030\007 \001(\010\"0\n\tTasksPlan\022#\n\007entries\030\001"
+    " \003(\0132\022.arangodb.TaskPlan\"\250\001\n\004Plan\022#\n\006age"
+    "nts\030\001 \002(\0132\023.arangodb.TasksPlan\022)\n\014coordi"
+    "nators\030\002 \002(\0132\023.arangodb.TasksPlan\022&\n\tdbs"
+    "ervers\030\003 \002(\0132\023.arangodb.TasksPlan\022(\n\013sec"
+    "ondaries\030\004 \002(\0132\023.arangodb.TasksPlan\"\265\002\n\013"
+    "TaskCurrent\022 \n\010slave_id\030\001 \001(\0132\016.mesos.Sl"
+    "aveID\022 \n\010offer_id\030\002 \001(\0132\016.mesos.OfferID\022"
+    "\"\n\tresources\030\003 \003(\0132\017.mesos.Resource\022\r\n\005p"
+    "orts\030\004 \003(\r\022\020\n\010hostname\030\005 \001(\t\022\026\n\016containe"
+    "r_path\030\006 \001(\t\022\"\n\ttask_info\030\007 \001(\0132\017.mesos."
+    "TaskInfo\022\022\n\nstart_time\030\010 \001(\001\022\021\n\tkill_tim"
+    "e\030\t \001(\001\022\017\n\007task_id\030\n \001(\t\022\023\n\013launch_hash\030"
+    "\013 \001(\t\022\024\n\014single_offer\030\014 \001(\010\"6\n\014TasksCurr"
+    "ent\022&\n\007entries\030\001 \003(\0132\025.arangodb.TaskCurr"
+    "ent\"\321\001\n\007Current\022&\n\006agents\030\001 \002(\0132\026.arango"
+    "db.TasksCurrent\022,\n\014coordinators\030\002 \002(\0132\026."
+    "arangodb.TasksCurrent\022)\n\tdbservers\030\003 \002(\013"
+    "2\026.arangodb.TasksCurrent\022+\n\013secondaries\030"
+    "\004 \002(\0132\026.arangodb.TasksCurrent\022\030\n\020cluster"
+    "_complete\030\005 \002(\010\"\224\001\n\010Failover\022\017\n\007primary\030"
+    "\001 \002(\t\022\021\n\tsecondary\030\002 \002(\t\022?\n\005state\030\003 \002(\0162"
+    "\027.arangodb.FailoverState:\027FAILOVER_SWAP_"
+    "REQUESTED\022\021\n\ttimestamp\030\004 \001(\001\022\020\n\010attempts"
+    "\030\005 \001(\r\"0\n\tFailovers\022#\n\007entries\030\001 \003(\0132\022.a"
+    "rangodb.Failover\"\225\002\n\005State\022(\n\014framework_"
+    "id\030\001 \001(\0132\022.mesos.FrameworkID\022\"\n\007targets\030"
+    "\002 \002(\0132\021.arangodb.Targets\022\034\n\004plan\030\003 \002(\0132\016"
+    ".arangodb.Plan\022\"\n\007current\030\004 \002(\0132\021.arango"
+    "db.Current\022\"\n\007restart\030\005 \001(\0132\021.arangodb.R"
+    "estart\022\030\n\020journal_sequence\030\006 \001(\004\022\026\n\016sche"
+    "ma_version\030\007 \001(\r\022&\n\tfailovers\030\010 \001(\0132\023.ar"
+    "angodb.Failovers\"z\n\tTaskDelta\022\021\n\ttask_ty"
+    "pe\030\001 \002(\r\022\020\n\010position\030\002 \002(\r\022 \n\004plan\030\003 \001(\013"
+    "2\022.arangodb.TaskPlan\022&\n\007current\030\004 \001(\0132\025."
+    "arangodb.TaskCurrent\"\270\002\n\nStateDelta\022\020\n\010s"
+    "equence\030\001 \002(\004\022(\n\014framework_id\030\002 \001(\0132\022.me"
+    "sos.FrameworkID\022\"\n\007targets\030\003 \001(\0132\021.arang"
+    "odb.Targets\022\"\n\005tasks\030\004 \003(\0132\023.arangodb.Ta"
+    "skDelta\022\022\n\nplan_sizes\030\005 \003(\r\022\025\n\rcurrent_s"
+    "izes\030\006 \003(\r\022\"\n\007restart\030\007 \001(\0132\021.arangodb.R"
+    "estart\022\025\n\rclear_restart\030\010 \001(\010\022\030\n\020cluster"
+    "_complete\030\t \001(\010\022&\n\tfailovers\030\n \001(\0132\023.ara"
+    "ngodb.Failovers\"M\n\nStateShard\022\013\n\003key\030\001 \002"
+    "(\t\022\020\n\010variable\030\002 \002(\t\022\022\n\ncompressed\030\003 \001(\010"
+    "\022\014\n\004size\030\004 \001(\004\"\277\001\n\rStateManifest\022\022\n\ngene"
+    "ration\030\001 \002(\004\022(\n\014framework_id\030\002 \001(\0132\022.mes"
+    "os.FrameworkID\022\030\n\020cluster_complete\030\003 \001(\010"
+    "\022\030\n\020journal_sequence\030\004 \001(\004\022$\n\006shards\030\005 \003"
+    "(\0132\024.arangodb.StateShard\022\026\n\016schema_versi"
+    "on\030\006 \001(\r*\247\002\n\rTaskPlanState\022\022\n\016TASK_STATE"
+    "_NEW\020\001\022 \n\034TASK_STATE_TRYING_TO_RESERVE\020\002"
+    "\022 \n\034TASK_STATE_TRYING_TO_PERSIST\020\003\022\036\n\032TA"
+    "SK_STATE_TRYING_TO_START\020\004\022 \n\034TASK_STATE"
+    "_TRYING_TO_RESTART\020\005\022\026\n\022TASK_STATE_RUNNI"
+    "NG\020\006\022\025\n\021TASK_STATE_KILLED\020\007\022\032\n\026TASK_STAT"
+    "E_FAILED_OVER\020\010\022\023\n\017TASK_STATE_DEAD\020\t\022\034\n\030"
+    "TASK_STATE_SHUTTING_DOWN\020\n*a\n\rFailoverSt"
+    "ate\022\033\n\027FAILOVER_SWAP_REQUESTED\020\001\022 \n\034FAIL"
+    "OVER_AGENCY_ACKNOWLEDGED\020\002\022\021\n\rFAILOVER_D"
+    "ONE\020\003", 3245);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "arangodb.proto", &protobuf_RegisterTypes);
   Restart::default_instance_ = new Restart();
@@ -420,7 +621,13 @@ void protobuf_AddDesc_arangodb_2eproto() {
   TaskCurrent::default_instance_ = new TaskCurrent();
   TasksCurrent::default_instance_ = new TasksCurrent();
   Current::default_instance_ = new Current();
+  Failover::default_instance_ = new Failover();
+  Failovers::default_instance_ = new Failovers();
   State::default_instance_ = new State();
+  TaskDelta::default_instance_ = new TaskDelta();
+  StateDelta::default_instance_ = new StateDelta();
+  StateShard::default_instance_ = new StateShard();
+  StateManifest::default_instance_ = new StateManifest();
   Restart::default_instance_->InitAsDefaultInstance();
   RestartBucket::default_instance_->InitAsDefaultInstance();
   RestartTaskInfo::default_instance_->InitAsDefaultInstance();
@@ -432,7 +639,13 @@ void protobuf_AddDesc_arangodb_2eproto() {
   TaskCurrent::default_instance_->InitAsDefaultInstance();
   TasksCurrent::default_instance_->InitAsDefaultInstance();
   Current::default_instance_->InitAsDefaultInstance();
+  Failover::default_instance_->InitAsDefaultInstance();
+  Failovers::default_instance_->InitAsDefaultInstance();
   State::default_instance_->InitAsDefaultInstance();
+  TaskDelta::default_instance_->InitAsDefaultInstance();
+  StateDelta::default_instance_->InitAsDefaultInstance();
+  StateShard::default_instance_->InitAsDefaultInstance();
+  StateManifest::default_instance_->InitAsDefaultInstance();
   ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_arangodb_2eproto);
 }
 
@@ -464,12 +677,30 @@ bool TaskPlanState_IsValid(int value) {
   }
 }
 
+const ::google::protobuf::EnumDescriptor* FailoverState_descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return FailoverState_descriptor_;
+}
+bool FailoverState_IsValid(int value) {
+  switch(value) {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
 #ifndef _MSC_VER
 const int Restart::kBucketsFieldNumber;
 const int Restart::kTimestampFieldNumber;
+const int Restart::kIdFieldNumber;
+const int Restart::kParallelismFieldNumber;
+const int Restart::kTotalBucketsFieldNumber;
 #endif  // !_MSC_VER
 
 Restart::Restart()
@@ -489,6 +720,9 @@ Restart::Restart(const Restart& from)
 void Restart::SharedCtor() {
   _cached_size_ = 0;
   timestamp_ = 0;
+  id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  parallelism_ = 0u;
+  total_buckets_ = 0u;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -497,6 +731,9 @@ Restart::~Restart() {
 }
 
 void Restart::SharedDtor() {
+  if (id_ != &::google::protobuf::internal::kEmptyString) {
+    delete id_;
+  }
   if (this != default_instance_) {
   }
 }
@@ -525,6 +762,13 @@ Restart* Restart::New() const {
 void Restart::Clear() {
   if (_has_bits_[1 / 32] & (0xffu << (1 % 32))) {
     timestamp_ = 0;
+    if (has_id()) {
+      if (id_ != &::google::protobuf::internal::kEmptyString) {
+        id_->clear();
+      }
+    }
+    parallelism_ = 0u;
+    total_buckets_ = 0u;
   }
   buckets_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
@@ -564,6 +808,55 @@ bool Restart::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(26)) goto parse_id;
+        break;
+      }
+
+      // optional string id = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_id:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_id()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->id().data(), this->id().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(32)) goto parse_parallelism;
+        break;
+      }
+
+      // optional uint32 parallelism = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_parallelism:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &parallelism_)));
+          set_has_parallelism();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(40)) goto parse_total_buckets;
+        break;
+      }
+
+      // optional uint32 total_buckets = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_total_buckets:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &total_buckets_)));
+          set_has_total_buckets();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -597,6 +890,25 @@ void Restart::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteDouble(2, this->timestamp(), output);
   }
 
+  // optional string id = 3;
+  if (has_id()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->id().data(), this->id().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      3, this->id(), output);
+  }
+
+  // optional uint32 parallelism = 4;
+  if (has_parallelism()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->parallelism(), output);
+  }
+
+  // optional uint32 total_buckets = 5;
+  if (has_total_buckets()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->total_buckets(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -617,6 +929,26 @@ void Restart::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(2, this->timestamp(), target);
   }
 
+  // optional string id = 3;
+  if (has_id()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->id().data(), this->id().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->id(), target);
+  }
+
+  // optional uint32 parallelism = 4;
+  if (has_parallelism()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->parallelism(), target);
+  }
+
+  // optional uint32 total_buckets = 5;
+  if (has_total_buckets()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(5, this->total_buckets(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -633,6 +965,27 @@ int Restart::ByteSize() const {
       total_size += 1 + 8;
     }
 
+    // optional string id = 3;
+    if (has_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->id());
+    }
+
+    // optional uint32 parallelism = 4;
+    if (has_parallelism()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->parallelism());
+    }
+
+    // optional uint32 total_buckets = 5;
+    if (has_total_buckets()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->total_buckets());
+    }
+
   }
   // repeated .arangodb.RestartBucket buckets = 1;
   total_size += 1 * this->buckets_size();
@@ -672,6 +1025,15 @@ void Restart::MergeFrom(const Restart& from) {
     if (from.has_timestamp()) {
       set_timestamp(from.timestamp());
     }
+    if (from.has_id()) {
+      set_id(from.id());
+    }
+    if (from.has_parallelism()) {
+      set_parallelism(from.parallelism());
+    }
+    if (from.has_total_buckets()) {
+      set_total_buckets(from.total_buckets());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -701,6 +1063,9 @@ void Restart::Swap(Restart* other) {
   if (other != this) {
     buckets_.Swap(&other->buckets_);
     std::swap(timestamp_, other->timestamp_);
+    std::swap(id_, other->id_);
+    std::swap(parallelism_, other->parallelism_);
+    std::swap(total_buckets_, other->total_buckets_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -927,6 +1292,7 @@ void RestartBucket::Swap(RestartBucket* other) {
 #ifndef _MSC_VER
 const int RestartTaskInfo::kTaskTypeFieldNumber;
 const int RestartTaskInfo::kTaskNameFieldNumber;
+const int RestartTaskInfo::kRestartedFieldNumber;
 #endif  // !_MSC_VER
 
 RestartTaskInfo::RestartTaskInfo()
@@ -947,6 +1313,7 @@ void RestartTaskInfo::SharedCtor() {
   _cached_size_ = 0;
   task_type_ = 0u;
   task_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  restarted_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -991,6 +1358,7 @@ void RestartTaskInfo::Clear() {
         task_name_->clear();
       }
     }
+    restarted_ = false;
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -1030,6 +1398,22 @@ bool RestartTaskInfo::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(24)) goto parse_restarted;
+        break;
+      }
+
+      // optional bool restarted = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_restarted:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &restarted_)));
+          set_has_restarted();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -1066,6 +1450,11 @@ void RestartTaskInfo::SerializeWithCachedSizes(
       2, this->task_name(), output);
   }
 
+  // optional bool restarted = 3;
+  if (has_restarted()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->restarted(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -1089,6 +1478,11 @@ void RestartTaskInfo::SerializeWithCachedSizes(
         2, this->task_name(), target);
   }
 
+  // optional bool restarted = 3;
+  if (has_restarted()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->restarted(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -1114,6 +1508,11 @@ int RestartTaskInfo::ByteSize() const {
           this->task_name());
     }
 
+    // optional bool restarted = 3;
+    if (has_restarted()) {
+      total_size += 1 + 1;
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -1147,6 +1546,9 @@ void RestartTaskInfo::MergeFrom(const RestartTaskInfo& from) {
     if (from.has_task_name()) {
       set_task_name(from.task_name());
     }
+    if (from.has_restarted()) {
+      set_restarted(from.restarted());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -1173,6 +1575,7 @@ void RestartTaskInfo::Swap(RestartTaskInfo* other) {
   if (other != this) {
     std::swap(task_type_, other->task_type_);
     std::swap(task_name_, other->task_name_);
+    std::swap(restarted_, other->restarted_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -1988,6 +2391,7 @@ const int TaskPlan::kTimestampFieldNumber;
 const int TaskPlan::kNameFieldNumber;
 const int TaskPlan::kSyncPartnerFieldNumber;
 const int TaskPlan::kServerIdFieldNumber;
+const int TaskPlan::kStepwiseFieldNumber;
 #endif  // !_MSC_VER
 
 TaskPlan::TaskPlan()
@@ -2012,6 +2416,7 @@ void TaskPlan::SharedCtor() {
   name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   sync_partner_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   server_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  stepwise_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -2081,6 +2486,7 @@ void TaskPlan::Clear() {
         server_id_->clear();
       }
     }
+    stepwise_ = false;
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -2192,6 +2598,22 @@ bool TaskPlan::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(56)) goto parse_stepwise;
+        break;
+      }
+
+      // optional bool stepwise = 7;
+      case 7: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_stepwise:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &stepwise_)));
+          set_has_stepwise();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -2261,6 +2683,11 @@ void TaskPlan::SerializeWithCachedSizes(
       6, this->server_id(), output);
   }
 
+  // optional bool stepwise = 7;
+  if (has_stepwise()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(7, this->stepwise(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -2320,6 +2747,11 @@ void TaskPlan::SerializeWithCachedSizes(
         6, this->server_id(), target);
   }
 
+  // optional bool stepwise = 7;
+  if (has_stepwise()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(7, this->stepwise(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -2370,6 +2802,11 @@ int TaskPlan::ByteSize() const {
           this->server_id());
     }
 
+    // optional bool stepwise = 7;
+    if (has_stepwise()) {
+      total_size += 1 + 1;
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -2415,6 +2852,9 @@ void TaskPlan::MergeFrom(const TaskPlan& from) {
     if (from.has_server_id()) {
       set_server_id(from.server_id());
     }
+    if (from.has_stepwise()) {
+      set_stepwise(from.stepwise());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -2445,6 +2885,7 @@ void TaskPlan::Swap(TaskPlan* other) {
     std::swap(name_, other->name_);
     std::swap(sync_partner_, other->sync_partner_);
     std::swap(server_id_, other->server_id_);
+    std::swap(stepwise_, other->stepwise_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -3039,6 +3480,9 @@ const int TaskCurrent::kContainerPathFieldNumber;
 const int TaskCurrent::kTaskInfoFieldNumber;
 const int TaskCurrent::kStartTimeFieldNumber;
 const int TaskCurrent::kKillTimeFieldNumber;
+const int TaskCurrent::kTaskIdFieldNumber;
+const int TaskCurrent::kLaunchHashFieldNumber;
+const int TaskCurrent::kSingleOfferFieldNumber;
 #endif  // !_MSC_VER
 
 TaskCurrent::TaskCurrent()
@@ -3067,6 +3511,9 @@ void TaskCurrent::SharedCtor() {
   task_info_ = NULL;
   start_time_ = 0;
   kill_time_ = 0;
+  task_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  launch_hash_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  single_offer_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -3081,6 +3528,12 @@ void TaskCurrent::SharedDtor() {
   if (container_path_ != &::google::protobuf::internal::kEmptyString) {
     delete container_path_;
   }
+  if (task_id_ != &::google::protobuf::internal::kEmptyString) {
+    delete task_id_;
+  }
+  if (launch_hash_ != &::google::protobuf::internal::kEmptyString) {
+    delete launch_hash_;
+  }
   if (this != default_instance_) {
     delete slave_id_;
     delete offer_id_;
@@ -3134,6 +3587,17 @@ void TaskCurrent::Clear() {
   }
   if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
     kill_time_ = 0;
+    if (has_task_id()) {
+      if (task_id_ != &::google::protobuf::internal::kEmptyString) {
+        task_id_->clear();
+      }
+    }
+    if (has_launch_hash()) {
+      if (launch_hash_ != &::google::protobuf::internal::kEmptyString) {
+        launch_hash_->clear();
+      }
+    }
+    single_offer_ = false;
   }
   resources_.Clear();
   ports_.Clear();
@@ -3287,6 +3751,56 @@ bool TaskCurrent::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(82)) goto parse_task_id;
+        break;
+      }
+
+      // optional string task_id = 10;
+      case 10: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_task_id:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_task_id()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->task_id().data(), this->task_id().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(90)) goto parse_launch_hash;
+        break;
+      }
+
+      // optional string launch_hash = 11;
+      case 11: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_launch_hash:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_launch_hash()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->launch_hash().data(), this->launch_hash().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(96)) goto parse_single_offer;
+        break;
+      }
+
+      // optional bool single_offer = 12;
+      case 12: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_single_offer:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &single_offer_)));
+          set_has_single_offer();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -3367,6 +3881,29 @@ void TaskCurrent::SerializeWithCachedSizes(
     ::google::protobuf::internal::WireFormatLite::WriteDouble(9, this->kill_time(), output);
   }
 
+  // optional string task_id = 10;
+  if (has_task_id()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->task_id().data(), this->task_id().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      10, this->task_id(), output);
+  }
+
+  // optional string launch_hash = 11;
+  if (has_launch_hash()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->launch_hash().data(), this->launch_hash().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      11, this->launch_hash(), output);
+  }
+
+  // optional bool single_offer = 12;
+  if (has_single_offer()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(12, this->single_offer(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -3439,6 +3976,31 @@ void TaskCurrent::SerializeWithCachedSizes(
     target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(9, this->kill_time(), target);
   }
 
+  // optional string task_id = 10;
+  if (has_task_id()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->task_id().data(), this->task_id().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        10, this->task_id(), target);
+  }
+
+  // optional string launch_hash = 11;
+  if (has_launch_hash()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->launch_hash().data(), this->launch_hash().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        11, this->launch_hash(), target);
+  }
+
+  // optional bool single_offer = 12;
+  if (has_single_offer()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(12, this->single_offer(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -3497,6 +4059,25 @@ int TaskCurrent::ByteSize() const {
       total_size += 1 + 8;
     }
 
+    // optional string task_id = 10;
+    if (has_task_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->task_id());
+    }
+
+    // optional string launch_hash = 11;
+    if (has_launch_hash()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->launch_hash());
+    }
+
+    // optional bool single_offer = 12;
+    if (has_single_offer()) {
+      total_size += 1 + 1;
+    }
+
   }
   // repeated .mesos.Resource resources = 3;
   total_size += 1 * this->resources_size();
@@ -3567,6 +4148,15 @@ void TaskCurrent::MergeFrom(const TaskCurrent& from) {
     if (from.has_kill_time()) {
       set_kill_time(from.kill_time());
     }
+    if (from.has_task_id()) {
+      set_task_id(from.task_id());
+    }
+    if (from.has_launch_hash()) {
+      set_launch_hash(from.launch_hash());
+    }
+    if (from.has_single_offer()) {
+      set_single_offer(from.single_offer());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -3611,6 +4201,9 @@ void TaskCurrent::Swap(TaskCurrent* other) {
     std::swap(task_info_, other->task_info_);
     std::swap(start_time_, other->start_time_);
     std::swap(kill_time_, other->kill_time_);
+    std::swap(task_id_, other->task_id_);
+    std::swap(launch_hash_, other->launch_hash_);
+    std::swap(single_offer_, other->single_offer_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -4234,167 +4827,2654 @@ void Current::Swap(Current* other) {
 // ===================================================================
 
 #ifndef _MSC_VER
-const int State::kFrameworkIdFieldNumber;
-const int State::kTargetsFieldNumber;
-const int State::kPlanFieldNumber;
-const int State::kCurrentFieldNumber;
-const int State::kRestartFieldNumber;
+const int Failover::kPrimaryFieldNumber;
+const int Failover::kSecondaryFieldNumber;
+const int Failover::kStateFieldNumber;
+const int Failover::kTimestampFieldNumber;
+const int Failover::kAttemptsFieldNumber;
 #endif  // !_MSC_VER
 
-State::State()
+Failover::Failover()
   : ::google::protobuf::Message() {
   SharedCtor();
 }
 
-void State::InitAsDefaultInstance() {
-  framework_id_ = const_cast< ::mesos::FrameworkID*>(&::mesos::FrameworkID::default_instance());
-  targets_ = const_cast< ::arangodb::Targets*>(&::arangodb::Targets::default_instance());
-  plan_ = const_cast< ::arangodb::Plan*>(&::arangodb::Plan::default_instance());
-  current_ = const_cast< ::arangodb::Current*>(&::arangodb::Current::default_instance());
-  restart_ = const_cast< ::arangodb::Restart*>(&::arangodb::Restart::default_instance());
+void Failover::InitAsDefaultInstance() {
 }
 
-State::State(const State& from)
+Failover::Failover(const Failover& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
 }
 
-void State::SharedCtor() {
+void Failover::SharedCtor() {
   _cached_size_ = 0;
-  framework_id_ = NULL;
+  primary_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  secondary_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  state_ = 1;
+  timestamp_ = 0;
+  attempts_ = 0u;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+Failover::~Failover() {
+  SharedDtor();
+}
+
+void Failover::SharedDtor() {
+  if (primary_ != &::google::protobuf::internal::kEmptyString) {
+    delete primary_;
+  }
+  if (secondary_ != &::google::protobuf::internal::kEmptyString) {
+    delete secondary_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void Failover::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* Failover::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Failover_descriptor_;
+}
+
+const Failover& Failover::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_arangodb_2eproto();
+  return *default_instance_;
+}
+
+Failover* Failover::default_instance_ = NULL;
+
+Failover* Failover::New() const {
+  return new Failover;
+}
+
+void Failover::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_primary()) {
+      if (primary_ != &::google::protobuf::internal::kEmptyString) {
+        primary_->clear();
+      }
+    }
+    if (has_secondary()) {
+      if (secondary_ != &::google::protobuf::internal::kEmptyString) {
+        secondary_->clear();
+      }
+    }
+    state_ = 1;
+    timestamp_ = 0;
+    attempts_ = 0u;
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Failover::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required string primary = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_primary()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->primary().data(), this->primary().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_secondary;
+        break;
+      }
+
+      // required string secondary = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_secondary:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_secondary()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->secondary().data(), this->secondary().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_state;
+        break;
+      }
+
+      // required .arangodb.FailoverState state = 3 [default = FAILOVER_SWAP_REQUESTED];
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_state:
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::arangodb::FailoverState_IsValid(value)) {
+            set_state(static_cast< ::arangodb::FailoverState >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(3, value);
+          }
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(33)) goto parse_timestamp;
+        break;
+      }
+
+      // optional double timestamp = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED64) {
+         parse_timestamp:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &timestamp_)));
+          set_has_timestamp();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(40)) goto parse_attempts;
+        break;
+      }
+
+      // optional uint32 attempts = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_attempts:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &attempts_)));
+          set_has_attempts();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void Failover::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required string primary = 1;
+  if (has_primary()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->primary().data(), this->primary().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->primary(), output);
+  }
+
+  // required string secondary = 2;
+  if (has_secondary()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->secondary().data(), this->secondary().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      2, this->secondary(), output);
+  }
+
+  // required .arangodb.FailoverState state = 3 [default = FAILOVER_SWAP_REQUESTED];
+  if (has_state()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      3, this->state(), output);
+  }
+
+  // optional double timestamp = 4;
+  if (has_timestamp()) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(4, this->timestamp(), output);
+  }
+
+  // optional uint32 attempts = 5;
+  if (has_attempts()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->attempts(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* Failover::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required string primary = 1;
+  if (has_primary()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->primary().data(), this->primary().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->primary(), target);
+  }
+
+  // required string secondary = 2;
+  if (has_secondary()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->secondary().data(), this->secondary().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->secondary(), target);
+  }
+
+  // required .arangodb.FailoverState state = 3 [default = FAILOVER_SWAP_REQUESTED];
+  if (has_state()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      3, this->state(), target);
+  }
+
+  // optional double timestamp = 4;
+  if (has_timestamp()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(4, this->timestamp(), target);
+  }
+
+  // optional uint32 attempts = 5;
+  if (has_attempts()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(5, this->attempts(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int Failover::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required string primary = 1;
+    if (has_primary()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->primary());
+    }
+
+    // required string secondary = 2;
+    if (has_secondary()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->secondary());
+    }
+
+    // required .arangodb.FailoverState state = 3 [default = FAILOVER_SWAP_REQUESTED];
+    if (has_state()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->state());
+    }
+
+    // optional double timestamp = 4;
+    if (has_timestamp()) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint32 attempts = 5;
+    if (has_attempts()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->attempts());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Failover::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Failover* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Failover*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Failover::MergeFrom(const Failover& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_primary()) {
+      set_primary(from.primary());
+    }
+    if (from.has_secondary()) {
+      set_secondary(from.secondary());
+    }
+    if (from.has_state()) {
+      set_state(from.state());
+    }
+    if (from.has_timestamp()) {
+      set_timestamp(from.timestamp());
+    }
+    if (from.has_attempts()) {
+      set_attempts(from.attempts());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Failover::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Failover::CopyFrom(const Failover& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Failover::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
+
+  return true;
+}
+
+void Failover::Swap(Failover* other) {
+  if (other != this) {
+    std::swap(primary_, other->primary_);
+    std::swap(secondary_, other->secondary_);
+    std::swap(state_, other->state_);
+    std::swap(timestamp_, other->timestamp_);
+    std::swap(attempts_, other->attempts_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata Failover::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = Failover_descriptor_;
+  metadata.reflection = Failover_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int Failovers::kEntriesFieldNumber;
+#endif  // !_MSC_VER
+
+Failovers::Failovers()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void Failovers::InitAsDefaultInstance() {
+}
+
+Failovers::Failovers(const Failovers& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void Failovers::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+Failovers::~Failovers() {
+  SharedDtor();
+}
+
+void Failovers::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void Failovers::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* Failovers::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Failovers_descriptor_;
+}
+
+const Failovers& Failovers::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_arangodb_2eproto();
+  return *default_instance_;
+}
+
+Failovers* Failovers::default_instance_ = NULL;
+
+Failovers* Failovers::New() const {
+  return new Failovers;
+}
+
+void Failovers::Clear() {
+  entries_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Failovers::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .arangodb.Failover entries = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_entries:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_entries()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(10)) goto parse_entries;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void Failovers::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // repeated .arangodb.Failover entries = 1;
+  for (int i = 0; i < this->entries_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->entries(i), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* Failovers::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // repeated .arangodb.Failover entries = 1;
+  for (int i = 0; i < this->entries_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->entries(i), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int Failovers::ByteSize() const {
+  int total_size = 0;
+
+  // repeated .arangodb.Failover entries = 1;
+  total_size += 1 * this->entries_size();
+  for (int i = 0; i < this->entries_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->entries(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Failovers::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Failovers* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Failovers*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Failovers::MergeFrom(const Failovers& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  entries_.MergeFrom(from.entries_);
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Failovers::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Failovers::CopyFrom(const Failovers& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Failovers::IsInitialized() const {
+
+  for (int i = 0; i < entries_size(); i++) {
+    if (!this->entries(i).IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Failovers::Swap(Failovers* other) {
+  if (other != this) {
+    entries_.Swap(&other->entries_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata Failovers::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = Failovers_descriptor_;
+  metadata.reflection = Failovers_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int State::kFrameworkIdFieldNumber;
+const int State::kTargetsFieldNumber;
+const int State::kPlanFieldNumber;
+const int State::kCurrentFieldNumber;
+const int State::kRestartFieldNumber;
+const int State::kJournalSequenceFieldNumber;
+const int State::kSchemaVersionFieldNumber;
+const int State::kFailoversFieldNumber;
+#endif  // !_MSC_VER
+
+State::State()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void State::InitAsDefaultInstance() {
+  framework_id_ = const_cast< ::mesos::FrameworkID*>(&::mesos::FrameworkID::default_instance());
+  targets_ = const_cast< ::arangodb::Targets*>(&::arangodb::Targets::default_instance());
+  plan_ = const_cast< ::arangodb::Plan*>(&::arangodb::Plan::default_instance());
+  current_ = const_cast< ::arangodb::Current*>(&::arangodb::Current::default_instance());
+  restart_ = const_cast< ::arangodb::Restart*>(&::arangodb::Restart::default_instance());
+  failovers_ = const_cast< ::arangodb::Failovers*>(&::arangodb::Failovers::default_instance());
+}
+
+State::State(const State& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void State::SharedCtor() {
+  _cached_size_ = 0;
+  framework_id_ = NULL;
+  targets_ = NULL;
+  plan_ = NULL;
+  current_ = NULL;
+  restart_ = NULL;
+  journal_sequence_ = GOOGLE_ULONGLONG(0);
+  schema_version_ = 0u;
+  failovers_ = NULL;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+State::~State() {
+  SharedDtor();
+}
+
+void State::SharedDtor() {
+  if (this != default_instance_) {
+    delete framework_id_;
+    delete targets_;
+    delete plan_;
+    delete current_;
+    delete restart_;
+    delete failovers_;
+  }
+}
+
+void State::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* State::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return State_descriptor_;
+}
+
+const State& State::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_arangodb_2eproto();
+  return *default_instance_;
+}
+
+State* State::default_instance_ = NULL;
+
+State* State::New() const {
+  return new State;
+}
+
+void State::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_framework_id()) {
+      if (framework_id_ != NULL) framework_id_->::mesos::FrameworkID::Clear();
+    }
+    if (has_targets()) {
+      if (targets_ != NULL) targets_->::arangodb::Targets::Clear();
+    }
+    if (has_plan()) {
+      if (plan_ != NULL) plan_->::arangodb::Plan::Clear();
+    }
+    if (has_current()) {
+      if (current_ != NULL) current_->::arangodb::Current::Clear();
+    }
+    if (has_restart()) {
+      if (restart_ != NULL) restart_->::arangodb::Restart::Clear();
+    }
+    journal_sequence_ = GOOGLE_ULONGLONG(0);
+    schema_version_ = 0u;
+    if (has_failovers()) {
+      if (failovers_ != NULL) failovers_->::arangodb::Failovers::Clear();
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool State::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional .mesos.FrameworkID framework_id = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_framework_id()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_targets;
+        break;
+      }
+
+      // required .arangodb.Targets targets = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_targets:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_targets()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_plan;
+        break;
+      }
+
+      // required .arangodb.Plan plan = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_plan:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_plan()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(34)) goto parse_current;
+        break;
+      }
+
+      // required .arangodb.Current current = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_current:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_current()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(42)) goto parse_restart;
+        break;
+      }
+
+      // optional .arangodb.Restart restart = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_restart:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_restart()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(48)) goto parse_journal_sequence;
+        break;
+      }
+
+      // optional uint64 journal_sequence = 6;
+      case 6: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_journal_sequence:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &journal_sequence_)));
+          set_has_journal_sequence();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(56)) goto parse_schema_version;
+        break;
+      }
+
+      // optional uint32 schema_version = 7;
+      case 7: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_schema_version:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &schema_version_)));
+          set_has_schema_version();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(66)) goto parse_failovers;
+        break;
+      }
+
+      // optional .arangodb.Failovers failovers = 8;
+      case 8: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_failovers:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_failovers()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void State::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // optional .mesos.FrameworkID framework_id = 1;
+  if (has_framework_id()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->framework_id(), output);
+  }
+
+  // required .arangodb.Targets targets = 2;
+  if (has_targets()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->targets(), output);
+  }
+
+  // required .arangodb.Plan plan = 3;
+  if (has_plan()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->plan(), output);
+  }
+
+  // required .arangodb.Current current = 4;
+  if (has_current()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->current(), output);
+  }
+
+  // optional .arangodb.Restart restart = 5;
+  if (has_restart()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, this->restart(), output);
+  }
+
+  // optional uint64 journal_sequence = 6;
+  if (has_journal_sequence()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->journal_sequence(), output);
+  }
+
+  // optional uint32 schema_version = 7;
+  if (has_schema_version()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(7, this->schema_version(), output);
+  }
+
+  // optional .arangodb.Failovers failovers = 8;
+  if (has_failovers()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      8, this->failovers(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* State::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // optional .mesos.FrameworkID framework_id = 1;
+  if (has_framework_id()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->framework_id(), target);
+  }
+
+  // required .arangodb.Targets targets = 2;
+  if (has_targets()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        2, this->targets(), target);
+  }
+
+  // required .arangodb.Plan plan = 3;
+  if (has_plan()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->plan(), target);
+  }
+
+  // required .arangodb.Current current = 4;
+  if (has_current()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        4, this->current(), target);
+  }
+
+  // optional .arangodb.Restart restart = 5;
+  if (has_restart()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        5, this->restart(), target);
+  }
+
+  // optional uint64 journal_sequence = 6;
+  if (has_journal_sequence()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(6, this->journal_sequence(), target);
+  }
+
+  // optional uint32 schema_version = 7;
+  if (has_schema_version()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(7, this->schema_version(), target);
+  }
+
+  // optional .arangodb.Failovers failovers = 8;
+  if (has_failovers()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        8, this->failovers(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int State::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional .mesos.FrameworkID framework_id = 1;
+    if (has_framework_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->framework_id());
+    }
+
+    // required .arangodb.Targets targets = 2;
+    if (has_targets()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->targets());
+    }
+
+    // required .arangodb.Plan plan = 3;
+    if (has_plan()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->plan());
+    }
+
+    // required .arangodb.Current current = 4;
+    if (has_current()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->current());
+    }
+
+    // optional .arangodb.Restart restart = 5;
+    if (has_restart()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->restart());
+    }
+
+    // optional uint64 journal_sequence = 6;
+    if (has_journal_sequence()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->journal_sequence());
+    }
+
+    // optional uint32 schema_version = 7;
+    if (has_schema_version()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->schema_version());
+    }
+
+    // optional .arangodb.Failovers failovers = 8;
+    if (has_failovers()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->failovers());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void State::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const State* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const State*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void State::MergeFrom(const State& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_framework_id()) {
+      mutable_framework_id()->::mesos::FrameworkID::MergeFrom(from.framework_id());
+    }
+    if (from.has_targets()) {
+      mutable_targets()->::arangodb::Targets::MergeFrom(from.targets());
+    }
+    if (from.has_plan()) {
+      mutable_plan()->::arangodb::Plan::MergeFrom(from.plan());
+    }
+    if (from.has_current()) {
+      mutable_current()->::arangodb::Current::MergeFrom(from.current());
+    }
+    if (from.has_restart()) {
+      mutable_restart()->::arangodb::Restart::MergeFrom(from.restart());
+    }
+    if (from.has_journal_sequence()) {
+      set_journal_sequence(from.journal_sequence());
+    }
+    if (from.has_schema_version()) {
+      set_schema_version(from.schema_version());
+    }
+    if (from.has_failovers()) {
+      mutable_failovers()->::arangodb::Failovers::MergeFrom(from.failovers());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void State::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void State::CopyFrom(const State& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool State::IsInitialized() const {
+  if ((_has_bits_[0] & 0x0000000e) != 0x0000000e) return false;
+
+  if (has_framework_id()) {
+    if (!this->framework_id().IsInitialized()) return false;
+  }
+  if (has_targets()) {
+    if (!this->targets().IsInitialized()) return false;
+  }
+  if (has_plan()) {
+    if (!this->plan().IsInitialized()) return false;
+  }
+  if (has_current()) {
+    if (!this->current().IsInitialized()) return false;
+  }
+  if (has_restart()) {
+    if (!this->restart().IsInitialized()) return false;
+  }
+  if (has_failovers()) {
+    if (!this->failovers().IsInitialized()) return false;
+  }
+  return true;
+}
+
+void State::Swap(State* other) {
+  if (other != this) {
+    std::swap(framework_id_, other->framework_id_);
+    std::swap(targets_, other->targets_);
+    std::swap(plan_, other->plan_);
+    std::swap(current_, other->current_);
+    std::swap(restart_, other->restart_);
+    std::swap(journal_sequence_, other->journal_sequence_);
+    std::swap(schema_version_, other->schema_version_);
+    std::swap(failovers_, other->failovers_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata State::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = State_descriptor_;
+  metadata.reflection = State_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int TaskDelta::kTaskTypeFieldNumber;
+const int TaskDelta::kPositionFieldNumber;
+const int TaskDelta::kPlanFieldNumber;
+const int TaskDelta::kCurrentFieldNumber;
+#endif  // !_MSC_VER
+
+TaskDelta::TaskDelta()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void TaskDelta::InitAsDefaultInstance() {
+  plan_ = const_cast< ::arangodb::TaskPlan*>(&::arangodb::TaskPlan::default_instance());
+  current_ = const_cast< ::arangodb::TaskCurrent*>(&::arangodb::TaskCurrent::default_instance());
+}
+
+TaskDelta::TaskDelta(const TaskDelta& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void TaskDelta::SharedCtor() {
+  _cached_size_ = 0;
+  task_type_ = 0u;
+  position_ = 0u;
+  plan_ = NULL;
+  current_ = NULL;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+TaskDelta::~TaskDelta() {
+  SharedDtor();
+}
+
+void TaskDelta::SharedDtor() {
+  if (this != default_instance_) {
+    delete plan_;
+    delete current_;
+  }
+}
+
+void TaskDelta::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* TaskDelta::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return TaskDelta_descriptor_;
+}
+
+const TaskDelta& TaskDelta::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_arangodb_2eproto();
+  return *default_instance_;
+}
+
+TaskDelta* TaskDelta::default_instance_ = NULL;
+
+TaskDelta* TaskDelta::New() const {
+  return new TaskDelta;
+}
+
+void TaskDelta::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    task_type_ = 0u;
+    position_ = 0u;
+    if (has_plan()) {
+      if (plan_ != NULL) plan_->::arangodb::TaskPlan::Clear();
+    }
+    if (has_current()) {
+      if (current_ != NULL) current_->::arangodb::TaskCurrent::Clear();
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool TaskDelta::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint32 task_type = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &task_type_)));
+          set_has_task_type();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_position;
+        break;
+      }
+
+      // required uint32 position = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_position:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &position_)));
+          set_has_position();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_plan;
+        break;
+      }
+
+      // optional .arangodb.TaskPlan plan = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_plan:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_plan()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(34)) goto parse_current;
+        break;
+      }
+
+      // optional .arangodb.TaskCurrent current = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_current:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_current()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void TaskDelta::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required uint32 task_type = 1;
+  if (has_task_type()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->task_type(), output);
+  }
+
+  // required uint32 position = 2;
+  if (has_position()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->position(), output);
+  }
+
+  // optional .arangodb.TaskPlan plan = 3;
+  if (has_plan()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->plan(), output);
+  }
+
+  // optional .arangodb.TaskCurrent current = 4;
+  if (has_current()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->current(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* TaskDelta::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required uint32 task_type = 1;
+  if (has_task_type()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->task_type(), target);
+  }
+
+  // required uint32 position = 2;
+  if (has_position()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->position(), target);
+  }
+
+  // optional .arangodb.TaskPlan plan = 3;
+  if (has_plan()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->plan(), target);
+  }
+
+  // optional .arangodb.TaskCurrent current = 4;
+  if (has_current()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        4, this->current(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int TaskDelta::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint32 task_type = 1;
+    if (has_task_type()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->task_type());
+    }
+
+    // required uint32 position = 2;
+    if (has_position()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->position());
+    }
+
+    // optional .arangodb.TaskPlan plan = 3;
+    if (has_plan()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->plan());
+    }
+
+    // optional .arangodb.TaskCurrent current = 4;
+    if (has_current()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->current());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void TaskDelta::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const TaskDelta* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const TaskDelta*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void TaskDelta::MergeFrom(const TaskDelta& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_task_type()) {
+      set_task_type(from.task_type());
+    }
+    if (from.has_position()) {
+      set_position(from.position());
+    }
+    if (from.has_plan()) {
+      mutable_plan()->::arangodb::TaskPlan::MergeFrom(from.plan());
+    }
+    if (from.has_current()) {
+      mutable_current()->::arangodb::TaskCurrent::MergeFrom(from.current());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void TaskDelta::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TaskDelta::CopyFrom(const TaskDelta& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TaskDelta::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+
+  if (has_plan()) {
+    if (!this->plan().IsInitialized()) return false;
+  }
+  if (has_current()) {
+    if (!this->current().IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TaskDelta::Swap(TaskDelta* other) {
+  if (other != this) {
+    std::swap(task_type_, other->task_type_);
+    std::swap(position_, other->position_);
+    std::swap(plan_, other->plan_);
+    std::swap(current_, other->current_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata TaskDelta::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = TaskDelta_descriptor_;
+  metadata.reflection = TaskDelta_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int StateDelta::kSequenceFieldNumber;
+const int StateDelta::kFrameworkIdFieldNumber;
+const int StateDelta::kTargetsFieldNumber;
+const int StateDelta::kTasksFieldNumber;
+const int StateDelta::kPlanSizesFieldNumber;
+const int StateDelta::kCurrentSizesFieldNumber;
+const int StateDelta::kRestartFieldNumber;
+const int StateDelta::kClearRestartFieldNumber;
+const int StateDelta::kClusterCompleteFieldNumber;
+const int StateDelta::kFailoversFieldNumber;
+#endif  // !_MSC_VER
+
+StateDelta::StateDelta()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void StateDelta::InitAsDefaultInstance() {
+  framework_id_ = const_cast< ::mesos::FrameworkID*>(&::mesos::FrameworkID::default_instance());
+  targets_ = const_cast< ::arangodb::Targets*>(&::arangodb::Targets::default_instance());
+  restart_ = const_cast< ::arangodb::Restart*>(&::arangodb::Restart::default_instance());
+  failovers_ = const_cast< ::arangodb::Failovers*>(&::arangodb::Failovers::default_instance());
+}
+
+StateDelta::StateDelta(const StateDelta& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void StateDelta::SharedCtor() {
+  _cached_size_ = 0;
+  sequence_ = GOOGLE_ULONGLONG(0);
+  framework_id_ = NULL;
   targets_ = NULL;
-  plan_ = NULL;
-  current_ = NULL;
   restart_ = NULL;
+  clear_restart_ = false;
+  cluster_complete_ = false;
+  failovers_ = NULL;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+StateDelta::~StateDelta() {
+  SharedDtor();
+}
+
+void StateDelta::SharedDtor() {
+  if (this != default_instance_) {
+    delete framework_id_;
+    delete targets_;
+    delete restart_;
+    delete failovers_;
+  }
+}
+
+void StateDelta::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* StateDelta::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return StateDelta_descriptor_;
+}
+
+const StateDelta& StateDelta::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_arangodb_2eproto();
+  return *default_instance_;
+}
+
+StateDelta* StateDelta::default_instance_ = NULL;
+
+StateDelta* StateDelta::New() const {
+  return new StateDelta;
+}
+
+void StateDelta::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    sequence_ = GOOGLE_ULONGLONG(0);
+    if (has_framework_id()) {
+      if (framework_id_ != NULL) framework_id_->::mesos::FrameworkID::Clear();
+    }
+    if (has_targets()) {
+      if (targets_ != NULL) targets_->::arangodb::Targets::Clear();
+    }
+    if (has_restart()) {
+      if (restart_ != NULL) restart_->::arangodb::Restart::Clear();
+    }
+    clear_restart_ = false;
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    cluster_complete_ = false;
+    if (has_failovers()) {
+      if (failovers_ != NULL) failovers_->::arangodb::Failovers::Clear();
+    }
+  }
+  tasks_.Clear();
+  plan_sizes_.Clear();
+  current_sizes_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool StateDelta::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint64 sequence = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &sequence_)));
+          set_has_sequence();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_framework_id;
+        break;
+      }
+
+      // optional .mesos.FrameworkID framework_id = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_framework_id:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_framework_id()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(26)) goto parse_targets;
+        break;
+      }
+
+      // optional .arangodb.Targets targets = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_targets:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_targets()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(34)) goto parse_tasks;
+        break;
+      }
+
+      // repeated .arangodb.TaskDelta tasks = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_tasks:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_tasks()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(34)) goto parse_tasks;
+        if (input->ExpectTag(40)) goto parse_plan_sizes;
+        break;
+      }
+
+      // repeated uint32 plan_sizes = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_plan_sizes:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 1, 40, input, this->mutable_plan_sizes())));
+        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
+                   == ::google::protobuf::internal::WireFormatLite::
+                      WIRETYPE_LENGTH_DELIMITED) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, this->mutable_plan_sizes())));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(40)) goto parse_plan_sizes;
+        if (input->ExpectTag(48)) goto parse_current_sizes;
+        break;
+      }
+
+      // repeated uint32 current_sizes = 6;
+      case 6: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_current_sizes:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 1, 48, input, this->mutable_current_sizes())));
+        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
+                   == ::google::protobuf::internal::WireFormatLite::
+                      WIRETYPE_LENGTH_DELIMITED) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, this->mutable_current_sizes())));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(48)) goto parse_current_sizes;
+        if (input->ExpectTag(58)) goto parse_restart;
+        break;
+      }
+
+      // optional .arangodb.Restart restart = 7;
+      case 7: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_restart:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_restart()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(64)) goto parse_clear_restart;
+        break;
+      }
+
+      // optional bool clear_restart = 8;
+      case 8: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_clear_restart:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &clear_restart_)));
+          set_has_clear_restart();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(72)) goto parse_cluster_complete;
+        break;
+      }
+
+      // optional bool cluster_complete = 9;
+      case 9: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_cluster_complete:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &cluster_complete_)));
+          set_has_cluster_complete();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(82)) goto parse_failovers;
+        break;
+      }
+
+      // optional .arangodb.Failovers failovers = 10;
+      case 10: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_failovers:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_failovers()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void StateDelta::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required uint64 sequence = 1;
+  if (has_sequence()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->sequence(), output);
+  }
+
+  // optional .mesos.FrameworkID framework_id = 2;
+  if (has_framework_id()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->framework_id(), output);
+  }
+
+  // optional .arangodb.Targets targets = 3;
+  if (has_targets()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->targets(), output);
+  }
+
+  // repeated .arangodb.TaskDelta tasks = 4;
+  for (int i = 0; i < this->tasks_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->tasks(i), output);
+  }
+
+  // repeated uint32 plan_sizes = 5;
+  for (int i = 0; i < this->plan_sizes_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(
+      5, this->plan_sizes(i), output);
+  }
+
+  // repeated uint32 current_sizes = 6;
+  for (int i = 0; i < this->current_sizes_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(
+      6, this->current_sizes(i), output);
+  }
+
+  // optional .arangodb.Restart restart = 7;
+  if (has_restart()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, this->restart(), output);
+  }
+
+  // optional bool clear_restart = 8;
+  if (has_clear_restart()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(8, this->clear_restart(), output);
+  }
+
+  // optional bool cluster_complete = 9;
+  if (has_cluster_complete()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(9, this->cluster_complete(), output);
+  }
+
+  // optional .arangodb.Failovers failovers = 10;
+  if (has_failovers()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      10, this->failovers(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* StateDelta::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required uint64 sequence = 1;
+  if (has_sequence()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->sequence(), target);
+  }
+
+  // optional .mesos.FrameworkID framework_id = 2;
+  if (has_framework_id()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        2, this->framework_id(), target);
+  }
+
+  // optional .arangodb.Targets targets = 3;
+  if (has_targets()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->targets(), target);
+  }
+
+  // repeated .arangodb.TaskDelta tasks = 4;
+  for (int i = 0; i < this->tasks_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        4, this->tasks(i), target);
+  }
+
+  // repeated uint32 plan_sizes = 5;
+  for (int i = 0; i < this->plan_sizes_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt32ToArray(5, this->plan_sizes(i), target);
+  }
+
+  // repeated uint32 current_sizes = 6;
+  for (int i = 0; i < this->current_sizes_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteUInt32ToArray(6, this->current_sizes(i), target);
+  }
+
+  // optional .arangodb.Restart restart = 7;
+  if (has_restart()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        7, this->restart(), target);
+  }
+
+  // optional bool clear_restart = 8;
+  if (has_clear_restart()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(8, this->clear_restart(), target);
+  }
+
+  // optional bool cluster_complete = 9;
+  if (has_cluster_complete()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(9, this->cluster_complete(), target);
+  }
+
+  // optional .arangodb.Failovers failovers = 10;
+  if (has_failovers()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        10, this->failovers(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int StateDelta::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint64 sequence = 1;
+    if (has_sequence()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->sequence());
+    }
+
+    // optional .mesos.FrameworkID framework_id = 2;
+    if (has_framework_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->framework_id());
+    }
+
+    // optional .arangodb.Targets targets = 3;
+    if (has_targets()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->targets());
+    }
+
+    // optional .arangodb.Restart restart = 7;
+    if (has_restart()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->restart());
+    }
+
+    // optional bool clear_restart = 8;
+    if (has_clear_restart()) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional bool cluster_complete = 9;
+    if (has_cluster_complete()) {
+      total_size += 1 + 1;
+    }
+
+    // optional .arangodb.Failovers failovers = 10;
+    if (has_failovers()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->failovers());
+    }
+
+  }
+  // repeated .arangodb.TaskDelta tasks = 4;
+  total_size += 1 * this->tasks_size();
+  for (int i = 0; i < this->tasks_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->tasks(i));
+  }
+
+  // repeated uint32 plan_sizes = 5;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->plan_sizes_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt32Size(this->plan_sizes(i));
+    }
+    total_size += 1 * this->plan_sizes_size() + data_size;
+  }
+
+  // repeated uint32 current_sizes = 6;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->current_sizes_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt32Size(this->current_sizes(i));
+    }
+    total_size += 1 * this->current_sizes_size() + data_size;
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void StateDelta::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const StateDelta* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const StateDelta*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void StateDelta::MergeFrom(const StateDelta& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  tasks_.MergeFrom(from.tasks_);
+  plan_sizes_.MergeFrom(from.plan_sizes_);
+  current_sizes_.MergeFrom(from.current_sizes_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_sequence()) {
+      set_sequence(from.sequence());
+    }
+    if (from.has_framework_id()) {
+      mutable_framework_id()->::mesos::FrameworkID::MergeFrom(from.framework_id());
+    }
+    if (from.has_targets()) {
+      mutable_targets()->::arangodb::Targets::MergeFrom(from.targets());
+    }
+    if (from.has_restart()) {
+      mutable_restart()->::arangodb::Restart::MergeFrom(from.restart());
+    }
+    if (from.has_clear_restart()) {
+      set_clear_restart(from.clear_restart());
+    }
+  }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from.has_cluster_complete()) {
+      set_cluster_complete(from.cluster_complete());
+    }
+    if (from.has_failovers()) {
+      mutable_failovers()->::arangodb::Failovers::MergeFrom(from.failovers());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void StateDelta::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void StateDelta::CopyFrom(const StateDelta& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateDelta::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+
+  if (has_framework_id()) {
+    if (!this->framework_id().IsInitialized()) return false;
+  }
+  if (has_targets()) {
+    if (!this->targets().IsInitialized()) return false;
+  }
+  for (int i = 0; i < tasks_size(); i++) {
+    if (!this->tasks(i).IsInitialized()) return false;
+  }
+  if (has_restart()) {
+    if (!this->restart().IsInitialized()) return false;
+  }
+  if (has_failovers()) {
+    if (!this->failovers().IsInitialized()) return false;
+  }
+  return true;
+}
+
+void StateDelta::Swap(StateDelta* other) {
+  if (other != this) {
+    std::swap(sequence_, other->sequence_);
+    std::swap(framework_id_, other->framework_id_);
+    std::swap(targets_, other->targets_);
+    tasks_.Swap(&other->tasks_);
+    plan_sizes_.Swap(&other->plan_sizes_);
+    current_sizes_.Swap(&other->current_sizes_);
+    std::swap(restart_, other->restart_);
+    std::swap(clear_restart_, other->clear_restart_);
+    std::swap(cluster_complete_, other->cluster_complete_);
+    std::swap(failovers_, other->failovers_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata StateDelta::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = StateDelta_descriptor_;
+  metadata.reflection = StateDelta_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int StateShard::kKeyFieldNumber;
+const int StateShard::kVariableFieldNumber;
+const int StateShard::kCompressedFieldNumber;
+const int StateShard::kSizeFieldNumber;
+#endif  // !_MSC_VER
+
+StateShard::StateShard()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void StateShard::InitAsDefaultInstance() {
+}
+
+StateShard::StateShard(const StateShard& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void StateShard::SharedCtor() {
+  _cached_size_ = 0;
+  key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  variable_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  compressed_ = false;
+  size_ = GOOGLE_ULONGLONG(0);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+StateShard::~StateShard() {
+  SharedDtor();
+}
+
+void StateShard::SharedDtor() {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    delete key_;
+  }
+  if (variable_ != &::google::protobuf::internal::kEmptyString) {
+    delete variable_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void StateShard::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* StateShard::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return StateShard_descriptor_;
+}
+
+const StateShard& StateShard::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_arangodb_2eproto();
+  return *default_instance_;
+}
+
+StateShard* StateShard::default_instance_ = NULL;
+
+StateShard* StateShard::New() const {
+  return new StateShard;
+}
+
+void StateShard::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_key()) {
+      if (key_ != &::google::protobuf::internal::kEmptyString) {
+        key_->clear();
+      }
+    }
+    if (has_variable()) {
+      if (variable_ != &::google::protobuf::internal::kEmptyString) {
+        variable_->clear();
+      }
+    }
+    compressed_ = false;
+    size_ = GOOGLE_ULONGLONG(0);
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool StateShard::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required string key = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_key()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->key().data(), this->key().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_variable;
+        break;
+      }
+
+      // required string variable = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_variable:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_variable()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->variable().data(), this->variable().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_compressed;
+        break;
+      }
+
+      // optional bool compressed = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_compressed:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &compressed_)));
+          set_has_compressed();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(32)) goto parse_size;
+        break;
+      }
+
+      // optional uint64 size = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_size:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &size_)));
+          set_has_size();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void StateShard::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required string key = 1;
+  if (has_key()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->key().data(), this->key().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->key(), output);
+  }
+
+  // required string variable = 2;
+  if (has_variable()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->variable().data(), this->variable().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      2, this->variable(), output);
+  }
+
+  // optional bool compressed = 3;
+  if (has_compressed()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->compressed(), output);
+  }
+
+  // optional uint64 size = 4;
+  if (has_size()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->size(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* StateShard::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required string key = 1;
+  if (has_key()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->key().data(), this->key().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->key(), target);
+  }
+
+  // required string variable = 2;
+  if (has_variable()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->variable().data(), this->variable().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->variable(), target);
+  }
+
+  // optional bool compressed = 3;
+  if (has_compressed()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->compressed(), target);
+  }
+
+  // optional uint64 size = 4;
+  if (has_size()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->size(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int StateShard::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required string key = 1;
+    if (has_key()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->key());
+    }
+
+    // required string variable = 2;
+    if (has_variable()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->variable());
+    }
+
+    // optional bool compressed = 3;
+    if (has_compressed()) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint64 size = 4;
+    if (has_size()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->size());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void StateShard::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const StateShard* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const StateShard*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void StateShard::MergeFrom(const StateShard& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_key()) {
+      set_key(from.key());
+    }
+    if (from.has_variable()) {
+      set_variable(from.variable());
+    }
+    if (from.has_compressed()) {
+      set_compressed(from.compressed());
+    }
+    if (from.has_size()) {
+      set_size(from.size());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void StateShard::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void StateShard::CopyFrom(const StateShard& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateShard::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+
+  return true;
+}
+
+void StateShard::Swap(StateShard* other) {
+  if (other != this) {
+    std::swap(key_, other->key_);
+    std::swap(variable_, other->variable_);
+    std::swap(compressed_, other->compressed_);
+    std::swap(size_, other->size_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata StateShard::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = StateShard_descriptor_;
+  metadata.reflection = StateShard_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int StateManifest::kGenerationFieldNumber;
+const int StateManifest::kFrameworkIdFieldNumber;
+const int StateManifest::kClusterCompleteFieldNumber;
+const int StateManifest::kJournalSequenceFieldNumber;
+const int StateManifest::kShardsFieldNumber;
+const int StateManifest::kSchemaVersionFieldNumber;
+#endif  // !_MSC_VER
+
+StateManifest::StateManifest()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void StateManifest::InitAsDefaultInstance() {
+  framework_id_ = const_cast< ::mesos::FrameworkID*>(&::mesos::FrameworkID::default_instance());
+}
+
+StateManifest::StateManifest(const StateManifest& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void StateManifest::SharedCtor() {
+  _cached_size_ = 0;
+  generation_ = GOOGLE_ULONGLONG(0);
+  framework_id_ = NULL;
+  cluster_complete_ = false;
+  journal_sequence_ = GOOGLE_ULONGLONG(0);
+  schema_version_ = 0u;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-State::~State() {
+StateManifest::~StateManifest() {
   SharedDtor();
 }
 
-void State::SharedDtor() {
+void StateManifest::SharedDtor() {
   if (this != default_instance_) {
     delete framework_id_;
-    delete targets_;
-    delete plan_;
-    delete current_;
-    delete restart_;
   }
 }
 
-void State::SetCachedSize(int size) const {
+void StateManifest::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* State::descriptor() {
+const ::google::protobuf::Descriptor* StateManifest::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return State_descriptor_;
+  return StateManifest_descriptor_;
 }
 
-const State& State::default_instance() {
+const StateManifest& StateManifest::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_arangodb_2eproto();
   return *default_instance_;
 }
 
-State* State::default_instance_ = NULL;
+StateManifest* StateManifest::default_instance_ = NULL;
 
-State* State::New() const {
-  return new State;
+StateManifest* StateManifest::New() const {
+  return new StateManifest;
 }
 
-void State::Clear() {
+void StateManifest::Clear() {
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    generation_ = GOOGLE_ULONGLONG(0);
     if (has_framework_id()) {
       if (framework_id_ != NULL) framework_id_->::mesos::FrameworkID::Clear();
     }
-    if (has_targets()) {
-      if (targets_ != NULL) targets_->::arangodb::Targets::Clear();
-    }
-    if (has_plan()) {
-      if (plan_ != NULL) plan_->::arangodb::Plan::Clear();
-    }
-    if (has_current()) {
-      if (current_ != NULL) current_->::arangodb::Current::Clear();
-    }
-    if (has_restart()) {
-      if (restart_ != NULL) restart_->::arangodb::Restart::Clear();
-    }
+    cluster_complete_ = false;
+    journal_sequence_ = GOOGLE_ULONGLONG(0);
+    schema_version_ = 0u;
   }
+  shards_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool State::MergePartialFromCodedStream(
+bool StateManifest::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) return false
   ::google::protobuf::uint32 tag;
   while ((tag = input->ReadTag()) != 0) {
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional .mesos.FrameworkID framework_id = 1;
+      // required uint64 generation = 1;
       case 1: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_framework_id()));
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &generation_)));
+          set_has_generation();
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(18)) goto parse_targets;
+        if (input->ExpectTag(18)) goto parse_framework_id;
         break;
       }
 
-      // required .arangodb.Targets targets = 2;
+      // optional .mesos.FrameworkID framework_id = 2;
       case 2: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_targets:
+         parse_framework_id:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_targets()));
+               input, mutable_framework_id()));
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(26)) goto parse_plan;
+        if (input->ExpectTag(24)) goto parse_cluster_complete;
         break;
       }
 
-      // required .arangodb.Plan plan = 3;
+      // optional bool cluster_complete = 3;
       case 3: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_plan:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_plan()));
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_cluster_complete:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &cluster_complete_)));
+          set_has_cluster_complete();
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(34)) goto parse_current;
+        if (input->ExpectTag(32)) goto parse_journal_sequence;
         break;
       }
 
-      // required .arangodb.Current current = 4;
+      // optional uint64 journal_sequence = 4;
       case 4: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_current:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_current()));
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_journal_sequence:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &journal_sequence_)));
+          set_has_journal_sequence();
         } else {
           goto handle_uninterpreted;
         }
-        if (input->ExpectTag(42)) goto parse_restart;
+        if (input->ExpectTag(42)) goto parse_shards;
         break;
       }
 
-      // optional .arangodb.Restart restart = 5;
+      // repeated .arangodb.StateShard shards = 5;
       case 5: {
         if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
             ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_restart:
+         parse_shards:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_restart()));
+                input, add_shards()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(42)) goto parse_shards;
+        if (input->ExpectTag(48)) goto parse_schema_version;
+        break;
+      }
+
+      // optional uint32 schema_version = 6;
+      case 6: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_schema_version:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &schema_version_)));
+          set_has_schema_version();
         } else {
           goto handle_uninterpreted;
         }
@@ -4418,36 +7498,38 @@ bool State::MergePartialFromCodedStream(
 #undef DO_
 }
 
-void State::SerializeWithCachedSizes(
+void StateManifest::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional .mesos.FrameworkID framework_id = 1;
+  // required uint64 generation = 1;
+  if (has_generation()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->generation(), output);
+  }
+
+  // optional .mesos.FrameworkID framework_id = 2;
   if (has_framework_id()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->framework_id(), output);
+      2, this->framework_id(), output);
   }
 
-  // required .arangodb.Targets targets = 2;
-  if (has_targets()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->targets(), output);
+  // optional bool cluster_complete = 3;
+  if (has_cluster_complete()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->cluster_complete(), output);
   }
 
-  // required .arangodb.Plan plan = 3;
-  if (has_plan()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->plan(), output);
+  // optional uint64 journal_sequence = 4;
+  if (has_journal_sequence()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(4, this->journal_sequence(), output);
   }
 
-  // required .arangodb.Current current = 4;
-  if (has_current()) {
+  // repeated .arangodb.StateShard shards = 5;
+  for (int i = 0; i < this->shards_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->current(), output);
+      5, this->shards(i), output);
   }
 
-  // optional .arangodb.Restart restart = 5;
-  if (has_restart()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->restart(), output);
+  // optional uint32 schema_version = 6;
+  if (has_schema_version()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(6, this->schema_version(), output);
   }
 
   if (!unknown_fields().empty()) {
@@ -4456,41 +7538,40 @@ void State::SerializeWithCachedSizes(
   }
 }
 
-::google::protobuf::uint8* State::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* StateManifest::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // optional .mesos.FrameworkID framework_id = 1;
+  // required uint64 generation = 1;
+  if (has_generation()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->generation(), target);
+  }
+
+  // optional .mesos.FrameworkID framework_id = 2;
   if (has_framework_id()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        1, this->framework_id(), target);
+        2, this->framework_id(), target);
   }
 
-  // required .arangodb.Targets targets = 2;
-  if (has_targets()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->targets(), target);
+  // optional bool cluster_complete = 3;
+  if (has_cluster_complete()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->cluster_complete(), target);
   }
 
-  // required .arangodb.Plan plan = 3;
-  if (has_plan()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->plan(), target);
+  // optional uint64 journal_sequence = 4;
+  if (has_journal_sequence()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(4, this->journal_sequence(), target);
   }
 
-  // required .arangodb.Current current = 4;
-  if (has_current()) {
+  // repeated .arangodb.StateShard shards = 5;
+  for (int i = 0; i < this->shards_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        4, this->current(), target);
+        5, this->shards(i), target);
   }
 
-  // optional .arangodb.Restart restart = 5;
-  if (has_restart()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->restart(), target);
+  // optional uint32 schema_version = 6;
+  if (has_schema_version()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(6, this->schema_version(), target);
   }
 
   if (!unknown_fields().empty()) {
@@ -4500,46 +7581,52 @@ void State::SerializeWithCachedSizes(
   return target;
 }
 
-int State::ByteSize() const {
+int StateManifest::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional .mesos.FrameworkID framework_id = 1;
-    if (has_framework_id()) {
+    // required uint64 generation = 1;
+    if (has_generation()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->framework_id());
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->generation());
     }
 
-    // required .arangodb.Targets targets = 2;
-    if (has_targets()) {
+    // optional .mesos.FrameworkID framework_id = 2;
+    if (has_framework_id()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->targets());
+          this->framework_id());
     }
 
-    // required .arangodb.Plan plan = 3;
-    if (has_plan()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->plan());
+    // optional bool cluster_complete = 3;
+    if (has_cluster_complete()) {
+      total_size += 1 + 1;
     }
 
-    // required .arangodb.Current current = 4;
-    if (has_current()) {
+    // optional uint64 journal_sequence = 4;
+    if (has_journal_sequence()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->current());
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->journal_sequence());
     }
 
-    // optional .arangodb.Restart restart = 5;
-    if (has_restart()) {
+    // optional uint32 schema_version = 6;
+    if (has_schema_version()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->restart());
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->schema_version());
     }
 
   }
+  // repeated .arangodb.StateShard shards = 5;
+  total_size += 1 * this->shards_size();
+  for (int i = 0; i < this->shards_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->shards(i));
+  }
+
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -4551,10 +7638,10 @@ int State::ByteSize() const {
   return total_size;
 }
 
-void State::MergeFrom(const ::google::protobuf::Message& from) {
+void StateManifest::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const State* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const State*>(
+  const StateManifest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const StateManifest*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -4563,79 +7650,72 @@ void State::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void State::MergeFrom(const State& from) {
+void StateManifest::MergeFrom(const StateManifest& from) {
   GOOGLE_CHECK_NE(&from, this);
+  shards_.MergeFrom(from.shards_);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_generation()) {
+      set_generation(from.generation());
+    }
     if (from.has_framework_id()) {
       mutable_framework_id()->::mesos::FrameworkID::MergeFrom(from.framework_id());
     }
-    if (from.has_targets()) {
-      mutable_targets()->::arangodb::Targets::MergeFrom(from.targets());
-    }
-    if (from.has_plan()) {
-      mutable_plan()->::arangodb::Plan::MergeFrom(from.plan());
+    if (from.has_cluster_complete()) {
+      set_cluster_complete(from.cluster_complete());
     }
-    if (from.has_current()) {
-      mutable_current()->::arangodb::Current::MergeFrom(from.current());
+    if (from.has_journal_sequence()) {
+      set_journal_sequence(from.journal_sequence());
     }
-    if (from.has_restart()) {
-      mutable_restart()->::arangodb::Restart::MergeFrom(from.restart());
+    if (from.has_schema_version()) {
+      set_schema_version(from.schema_version());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void State::CopyFrom(const ::google::protobuf::Message& from) {
+void StateManifest::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void State::CopyFrom(const State& from) {
+void StateManifest::CopyFrom(const StateManifest& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool State::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000000e) != 0x0000000e) return false;
+bool StateManifest::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
 
   if (has_framework_id()) {
     if (!this->framework_id().IsInitialized()) return false;
   }
-  if (has_targets()) {
-    if (!this->targets().IsInitialized()) return false;
-  }
-  if (has_plan()) {
-    if (!this->plan().IsInitialized()) return false;
-  }
-  if (has_current()) {
-    if (!this->current().IsInitialized()) return false;
-  }
-  if (has_restart()) {
-    if (!this->restart().IsInitialized()) return false;
+  for (int i = 0; i < shards_size(); i++) {
+    if (!this->shards(i).IsInitialized()) return false;
   }
   return true;
 }
 
-void State::Swap(State* other) {
+void StateManifest::Swap(StateManifest* other) {
   if (other != this) {
+    std::swap(generation_, other->generation_);
     std::swap(framework_id_, other->framework_id_);
-    std::swap(targets_, other->targets_);
-    std::swap(plan_, other->plan_);
-    std::swap(current_, other->current_);
-    std::swap(restart_, other->restart_);
+    std::swap(cluster_complete_, other->cluster_complete_);
+    std::swap(journal_sequence_, other->journal_sequence_);
+    shards_.Swap(&other->shards_);
+    std::swap(schema_version_, other->schema_version_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata State::GetMetadata() const {
+::google::protobuf::Metadata StateManifest::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = State_descriptor_;
-  metadata.reflection = State_reflection_;
+  metadata.descriptor = StateManifest_descriptor_;
+  metadata.reflection = StateManifest_reflection_;
   return metadata;
 }
 
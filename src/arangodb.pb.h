@@ -46,7 +46,13 @@ class Plan;
 class TaskCurrent;
 class TasksCurrent;
 class Current;
+class Failover;
+class Failovers;
 class State;
+class TaskDelta;
+class StateDelta;
+class StateShard;
+class StateManifest;
 
 enum TaskPlanState {
   TASK_STATE_NEW = 1,
@@ -75,6 +81,26 @@ inline bool TaskPlanState_Parse(
   return ::google::protobuf::internal::ParseNamedEnum<TaskPlanState>(
     TaskPlanState_descriptor(), name, value);
 }
+enum FailoverState {
+  FAILOVER_SWAP_REQUESTED = 1,
+  FAILOVER_AGENCY_ACKNOWLEDGED = 2,
+  FAILOVER_DONE = 3
+};
+bool FailoverState_IsValid(int value);
+const FailoverState FailoverState_MIN = FAILOVER_SWAP_REQUESTED;
+const FailoverState FailoverState_MAX = FAILOVER_DONE;
+const int FailoverState_ARRAYSIZE = FailoverState_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* FailoverState_descriptor();
+inline const ::std::string& FailoverState_Name(FailoverState value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    FailoverState_descriptor(), value);
+}
+inline bool FailoverState_Parse(
+    const ::std::string& name, FailoverState* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<FailoverState>(
+    FailoverState_descriptor(), name, value);
+}
 // ===================================================================
 
 class Restart : public ::google::protobuf::Message {
@@ -150,18 +176,53 @@ class Restart : public ::google::protobuf::Message {
   inline double timestamp() const;
   inline void set_timestamp(double value);
 
+  // optional string id = 3;
+  inline bool has_id() const;
+  inline void clear_id();
+  static const int kIdFieldNumber = 3;
+  inline const ::std::string& id() const;
+  inline void set_id(const ::std::string& value);
+  inline void set_id(const char* value);
+  inline void set_id(const char* value, size_t size);
+  inline ::std::string* mutable_id();
+  inline ::std::string* release_id();
+  inline void set_allocated_id(::std::string* id);
+
+  // optional uint32 parallelism = 4;
+  inline bool has_parallelism() const;
+  inline void clear_parallelism();
+  static const int kParallelismFieldNumber = 4;
+  inline ::google::protobuf::uint32 parallelism() const;
+  inline void set_parallelism(::google::protobuf::uint32 value);
+
+  // optional uint32 total_buckets = 5;
+  inline bool has_total_buckets() const;
+  inline void clear_total_buckets();
+  static const int kTotalBucketsFieldNumber = 5;
+  inline ::google::protobuf::uint32 total_buckets() const;
+  inline void set_total_buckets(::google::protobuf::uint32 value);
+
   // @@protoc_insertion_point(class_scope:arangodb.Restart)
  private:
   inline void set_has_timestamp();
   inline void clear_has_timestamp();
+  inline void set_has_id();
+  inline void clear_has_id();
+  inline void set_has_parallelism();
+  inline void clear_has_parallelism();
+  inline void set_has_total_buckets();
+  inline void clear_has_total_buckets();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::google::protobuf::RepeatedPtrField< ::arangodb::RestartBucket > buckets_;
   double timestamp_;
+  ::std::string* id_;
+  ::google::protobuf::uint32 parallelism_;
+  ::google::protobuf::uint32 total_buckets_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
 
   friend void  protobuf_AddDesc_arangodb_2eproto();
   friend void protobuf_AssignDesc_arangodb_2eproto();
@@ -330,20 +391,30 @@ class RestartTaskInfo : public ::google::protobuf::Message {
   inline ::std::string* release_task_name();
   inline void set_allocated_task_name(::std::string* task_name);
 
+  // optional bool restarted = 3;
+  inline bool has_restarted() const;
+  inline void clear_restarted();
+  static const int kRestartedFieldNumber = 3;
+  inline bool restarted() const;
+  inline void set_restarted(bool value);
+
   // @@protoc_insertion_point(class_scope:arangodb.RestartTaskInfo)
  private:
   inline void set_has_task_type();
   inline void clear_has_task_type();
   inline void set_has_task_name();
   inline void clear_has_task_name();
+  inline void set_has_restarted();
+  inline void clear_has_restarted();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::std::string* task_name_;
   ::google::protobuf::uint32 task_type_;
+  bool restarted_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
 
   friend void  protobuf_AddDesc_arangodb_2eproto();
   friend void protobuf_AssignDesc_arangodb_2eproto();
@@ -733,6 +804,13 @@ class TaskPlan : public ::google::protobuf::Message {
   inline ::std::string* release_server_id();
   inline void set_allocated_server_id(::std::string* server_id);
 
+  // optional bool stepwise = 7;
+  inline bool has_stepwise() const;
+  inline void clear_stepwise();
+  static const int kStepwiseFieldNumber = 7;
+  inline bool stepwise() const;
+  inline void set_stepwise(bool value);
+
   // @@protoc_insertion_point(class_scope:arangodb.TaskPlan)
  private:
   inline void set_has_state();
@@ -747,18 +825,21 @@ class TaskPlan : public ::google::protobuf::Message {
   inline void clear_has_sync_partner();
   inline void set_has_server_id();
   inline void clear_has_server_id();
+  inline void set_has_stepwise();
+  inline void clear_has_stepwise();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::std::string* persistence_id_;
   double timestamp_;
   ::std::string* name_;
+  int state_;
+  bool stepwise_;
   ::std::string* sync_partner_;
   ::std::string* server_id_;
-  int state_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(7 + 31) / 32];
 
   friend void  protobuf_AddDesc_arangodb_2eproto();
   friend void protobuf_AssignDesc_arangodb_2eproto();
@@ -1117,6 +1198,37 @@ class TaskCurrent : public ::google::protobuf::Message {
   inline double kill_time() const;
   inline void set_kill_time(double value);
 
+  // optional string task_id = 10;
+  inline bool has_task_id() const;
+  inline void clear_task_id();
+  static const int kTaskIdFieldNumber = 10;
+  inline const ::std::string& task_id() const;
+  inline void set_task_id(const ::std::string& value);
+  inline void set_task_id(const char* value);
+  inline void set_task_id(const char* value, size_t size);
+  inline ::std::string* mutable_task_id();
+  inline ::std::string* release_task_id();
+  inline void set_allocated_task_id(::std::string* task_id);
+
+  // optional string launch_hash = 11;
+  inline bool has_launch_hash() const;
+  inline void clear_launch_hash();
+  static const int kLaunchHashFieldNumber = 11;
+  inline const ::std::string& launch_hash() const;
+  inline void set_launch_hash(const ::std::string& value);
+  inline void set_launch_hash(const char* value);
+  inline void set_launch_hash(const char* value, size_t size);
+  inline ::std::string* mutable_launch_hash();
+  inline ::std::string* release_launch_hash();
+  inline void set_allocated_launch_hash(::std::string* launch_hash);
+
+  // optional bool single_offer = 12;
+  inline bool has_single_offer() const;
+  inline void clear_single_offer();
+  static const int kSingleOfferFieldNumber = 12;
+  inline bool single_offer() const;
+  inline void set_single_offer(bool value);
+
   // @@protoc_insertion_point(class_scope:arangodb.TaskCurrent)
  private:
   inline void set_has_slave_id();
@@ -1133,6 +1245,12 @@ class TaskCurrent : public ::google::protobuf::Message {
   inline void clear_has_start_time();
   inline void set_has_kill_time();
   inline void clear_has_kill_time();
+  inline void set_has_task_id();
+  inline void clear_has_task_id();
+  inline void set_has_launch_hash();
+  inline void clear_has_launch_hash();
+  inline void set_has_single_offer();
+  inline void clear_has_single_offer();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -1145,9 +1263,12 @@ class TaskCurrent : public ::google::protobuf::Message {
   ::mesos::TaskInfo* task_info_;
   double start_time_;
   double kill_time_;
+  ::std::string* task_id_;
+  ::std::string* launch_hash_;
+  bool single_offer_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(9 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(12 + 31) / 32];
 
   friend void  protobuf_AddDesc_arangodb_2eproto();
   friend void protobuf_AssignDesc_arangodb_2eproto();
@@ -1373,6 +1494,223 @@ class Current : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
+class Failover : public ::google::protobuf::Message {
+ public:
+  Failover();
+  virtual ~Failover();
+
+  Failover(const Failover& from);
+
+  inline Failover& operator=(const Failover& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const Failover& default_instance();
+
+  void Swap(Failover* other);
+
+  // implements Message ----------------------------------------------
+
+  Failover* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const Failover& from);
+  void MergeFrom(const Failover& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required string primary = 1;
+  inline bool has_primary() const;
+  inline void clear_primary();
+  static const int kPrimaryFieldNumber = 1;
+  inline const ::std::string& primary() const;
+  inline void set_primary(const ::std::string& value);
+  inline void set_primary(const char* value);
+  inline void set_primary(const char* value, size_t size);
+  inline ::std::string* mutable_primary();
+  inline ::std::string* release_primary();
+  inline void set_allocated_primary(::std::string* primary);
+
+  // required string secondary = 2;
+  inline bool has_secondary() const;
+  inline void clear_secondary();
+  static const int kSecondaryFieldNumber = 2;
+  inline const ::std::string& secondary() const;
+  inline void set_secondary(const ::std::string& value);
+  inline void set_secondary(const char* value);
+  inline void set_secondary(const char* value, size_t size);
+  inline ::std::string* mutable_secondary();
+  inline ::std::string* release_secondary();
+  inline void set_allocated_secondary(::std::string* secondary);
+
+  // required .arangodb.FailoverState state = 3 [default = FAILOVER_SWAP_REQUESTED];
+  inline bool has_state() const;
+  inline void clear_state();
+  static const int kStateFieldNumber = 3;
+  inline ::arangodb::FailoverState state() const;
+  inline void set_state(::arangodb::FailoverState value);
+
+  // optional double timestamp = 4;
+  inline bool has_timestamp() const;
+  inline void clear_timestamp();
+  static const int kTimestampFieldNumber = 4;
+  inline double timestamp() const;
+  inline void set_timestamp(double value);
+
+  // optional uint32 attempts = 5;
+  inline bool has_attempts() const;
+  inline void clear_attempts();
+  static const int kAttemptsFieldNumber = 5;
+  inline ::google::protobuf::uint32 attempts() const;
+  inline void set_attempts(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:arangodb.Failover)
+ private:
+  inline void set_has_primary();
+  inline void clear_has_primary();
+  inline void set_has_secondary();
+  inline void clear_has_secondary();
+  inline void set_has_state();
+  inline void clear_has_state();
+  inline void set_has_timestamp();
+  inline void clear_has_timestamp();
+  inline void set_has_attempts();
+  inline void clear_has_attempts();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::std::string* primary_;
+  ::std::string* secondary_;
+  double timestamp_;
+  int state_;
+  ::google::protobuf::uint32 attempts_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
+
+  friend void  protobuf_AddDesc_arangodb_2eproto();
+  friend void protobuf_AssignDesc_arangodb_2eproto();
+  friend void protobuf_ShutdownFile_arangodb_2eproto();
+
+  void InitAsDefaultInstance();
+  static Failover* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class Failovers : public ::google::protobuf::Message {
+ public:
+  Failovers();
+  virtual ~Failovers();
+
+  Failovers(const Failovers& from);
+
+  inline Failovers& operator=(const Failovers& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const Failovers& default_instance();
+
+  void Swap(Failovers* other);
+
+  // implements Message ----------------------------------------------
+
+  Failovers* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const Failovers& from);
+  void MergeFrom(const Failovers& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .arangodb.Failover entries = 1;
+  inline int entries_size() const;
+  inline void clear_entries();
+  static const int kEntriesFieldNumber = 1;
+  inline const ::arangodb::Failover& entries(int index) const;
+  inline ::arangodb::Failover* mutable_entries(int index);
+  inline ::arangodb::Failover* add_entries();
+  inline const ::google::protobuf::RepeatedPtrField< ::arangodb::Failover >&
+      entries() const;
+  inline ::google::protobuf::RepeatedPtrField< ::arangodb::Failover >*
+      mutable_entries();
+
+  // @@protoc_insertion_point(class_scope:arangodb.Failovers)
+ private:
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::RepeatedPtrField< ::arangodb::Failover > entries_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+
+  friend void  protobuf_AddDesc_arangodb_2eproto();
+  friend void protobuf_AssignDesc_arangodb_2eproto();
+  friend void protobuf_ShutdownFile_arangodb_2eproto();
+
+  void InitAsDefaultInstance();
+  static Failovers* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class State : public ::google::protobuf::Message {
  public:
   State();
@@ -1472,6 +1810,29 @@ class State : public ::google::protobuf::Message {
   inline ::arangodb::Restart* release_restart();
   inline void set_allocated_restart(::arangodb::Restart* restart);
 
+  // optional uint64 journal_sequence = 6;
+  inline bool has_journal_sequence() const;
+  inline void clear_journal_sequence();
+  static const int kJournalSequenceFieldNumber = 6;
+  inline ::google::protobuf::uint64 journal_sequence() const;
+  inline void set_journal_sequence(::google::protobuf::uint64 value);
+
+  // optional uint32 schema_version = 7;
+  inline bool has_schema_version() const;
+  inline void clear_schema_version();
+  static const int kSchemaVersionFieldNumber = 7;
+  inline ::google::protobuf::uint32 schema_version() const;
+  inline void set_schema_version(::google::protobuf::uint32 value);
+
+  // optional .arangodb.Failovers failovers = 8;
+  inline bool has_failovers() const;
+  inline void clear_failovers();
+  static const int kFailoversFieldNumber = 8;
+  inline const ::arangodb::Failovers& failovers() const;
+  inline ::arangodb::Failovers* mutable_failovers();
+  inline ::arangodb::Failovers* release_failovers();
+  inline void set_allocated_failovers(::arangodb::Failovers* failovers);
+
   // @@protoc_insertion_point(class_scope:arangodb.State)
  private:
   inline void set_has_framework_id();
@@ -1484,6 +1845,12 @@ class State : public ::google::protobuf::Message {
   inline void clear_has_current();
   inline void set_has_restart();
   inline void clear_has_restart();
+  inline void set_has_journal_sequence();
+  inline void clear_has_journal_sequence();
+  inline void set_has_schema_version();
+  inline void clear_has_schema_version();
+  inline void set_has_failovers();
+  inline void clear_has_failovers();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
@@ -1492,9 +1859,12 @@ class State : public ::google::protobuf::Message {
   ::arangodb::Plan* plan_;
   ::arangodb::Current* current_;
   ::arangodb::Restart* restart_;
+  ::google::protobuf::uint64 journal_sequence_;
+  ::arangodb::Failovers* failovers_;
+  ::google::protobuf::uint32 schema_version_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(8 + 31) / 32];
 
   friend void  protobuf_AddDesc_arangodb_2eproto();
   friend void protobuf_AssignDesc_arangodb_2eproto();
@@ -1503,1637 +1873,3668 @@ class State : public ::google::protobuf::Message {
   void InitAsDefaultInstance();
   static State* default_instance_;
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class TaskDelta : public ::google::protobuf::Message {
+ public:
+  TaskDelta();
+  virtual ~TaskDelta();
 
-// Restart
+  TaskDelta(const TaskDelta& from);
 
-// repeated .arangodb.RestartBucket buckets = 1;
-inline int Restart::buckets_size() const {
-  return buckets_.size();
-}
-inline void Restart::clear_buckets() {
-  buckets_.Clear();
-}
-inline const ::arangodb::RestartBucket& Restart::buckets(int index) const {
-  return buckets_.Get(index);
-}
-inline ::arangodb::RestartBucket* Restart::mutable_buckets(int index) {
-  return buckets_.Mutable(index);
-}
-inline ::arangodb::RestartBucket* Restart::add_buckets() {
-  return buckets_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::arangodb::RestartBucket >&
-Restart::buckets() const {
-  return buckets_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::arangodb::RestartBucket >*
-Restart::mutable_buckets() {
-  return &buckets_;
-}
+  inline TaskDelta& operator=(const TaskDelta& from) {
+    CopyFrom(from);
+    return *this;
+  }
 
-// required double timestamp = 2;
-inline bool Restart::has_timestamp() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void Restart::set_has_timestamp() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Restart::clear_has_timestamp() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void Restart::clear_timestamp() {
-  timestamp_ = 0;
-  clear_has_timestamp();
-}
-inline double Restart::timestamp() const {
-  return timestamp_;
-}
-inline void Restart::set_timestamp(double value) {
-  set_has_timestamp();
-  timestamp_ = value;
-}
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
 
-// -------------------------------------------------------------------
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
 
-// RestartBucket
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const TaskDelta& default_instance();
 
-// repeated .arangodb.RestartTaskInfo restart_tasks = 1;
-inline int RestartBucket::restart_tasks_size() const {
-  return restart_tasks_.size();
-}
-inline void RestartBucket::clear_restart_tasks() {
-  restart_tasks_.Clear();
-}
-inline const ::arangodb::RestartTaskInfo& RestartBucket::restart_tasks(int index) const {
-  return restart_tasks_.Get(index);
-}
-inline ::arangodb::RestartTaskInfo* RestartBucket::mutable_restart_tasks(int index) {
-  return restart_tasks_.Mutable(index);
-}
-inline ::arangodb::RestartTaskInfo* RestartBucket::add_restart_tasks() {
-  return restart_tasks_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::arangodb::RestartTaskInfo >&
-RestartBucket::restart_tasks() const {
-  return restart_tasks_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::arangodb::RestartTaskInfo >*
-RestartBucket::mutable_restart_tasks() {
-  return &restart_tasks_;
-}
+  void Swap(TaskDelta* other);
 
-// -------------------------------------------------------------------
+  // implements Message ----------------------------------------------
 
-// RestartTaskInfo
+  TaskDelta* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const TaskDelta& from);
+  void MergeFrom(const TaskDelta& from);
+  void Clear();
+  bool IsInitialized() const;
 
-// required uint32 task_type = 1;
-inline bool RestartTaskInfo::has_task_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void RestartTaskInfo::set_has_task_type() {
-  _has_bits_[0] |= 0x00000001u;
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required uint32 task_type = 1;
+  inline bool has_task_type() const;
+  inline void clear_task_type();
+  static const int kTaskTypeFieldNumber = 1;
+  inline ::google::protobuf::uint32 task_type() const;
+  inline void set_task_type(::google::protobuf::uint32 value);
+
+  // required uint32 position = 2;
+  inline bool has_position() const;
+  inline void clear_position();
+  static const int kPositionFieldNumber = 2;
+  inline ::google::protobuf::uint32 position() const;
+  inline void set_position(::google::protobuf::uint32 value);
+
+  // optional .arangodb.TaskPlan plan = 3;
+  inline bool has_plan() const;
+  inline void clear_plan();
+  static const int kPlanFieldNumber = 3;
+  inline const ::arangodb::TaskPlan& plan() const;
+  inline ::arangodb::TaskPlan* mutable_plan();
+  inline ::arangodb::TaskPlan* release_plan();
+  inline void set_allocated_plan(::arangodb::TaskPlan* plan);
+
+  // optional .arangodb.TaskCurrent current = 4;
+  inline bool has_current() const;
+  inline void clear_current();
+  static const int kCurrentFieldNumber = 4;
+  inline const ::arangodb::TaskCurrent& current() const;
+  inline ::arangodb::TaskCurrent* mutable_current();
+  inline ::arangodb::TaskCurrent* release_current();
+  inline void set_allocated_current(::arangodb::TaskCurrent* current);
+
+  // @@protoc_insertion_point(class_scope:arangodb.TaskDelta)
+ private:
+  inline void set_has_task_type();
+  inline void clear_has_task_type();
+  inline void set_has_position();
+  inline void clear_has_position();
+  inline void set_has_plan();
+  inline void clear_has_plan();
+  inline void set_has_current();
+  inline void clear_has_current();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 task_type_;
+  ::google::protobuf::uint32 position_;
+  ::arangodb::TaskPlan* plan_;
+  ::arangodb::TaskCurrent* current_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+
+  friend void  protobuf_AddDesc_arangodb_2eproto();
+  friend void protobuf_AssignDesc_arangodb_2eproto();
+  friend void protobuf_ShutdownFile_arangodb_2eproto();
+
+  void InitAsDefaultInstance();
+  static TaskDelta* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class StateDelta : public ::google::protobuf::Message {
+ public:
+  StateDelta();
+  virtual ~StateDelta();
+
+  StateDelta(const StateDelta& from);
+
+  inline StateDelta& operator=(const StateDelta& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const StateDelta& default_instance();
+
+  void Swap(StateDelta* other);
+
+  // implements Message ----------------------------------------------
+
+  StateDelta* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const StateDelta& from);
+  void MergeFrom(const StateDelta& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required uint64 sequence = 1;
+  inline bool has_sequence() const;
+  inline void clear_sequence();
+  static const int kSequenceFieldNumber = 1;
+  inline ::google::protobuf::uint64 sequence() const;
+  inline void set_sequence(::google::protobuf::uint64 value);
+
+  // optional .mesos.FrameworkID framework_id = 2;
+  inline bool has_framework_id() const;
+  inline void clear_framework_id();
+  static const int kFrameworkIdFieldNumber = 2;
+  inline const ::mesos::FrameworkID& framework_id() const;
+  inline ::mesos::FrameworkID* mutable_framework_id();
+  inline ::mesos::FrameworkID* release_framework_id();
+  inline void set_allocated_framework_id(::mesos::FrameworkID* framework_id);
+
+  // optional .arangodb.Targets targets = 3;
+  inline bool has_targets() const;
+  inline void clear_targets();
+  static const int kTargetsFieldNumber = 3;
+  inline const ::arangodb::Targets& targets() const;
+  inline ::arangodb::Targets* mutable_targets();
+  inline ::arangodb::Targets* release_targets();
+  inline void set_allocated_targets(::arangodb::Targets* targets);
+
+  // repeated .arangodb.TaskDelta tasks = 4;
+  inline int tasks_size() const;
+  inline void clear_tasks();
+  static const int kTasksFieldNumber = 4;
+  inline const ::arangodb::TaskDelta& tasks(int index) const;
+  inline ::arangodb::TaskDelta* mutable_tasks(int index);
+  inline ::arangodb::TaskDelta* add_tasks();
+  inline const ::google::protobuf::RepeatedPtrField< ::arangodb::TaskDelta >&
+      tasks() const;
+  inline ::google::protobuf::RepeatedPtrField< ::arangodb::TaskDelta >*
+      mutable_tasks();
+
+  // repeated uint32 plan_sizes = 5;
+  inline int plan_sizes_size() const;
+  inline void clear_plan_sizes();
+  static const int kPlanSizesFieldNumber = 5;
+  inline ::google::protobuf::uint32 plan_sizes(int index) const;
+  inline void set_plan_sizes(int index, ::google::protobuf::uint32 value);
+  inline void add_plan_sizes(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      plan_sizes() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_plan_sizes();
+
+  // repeated uint32 current_sizes = 6;
+  inline int current_sizes_size() const;
+  inline void clear_current_sizes();
+  static const int kCurrentSizesFieldNumber = 6;
+  inline ::google::protobuf::uint32 current_sizes(int index) const;
+  inline void set_current_sizes(int index, ::google::protobuf::uint32 value);
+  inline void add_current_sizes(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      current_sizes() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_current_sizes();
+
+  // optional .arangodb.Restart restart = 7;
+  inline bool has_restart() const;
+  inline void clear_restart();
+  static const int kRestartFieldNumber = 7;
+  inline const ::arangodb::Restart& restart() const;
+  inline ::arangodb::Restart* mutable_restart();
+  inline ::arangodb::Restart* release_restart();
+  inline void set_allocated_restart(::arangodb::Restart* restart);
+
+  // optional bool clear_restart = 8;
+  inline bool has_clear_restart() const;
+  inline void clear_clear_restart();
+  static const int kClearRestartFieldNumber = 8;
+  inline bool clear_restart() const;
+  inline void set_clear_restart(bool value);
+
+  // optional bool cluster_complete = 9;
+  inline bool has_cluster_complete() const;
+  inline void clear_cluster_complete();
+  static const int kClusterCompleteFieldNumber = 9;
+  inline bool cluster_complete() const;
+  inline void set_cluster_complete(bool value);
+
+  // optional .arangodb.Failovers failovers = 10;
+  inline bool has_failovers() const;
+  inline void clear_failovers();
+  static const int kFailoversFieldNumber = 10;
+  inline const ::arangodb::Failovers& failovers() const;
+  inline ::arangodb::Failovers* mutable_failovers();
+  inline ::arangodb::Failovers* release_failovers();
+  inline void set_allocated_failovers(::arangodb::Failovers* failovers);
+
+  // @@protoc_insertion_point(class_scope:arangodb.StateDelta)
+ private:
+  inline void set_has_sequence();
+  inline void clear_has_sequence();
+  inline void set_has_framework_id();
+  inline void clear_has_framework_id();
+  inline void set_has_targets();
+  inline void clear_has_targets();
+  inline void set_has_restart();
+  inline void clear_has_restart();
+  inline void set_has_clear_restart();
+  inline void clear_has_clear_restart();
+  inline void set_has_cluster_complete();
+  inline void clear_has_cluster_complete();
+  inline void set_has_failovers();
+  inline void clear_has_failovers();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint64 sequence_;
+  ::mesos::FrameworkID* framework_id_;
+  ::arangodb::Targets* targets_;
+  ::google::protobuf::RepeatedPtrField< ::arangodb::TaskDelta > tasks_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > plan_sizes_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > current_sizes_;
+  ::arangodb::Restart* restart_;
+  ::arangodb::Failovers* failovers_;
+  bool clear_restart_;
+  bool cluster_complete_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(10 + 31) / 32];
+
+  friend void  protobuf_AddDesc_arangodb_2eproto();
+  friend void protobuf_AssignDesc_arangodb_2eproto();
+  friend void protobuf_ShutdownFile_arangodb_2eproto();
+
+  void InitAsDefaultInstance();
+  static StateDelta* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class StateShard : public ::google::protobuf::Message {
+ public:
+  StateShard();
+  virtual ~StateShard();
+
+  StateShard(const StateShard& from);
+
+  inline StateShard& operator=(const StateShard& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const StateShard& default_instance();
+
+  void Swap(StateShard* other);
+
+  // implements Message ----------------------------------------------
+
+  StateShard* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const StateShard& from);
+  void MergeFrom(const StateShard& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required string key = 1;
+  inline bool has_key() const;
+  inline void clear_key();
+  static const int kKeyFieldNumber = 1;
+  inline const ::std::string& key() const;
+  inline void set_key(const ::std::string& value);
+  inline void set_key(const char* value);
+  inline void set_key(const char* value, size_t size);
+  inline ::std::string* mutable_key();
+  inline ::std::string* release_key();
+  inline void set_allocated_key(::std::string* key);
+
+  // required string variable = 2;
+  inline bool has_variable() const;
+  inline void clear_variable();
+  static const int kVariableFieldNumber = 2;
+  inline const ::std::string& variable() const;
+  inline void set_variable(const ::std::string& value);
+  inline void set_variable(const char* value);
+  inline void set_variable(const char* value, size_t size);
+  inline ::std::string* mutable_variable();
+  inline ::std::string* release_variable();
+  inline void set_allocated_variable(::std::string* variable);
+
+  // optional bool compressed = 3;
+  inline bool has_compressed() const;
+  inline void clear_compressed();
+  static const int kCompressedFieldNumber = 3;
+  inline bool compressed() const;
+  inline void set_compressed(bool value);
+
+  // optional uint64 size = 4;
+  inline bool has_size() const;
+  inline void clear_size();
+  static const int kSizeFieldNumber = 4;
+  inline ::google::protobuf::uint64 size() const;
+  inline void set_size(::google::protobuf::uint64 value);
+
+  // @@protoc_insertion_point(class_scope:arangodb.StateShard)
+ private:
+  inline void set_has_key();
+  inline void clear_has_key();
+  inline void set_has_variable();
+  inline void clear_has_variable();
+  inline void set_has_compressed();
+  inline void clear_has_compressed();
+  inline void set_has_size();
+  inline void clear_has_size();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::std::string* key_;
+  ::std::string* variable_;
+  ::google::protobuf::uint64 size_;
+  bool compressed_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+
+  friend void  protobuf_AddDesc_arangodb_2eproto();
+  friend void protobuf_AssignDesc_arangodb_2eproto();
+  friend void protobuf_ShutdownFile_arangodb_2eproto();
+
+  void InitAsDefaultInstance();
+  static StateShard* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class StateManifest : public ::google::protobuf::Message {
+ public:
+  StateManifest();
+  virtual ~StateManifest();
+
+  StateManifest(const StateManifest& from);
+
+  inline StateManifest& operator=(const StateManifest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const StateManifest& default_instance();
+
+  void Swap(StateManifest* other);
+
+  // implements Message ----------------------------------------------
+
+  StateManifest* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const StateManifest& from);
+  void MergeFrom(const StateManifest& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required uint64 generation = 1;
+  inline bool has_generation() const;
+  inline void clear_generation();
+  static const int kGenerationFieldNumber = 1;
+  inline ::google::protobuf::uint64 generation() const;
+  inline void set_generation(::google::protobuf::uint64 value);
+
+  // optional .mesos.FrameworkID framework_id = 2;
+  inline bool has_framework_id() const;
+  inline void clear_framework_id();
+  static const int kFrameworkIdFieldNumber = 2;
+  inline const ::mesos::FrameworkID& framework_id() const;
+  inline ::mesos::FrameworkID* mutable_framework_id();
+  inline ::mesos::FrameworkID* release_framework_id();
+  inline void set_allocated_framework_id(::mesos::FrameworkID* framework_id);
+
+  // optional bool cluster_complete = 3;
+  inline bool has_cluster_complete() const;
+  inline void clear_cluster_complete();
+  static const int kClusterCompleteFieldNumber = 3;
+  inline bool cluster_complete() const;
+  inline void set_cluster_complete(bool value);
+
+  // optional uint64 journal_sequence = 4;
+  inline bool has_journal_sequence() const;
+  inline void clear_journal_sequence();
+  static const int kJournalSequenceFieldNumber = 4;
+  inline ::google::protobuf::uint64 journal_sequence() const;
+  inline void set_journal_sequence(::google::protobuf::uint64 value);
+
+  // repeated .arangodb.StateShard shards = 5;
+  inline int shards_size() const;
+  inline void clear_shards();
+  static const int kShardsFieldNumber = 5;
+  inline const ::arangodb::StateShard& shards(int index) const;
+  inline ::arangodb::StateShard* mutable_shards(int index);
+  inline ::arangodb::StateShard* add_shards();
+  inline const ::google::protobuf::RepeatedPtrField< ::arangodb::StateShard >&
+      shards() const;
+  inline ::google::protobuf::RepeatedPtrField< ::arangodb::StateShard >*
+      mutable_shards();
+
+  // optional uint32 schema_version = 6;
+  inline bool has_schema_version() const;
+  inline void clear_schema_version();
+  static const int kSchemaVersionFieldNumber = 6;
+  inline ::google::protobuf::uint32 schema_version() const;
+  inline void set_schema_version(::google::protobuf::uint32 value);
+
+  // @@protoc_insertion_point(class_scope:arangodb.StateManifest)
+ private:
+  inline void set_has_generation();
+  inline void clear_has_generation();
+  inline void set_has_framework_id();
+  inline void clear_has_framework_id();
+  inline void set_has_cluster_complete();
+  inline void clear_has_cluster_complete();
+  inline void set_has_journal_sequence();
+  inline void clear_has_journal_sequence();
+  inline void set_has_schema_version();
+  inline void clear_has_schema_version();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint64 generation_;
+  ::mesos::FrameworkID* framework_id_;
+  ::google::protobuf::uint64 journal_sequence_;
+  bool cluster_complete_;
+  ::google::protobuf::uint32 schema_version_;
+  ::google::protobuf::RepeatedPtrField< ::arangodb::StateShard > shards_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
+
+  friend void  protobuf_AddDesc_arangodb_2eproto();
+  friend void protobuf_AssignDesc_arangodb_2eproto();
+  friend void protobuf_ShutdownFile_arangodb_2eproto();
+
+  void InitAsDefaultInstance();
+  static StateManifest* default_instance_;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+// Restart
+
+// repeated .arangodb.RestartBucket buckets = 1;
+inline int Restart::buckets_size() const {
+  return buckets_.size();
+}
+inline void Restart::clear_buckets() {
+  buckets_.Clear();
+}
+inline const ::arangodb::RestartBucket& Restart::buckets(int index) const {
+  return buckets_.Get(index);
+}
+inline ::arangodb::RestartBucket* Restart::mutable_buckets(int index) {
+  return buckets_.Mutable(index);
+}
+inline ::arangodb::RestartBucket* Restart::add_buckets() {
+  return buckets_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::arangodb::RestartBucket >&
+Restart::buckets() const {
+  return buckets_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::arangodb::RestartBucket >*
+Restart::mutable_buckets() {
+  return &buckets_;
+}
+
+// required double timestamp = 2;
+inline bool Restart::has_timestamp() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Restart::set_has_timestamp() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void Restart::clear_has_timestamp() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void Restart::clear_timestamp() {
+  timestamp_ = 0;
+  clear_has_timestamp();
+}
+inline double Restart::timestamp() const {
+  return timestamp_;
+}
+inline void Restart::set_timestamp(double value) {
+  set_has_timestamp();
+  timestamp_ = value;
+}
+
+// optional string id = 3;
+inline bool Restart::has_id() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Restart::set_has_id() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void Restart::clear_has_id() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void Restart::clear_id() {
+  if (id_ != &::google::protobuf::internal::kEmptyString) {
+    id_->clear();
+  }
+  clear_has_id();
+}
+inline const ::std::string& Restart::id() const {
+  return *id_;
+}
+inline void Restart::set_id(const ::std::string& value) {
+  set_has_id();
+  if (id_ == &::google::protobuf::internal::kEmptyString) {
+    id_ = new ::std::string;
+  }
+  id_->assign(value);
+}
+inline void Restart::set_id(const char* value) {
+  set_has_id();
+  if (id_ == &::google::protobuf::internal::kEmptyString) {
+    id_ = new ::std::string;
+  }
+  id_->assign(value);
+}
+inline void Restart::set_id(const char* value, size_t size) {
+  set_has_id();
+  if (id_ == &::google::protobuf::internal::kEmptyString) {
+    id_ = new ::std::string;
+  }
+  id_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* Restart::mutable_id() {
+  set_has_id();
+  if (id_ == &::google::protobuf::internal::kEmptyString) {
+    id_ = new ::std::string;
+  }
+  return id_;
+}
+inline ::std::string* Restart::release_id() {
+  clear_has_id();
+  if (id_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = id_;
+    id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void Restart::set_allocated_id(::std::string* id) {
+  if (id_ != &::google::protobuf::internal::kEmptyString) {
+    delete id_;
+  }
+  if (id) {
+    set_has_id();
+    id_ = id;
+  } else {
+    clear_has_id();
+    id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional uint32 parallelism = 4;
+inline bool Restart::has_parallelism() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void Restart::set_has_parallelism() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void Restart::clear_has_parallelism() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void Restart::clear_parallelism() {
+  parallelism_ = 0u;
+  clear_has_parallelism();
+}
+inline ::google::protobuf::uint32 Restart::parallelism() const {
+  return parallelism_;
+}
+inline void Restart::set_parallelism(::google::protobuf::uint32 value) {
+  set_has_parallelism();
+  parallelism_ = value;
+}
+
+// optional uint32 total_buckets = 5;
+inline bool Restart::has_total_buckets() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void Restart::set_has_total_buckets() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void Restart::clear_has_total_buckets() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void Restart::clear_total_buckets() {
+  total_buckets_ = 0u;
+  clear_has_total_buckets();
+}
+inline ::google::protobuf::uint32 Restart::total_buckets() const {
+  return total_buckets_;
+}
+inline void Restart::set_total_buckets(::google::protobuf::uint32 value) {
+  set_has_total_buckets();
+  total_buckets_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// RestartBucket
+
+// repeated .arangodb.RestartTaskInfo restart_tasks = 1;
+inline int RestartBucket::restart_tasks_size() const {
+  return restart_tasks_.size();
+}
+inline void RestartBucket::clear_restart_tasks() {
+  restart_tasks_.Clear();
+}
+inline const ::arangodb::RestartTaskInfo& RestartBucket::restart_tasks(int index) const {
+  return restart_tasks_.Get(index);
+}
+inline ::arangodb::RestartTaskInfo* RestartBucket::mutable_restart_tasks(int index) {
+  return restart_tasks_.Mutable(index);
+}
+inline ::arangodb::RestartTaskInfo* RestartBucket::add_restart_tasks() {
+  return restart_tasks_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::arangodb::RestartTaskInfo >&
+RestartBucket::restart_tasks() const {
+  return restart_tasks_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::arangodb::RestartTaskInfo >*
+RestartBucket::mutable_restart_tasks() {
+  return &restart_tasks_;
+}
+
+// -------------------------------------------------------------------
+
+// RestartTaskInfo
+
+// required uint32 task_type = 1;
+inline bool RestartTaskInfo::has_task_type() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void RestartTaskInfo::set_has_task_type() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void RestartTaskInfo::clear_has_task_type() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void RestartTaskInfo::clear_task_type() {
+  task_type_ = 0u;
+  clear_has_task_type();
+}
+inline ::google::protobuf::uint32 RestartTaskInfo::task_type() const {
+  return task_type_;
+}
+inline void RestartTaskInfo::set_task_type(::google::protobuf::uint32 value) {
+  set_has_task_type();
+  task_type_ = value;
+}
+
+// required string task_name = 2;
+inline bool RestartTaskInfo::has_task_name() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void RestartTaskInfo::set_has_task_name() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void RestartTaskInfo::clear_has_task_name() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void RestartTaskInfo::clear_task_name() {
+  if (task_name_ != &::google::protobuf::internal::kEmptyString) {
+    task_name_->clear();
+  }
+  clear_has_task_name();
+}
+inline const ::std::string& RestartTaskInfo::task_name() const {
+  return *task_name_;
+}
+inline void RestartTaskInfo::set_task_name(const ::std::string& value) {
+  set_has_task_name();
+  if (task_name_ == &::google::protobuf::internal::kEmptyString) {
+    task_name_ = new ::std::string;
+  }
+  task_name_->assign(value);
+}
+inline void RestartTaskInfo::set_task_name(const char* value) {
+  set_has_task_name();
+  if (task_name_ == &::google::protobuf::internal::kEmptyString) {
+    task_name_ = new ::std::string;
+  }
+  task_name_->assign(value);
+}
+inline void RestartTaskInfo::set_task_name(const char* value, size_t size) {
+  set_has_task_name();
+  if (task_name_ == &::google::protobuf::internal::kEmptyString) {
+    task_name_ = new ::std::string;
+  }
+  task_name_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* RestartTaskInfo::mutable_task_name() {
+  set_has_task_name();
+  if (task_name_ == &::google::protobuf::internal::kEmptyString) {
+    task_name_ = new ::std::string;
+  }
+  return task_name_;
+}
+inline ::std::string* RestartTaskInfo::release_task_name() {
+  clear_has_task_name();
+  if (task_name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = task_name_;
+    task_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void RestartTaskInfo::set_allocated_task_name(::std::string* task_name) {
+  if (task_name_ != &::google::protobuf::internal::kEmptyString) {
+    delete task_name_;
+  }
+  if (task_name) {
+    set_has_task_name();
+    task_name_ = task_name;
+  } else {
+    clear_has_task_name();
+    task_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional bool restarted = 3;
+inline bool RestartTaskInfo::has_restarted() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void RestartTaskInfo::set_has_restarted() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void RestartTaskInfo::clear_has_restarted() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void RestartTaskInfo::clear_restarted() {
+  restarted_ = false;
+  clear_has_restarted();
+}
+inline bool RestartTaskInfo::restarted() const {
+  return restarted_;
+}
+inline void RestartTaskInfo::set_restarted(bool value) {
+  set_has_restarted();
+  restarted_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// Target
+
+// required uint32 instances = 1;
+inline bool Target::has_instances() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Target::set_has_instances() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Target::clear_has_instances() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Target::clear_instances() {
+  instances_ = 0u;
+  clear_has_instances();
+}
+inline ::google::protobuf::uint32 Target::instances() const {
+  return instances_;
+}
+inline void Target::set_instances(::google::protobuf::uint32 value) {
+  set_has_instances();
+  instances_ = value;
+}
+
+// repeated .mesos.Resource minimal_resources = 2;
+inline int Target::minimal_resources_size() const {
+  return minimal_resources_.size();
+}
+inline void Target::clear_minimal_resources() {
+  minimal_resources_.Clear();
+}
+inline const ::mesos::Resource& Target::minimal_resources(int index) const {
+  return minimal_resources_.Get(index);
+}
+inline ::mesos::Resource* Target::mutable_minimal_resources(int index) {
+  return minimal_resources_.Mutable(index);
+}
+inline ::mesos::Resource* Target::add_minimal_resources() {
+  return minimal_resources_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::mesos::Resource >&
+Target::minimal_resources() const {
+  return minimal_resources_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::mesos::Resource >*
+Target::mutable_minimal_resources() {
+  return &minimal_resources_;
+}
+
+// repeated .mesos.Resource additional_resources = 3;
+inline int Target::additional_resources_size() const {
+  return additional_resources_.size();
+}
+inline void Target::clear_additional_resources() {
+  additional_resources_.Clear();
+}
+inline const ::mesos::Resource& Target::additional_resources(int index) const {
+  return additional_resources_.Get(index);
+}
+inline ::mesos::Resource* Target::mutable_additional_resources(int index) {
+  return additional_resources_.Mutable(index);
+}
+inline ::mesos::Resource* Target::add_additional_resources() {
+  return additional_resources_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::mesos::Resource >&
+Target::additional_resources() const {
+  return additional_resources_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::mesos::Resource >*
+Target::mutable_additional_resources() {
+  return &additional_resources_;
+}
+
+// required uint32 number_ports = 4;
+inline bool Target::has_number_ports() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void Target::set_has_number_ports() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void Target::clear_has_number_ports() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void Target::clear_number_ports() {
+  number_ports_ = 0u;
+  clear_has_number_ports();
+}
+inline ::google::protobuf::uint32 Target::number_ports() const {
+  return number_ports_;
+}
+inline void Target::set_number_ports(::google::protobuf::uint32 value) {
+  set_has_number_ports();
+  number_ports_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// Targets
+
+// required string mode = 1;
+inline bool Targets::has_mode() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Targets::set_has_mode() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Targets::clear_has_mode() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Targets::clear_mode() {
+  if (mode_ != &::google::protobuf::internal::kEmptyString) {
+    mode_->clear();
+  }
+  clear_has_mode();
+}
+inline const ::std::string& Targets::mode() const {
+  return *mode_;
+}
+inline void Targets::set_mode(const ::std::string& value) {
+  set_has_mode();
+  if (mode_ == &::google::protobuf::internal::kEmptyString) {
+    mode_ = new ::std::string;
+  }
+  mode_->assign(value);
+}
+inline void Targets::set_mode(const char* value) {
+  set_has_mode();
+  if (mode_ == &::google::protobuf::internal::kEmptyString) {
+    mode_ = new ::std::string;
+  }
+  mode_->assign(value);
+}
+inline void Targets::set_mode(const char* value, size_t size) {
+  set_has_mode();
+  if (mode_ == &::google::protobuf::internal::kEmptyString) {
+    mode_ = new ::std::string;
+  }
+  mode_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* Targets::mutable_mode() {
+  set_has_mode();
+  if (mode_ == &::google::protobuf::internal::kEmptyString) {
+    mode_ = new ::std::string;
+  }
+  return mode_;
+}
+inline ::std::string* Targets::release_mode() {
+  clear_has_mode();
+  if (mode_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = mode_;
+    mode_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void Targets::set_allocated_mode(::std::string* mode) {
+  if (mode_ != &::google::protobuf::internal::kEmptyString) {
+    delete mode_;
+  }
+  if (mode) {
+    set_has_mode();
+    mode_ = mode;
+  } else {
+    clear_has_mode();
+    mode_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// required .arangodb.Target agents = 2;
+inline bool Targets::has_agents() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Targets::set_has_agents() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void Targets::clear_has_agents() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void Targets::clear_agents() {
+  if (agents_ != NULL) agents_->::arangodb::Target::Clear();
+  clear_has_agents();
+}
+inline const ::arangodb::Target& Targets::agents() const {
+  return agents_ != NULL ? *agents_ : *default_instance_->agents_;
+}
+inline ::arangodb::Target* Targets::mutable_agents() {
+  set_has_agents();
+  if (agents_ == NULL) agents_ = new ::arangodb::Target;
+  return agents_;
+}
+inline ::arangodb::Target* Targets::release_agents() {
+  clear_has_agents();
+  ::arangodb::Target* temp = agents_;
+  agents_ = NULL;
+  return temp;
+}
+inline void Targets::set_allocated_agents(::arangodb::Target* agents) {
+  delete agents_;
+  agents_ = agents;
+  if (agents) {
+    set_has_agents();
+  } else {
+    clear_has_agents();
+  }
+}
+
+// required .arangodb.Target coordinators = 3;
+inline bool Targets::has_coordinators() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Targets::set_has_coordinators() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void Targets::clear_has_coordinators() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void Targets::clear_coordinators() {
+  if (coordinators_ != NULL) coordinators_->::arangodb::Target::Clear();
+  clear_has_coordinators();
+}
+inline const ::arangodb::Target& Targets::coordinators() const {
+  return coordinators_ != NULL ? *coordinators_ : *default_instance_->coordinators_;
+}
+inline ::arangodb::Target* Targets::mutable_coordinators() {
+  set_has_coordinators();
+  if (coordinators_ == NULL) coordinators_ = new ::arangodb::Target;
+  return coordinators_;
+}
+inline ::arangodb::Target* Targets::release_coordinators() {
+  clear_has_coordinators();
+  ::arangodb::Target* temp = coordinators_;
+  coordinators_ = NULL;
+  return temp;
+}
+inline void Targets::set_allocated_coordinators(::arangodb::Target* coordinators) {
+  delete coordinators_;
+  coordinators_ = coordinators;
+  if (coordinators) {
+    set_has_coordinators();
+  } else {
+    clear_has_coordinators();
+  }
+}
+
+// required .arangodb.Target dbservers = 4;
+inline bool Targets::has_dbservers() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void Targets::set_has_dbservers() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void Targets::clear_has_dbservers() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void Targets::clear_dbservers() {
+  if (dbservers_ != NULL) dbservers_->::arangodb::Target::Clear();
+  clear_has_dbservers();
+}
+inline const ::arangodb::Target& Targets::dbservers() const {
+  return dbservers_ != NULL ? *dbservers_ : *default_instance_->dbservers_;
+}
+inline ::arangodb::Target* Targets::mutable_dbservers() {
+  set_has_dbservers();
+  if (dbservers_ == NULL) dbservers_ = new ::arangodb::Target;
+  return dbservers_;
+}
+inline ::arangodb::Target* Targets::release_dbservers() {
+  clear_has_dbservers();
+  ::arangodb::Target* temp = dbservers_;
+  dbservers_ = NULL;
+  return temp;
+}
+inline void Targets::set_allocated_dbservers(::arangodb::Target* dbservers) {
+  delete dbservers_;
+  dbservers_ = dbservers;
+  if (dbservers) {
+    set_has_dbservers();
+  } else {
+    clear_has_dbservers();
+  }
+}
+
+// required .arangodb.Target secondaries = 5;
+inline bool Targets::has_secondaries() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void Targets::set_has_secondaries() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void Targets::clear_has_secondaries() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void Targets::clear_secondaries() {
+  if (secondaries_ != NULL) secondaries_->::arangodb::Target::Clear();
+  clear_has_secondaries();
+}
+inline const ::arangodb::Target& Targets::secondaries() const {
+  return secondaries_ != NULL ? *secondaries_ : *default_instance_->secondaries_;
+}
+inline ::arangodb::Target* Targets::mutable_secondaries() {
+  set_has_secondaries();
+  if (secondaries_ == NULL) secondaries_ = new ::arangodb::Target;
+  return secondaries_;
+}
+inline ::arangodb::Target* Targets::release_secondaries() {
+  clear_has_secondaries();
+  ::arangodb::Target* temp = secondaries_;
+  secondaries_ = NULL;
+  return temp;
+}
+inline void Targets::set_allocated_secondaries(::arangodb::Target* secondaries) {
+  delete secondaries_;
+  secondaries_ = secondaries;
+  if (secondaries) {
+    set_has_secondaries();
+  } else {
+    clear_has_secondaries();
+  }
+}
+
+// optional bool asynchronous_replication = 6;
+inline bool Targets::has_asynchronous_replication() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void Targets::set_has_asynchronous_replication() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void Targets::clear_has_asynchronous_replication() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void Targets::clear_asynchronous_replication() {
+  asynchronous_replication_ = false;
+  clear_has_asynchronous_replication();
+}
+inline bool Targets::asynchronous_replication() const {
+  return asynchronous_replication_;
+}
+inline void Targets::set_asynchronous_replication(bool value) {
+  set_has_asynchronous_replication();
+  asynchronous_replication_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TaskPlan
+
+// required .arangodb.TaskPlanState state = 1 [default = TASK_STATE_NEW];
+inline bool TaskPlan::has_state() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TaskPlan::set_has_state() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void TaskPlan::clear_has_state() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void TaskPlan::clear_state() {
+  state_ = 1;
+  clear_has_state();
+}
+inline ::arangodb::TaskPlanState TaskPlan::state() const {
+  return static_cast< ::arangodb::TaskPlanState >(state_);
+}
+inline void TaskPlan::set_state(::arangodb::TaskPlanState value) {
+  assert(::arangodb::TaskPlanState_IsValid(value));
+  set_has_state();
+  state_ = value;
+}
+
+// optional string persistence_id = 2;
+inline bool TaskPlan::has_persistence_id() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TaskPlan::set_has_persistence_id() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void TaskPlan::clear_has_persistence_id() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void TaskPlan::clear_persistence_id() {
+  if (persistence_id_ != &::google::protobuf::internal::kEmptyString) {
+    persistence_id_->clear();
+  }
+  clear_has_persistence_id();
+}
+inline const ::std::string& TaskPlan::persistence_id() const {
+  return *persistence_id_;
+}
+inline void TaskPlan::set_persistence_id(const ::std::string& value) {
+  set_has_persistence_id();
+  if (persistence_id_ == &::google::protobuf::internal::kEmptyString) {
+    persistence_id_ = new ::std::string;
+  }
+  persistence_id_->assign(value);
+}
+inline void TaskPlan::set_persistence_id(const char* value) {
+  set_has_persistence_id();
+  if (persistence_id_ == &::google::protobuf::internal::kEmptyString) {
+    persistence_id_ = new ::std::string;
+  }
+  persistence_id_->assign(value);
+}
+inline void TaskPlan::set_persistence_id(const char* value, size_t size) {
+  set_has_persistence_id();
+  if (persistence_id_ == &::google::protobuf::internal::kEmptyString) {
+    persistence_id_ = new ::std::string;
+  }
+  persistence_id_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TaskPlan::mutable_persistence_id() {
+  set_has_persistence_id();
+  if (persistence_id_ == &::google::protobuf::internal::kEmptyString) {
+    persistence_id_ = new ::std::string;
+  }
+  return persistence_id_;
+}
+inline ::std::string* TaskPlan::release_persistence_id() {
+  clear_has_persistence_id();
+  if (persistence_id_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = persistence_id_;
+    persistence_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void TaskPlan::set_allocated_persistence_id(::std::string* persistence_id) {
+  if (persistence_id_ != &::google::protobuf::internal::kEmptyString) {
+    delete persistence_id_;
+  }
+  if (persistence_id) {
+    set_has_persistence_id();
+    persistence_id_ = persistence_id;
+  } else {
+    clear_has_persistence_id();
+    persistence_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional double timestamp = 3;
+inline bool TaskPlan::has_timestamp() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void TaskPlan::set_has_timestamp() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void TaskPlan::clear_has_timestamp() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void TaskPlan::clear_timestamp() {
+  timestamp_ = 0;
+  clear_has_timestamp();
+}
+inline double TaskPlan::timestamp() const {
+  return timestamp_;
+}
+inline void TaskPlan::set_timestamp(double value) {
+  set_has_timestamp();
+  timestamp_ = value;
+}
+
+// required string name = 4;
+inline bool TaskPlan::has_name() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void TaskPlan::set_has_name() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void TaskPlan::clear_has_name() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void TaskPlan::clear_name() {
+  if (name_ != &::google::protobuf::internal::kEmptyString) {
+    name_->clear();
+  }
+  clear_has_name();
+}
+inline const ::std::string& TaskPlan::name() const {
+  return *name_;
+}
+inline void TaskPlan::set_name(const ::std::string& value) {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    name_ = new ::std::string;
+  }
+  name_->assign(value);
+}
+inline void TaskPlan::set_name(const char* value) {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    name_ = new ::std::string;
+  }
+  name_->assign(value);
+}
+inline void TaskPlan::set_name(const char* value, size_t size) {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    name_ = new ::std::string;
+  }
+  name_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TaskPlan::mutable_name() {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    name_ = new ::std::string;
+  }
+  return name_;
+}
+inline ::std::string* TaskPlan::release_name() {
+  clear_has_name();
+  if (name_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = name_;
+    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void TaskPlan::set_allocated_name(::std::string* name) {
+  if (name_ != &::google::protobuf::internal::kEmptyString) {
+    delete name_;
+  }
+  if (name) {
+    set_has_name();
+    name_ = name;
+  } else {
+    clear_has_name();
+    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional string sync_partner = 5;
+inline bool TaskPlan::has_sync_partner() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void TaskPlan::set_has_sync_partner() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void TaskPlan::clear_has_sync_partner() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void TaskPlan::clear_sync_partner() {
+  if (sync_partner_ != &::google::protobuf::internal::kEmptyString) {
+    sync_partner_->clear();
+  }
+  clear_has_sync_partner();
+}
+inline const ::std::string& TaskPlan::sync_partner() const {
+  return *sync_partner_;
+}
+inline void TaskPlan::set_sync_partner(const ::std::string& value) {
+  set_has_sync_partner();
+  if (sync_partner_ == &::google::protobuf::internal::kEmptyString) {
+    sync_partner_ = new ::std::string;
+  }
+  sync_partner_->assign(value);
+}
+inline void TaskPlan::set_sync_partner(const char* value) {
+  set_has_sync_partner();
+  if (sync_partner_ == &::google::protobuf::internal::kEmptyString) {
+    sync_partner_ = new ::std::string;
+  }
+  sync_partner_->assign(value);
+}
+inline void TaskPlan::set_sync_partner(const char* value, size_t size) {
+  set_has_sync_partner();
+  if (sync_partner_ == &::google::protobuf::internal::kEmptyString) {
+    sync_partner_ = new ::std::string;
+  }
+  sync_partner_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TaskPlan::mutable_sync_partner() {
+  set_has_sync_partner();
+  if (sync_partner_ == &::google::protobuf::internal::kEmptyString) {
+    sync_partner_ = new ::std::string;
+  }
+  return sync_partner_;
+}
+inline ::std::string* TaskPlan::release_sync_partner() {
+  clear_has_sync_partner();
+  if (sync_partner_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = sync_partner_;
+    sync_partner_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void TaskPlan::set_allocated_sync_partner(::std::string* sync_partner) {
+  if (sync_partner_ != &::google::protobuf::internal::kEmptyString) {
+    delete sync_partner_;
+  }
+  if (sync_partner) {
+    set_has_sync_partner();
+    sync_partner_ = sync_partner;
+  } else {
+    clear_has_sync_partner();
+    sync_partner_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional string server_id = 6;
+inline bool TaskPlan::has_server_id() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void TaskPlan::set_has_server_id() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void TaskPlan::clear_has_server_id() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void TaskPlan::clear_server_id() {
+  if (server_id_ != &::google::protobuf::internal::kEmptyString) {
+    server_id_->clear();
+  }
+  clear_has_server_id();
+}
+inline const ::std::string& TaskPlan::server_id() const {
+  return *server_id_;
+}
+inline void TaskPlan::set_server_id(const ::std::string& value) {
+  set_has_server_id();
+  if (server_id_ == &::google::protobuf::internal::kEmptyString) {
+    server_id_ = new ::std::string;
+  }
+  server_id_->assign(value);
+}
+inline void TaskPlan::set_server_id(const char* value) {
+  set_has_server_id();
+  if (server_id_ == &::google::protobuf::internal::kEmptyString) {
+    server_id_ = new ::std::string;
+  }
+  server_id_->assign(value);
+}
+inline void TaskPlan::set_server_id(const char* value, size_t size) {
+  set_has_server_id();
+  if (server_id_ == &::google::protobuf::internal::kEmptyString) {
+    server_id_ = new ::std::string;
+  }
+  server_id_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TaskPlan::mutable_server_id() {
+  set_has_server_id();
+  if (server_id_ == &::google::protobuf::internal::kEmptyString) {
+    server_id_ = new ::std::string;
+  }
+  return server_id_;
+}
+inline ::std::string* TaskPlan::release_server_id() {
+  clear_has_server_id();
+  if (server_id_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = server_id_;
+    server_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void TaskPlan::set_allocated_server_id(::std::string* server_id) {
+  if (server_id_ != &::google::protobuf::internal::kEmptyString) {
+    delete server_id_;
+  }
+  if (server_id) {
+    set_has_server_id();
+    server_id_ = server_id;
+  } else {
+    clear_has_server_id();
+    server_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional bool stepwise = 7;
+inline bool TaskPlan::has_stepwise() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void TaskPlan::set_has_stepwise() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void TaskPlan::clear_has_stepwise() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void TaskPlan::clear_stepwise() {
+  stepwise_ = false;
+  clear_has_stepwise();
+}
+inline bool TaskPlan::stepwise() const {
+  return stepwise_;
+}
+inline void TaskPlan::set_stepwise(bool value) {
+  set_has_stepwise();
+  stepwise_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// TasksPlan
+
+// repeated .arangodb.TaskPlan entries = 1;
+inline int TasksPlan::entries_size() const {
+  return entries_.size();
+}
+inline void TasksPlan::clear_entries() {
+  entries_.Clear();
+}
+inline const ::arangodb::TaskPlan& TasksPlan::entries(int index) const {
+  return entries_.Get(index);
+}
+inline ::arangodb::TaskPlan* TasksPlan::mutable_entries(int index) {
+  return entries_.Mutable(index);
+}
+inline ::arangodb::TaskPlan* TasksPlan::add_entries() {
+  return entries_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::arangodb::TaskPlan >&
+TasksPlan::entries() const {
+  return entries_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::arangodb::TaskPlan >*
+TasksPlan::mutable_entries() {
+  return &entries_;
+}
+
+// -------------------------------------------------------------------
+
+// Plan
+
+// required .arangodb.TasksPlan agents = 1;
+inline bool Plan::has_agents() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Plan::set_has_agents() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Plan::clear_has_agents() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Plan::clear_agents() {
+  if (agents_ != NULL) agents_->::arangodb::TasksPlan::Clear();
+  clear_has_agents();
+}
+inline const ::arangodb::TasksPlan& Plan::agents() const {
+  return agents_ != NULL ? *agents_ : *default_instance_->agents_;
+}
+inline ::arangodb::TasksPlan* Plan::mutable_agents() {
+  set_has_agents();
+  if (agents_ == NULL) agents_ = new ::arangodb::TasksPlan;
+  return agents_;
+}
+inline ::arangodb::TasksPlan* Plan::release_agents() {
+  clear_has_agents();
+  ::arangodb::TasksPlan* temp = agents_;
+  agents_ = NULL;
+  return temp;
+}
+inline void Plan::set_allocated_agents(::arangodb::TasksPlan* agents) {
+  delete agents_;
+  agents_ = agents;
+  if (agents) {
+    set_has_agents();
+  } else {
+    clear_has_agents();
+  }
+}
+
+// required .arangodb.TasksPlan coordinators = 2;
+inline bool Plan::has_coordinators() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Plan::set_has_coordinators() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void Plan::clear_has_coordinators() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void Plan::clear_coordinators() {
+  if (coordinators_ != NULL) coordinators_->::arangodb::TasksPlan::Clear();
+  clear_has_coordinators();
+}
+inline const ::arangodb::TasksPlan& Plan::coordinators() const {
+  return coordinators_ != NULL ? *coordinators_ : *default_instance_->coordinators_;
+}
+inline ::arangodb::TasksPlan* Plan::mutable_coordinators() {
+  set_has_coordinators();
+  if (coordinators_ == NULL) coordinators_ = new ::arangodb::TasksPlan;
+  return coordinators_;
+}
+inline ::arangodb::TasksPlan* Plan::release_coordinators() {
+  clear_has_coordinators();
+  ::arangodb::TasksPlan* temp = coordinators_;
+  coordinators_ = NULL;
+  return temp;
+}
+inline void Plan::set_allocated_coordinators(::arangodb::TasksPlan* coordinators) {
+  delete coordinators_;
+  coordinators_ = coordinators;
+  if (coordinators) {
+    set_has_coordinators();
+  } else {
+    clear_has_coordinators();
+  }
+}
+
+// required .arangodb.TasksPlan dbservers = 3;
+inline bool Plan::has_dbservers() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Plan::set_has_dbservers() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void Plan::clear_has_dbservers() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void Plan::clear_dbservers() {
+  if (dbservers_ != NULL) dbservers_->::arangodb::TasksPlan::Clear();
+  clear_has_dbservers();
+}
+inline const ::arangodb::TasksPlan& Plan::dbservers() const {
+  return dbservers_ != NULL ? *dbservers_ : *default_instance_->dbservers_;
+}
+inline ::arangodb::TasksPlan* Plan::mutable_dbservers() {
+  set_has_dbservers();
+  if (dbservers_ == NULL) dbservers_ = new ::arangodb::TasksPlan;
+  return dbservers_;
+}
+inline ::arangodb::TasksPlan* Plan::release_dbservers() {
+  clear_has_dbservers();
+  ::arangodb::TasksPlan* temp = dbservers_;
+  dbservers_ = NULL;
+  return temp;
+}
+inline void Plan::set_allocated_dbservers(::arangodb::TasksPlan* dbservers) {
+  delete dbservers_;
+  dbservers_ = dbservers;
+  if (dbservers) {
+    set_has_dbservers();
+  } else {
+    clear_has_dbservers();
+  }
+}
+
+// required .arangodb.TasksPlan secondaries = 4;
+inline bool Plan::has_secondaries() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void Plan::set_has_secondaries() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void Plan::clear_has_secondaries() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void Plan::clear_secondaries() {
+  if (secondaries_ != NULL) secondaries_->::arangodb::TasksPlan::Clear();
+  clear_has_secondaries();
+}
+inline const ::arangodb::TasksPlan& Plan::secondaries() const {
+  return secondaries_ != NULL ? *secondaries_ : *default_instance_->secondaries_;
+}
+inline ::arangodb::TasksPlan* Plan::mutable_secondaries() {
+  set_has_secondaries();
+  if (secondaries_ == NULL) secondaries_ = new ::arangodb::TasksPlan;
+  return secondaries_;
+}
+inline ::arangodb::TasksPlan* Plan::release_secondaries() {
+  clear_has_secondaries();
+  ::arangodb::TasksPlan* temp = secondaries_;
+  secondaries_ = NULL;
+  return temp;
+}
+inline void Plan::set_allocated_secondaries(::arangodb::TasksPlan* secondaries) {
+  delete secondaries_;
+  secondaries_ = secondaries;
+  if (secondaries) {
+    set_has_secondaries();
+  } else {
+    clear_has_secondaries();
+  }
+}
+
+// -------------------------------------------------------------------
+
+// TaskCurrent
+
+// optional .mesos.SlaveID slave_id = 1;
+inline bool TaskCurrent::has_slave_id() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TaskCurrent::set_has_slave_id() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void TaskCurrent::clear_has_slave_id() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void TaskCurrent::clear_slave_id() {
+  if (slave_id_ != NULL) slave_id_->::mesos::SlaveID::Clear();
+  clear_has_slave_id();
+}
+inline const ::mesos::SlaveID& TaskCurrent::slave_id() const {
+  return slave_id_ != NULL ? *slave_id_ : *default_instance_->slave_id_;
+}
+inline ::mesos::SlaveID* TaskCurrent::mutable_slave_id() {
+  set_has_slave_id();
+  if (slave_id_ == NULL) slave_id_ = new ::mesos::SlaveID;
+  return slave_id_;
+}
+inline ::mesos::SlaveID* TaskCurrent::release_slave_id() {
+  clear_has_slave_id();
+  ::mesos::SlaveID* temp = slave_id_;
+  slave_id_ = NULL;
+  return temp;
+}
+inline void TaskCurrent::set_allocated_slave_id(::mesos::SlaveID* slave_id) {
+  delete slave_id_;
+  slave_id_ = slave_id;
+  if (slave_id) {
+    set_has_slave_id();
+  } else {
+    clear_has_slave_id();
+  }
+}
+
+// optional .mesos.OfferID offer_id = 2;
+inline bool TaskCurrent::has_offer_id() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TaskCurrent::set_has_offer_id() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void TaskCurrent::clear_has_offer_id() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void TaskCurrent::clear_offer_id() {
+  if (offer_id_ != NULL) offer_id_->::mesos::OfferID::Clear();
+  clear_has_offer_id();
+}
+inline const ::mesos::OfferID& TaskCurrent::offer_id() const {
+  return offer_id_ != NULL ? *offer_id_ : *default_instance_->offer_id_;
+}
+inline ::mesos::OfferID* TaskCurrent::mutable_offer_id() {
+  set_has_offer_id();
+  if (offer_id_ == NULL) offer_id_ = new ::mesos::OfferID;
+  return offer_id_;
+}
+inline ::mesos::OfferID* TaskCurrent::release_offer_id() {
+  clear_has_offer_id();
+  ::mesos::OfferID* temp = offer_id_;
+  offer_id_ = NULL;
+  return temp;
+}
+inline void TaskCurrent::set_allocated_offer_id(::mesos::OfferID* offer_id) {
+  delete offer_id_;
+  offer_id_ = offer_id;
+  if (offer_id) {
+    set_has_offer_id();
+  } else {
+    clear_has_offer_id();
+  }
+}
+
+// repeated .mesos.Resource resources = 3;
+inline int TaskCurrent::resources_size() const {
+  return resources_.size();
+}
+inline void TaskCurrent::clear_resources() {
+  resources_.Clear();
+}
+inline const ::mesos::Resource& TaskCurrent::resources(int index) const {
+  return resources_.Get(index);
+}
+inline ::mesos::Resource* TaskCurrent::mutable_resources(int index) {
+  return resources_.Mutable(index);
+}
+inline ::mesos::Resource* TaskCurrent::add_resources() {
+  return resources_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::mesos::Resource >&
+TaskCurrent::resources() const {
+  return resources_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::mesos::Resource >*
+TaskCurrent::mutable_resources() {
+  return &resources_;
+}
+
+// repeated uint32 ports = 4;
+inline int TaskCurrent::ports_size() const {
+  return ports_.size();
+}
+inline void TaskCurrent::clear_ports() {
+  ports_.Clear();
+}
+inline ::google::protobuf::uint32 TaskCurrent::ports(int index) const {
+  return ports_.Get(index);
+}
+inline void TaskCurrent::set_ports(int index, ::google::protobuf::uint32 value) {
+  ports_.Set(index, value);
+}
+inline void TaskCurrent::add_ports(::google::protobuf::uint32 value) {
+  ports_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TaskCurrent::ports() const {
+  return ports_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TaskCurrent::mutable_ports() {
+  return &ports_;
+}
+
+// optional string hostname = 5;
+inline bool TaskCurrent::has_hostname() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void TaskCurrent::set_has_hostname() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void TaskCurrent::clear_has_hostname() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void TaskCurrent::clear_hostname() {
+  if (hostname_ != &::google::protobuf::internal::kEmptyString) {
+    hostname_->clear();
+  }
+  clear_has_hostname();
+}
+inline const ::std::string& TaskCurrent::hostname() const {
+  return *hostname_;
+}
+inline void TaskCurrent::set_hostname(const ::std::string& value) {
+  set_has_hostname();
+  if (hostname_ == &::google::protobuf::internal::kEmptyString) {
+    hostname_ = new ::std::string;
+  }
+  hostname_->assign(value);
+}
+inline void TaskCurrent::set_hostname(const char* value) {
+  set_has_hostname();
+  if (hostname_ == &::google::protobuf::internal::kEmptyString) {
+    hostname_ = new ::std::string;
+  }
+  hostname_->assign(value);
+}
+inline void TaskCurrent::set_hostname(const char* value, size_t size) {
+  set_has_hostname();
+  if (hostname_ == &::google::protobuf::internal::kEmptyString) {
+    hostname_ = new ::std::string;
+  }
+  hostname_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TaskCurrent::mutable_hostname() {
+  set_has_hostname();
+  if (hostname_ == &::google::protobuf::internal::kEmptyString) {
+    hostname_ = new ::std::string;
+  }
+  return hostname_;
+}
+inline ::std::string* TaskCurrent::release_hostname() {
+  clear_has_hostname();
+  if (hostname_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = hostname_;
+    hostname_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void TaskCurrent::set_allocated_hostname(::std::string* hostname) {
+  if (hostname_ != &::google::protobuf::internal::kEmptyString) {
+    delete hostname_;
+  }
+  if (hostname) {
+    set_has_hostname();
+    hostname_ = hostname;
+  } else {
+    clear_has_hostname();
+    hostname_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional string container_path = 6;
+inline bool TaskCurrent::has_container_path() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void TaskCurrent::set_has_container_path() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void TaskCurrent::clear_has_container_path() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void TaskCurrent::clear_container_path() {
+  if (container_path_ != &::google::protobuf::internal::kEmptyString) {
+    container_path_->clear();
+  }
+  clear_has_container_path();
+}
+inline const ::std::string& TaskCurrent::container_path() const {
+  return *container_path_;
+}
+inline void TaskCurrent::set_container_path(const ::std::string& value) {
+  set_has_container_path();
+  if (container_path_ == &::google::protobuf::internal::kEmptyString) {
+    container_path_ = new ::std::string;
+  }
+  container_path_->assign(value);
+}
+inline void TaskCurrent::set_container_path(const char* value) {
+  set_has_container_path();
+  if (container_path_ == &::google::protobuf::internal::kEmptyString) {
+    container_path_ = new ::std::string;
+  }
+  container_path_->assign(value);
+}
+inline void TaskCurrent::set_container_path(const char* value, size_t size) {
+  set_has_container_path();
+  if (container_path_ == &::google::protobuf::internal::kEmptyString) {
+    container_path_ = new ::std::string;
+  }
+  container_path_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TaskCurrent::mutable_container_path() {
+  set_has_container_path();
+  if (container_path_ == &::google::protobuf::internal::kEmptyString) {
+    container_path_ = new ::std::string;
+  }
+  return container_path_;
+}
+inline ::std::string* TaskCurrent::release_container_path() {
+  clear_has_container_path();
+  if (container_path_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = container_path_;
+    container_path_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void TaskCurrent::set_allocated_container_path(::std::string* container_path) {
+  if (container_path_ != &::google::protobuf::internal::kEmptyString) {
+    delete container_path_;
+  }
+  if (container_path) {
+    set_has_container_path();
+    container_path_ = container_path;
+  } else {
+    clear_has_container_path();
+    container_path_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional .mesos.TaskInfo task_info = 7;
+inline bool TaskCurrent::has_task_info() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void TaskCurrent::set_has_task_info() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void TaskCurrent::clear_has_task_info() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void TaskCurrent::clear_task_info() {
+  if (task_info_ != NULL) task_info_->::mesos::TaskInfo::Clear();
+  clear_has_task_info();
+}
+inline const ::mesos::TaskInfo& TaskCurrent::task_info() const {
+  return task_info_ != NULL ? *task_info_ : *default_instance_->task_info_;
+}
+inline ::mesos::TaskInfo* TaskCurrent::mutable_task_info() {
+  set_has_task_info();
+  if (task_info_ == NULL) task_info_ = new ::mesos::TaskInfo;
+  return task_info_;
+}
+inline ::mesos::TaskInfo* TaskCurrent::release_task_info() {
+  clear_has_task_info();
+  ::mesos::TaskInfo* temp = task_info_;
+  task_info_ = NULL;
+  return temp;
+}
+inline void TaskCurrent::set_allocated_task_info(::mesos::TaskInfo* task_info) {
+  delete task_info_;
+  task_info_ = task_info;
+  if (task_info) {
+    set_has_task_info();
+  } else {
+    clear_has_task_info();
+  }
 }
-inline void RestartTaskInfo::clear_has_task_type() {
-  _has_bits_[0] &= ~0x00000001u;
+
+// optional double start_time = 8;
+inline bool TaskCurrent::has_start_time() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
 }
-inline void RestartTaskInfo::clear_task_type() {
-  task_type_ = 0u;
-  clear_has_task_type();
+inline void TaskCurrent::set_has_start_time() {
+  _has_bits_[0] |= 0x00000080u;
 }
-inline ::google::protobuf::uint32 RestartTaskInfo::task_type() const {
-  return task_type_;
+inline void TaskCurrent::clear_has_start_time() {
+  _has_bits_[0] &= ~0x00000080u;
 }
-inline void RestartTaskInfo::set_task_type(::google::protobuf::uint32 value) {
-  set_has_task_type();
-  task_type_ = value;
+inline void TaskCurrent::clear_start_time() {
+  start_time_ = 0;
+  clear_has_start_time();
+}
+inline double TaskCurrent::start_time() const {
+  return start_time_;
+}
+inline void TaskCurrent::set_start_time(double value) {
+  set_has_start_time();
+  start_time_ = value;
 }
 
-// required string task_name = 2;
-inline bool RestartTaskInfo::has_task_name() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional double kill_time = 9;
+inline bool TaskCurrent::has_kill_time() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
 }
-inline void RestartTaskInfo::set_has_task_name() {
-  _has_bits_[0] |= 0x00000002u;
+inline void TaskCurrent::set_has_kill_time() {
+  _has_bits_[0] |= 0x00000100u;
 }
-inline void RestartTaskInfo::clear_has_task_name() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void TaskCurrent::clear_has_kill_time() {
+  _has_bits_[0] &= ~0x00000100u;
 }
-inline void RestartTaskInfo::clear_task_name() {
-  if (task_name_ != &::google::protobuf::internal::kEmptyString) {
-    task_name_->clear();
+inline void TaskCurrent::clear_kill_time() {
+  kill_time_ = 0;
+  clear_has_kill_time();
+}
+inline double TaskCurrent::kill_time() const {
+  return kill_time_;
+}
+inline void TaskCurrent::set_kill_time(double value) {
+  set_has_kill_time();
+  kill_time_ = value;
+}
+
+// optional string task_id = 10;
+inline bool TaskCurrent::has_task_id() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void TaskCurrent::set_has_task_id() {
+  _has_bits_[0] |= 0x00000200u;
+}
+inline void TaskCurrent::clear_has_task_id() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline void TaskCurrent::clear_task_id() {
+  if (task_id_ != &::google::protobuf::internal::kEmptyString) {
+    task_id_->clear();
   }
-  clear_has_task_name();
+  clear_has_task_id();
 }
-inline const ::std::string& RestartTaskInfo::task_name() const {
-  return *task_name_;
+inline const ::std::string& TaskCurrent::task_id() const {
+  return *task_id_;
 }
-inline void RestartTaskInfo::set_task_name(const ::std::string& value) {
-  set_has_task_name();
-  if (task_name_ == &::google::protobuf::internal::kEmptyString) {
-    task_name_ = new ::std::string;
+inline void TaskCurrent::set_task_id(const ::std::string& value) {
+  set_has_task_id();
+  if (task_id_ == &::google::protobuf::internal::kEmptyString) {
+    task_id_ = new ::std::string;
   }
-  task_name_->assign(value);
+  task_id_->assign(value);
 }
-inline void RestartTaskInfo::set_task_name(const char* value) {
-  set_has_task_name();
-  if (task_name_ == &::google::protobuf::internal::kEmptyString) {
-    task_name_ = new ::std::string;
+inline void TaskCurrent::set_task_id(const char* value) {
+  set_has_task_id();
+  if (task_id_ == &::google::protobuf::internal::kEmptyString) {
+    task_id_ = new ::std::string;
   }
-  task_name_->assign(value);
+  task_id_->assign(value);
 }
-inline void RestartTaskInfo::set_task_name(const char* value, size_t size) {
-  set_has_task_name();
-  if (task_name_ == &::google::protobuf::internal::kEmptyString) {
-    task_name_ = new ::std::string;
+inline void TaskCurrent::set_task_id(const char* value, size_t size) {
+  set_has_task_id();
+  if (task_id_ == &::google::protobuf::internal::kEmptyString) {
+    task_id_ = new ::std::string;
   }
-  task_name_->assign(reinterpret_cast<const char*>(value), size);
+  task_id_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* RestartTaskInfo::mutable_task_name() {
-  set_has_task_name();
-  if (task_name_ == &::google::protobuf::internal::kEmptyString) {
-    task_name_ = new ::std::string;
+inline ::std::string* TaskCurrent::mutable_task_id() {
+  set_has_task_id();
+  if (task_id_ == &::google::protobuf::internal::kEmptyString) {
+    task_id_ = new ::std::string;
   }
-  return task_name_;
+  return task_id_;
 }
-inline ::std::string* RestartTaskInfo::release_task_name() {
-  clear_has_task_name();
-  if (task_name_ == &::google::protobuf::internal::kEmptyString) {
+inline ::std::string* TaskCurrent::release_task_id() {
+  clear_has_task_id();
+  if (task_id_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
   } else {
-    ::std::string* temp = task_name_;
-    task_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    ::std::string* temp = task_id_;
+    task_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
     return temp;
   }
 }
-inline void RestartTaskInfo::set_allocated_task_name(::std::string* task_name) {
-  if (task_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete task_name_;
+inline void TaskCurrent::set_allocated_task_id(::std::string* task_id) {
+  if (task_id_ != &::google::protobuf::internal::kEmptyString) {
+    delete task_id_;
   }
-  if (task_name) {
-    set_has_task_name();
-    task_name_ = task_name;
+  if (task_id) {
+    set_has_task_id();
+    task_id_ = task_id;
   } else {
-    clear_has_task_name();
-    task_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_task_id();
+    task_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional string launch_hash = 11;
+inline bool TaskCurrent::has_launch_hash() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+inline void TaskCurrent::set_has_launch_hash() {
+  _has_bits_[0] |= 0x00000400u;
+}
+inline void TaskCurrent::clear_has_launch_hash() {
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline void TaskCurrent::clear_launch_hash() {
+  if (launch_hash_ != &::google::protobuf::internal::kEmptyString) {
+    launch_hash_->clear();
+  }
+  clear_has_launch_hash();
+}
+inline const ::std::string& TaskCurrent::launch_hash() const {
+  return *launch_hash_;
+}
+inline void TaskCurrent::set_launch_hash(const ::std::string& value) {
+  set_has_launch_hash();
+  if (launch_hash_ == &::google::protobuf::internal::kEmptyString) {
+    launch_hash_ = new ::std::string;
+  }
+  launch_hash_->assign(value);
+}
+inline void TaskCurrent::set_launch_hash(const char* value) {
+  set_has_launch_hash();
+  if (launch_hash_ == &::google::protobuf::internal::kEmptyString) {
+    launch_hash_ = new ::std::string;
+  }
+  launch_hash_->assign(value);
+}
+inline void TaskCurrent::set_launch_hash(const char* value, size_t size) {
+  set_has_launch_hash();
+  if (launch_hash_ == &::google::protobuf::internal::kEmptyString) {
+    launch_hash_ = new ::std::string;
   }
+  launch_hash_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* TaskCurrent::mutable_launch_hash() {
+  set_has_launch_hash();
+  if (launch_hash_ == &::google::protobuf::internal::kEmptyString) {
+    launch_hash_ = new ::std::string;
+  }
+  return launch_hash_;
+}
+inline ::std::string* TaskCurrent::release_launch_hash() {
+  clear_has_launch_hash();
+  if (launch_hash_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = launch_hash_;
+    launch_hash_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void TaskCurrent::set_allocated_launch_hash(::std::string* launch_hash) {
+  if (launch_hash_ != &::google::protobuf::internal::kEmptyString) {
+    delete launch_hash_;
+  }
+  if (launch_hash) {
+    set_has_launch_hash();
+    launch_hash_ = launch_hash;
+  } else {
+    clear_has_launch_hash();
+    launch_hash_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// optional bool single_offer = 12;
+inline bool TaskCurrent::has_single_offer() const {
+  return (_has_bits_[0] & 0x00000800u) != 0;
+}
+inline void TaskCurrent::set_has_single_offer() {
+  _has_bits_[0] |= 0x00000800u;
+}
+inline void TaskCurrent::clear_has_single_offer() {
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline void TaskCurrent::clear_single_offer() {
+  single_offer_ = false;
+  clear_has_single_offer();
+}
+inline bool TaskCurrent::single_offer() const {
+  return single_offer_;
+}
+inline void TaskCurrent::set_single_offer(bool value) {
+  set_has_single_offer();
+  single_offer_ = value;
 }
 
 // -------------------------------------------------------------------
 
-// Target
+// TasksCurrent
 
-// required uint32 instances = 1;
-inline bool Target::has_instances() const {
+// repeated .arangodb.TaskCurrent entries = 1;
+inline int TasksCurrent::entries_size() const {
+  return entries_.size();
+}
+inline void TasksCurrent::clear_entries() {
+  entries_.Clear();
+}
+inline const ::arangodb::TaskCurrent& TasksCurrent::entries(int index) const {
+  return entries_.Get(index);
+}
+inline ::arangodb::TaskCurrent* TasksCurrent::mutable_entries(int index) {
+  return entries_.Mutable(index);
+}
+inline ::arangodb::TaskCurrent* TasksCurrent::add_entries() {
+  return entries_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::arangodb::TaskCurrent >&
+TasksCurrent::entries() const {
+  return entries_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::arangodb::TaskCurrent >*
+TasksCurrent::mutable_entries() {
+  return &entries_;
+}
+
+// -------------------------------------------------------------------
+
+// Current
+
+// required .arangodb.TasksCurrent agents = 1;
+inline bool Current::has_agents() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void Target::set_has_instances() {
+inline void Current::set_has_agents() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void Target::clear_has_instances() {
+inline void Current::clear_has_agents() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void Target::clear_instances() {
-  instances_ = 0u;
-  clear_has_instances();
+inline void Current::clear_agents() {
+  if (agents_ != NULL) agents_->::arangodb::TasksCurrent::Clear();
+  clear_has_agents();
 }
-inline ::google::protobuf::uint32 Target::instances() const {
-  return instances_;
+inline const ::arangodb::TasksCurrent& Current::agents() const {
+  return agents_ != NULL ? *agents_ : *default_instance_->agents_;
 }
-inline void Target::set_instances(::google::protobuf::uint32 value) {
-  set_has_instances();
-  instances_ = value;
+inline ::arangodb::TasksCurrent* Current::mutable_agents() {
+  set_has_agents();
+  if (agents_ == NULL) agents_ = new ::arangodb::TasksCurrent;
+  return agents_;
+}
+inline ::arangodb::TasksCurrent* Current::release_agents() {
+  clear_has_agents();
+  ::arangodb::TasksCurrent* temp = agents_;
+  agents_ = NULL;
+  return temp;
+}
+inline void Current::set_allocated_agents(::arangodb::TasksCurrent* agents) {
+  delete agents_;
+  agents_ = agents;
+  if (agents) {
+    set_has_agents();
+  } else {
+    clear_has_agents();
+  }
 }
 
-// repeated .mesos.Resource minimal_resources = 2;
-inline int Target::minimal_resources_size() const {
-  return minimal_resources_.size();
+// required .arangodb.TasksCurrent coordinators = 2;
+inline bool Current::has_coordinators() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void Target::clear_minimal_resources() {
-  minimal_resources_.Clear();
+inline void Current::set_has_coordinators() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline const ::mesos::Resource& Target::minimal_resources(int index) const {
-  return minimal_resources_.Get(index);
+inline void Current::clear_has_coordinators() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void Current::clear_coordinators() {
+  if (coordinators_ != NULL) coordinators_->::arangodb::TasksCurrent::Clear();
+  clear_has_coordinators();
+}
+inline const ::arangodb::TasksCurrent& Current::coordinators() const {
+  return coordinators_ != NULL ? *coordinators_ : *default_instance_->coordinators_;
+}
+inline ::arangodb::TasksCurrent* Current::mutable_coordinators() {
+  set_has_coordinators();
+  if (coordinators_ == NULL) coordinators_ = new ::arangodb::TasksCurrent;
+  return coordinators_;
+}
+inline ::arangodb::TasksCurrent* Current::release_coordinators() {
+  clear_has_coordinators();
+  ::arangodb::TasksCurrent* temp = coordinators_;
+  coordinators_ = NULL;
+  return temp;
+}
+inline void Current::set_allocated_coordinators(::arangodb::TasksCurrent* coordinators) {
+  delete coordinators_;
+  coordinators_ = coordinators;
+  if (coordinators) {
+    set_has_coordinators();
+  } else {
+    clear_has_coordinators();
+  }
+}
+
+// required .arangodb.TasksCurrent dbservers = 3;
+inline bool Current::has_dbservers() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Current::set_has_dbservers() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void Current::clear_has_dbservers() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void Current::clear_dbservers() {
+  if (dbservers_ != NULL) dbservers_->::arangodb::TasksCurrent::Clear();
+  clear_has_dbservers();
 }
-inline ::mesos::Resource* Target::mutable_minimal_resources(int index) {
-  return minimal_resources_.Mutable(index);
+inline const ::arangodb::TasksCurrent& Current::dbservers() const {
+  return dbservers_ != NULL ? *dbservers_ : *default_instance_->dbservers_;
 }
-inline ::mesos::Resource* Target::add_minimal_resources() {
-  return minimal_resources_.Add();
+inline ::arangodb::TasksCurrent* Current::mutable_dbservers() {
+  set_has_dbservers();
+  if (dbservers_ == NULL) dbservers_ = new ::arangodb::TasksCurrent;
+  return dbservers_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::mesos::Resource >&
-Target::minimal_resources() const {
-  return minimal_resources_;
+inline ::arangodb::TasksCurrent* Current::release_dbservers() {
+  clear_has_dbservers();
+  ::arangodb::TasksCurrent* temp = dbservers_;
+  dbservers_ = NULL;
+  return temp;
 }
-inline ::google::protobuf::RepeatedPtrField< ::mesos::Resource >*
-Target::mutable_minimal_resources() {
-  return &minimal_resources_;
+inline void Current::set_allocated_dbservers(::arangodb::TasksCurrent* dbservers) {
+  delete dbservers_;
+  dbservers_ = dbservers;
+  if (dbservers) {
+    set_has_dbservers();
+  } else {
+    clear_has_dbservers();
+  }
 }
 
-// repeated .mesos.Resource additional_resources = 3;
-inline int Target::additional_resources_size() const {
-  return additional_resources_.size();
+// required .arangodb.TasksCurrent secondaries = 4;
+inline bool Current::has_secondaries() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline void Target::clear_additional_resources() {
-  additional_resources_.Clear();
+inline void Current::set_has_secondaries() {
+  _has_bits_[0] |= 0x00000008u;
 }
-inline const ::mesos::Resource& Target::additional_resources(int index) const {
-  return additional_resources_.Get(index);
+inline void Current::clear_has_secondaries() {
+  _has_bits_[0] &= ~0x00000008u;
 }
-inline ::mesos::Resource* Target::mutable_additional_resources(int index) {
-  return additional_resources_.Mutable(index);
+inline void Current::clear_secondaries() {
+  if (secondaries_ != NULL) secondaries_->::arangodb::TasksCurrent::Clear();
+  clear_has_secondaries();
 }
-inline ::mesos::Resource* Target::add_additional_resources() {
-  return additional_resources_.Add();
+inline const ::arangodb::TasksCurrent& Current::secondaries() const {
+  return secondaries_ != NULL ? *secondaries_ : *default_instance_->secondaries_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::mesos::Resource >&
-Target::additional_resources() const {
-  return additional_resources_;
+inline ::arangodb::TasksCurrent* Current::mutable_secondaries() {
+  set_has_secondaries();
+  if (secondaries_ == NULL) secondaries_ = new ::arangodb::TasksCurrent;
+  return secondaries_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::mesos::Resource >*
-Target::mutable_additional_resources() {
-  return &additional_resources_;
+inline ::arangodb::TasksCurrent* Current::release_secondaries() {
+  clear_has_secondaries();
+  ::arangodb::TasksCurrent* temp = secondaries_;
+  secondaries_ = NULL;
+  return temp;
+}
+inline void Current::set_allocated_secondaries(::arangodb::TasksCurrent* secondaries) {
+  delete secondaries_;
+  secondaries_ = secondaries;
+  if (secondaries) {
+    set_has_secondaries();
+  } else {
+    clear_has_secondaries();
+  }
 }
 
-// required uint32 number_ports = 4;
-inline bool Target::has_number_ports() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// required bool cluster_complete = 5;
+inline bool Current::has_cluster_complete() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
 }
-inline void Target::set_has_number_ports() {
-  _has_bits_[0] |= 0x00000008u;
+inline void Current::set_has_cluster_complete() {
+  _has_bits_[0] |= 0x00000010u;
 }
-inline void Target::clear_has_number_ports() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void Current::clear_has_cluster_complete() {
+  _has_bits_[0] &= ~0x00000010u;
 }
-inline void Target::clear_number_ports() {
-  number_ports_ = 0u;
-  clear_has_number_ports();
+inline void Current::clear_cluster_complete() {
+  cluster_complete_ = false;
+  clear_has_cluster_complete();
 }
-inline ::google::protobuf::uint32 Target::number_ports() const {
-  return number_ports_;
+inline bool Current::cluster_complete() const {
+  return cluster_complete_;
 }
-inline void Target::set_number_ports(::google::protobuf::uint32 value) {
-  set_has_number_ports();
-  number_ports_ = value;
+inline void Current::set_cluster_complete(bool value) {
+  set_has_cluster_complete();
+  cluster_complete_ = value;
 }
 
 // -------------------------------------------------------------------
 
-// Targets
+// Failover
 
-// required string mode = 1;
-inline bool Targets::has_mode() const {
+// required string primary = 1;
+inline bool Failover::has_primary() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void Targets::set_has_mode() {
+inline void Failover::set_has_primary() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void Targets::clear_has_mode() {
+inline void Failover::clear_has_primary() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void Targets::clear_mode() {
-  if (mode_ != &::google::protobuf::internal::kEmptyString) {
-    mode_->clear();
+inline void Failover::clear_primary() {
+  if (primary_ != &::google::protobuf::internal::kEmptyString) {
+    primary_->clear();
   }
-  clear_has_mode();
+  clear_has_primary();
 }
-inline const ::std::string& Targets::mode() const {
-  return *mode_;
+inline const ::std::string& Failover::primary() const {
+  return *primary_;
 }
-inline void Targets::set_mode(const ::std::string& value) {
-  set_has_mode();
-  if (mode_ == &::google::protobuf::internal::kEmptyString) {
-    mode_ = new ::std::string;
+inline void Failover::set_primary(const ::std::string& value) {
+  set_has_primary();
+  if (primary_ == &::google::protobuf::internal::kEmptyString) {
+    primary_ = new ::std::string;
   }
-  mode_->assign(value);
+  primary_->assign(value);
 }
-inline void Targets::set_mode(const char* value) {
-  set_has_mode();
-  if (mode_ == &::google::protobuf::internal::kEmptyString) {
-    mode_ = new ::std::string;
+inline void Failover::set_primary(const char* value) {
+  set_has_primary();
+  if (primary_ == &::google::protobuf::internal::kEmptyString) {
+    primary_ = new ::std::string;
   }
-  mode_->assign(value);
+  primary_->assign(value);
 }
-inline void Targets::set_mode(const char* value, size_t size) {
-  set_has_mode();
-  if (mode_ == &::google::protobuf::internal::kEmptyString) {
-    mode_ = new ::std::string;
+inline void Failover::set_primary(const char* value, size_t size) {
+  set_has_primary();
+  if (primary_ == &::google::protobuf::internal::kEmptyString) {
+    primary_ = new ::std::string;
   }
-  mode_->assign(reinterpret_cast<const char*>(value), size);
+  primary_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::std::string* Targets::mutable_mode() {
-  set_has_mode();
-  if (mode_ == &::google::protobuf::internal::kEmptyString) {
-    mode_ = new ::std::string;
+inline ::std::string* Failover::mutable_primary() {
+  set_has_primary();
+  if (primary_ == &::google::protobuf::internal::kEmptyString) {
+    primary_ = new ::std::string;
   }
-  return mode_;
+  return primary_;
 }
-inline ::std::string* Targets::release_mode() {
-  clear_has_mode();
-  if (mode_ == &::google::protobuf::internal::kEmptyString) {
+inline ::std::string* Failover::release_primary() {
+  clear_has_primary();
+  if (primary_ == &::google::protobuf::internal::kEmptyString) {
     return NULL;
   } else {
-    ::std::string* temp = mode_;
-    mode_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    ::std::string* temp = primary_;
+    primary_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
     return temp;
   }
 }
-inline void Targets::set_allocated_mode(::std::string* mode) {
-  if (mode_ != &::google::protobuf::internal::kEmptyString) {
-    delete mode_;
+inline void Failover::set_allocated_primary(::std::string* primary) {
+  if (primary_ != &::google::protobuf::internal::kEmptyString) {
+    delete primary_;
   }
-  if (mode) {
-    set_has_mode();
-    mode_ = mode;
+  if (primary) {
+    set_has_primary();
+    primary_ = primary;
   } else {
-    clear_has_mode();
-    mode_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_primary();
+    primary_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
-// required .arangodb.Target agents = 2;
-inline bool Targets::has_agents() const {
+// required string secondary = 2;
+inline bool Failover::has_secondary() const {
   return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void Targets::set_has_agents() {
+inline void Failover::set_has_secondary() {
   _has_bits_[0] |= 0x00000002u;
 }
-inline void Targets::clear_has_agents() {
+inline void Failover::clear_has_secondary() {
   _has_bits_[0] &= ~0x00000002u;
 }
-inline void Targets::clear_agents() {
-  if (agents_ != NULL) agents_->::arangodb::Target::Clear();
-  clear_has_agents();
+inline void Failover::clear_secondary() {
+  if (secondary_ != &::google::protobuf::internal::kEmptyString) {
+    secondary_->clear();
+  }
+  clear_has_secondary();
 }
-inline const ::arangodb::Target& Targets::agents() const {
-  return agents_ != NULL ? *agents_ : *default_instance_->agents_;
+inline const ::std::string& Failover::secondary() const {
+  return *secondary_;
 }
-inline ::arangodb::Target* Targets::mutable_agents() {
-  set_has_agents();
-  if (agents_ == NULL) agents_ = new ::arangodb::Target;
-  return agents_;
+inline void Failover::set_secondary(const ::std::string& value) {
+  set_has_secondary();
+  if (secondary_ == &::google::protobuf::internal::kEmptyString) {
+    secondary_ = new ::std::string;
+  }
+  secondary_->assign(value);
 }
-inline ::arangodb::Target* Targets::release_agents() {
-  clear_has_agents();
-  ::arangodb::Target* temp = agents_;
-  agents_ = NULL;
-  return temp;
+inline void Failover::set_secondary(const char* value) {
+  set_has_secondary();
+  if (secondary_ == &::google::protobuf::internal::kEmptyString) {
+    secondary_ = new ::std::string;
+  }
+  secondary_->assign(value);
 }
-inline void Targets::set_allocated_agents(::arangodb::Target* agents) {
-  delete agents_;
-  agents_ = agents;
-  if (agents) {
-    set_has_agents();
+inline void Failover::set_secondary(const char* value, size_t size) {
+  set_has_secondary();
+  if (secondary_ == &::google::protobuf::internal::kEmptyString) {
+    secondary_ = new ::std::string;
+  }
+  secondary_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* Failover::mutable_secondary() {
+  set_has_secondary();
+  if (secondary_ == &::google::protobuf::internal::kEmptyString) {
+    secondary_ = new ::std::string;
+  }
+  return secondary_;
+}
+inline ::std::string* Failover::release_secondary() {
+  clear_has_secondary();
+  if (secondary_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
   } else {
-    clear_has_agents();
+    ::std::string* temp = secondary_;
+    secondary_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void Failover::set_allocated_secondary(::std::string* secondary) {
+  if (secondary_ != &::google::protobuf::internal::kEmptyString) {
+    delete secondary_;
+  }
+  if (secondary) {
+    set_has_secondary();
+    secondary_ = secondary;
+  } else {
+    clear_has_secondary();
+    secondary_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
-// required .arangodb.Target coordinators = 3;
-inline bool Targets::has_coordinators() const {
+// required .arangodb.FailoverState state = 3 [default = FAILOVER_SWAP_REQUESTED];
+inline bool Failover::has_state() const {
   return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void Targets::set_has_coordinators() {
+inline void Failover::set_has_state() {
   _has_bits_[0] |= 0x00000004u;
 }
-inline void Targets::clear_has_coordinators() {
+inline void Failover::clear_has_state() {
   _has_bits_[0] &= ~0x00000004u;
 }
-inline void Targets::clear_coordinators() {
-  if (coordinators_ != NULL) coordinators_->::arangodb::Target::Clear();
-  clear_has_coordinators();
-}
-inline const ::arangodb::Target& Targets::coordinators() const {
-  return coordinators_ != NULL ? *coordinators_ : *default_instance_->coordinators_;
-}
-inline ::arangodb::Target* Targets::mutable_coordinators() {
-  set_has_coordinators();
-  if (coordinators_ == NULL) coordinators_ = new ::arangodb::Target;
-  return coordinators_;
+inline void Failover::clear_state() {
+  state_ = 1;
+  clear_has_state();
 }
-inline ::arangodb::Target* Targets::release_coordinators() {
-  clear_has_coordinators();
-  ::arangodb::Target* temp = coordinators_;
-  coordinators_ = NULL;
-  return temp;
+inline ::arangodb::FailoverState Failover::state() const {
+  return static_cast< ::arangodb::FailoverState >(state_);
 }
-inline void Targets::set_allocated_coordinators(::arangodb::Target* coordinators) {
-  delete coordinators_;
-  coordinators_ = coordinators;
-  if (coordinators) {
-    set_has_coordinators();
-  } else {
-    clear_has_coordinators();
-  }
+inline void Failover::set_state(::arangodb::FailoverState value) {
+  assert(::arangodb::FailoverState_IsValid(value));
+  set_has_state();
+  state_ = value;
 }
 
-// required .arangodb.Target dbservers = 4;
-inline bool Targets::has_dbservers() const {
+// optional double timestamp = 4;
+inline bool Failover::has_timestamp() const {
   return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline void Targets::set_has_dbservers() {
+inline void Failover::set_has_timestamp() {
   _has_bits_[0] |= 0x00000008u;
 }
-inline void Targets::clear_has_dbservers() {
+inline void Failover::clear_has_timestamp() {
   _has_bits_[0] &= ~0x00000008u;
 }
-inline void Targets::clear_dbservers() {
-  if (dbservers_ != NULL) dbservers_->::arangodb::Target::Clear();
-  clear_has_dbservers();
-}
-inline const ::arangodb::Target& Targets::dbservers() const {
-  return dbservers_ != NULL ? *dbservers_ : *default_instance_->dbservers_;
-}
-inline ::arangodb::Target* Targets::mutable_dbservers() {
-  set_has_dbservers();
-  if (dbservers_ == NULL) dbservers_ = new ::arangodb::Target;
-  return dbservers_;
+inline void Failover::clear_timestamp() {
+  timestamp_ = 0;
+  clear_has_timestamp();
 }
-inline ::arangodb::Target* Targets::release_dbservers() {
-  clear_has_dbservers();
-  ::arangodb::Target* temp = dbservers_;
-  dbservers_ = NULL;
-  return temp;
+inline double Failover::timestamp() const {
+  return timestamp_;
 }
-inline void Targets::set_allocated_dbservers(::arangodb::Target* dbservers) {
-  delete dbservers_;
-  dbservers_ = dbservers;
-  if (dbservers) {
-    set_has_dbservers();
-  } else {
-    clear_has_dbservers();
-  }
+inline void Failover::set_timestamp(double value) {
+  set_has_timestamp();
+  timestamp_ = value;
 }
-
-// required .arangodb.Target secondaries = 5;
-inline bool Targets::has_secondaries() const {
+
+// optional uint32 attempts = 5;
+inline bool Failover::has_attempts() const {
   return (_has_bits_[0] & 0x00000010u) != 0;
 }
-inline void Targets::set_has_secondaries() {
+inline void Failover::set_has_attempts() {
   _has_bits_[0] |= 0x00000010u;
 }
-inline void Targets::clear_has_secondaries() {
+inline void Failover::clear_has_attempts() {
   _has_bits_[0] &= ~0x00000010u;
 }
-inline void Targets::clear_secondaries() {
-  if (secondaries_ != NULL) secondaries_->::arangodb::Target::Clear();
-  clear_has_secondaries();
-}
-inline const ::arangodb::Target& Targets::secondaries() const {
-  return secondaries_ != NULL ? *secondaries_ : *default_instance_->secondaries_;
-}
-inline ::arangodb::Target* Targets::mutable_secondaries() {
-  set_has_secondaries();
-  if (secondaries_ == NULL) secondaries_ = new ::arangodb::Target;
-  return secondaries_;
+inline void Failover::clear_attempts() {
+  attempts_ = 0u;
+  clear_has_attempts();
 }
-inline ::arangodb::Target* Targets::release_secondaries() {
-  clear_has_secondaries();
-  ::arangodb::Target* temp = secondaries_;
-  secondaries_ = NULL;
-  return temp;
+inline ::google::protobuf::uint32 Failover::attempts() const {
+  return attempts_;
 }
-inline void Targets::set_allocated_secondaries(::arangodb::Target* secondaries) {
-  delete secondaries_;
-  secondaries_ = secondaries;
-  if (secondaries) {
-    set_has_secondaries();
-  } else {
-    clear_has_secondaries();
-  }
+inline void Failover::set_attempts(::google::protobuf::uint32 value) {
+  set_has_attempts();
+  attempts_ = value;
 }
 
-// optional bool asynchronous_replication = 6;
-inline bool Targets::has_asynchronous_replication() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+// -------------------------------------------------------------------
+
+// Failovers
+
+// repeated .arangodb.Failover entries = 1;
+inline int Failovers::entries_size() const {
+  return entries_.size();
 }
-inline void Targets::set_has_asynchronous_replication() {
-  _has_bits_[0] |= 0x00000020u;
+inline void Failovers::clear_entries() {
+  entries_.Clear();
 }
-inline void Targets::clear_has_asynchronous_replication() {
-  _has_bits_[0] &= ~0x00000020u;
+inline const ::arangodb::Failover& Failovers::entries(int index) const {
+  return entries_.Get(index);
 }
-inline void Targets::clear_asynchronous_replication() {
-  asynchronous_replication_ = false;
-  clear_has_asynchronous_replication();
+inline ::arangodb::Failover* Failovers::mutable_entries(int index) {
+  return entries_.Mutable(index);
 }
-inline bool Targets::asynchronous_replication() const {
-  return asynchronous_replication_;
+inline ::arangodb::Failover* Failovers::add_entries() {
+  return entries_.Add();
 }
-inline void Targets::set_asynchronous_replication(bool value) {
-  set_has_asynchronous_replication();
-  asynchronous_replication_ = value;
+inline const ::google::protobuf::RepeatedPtrField< ::arangodb::Failover >&
+Failovers::entries() const {
+  return entries_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::arangodb::Failover >*
+Failovers::mutable_entries() {
+  return &entries_;
 }
 
 // -------------------------------------------------------------------
 
-// TaskPlan
+// State
 
-// required .arangodb.TaskPlanState state = 1 [default = TASK_STATE_NEW];
-inline bool TaskPlan::has_state() const {
+// optional .mesos.FrameworkID framework_id = 1;
+inline bool State::has_framework_id() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void TaskPlan::set_has_state() {
+inline void State::set_has_framework_id() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void TaskPlan::clear_has_state() {
+inline void State::clear_has_framework_id() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void TaskPlan::clear_state() {
-  state_ = 1;
-  clear_has_state();
+inline void State::clear_framework_id() {
+  if (framework_id_ != NULL) framework_id_->::mesos::FrameworkID::Clear();
+  clear_has_framework_id();
 }
-inline ::arangodb::TaskPlanState TaskPlan::state() const {
-  return static_cast< ::arangodb::TaskPlanState >(state_);
+inline const ::mesos::FrameworkID& State::framework_id() const {
+  return framework_id_ != NULL ? *framework_id_ : *default_instance_->framework_id_;
 }
-inline void TaskPlan::set_state(::arangodb::TaskPlanState value) {
-  assert(::arangodb::TaskPlanState_IsValid(value));
-  set_has_state();
-  state_ = value;
+inline ::mesos::FrameworkID* State::mutable_framework_id() {
+  set_has_framework_id();
+  if (framework_id_ == NULL) framework_id_ = new ::mesos::FrameworkID;
+  return framework_id_;
+}
+inline ::mesos::FrameworkID* State::release_framework_id() {
+  clear_has_framework_id();
+  ::mesos::FrameworkID* temp = framework_id_;
+  framework_id_ = NULL;
+  return temp;
+}
+inline void State::set_allocated_framework_id(::mesos::FrameworkID* framework_id) {
+  delete framework_id_;
+  framework_id_ = framework_id;
+  if (framework_id) {
+    set_has_framework_id();
+  } else {
+    clear_has_framework_id();
+  }
 }
 
-// optional string persistence_id = 2;
-inline bool TaskPlan::has_persistence_id() const {
+// required .arangodb.Targets targets = 2;
+inline bool State::has_targets() const {
   return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void TaskPlan::set_has_persistence_id() {
+inline void State::set_has_targets() {
   _has_bits_[0] |= 0x00000002u;
 }
-inline void TaskPlan::clear_has_persistence_id() {
+inline void State::clear_has_targets() {
   _has_bits_[0] &= ~0x00000002u;
 }
-inline void TaskPlan::clear_persistence_id() {
-  if (persistence_id_ != &::google::protobuf::internal::kEmptyString) {
-    persistence_id_->clear();
-  }
-  clear_has_persistence_id();
-}
-inline const ::std::string& TaskPlan::persistence_id() const {
-  return *persistence_id_;
-}
-inline void TaskPlan::set_persistence_id(const ::std::string& value) {
-  set_has_persistence_id();
-  if (persistence_id_ == &::google::protobuf::internal::kEmptyString) {
-    persistence_id_ = new ::std::string;
-  }
-  persistence_id_->assign(value);
-}
-inline void TaskPlan::set_persistence_id(const char* value) {
-  set_has_persistence_id();
-  if (persistence_id_ == &::google::protobuf::internal::kEmptyString) {
-    persistence_id_ = new ::std::string;
-  }
-  persistence_id_->assign(value);
+inline void State::clear_targets() {
+  if (targets_ != NULL) targets_->::arangodb::Targets::Clear();
+  clear_has_targets();
 }
-inline void TaskPlan::set_persistence_id(const char* value, size_t size) {
-  set_has_persistence_id();
-  if (persistence_id_ == &::google::protobuf::internal::kEmptyString) {
-    persistence_id_ = new ::std::string;
-  }
-  persistence_id_->assign(reinterpret_cast<const char*>(value), size);
+inline const ::arangodb::Targets& State::targets() const {
+  return targets_ != NULL ? *targets_ : *default_instance_->targets_;
 }
-inline ::std::string* TaskPlan::mutable_persistence_id() {
-  set_has_persistence_id();
-  if (persistence_id_ == &::google::protobuf::internal::kEmptyString) {
-    persistence_id_ = new ::std::string;
-  }
-  return persistence_id_;
+inline ::arangodb::Targets* State::mutable_targets() {
+  set_has_targets();
+  if (targets_ == NULL) targets_ = new ::arangodb::Targets;
+  return targets_;
 }
-inline ::std::string* TaskPlan::release_persistence_id() {
-  clear_has_persistence_id();
-  if (persistence_id_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = persistence_id_;
-    persistence_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline ::arangodb::Targets* State::release_targets() {
+  clear_has_targets();
+  ::arangodb::Targets* temp = targets_;
+  targets_ = NULL;
+  return temp;
 }
-inline void TaskPlan::set_allocated_persistence_id(::std::string* persistence_id) {
-  if (persistence_id_ != &::google::protobuf::internal::kEmptyString) {
-    delete persistence_id_;
-  }
-  if (persistence_id) {
-    set_has_persistence_id();
-    persistence_id_ = persistence_id;
+inline void State::set_allocated_targets(::arangodb::Targets* targets) {
+  delete targets_;
+  targets_ = targets;
+  if (targets) {
+    set_has_targets();
   } else {
-    clear_has_persistence_id();
-    persistence_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_targets();
   }
 }
 
-// optional double timestamp = 3;
-inline bool TaskPlan::has_timestamp() const {
+// required .arangodb.Plan plan = 3;
+inline bool State::has_plan() const {
   return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void TaskPlan::set_has_timestamp() {
+inline void State::set_has_plan() {
   _has_bits_[0] |= 0x00000004u;
 }
-inline void TaskPlan::clear_has_timestamp() {
+inline void State::clear_has_plan() {
   _has_bits_[0] &= ~0x00000004u;
 }
-inline void TaskPlan::clear_timestamp() {
-  timestamp_ = 0;
-  clear_has_timestamp();
+inline void State::clear_plan() {
+  if (plan_ != NULL) plan_->::arangodb::Plan::Clear();
+  clear_has_plan();
 }
-inline double TaskPlan::timestamp() const {
-  return timestamp_;
+inline const ::arangodb::Plan& State::plan() const {
+  return plan_ != NULL ? *plan_ : *default_instance_->plan_;
 }
-inline void TaskPlan::set_timestamp(double value) {
-  set_has_timestamp();
-  timestamp_ = value;
+inline ::arangodb::Plan* State::mutable_plan() {
+  set_has_plan();
+  if (plan_ == NULL) plan_ = new ::arangodb::Plan;
+  return plan_;
+}
+inline ::arangodb::Plan* State::release_plan() {
+  clear_has_plan();
+  ::arangodb::Plan* temp = plan_;
+  plan_ = NULL;
+  return temp;
+}
+inline void State::set_allocated_plan(::arangodb::Plan* plan) {
+  delete plan_;
+  plan_ = plan;
+  if (plan) {
+    set_has_plan();
+  } else {
+    clear_has_plan();
+  }
 }
 
-// required string name = 4;
-inline bool TaskPlan::has_name() const {
+// required .arangodb.Current current = 4;
+inline bool State::has_current() const {
   return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline void TaskPlan::set_has_name() {
+inline void State::set_has_current() {
   _has_bits_[0] |= 0x00000008u;
 }
-inline void TaskPlan::clear_has_name() {
+inline void State::clear_has_current() {
   _has_bits_[0] &= ~0x00000008u;
 }
-inline void TaskPlan::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
-  }
-  clear_has_name();
-}
-inline const ::std::string& TaskPlan::name() const {
-  return *name_;
-}
-inline void TaskPlan::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void TaskPlan::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void TaskPlan::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
+inline void State::clear_current() {
+  if (current_ != NULL) current_->::arangodb::Current::Clear();
+  clear_has_current();
 }
-inline ::std::string* TaskPlan::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
+inline const ::arangodb::Current& State::current() const {
+  return current_ != NULL ? *current_ : *default_instance_->current_;
 }
-inline ::std::string* TaskPlan::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline ::arangodb::Current* State::mutable_current() {
+  set_has_current();
+  if (current_ == NULL) current_ = new ::arangodb::Current;
+  return current_;
 }
-inline void TaskPlan::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (name) {
-    set_has_name();
-    name_ = name;
+inline ::arangodb::Current* State::release_current() {
+  clear_has_current();
+  ::arangodb::Current* temp = current_;
+  current_ = NULL;
+  return temp;
+}
+inline void State::set_allocated_current(::arangodb::Current* current) {
+  delete current_;
+  current_ = current;
+  if (current) {
+    set_has_current();
   } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_current();
   }
 }
 
-// optional string sync_partner = 5;
-inline bool TaskPlan::has_sync_partner() const {
+// optional .arangodb.Restart restart = 5;
+inline bool State::has_restart() const {
   return (_has_bits_[0] & 0x00000010u) != 0;
 }
-inline void TaskPlan::set_has_sync_partner() {
+inline void State::set_has_restart() {
   _has_bits_[0] |= 0x00000010u;
 }
-inline void TaskPlan::clear_has_sync_partner() {
+inline void State::clear_has_restart() {
   _has_bits_[0] &= ~0x00000010u;
 }
-inline void TaskPlan::clear_sync_partner() {
-  if (sync_partner_ != &::google::protobuf::internal::kEmptyString) {
-    sync_partner_->clear();
-  }
-  clear_has_sync_partner();
-}
-inline const ::std::string& TaskPlan::sync_partner() const {
-  return *sync_partner_;
-}
-inline void TaskPlan::set_sync_partner(const ::std::string& value) {
-  set_has_sync_partner();
-  if (sync_partner_ == &::google::protobuf::internal::kEmptyString) {
-    sync_partner_ = new ::std::string;
-  }
-  sync_partner_->assign(value);
-}
-inline void TaskPlan::set_sync_partner(const char* value) {
-  set_has_sync_partner();
-  if (sync_partner_ == &::google::protobuf::internal::kEmptyString) {
-    sync_partner_ = new ::std::string;
-  }
-  sync_partner_->assign(value);
+inline void State::clear_restart() {
+  if (restart_ != NULL) restart_->::arangodb::Restart::Clear();
+  clear_has_restart();
 }
-inline void TaskPlan::set_sync_partner(const char* value, size_t size) {
-  set_has_sync_partner();
-  if (sync_partner_ == &::google::protobuf::internal::kEmptyString) {
-    sync_partner_ = new ::std::string;
-  }
-  sync_partner_->assign(reinterpret_cast<const char*>(value), size);
+inline const ::arangodb::Restart& State::restart() const {
+  return restart_ != NULL ? *restart_ : *default_instance_->restart_;
 }
-inline ::std::string* TaskPlan::mutable_sync_partner() {
-  set_has_sync_partner();
-  if (sync_partner_ == &::google::protobuf::internal::kEmptyString) {
-    sync_partner_ = new ::std::string;
-  }
-  return sync_partner_;
+inline ::arangodb::Restart* State::mutable_restart() {
+  set_has_restart();
+  if (restart_ == NULL) restart_ = new ::arangodb::Restart;
+  return restart_;
 }
-inline ::std::string* TaskPlan::release_sync_partner() {
-  clear_has_sync_partner();
-  if (sync_partner_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = sync_partner_;
-    sync_partner_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline ::arangodb::Restart* State::release_restart() {
+  clear_has_restart();
+  ::arangodb::Restart* temp = restart_;
+  restart_ = NULL;
+  return temp;
 }
-inline void TaskPlan::set_allocated_sync_partner(::std::string* sync_partner) {
-  if (sync_partner_ != &::google::protobuf::internal::kEmptyString) {
-    delete sync_partner_;
-  }
-  if (sync_partner) {
-    set_has_sync_partner();
-    sync_partner_ = sync_partner;
+inline void State::set_allocated_restart(::arangodb::Restart* restart) {
+  delete restart_;
+  restart_ = restart;
+  if (restart) {
+    set_has_restart();
   } else {
-    clear_has_sync_partner();
-    sync_partner_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    clear_has_restart();
   }
 }
 
-// optional string server_id = 6;
-inline bool TaskPlan::has_server_id() const {
+// optional uint64 journal_sequence = 6;
+inline bool State::has_journal_sequence() const {
   return (_has_bits_[0] & 0x00000020u) != 0;
 }
-inline void TaskPlan::set_has_server_id() {
+inline void State::set_has_journal_sequence() {
   _has_bits_[0] |= 0x00000020u;
 }
-inline void TaskPlan::clear_has_server_id() {
+inline void State::clear_has_journal_sequence() {
   _has_bits_[0] &= ~0x00000020u;
 }
-inline void TaskPlan::clear_server_id() {
-  if (server_id_ != &::google::protobuf::internal::kEmptyString) {
-    server_id_->clear();
-  }
-  clear_has_server_id();
+inline void State::clear_journal_sequence() {
+  journal_sequence_ = GOOGLE_ULONGLONG(0);
+  clear_has_journal_sequence();
 }
-inline const ::std::string& TaskPlan::server_id() const {
-  return *server_id_;
+inline ::google::protobuf::uint64 State::journal_sequence() const {
+  return journal_sequence_;
 }
-inline void TaskPlan::set_server_id(const ::std::string& value) {
-  set_has_server_id();
-  if (server_id_ == &::google::protobuf::internal::kEmptyString) {
-    server_id_ = new ::std::string;
-  }
-  server_id_->assign(value);
+inline void State::set_journal_sequence(::google::protobuf::uint64 value) {
+  set_has_journal_sequence();
+  journal_sequence_ = value;
 }
-inline void TaskPlan::set_server_id(const char* value) {
-  set_has_server_id();
-  if (server_id_ == &::google::protobuf::internal::kEmptyString) {
-    server_id_ = new ::std::string;
-  }
-  server_id_->assign(value);
+
+// optional uint32 schema_version = 7;
+inline bool State::has_schema_version() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
 }
-inline void TaskPlan::set_server_id(const char* value, size_t size) {
-  set_has_server_id();
-  if (server_id_ == &::google::protobuf::internal::kEmptyString) {
-    server_id_ = new ::std::string;
-  }
-  server_id_->assign(reinterpret_cast<const char*>(value), size);
+inline void State::set_has_schema_version() {
+  _has_bits_[0] |= 0x00000040u;
 }
-inline ::std::string* TaskPlan::mutable_server_id() {
-  set_has_server_id();
-  if (server_id_ == &::google::protobuf::internal::kEmptyString) {
-    server_id_ = new ::std::string;
-  }
-  return server_id_;
+inline void State::clear_has_schema_version() {
+  _has_bits_[0] &= ~0x00000040u;
 }
-inline ::std::string* TaskPlan::release_server_id() {
-  clear_has_server_id();
-  if (server_id_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = server_id_;
-    server_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void State::clear_schema_version() {
+  schema_version_ = 0u;
+  clear_has_schema_version();
 }
-inline void TaskPlan::set_allocated_server_id(::std::string* server_id) {
-  if (server_id_ != &::google::protobuf::internal::kEmptyString) {
-    delete server_id_;
-  }
-  if (server_id) {
-    set_has_server_id();
-    server_id_ = server_id;
-  } else {
-    clear_has_server_id();
-    server_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline ::google::protobuf::uint32 State::schema_version() const {
+  return schema_version_;
+}
+inline void State::set_schema_version(::google::protobuf::uint32 value) {
+  set_has_schema_version();
+  schema_version_ = value;
 }
 
-// -------------------------------------------------------------------
-
-// TasksPlan
-
-// repeated .arangodb.TaskPlan entries = 1;
-inline int TasksPlan::entries_size() const {
-  return entries_.size();
+// optional .arangodb.Failovers failovers = 8;
+inline bool State::has_failovers() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
 }
-inline void TasksPlan::clear_entries() {
-  entries_.Clear();
+inline void State::set_has_failovers() {
+  _has_bits_[0] |= 0x00000080u;
 }
-inline const ::arangodb::TaskPlan& TasksPlan::entries(int index) const {
-  return entries_.Get(index);
+inline void State::clear_has_failovers() {
+  _has_bits_[0] &= ~0x00000080u;
 }
-inline ::arangodb::TaskPlan* TasksPlan::mutable_entries(int index) {
-  return entries_.Mutable(index);
+inline void State::clear_failovers() {
+  if (failovers_ != NULL) failovers_->::arangodb::Failovers::Clear();
+  clear_has_failovers();
 }
-inline ::arangodb::TaskPlan* TasksPlan::add_entries() {
-  return entries_.Add();
+inline const ::arangodb::Failovers& State::failovers() const {
+  return failovers_ != NULL ? *failovers_ : *default_instance_->failovers_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::arangodb::TaskPlan >&
-TasksPlan::entries() const {
-  return entries_;
+inline ::arangodb::Failovers* State::mutable_failovers() {
+  set_has_failovers();
+  if (failovers_ == NULL) failovers_ = new ::arangodb::Failovers;
+  return failovers_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::arangodb::TaskPlan >*
-TasksPlan::mutable_entries() {
-  return &entries_;
+inline ::arangodb::Failovers* State::release_failovers() {
+  clear_has_failovers();
+  ::arangodb::Failovers* temp = failovers_;
+  failovers_ = NULL;
+  return temp;
+}
+inline void State::set_allocated_failovers(::arangodb::Failovers* failovers) {
+  delete failovers_;
+  failovers_ = failovers;
+  if (failovers) {
+    set_has_failovers();
+  } else {
+    clear_has_failovers();
+  }
 }
 
 // -------------------------------------------------------------------
 
-// Plan
+// TaskDelta
 
-// required .arangodb.TasksPlan agents = 1;
-inline bool Plan::has_agents() const {
+// required uint32 task_type = 1;
+inline bool TaskDelta::has_task_type() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void Plan::set_has_agents() {
+inline void TaskDelta::set_has_task_type() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void Plan::clear_has_agents() {
+inline void TaskDelta::clear_has_task_type() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void Plan::clear_agents() {
-  if (agents_ != NULL) agents_->::arangodb::TasksPlan::Clear();
-  clear_has_agents();
-}
-inline const ::arangodb::TasksPlan& Plan::agents() const {
-  return agents_ != NULL ? *agents_ : *default_instance_->agents_;
-}
-inline ::arangodb::TasksPlan* Plan::mutable_agents() {
-  set_has_agents();
-  if (agents_ == NULL) agents_ = new ::arangodb::TasksPlan;
-  return agents_;
+inline void TaskDelta::clear_task_type() {
+  task_type_ = 0u;
+  clear_has_task_type();
 }
-inline ::arangodb::TasksPlan* Plan::release_agents() {
-  clear_has_agents();
-  ::arangodb::TasksPlan* temp = agents_;
-  agents_ = NULL;
-  return temp;
+inline ::google::protobuf::uint32 TaskDelta::task_type() const {
+  return task_type_;
 }
-inline void Plan::set_allocated_agents(::arangodb::TasksPlan* agents) {
-  delete agents_;
-  agents_ = agents;
-  if (agents) {
-    set_has_agents();
-  } else {
-    clear_has_agents();
-  }
+inline void TaskDelta::set_task_type(::google::protobuf::uint32 value) {
+  set_has_task_type();
+  task_type_ = value;
 }
 
-// required .arangodb.TasksPlan coordinators = 2;
-inline bool Plan::has_coordinators() const {
+// required uint32 position = 2;
+inline bool TaskDelta::has_position() const {
   return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void Plan::set_has_coordinators() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Plan::clear_has_coordinators() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void Plan::clear_coordinators() {
-  if (coordinators_ != NULL) coordinators_->::arangodb::TasksPlan::Clear();
-  clear_has_coordinators();
+inline void TaskDelta::set_has_position() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline const ::arangodb::TasksPlan& Plan::coordinators() const {
-  return coordinators_ != NULL ? *coordinators_ : *default_instance_->coordinators_;
+inline void TaskDelta::clear_has_position() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline ::arangodb::TasksPlan* Plan::mutable_coordinators() {
-  set_has_coordinators();
-  if (coordinators_ == NULL) coordinators_ = new ::arangodb::TasksPlan;
-  return coordinators_;
+inline void TaskDelta::clear_position() {
+  position_ = 0u;
+  clear_has_position();
 }
-inline ::arangodb::TasksPlan* Plan::release_coordinators() {
-  clear_has_coordinators();
-  ::arangodb::TasksPlan* temp = coordinators_;
-  coordinators_ = NULL;
-  return temp;
+inline ::google::protobuf::uint32 TaskDelta::position() const {
+  return position_;
 }
-inline void Plan::set_allocated_coordinators(::arangodb::TasksPlan* coordinators) {
-  delete coordinators_;
-  coordinators_ = coordinators;
-  if (coordinators) {
-    set_has_coordinators();
-  } else {
-    clear_has_coordinators();
-  }
+inline void TaskDelta::set_position(::google::protobuf::uint32 value) {
+  set_has_position();
+  position_ = value;
 }
 
-// required .arangodb.TasksPlan dbservers = 3;
-inline bool Plan::has_dbservers() const {
+// optional .arangodb.TaskPlan plan = 3;
+inline bool TaskDelta::has_plan() const {
   return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void Plan::set_has_dbservers() {
+inline void TaskDelta::set_has_plan() {
   _has_bits_[0] |= 0x00000004u;
 }
-inline void Plan::clear_has_dbservers() {
+inline void TaskDelta::clear_has_plan() {
   _has_bits_[0] &= ~0x00000004u;
 }
-inline void Plan::clear_dbservers() {
-  if (dbservers_ != NULL) dbservers_->::arangodb::TasksPlan::Clear();
-  clear_has_dbservers();
+inline void TaskDelta::clear_plan() {
+  if (plan_ != NULL) plan_->::arangodb::TaskPlan::Clear();
+  clear_has_plan();
 }
-inline const ::arangodb::TasksPlan& Plan::dbservers() const {
-  return dbservers_ != NULL ? *dbservers_ : *default_instance_->dbservers_;
+inline const ::arangodb::TaskPlan& TaskDelta::plan() const {
+  return plan_ != NULL ? *plan_ : *default_instance_->plan_;
 }
-inline ::arangodb::TasksPlan* Plan::mutable_dbservers() {
-  set_has_dbservers();
-  if (dbservers_ == NULL) dbservers_ = new ::arangodb::TasksPlan;
-  return dbservers_;
+inline ::arangodb::TaskPlan* TaskDelta::mutable_plan() {
+  set_has_plan();
+  if (plan_ == NULL) plan_ = new ::arangodb::TaskPlan;
+  return plan_;
 }
-inline ::arangodb::TasksPlan* Plan::release_dbservers() {
-  clear_has_dbservers();
-  ::arangodb::TasksPlan* temp = dbservers_;
-  dbservers_ = NULL;
+inline ::arangodb::TaskPlan* TaskDelta::release_plan() {
+  clear_has_plan();
+  ::arangodb::TaskPlan* temp = plan_;
+  plan_ = NULL;
   return temp;
 }
-inline void Plan::set_allocated_dbservers(::arangodb::TasksPlan* dbservers) {
-  delete dbservers_;
-  dbservers_ = dbservers;
-  if (dbservers) {
-    set_has_dbservers();
+inline void TaskDelta::set_allocated_plan(::arangodb::TaskPlan* plan) {
+  delete plan_;
+  plan_ = plan;
+  if (plan) {
+    set_has_plan();
   } else {
-    clear_has_dbservers();
+    clear_has_plan();
   }
 }
 
-// required .arangodb.TasksPlan secondaries = 4;
-inline bool Plan::has_secondaries() const {
+// optional .arangodb.TaskCurrent current = 4;
+inline bool TaskDelta::has_current() const {
   return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline void Plan::set_has_secondaries() {
+inline void TaskDelta::set_has_current() {
   _has_bits_[0] |= 0x00000008u;
 }
-inline void Plan::clear_has_secondaries() {
+inline void TaskDelta::clear_has_current() {
   _has_bits_[0] &= ~0x00000008u;
 }
-inline void Plan::clear_secondaries() {
-  if (secondaries_ != NULL) secondaries_->::arangodb::TasksPlan::Clear();
-  clear_has_secondaries();
+inline void TaskDelta::clear_current() {
+  if (current_ != NULL) current_->::arangodb::TaskCurrent::Clear();
+  clear_has_current();
 }
-inline const ::arangodb::TasksPlan& Plan::secondaries() const {
-  return secondaries_ != NULL ? *secondaries_ : *default_instance_->secondaries_;
+inline const ::arangodb::TaskCurrent& TaskDelta::current() const {
+  return current_ != NULL ? *current_ : *default_instance_->current_;
 }
-inline ::arangodb::TasksPlan* Plan::mutable_secondaries() {
-  set_has_secondaries();
-  if (secondaries_ == NULL) secondaries_ = new ::arangodb::TasksPlan;
-  return secondaries_;
+inline ::arangodb::TaskCurrent* TaskDelta::mutable_current() {
+  set_has_current();
+  if (current_ == NULL) current_ = new ::arangodb::TaskCurrent;
+  return current_;
 }
-inline ::arangodb::TasksPlan* Plan::release_secondaries() {
-  clear_has_secondaries();
-  ::arangodb::TasksPlan* temp = secondaries_;
-  secondaries_ = NULL;
+inline ::arangodb::TaskCurrent* TaskDelta::release_current() {
+  clear_has_current();
+  ::arangodb::TaskCurrent* temp = current_;
+  current_ = NULL;
   return temp;
 }
-inline void Plan::set_allocated_secondaries(::arangodb::TasksPlan* secondaries) {
-  delete secondaries_;
-  secondaries_ = secondaries;
-  if (secondaries) {
-    set_has_secondaries();
+inline void TaskDelta::set_allocated_current(::arangodb::TaskCurrent* current) {
+  delete current_;
+  current_ = current;
+  if (current) {
+    set_has_current();
   } else {
-    clear_has_secondaries();
+    clear_has_current();
   }
 }
 
 // -------------------------------------------------------------------
 
-// TaskCurrent
+// StateDelta
 
-// optional .mesos.SlaveID slave_id = 1;
-inline bool TaskCurrent::has_slave_id() const {
+// required uint64 sequence = 1;
+inline bool StateDelta::has_sequence() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void TaskCurrent::set_has_slave_id() {
+inline void StateDelta::set_has_sequence() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void TaskCurrent::clear_has_slave_id() {
+inline void StateDelta::clear_has_sequence() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void TaskCurrent::clear_slave_id() {
-  if (slave_id_ != NULL) slave_id_->::mesos::SlaveID::Clear();
-  clear_has_slave_id();
-}
-inline const ::mesos::SlaveID& TaskCurrent::slave_id() const {
-  return slave_id_ != NULL ? *slave_id_ : *default_instance_->slave_id_;
-}
-inline ::mesos::SlaveID* TaskCurrent::mutable_slave_id() {
-  set_has_slave_id();
-  if (slave_id_ == NULL) slave_id_ = new ::mesos::SlaveID;
-  return slave_id_;
+inline void StateDelta::clear_sequence() {
+  sequence_ = GOOGLE_ULONGLONG(0);
+  clear_has_sequence();
 }
-inline ::mesos::SlaveID* TaskCurrent::release_slave_id() {
-  clear_has_slave_id();
-  ::mesos::SlaveID* temp = slave_id_;
-  slave_id_ = NULL;
-  return temp;
+inline ::google::protobuf::uint64 StateDelta::sequence() const {
+  return sequence_;
 }
-inline void TaskCurrent::set_allocated_slave_id(::mesos::SlaveID* slave_id) {
-  delete slave_id_;
-  slave_id_ = slave_id;
-  if (slave_id) {
-    set_has_slave_id();
-  } else {
-    clear_has_slave_id();
-  }
+inline void StateDelta::set_sequence(::google::protobuf::uint64 value) {
+  set_has_sequence();
+  sequence_ = value;
 }
 
-// optional .mesos.OfferID offer_id = 2;
-inline bool TaskCurrent::has_offer_id() const {
+// optional .mesos.FrameworkID framework_id = 2;
+inline bool StateDelta::has_framework_id() const {
   return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void TaskCurrent::set_has_offer_id() {
+inline void StateDelta::set_has_framework_id() {
   _has_bits_[0] |= 0x00000002u;
 }
-inline void TaskCurrent::clear_has_offer_id() {
+inline void StateDelta::clear_has_framework_id() {
   _has_bits_[0] &= ~0x00000002u;
 }
-inline void TaskCurrent::clear_offer_id() {
-  if (offer_id_ != NULL) offer_id_->::mesos::OfferID::Clear();
-  clear_has_offer_id();
+inline void StateDelta::clear_framework_id() {
+  if (framework_id_ != NULL) framework_id_->::mesos::FrameworkID::Clear();
+  clear_has_framework_id();
 }
-inline const ::mesos::OfferID& TaskCurrent::offer_id() const {
-  return offer_id_ != NULL ? *offer_id_ : *default_instance_->offer_id_;
+inline const ::mesos::FrameworkID& StateDelta::framework_id() const {
+  return framework_id_ != NULL ? *framework_id_ : *default_instance_->framework_id_;
 }
-inline ::mesos::OfferID* TaskCurrent::mutable_offer_id() {
-  set_has_offer_id();
-  if (offer_id_ == NULL) offer_id_ = new ::mesos::OfferID;
-  return offer_id_;
+inline ::mesos::FrameworkID* StateDelta::mutable_framework_id() {
+  set_has_framework_id();
+  if (framework_id_ == NULL) framework_id_ = new ::mesos::FrameworkID;
+  return framework_id_;
 }
-inline ::mesos::OfferID* TaskCurrent::release_offer_id() {
-  clear_has_offer_id();
-  ::mesos::OfferID* temp = offer_id_;
-  offer_id_ = NULL;
+inline ::mesos::FrameworkID* StateDelta::release_framework_id() {
+  clear_has_framework_id();
+  ::mesos::FrameworkID* temp = framework_id_;
+  framework_id_ = NULL;
   return temp;
 }
-inline void TaskCurrent::set_allocated_offer_id(::mesos::OfferID* offer_id) {
-  delete offer_id_;
-  offer_id_ = offer_id;
-  if (offer_id) {
-    set_has_offer_id();
+inline void StateDelta::set_allocated_framework_id(::mesos::FrameworkID* framework_id) {
+  delete framework_id_;
+  framework_id_ = framework_id;
+  if (framework_id) {
+    set_has_framework_id();
   } else {
-    clear_has_offer_id();
+    clear_has_framework_id();
   }
 }
 
-// repeated .mesos.Resource resources = 3;
-inline int TaskCurrent::resources_size() const {
-  return resources_.size();
-}
-inline void TaskCurrent::clear_resources() {
-  resources_.Clear();
-}
-inline const ::mesos::Resource& TaskCurrent::resources(int index) const {
-  return resources_.Get(index);
-}
-inline ::mesos::Resource* TaskCurrent::mutable_resources(int index) {
-  return resources_.Mutable(index);
-}
-inline ::mesos::Resource* TaskCurrent::add_resources() {
-  return resources_.Add();
-}
-inline const ::google::protobuf::RepeatedPtrField< ::mesos::Resource >&
-TaskCurrent::resources() const {
-  return resources_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::mesos::Resource >*
-TaskCurrent::mutable_resources() {
-  return &resources_;
-}
-
-// repeated uint32 ports = 4;
-inline int TaskCurrent::ports_size() const {
-  return ports_.size();
-}
-inline void TaskCurrent::clear_ports() {
-  ports_.Clear();
-}
-inline ::google::protobuf::uint32 TaskCurrent::ports(int index) const {
-  return ports_.Get(index);
-}
-inline void TaskCurrent::set_ports(int index, ::google::protobuf::uint32 value) {
-  ports_.Set(index, value);
-}
-inline void TaskCurrent::add_ports(::google::protobuf::uint32 value) {
-  ports_.Add(value);
-}
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-TaskCurrent::ports() const {
-  return ports_;
-}
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-TaskCurrent::mutable_ports() {
-  return &ports_;
-}
-
-// optional string hostname = 5;
-inline bool TaskCurrent::has_hostname() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void TaskCurrent::set_has_hostname() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void TaskCurrent::clear_has_hostname() {
-  _has_bits_[0] &= ~0x00000010u;
+// optional .arangodb.Targets targets = 3;
+inline bool StateDelta::has_targets() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void TaskCurrent::clear_hostname() {
-  if (hostname_ != &::google::protobuf::internal::kEmptyString) {
-    hostname_->clear();
-  }
-  clear_has_hostname();
+inline void StateDelta::set_has_targets() {
+  _has_bits_[0] |= 0x00000004u;
 }
-inline const ::std::string& TaskCurrent::hostname() const {
-  return *hostname_;
+inline void StateDelta::clear_has_targets() {
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline void TaskCurrent::set_hostname(const ::std::string& value) {
-  set_has_hostname();
-  if (hostname_ == &::google::protobuf::internal::kEmptyString) {
-    hostname_ = new ::std::string;
-  }
-  hostname_->assign(value);
+inline void StateDelta::clear_targets() {
+  if (targets_ != NULL) targets_->::arangodb::Targets::Clear();
+  clear_has_targets();
 }
-inline void TaskCurrent::set_hostname(const char* value) {
-  set_has_hostname();
-  if (hostname_ == &::google::protobuf::internal::kEmptyString) {
-    hostname_ = new ::std::string;
-  }
-  hostname_->assign(value);
+inline const ::arangodb::Targets& StateDelta::targets() const {
+  return targets_ != NULL ? *targets_ : *default_instance_->targets_;
 }
-inline void TaskCurrent::set_hostname(const char* value, size_t size) {
-  set_has_hostname();
-  if (hostname_ == &::google::protobuf::internal::kEmptyString) {
-    hostname_ = new ::std::string;
-  }
-  hostname_->assign(reinterpret_cast<const char*>(value), size);
+inline ::arangodb::Targets* StateDelta::mutable_targets() {
+  set_has_targets();
+  if (targets_ == NULL) targets_ = new ::arangodb::Targets;
+  return targets_;
 }
-inline ::std::string* TaskCurrent::mutable_hostname() {
-  set_has_hostname();
-  if (hostname_ == &::google::protobuf::internal::kEmptyString) {
-    hostname_ = new ::std::string;
-  }
-  return hostname_;
+inline ::arangodb::Targets* StateDelta::release_targets() {
+  clear_has_targets();
+  ::arangodb::Targets* temp = targets_;
+  targets_ = NULL;
+  return temp;
 }
-inline ::std::string* TaskCurrent::release_hostname() {
-  clear_has_hostname();
-  if (hostname_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void StateDelta::set_allocated_targets(::arangodb::Targets* targets) {
+  delete targets_;
+  targets_ = targets;
+  if (targets) {
+    set_has_targets();
   } else {
-    ::std::string* temp = hostname_;
-    hostname_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    clear_has_targets();
   }
 }
-inline void TaskCurrent::set_allocated_hostname(::std::string* hostname) {
-  if (hostname_ != &::google::protobuf::internal::kEmptyString) {
-    delete hostname_;
-  }
-  if (hostname) {
-    set_has_hostname();
-    hostname_ = hostname;
-  } else {
-    clear_has_hostname();
-    hostname_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+
+// repeated .arangodb.TaskDelta tasks = 4;
+inline int StateDelta::tasks_size() const {
+  return tasks_.size();
+}
+inline void StateDelta::clear_tasks() {
+  tasks_.Clear();
+}
+inline const ::arangodb::TaskDelta& StateDelta::tasks(int index) const {
+  return tasks_.Get(index);
+}
+inline ::arangodb::TaskDelta* StateDelta::mutable_tasks(int index) {
+  return tasks_.Mutable(index);
+}
+inline ::arangodb::TaskDelta* StateDelta::add_tasks() {
+  return tasks_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::arangodb::TaskDelta >&
+StateDelta::tasks() const {
+  return tasks_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::arangodb::TaskDelta >*
+StateDelta::mutable_tasks() {
+  return &tasks_;
 }
 
-// optional string container_path = 6;
-inline bool TaskCurrent::has_container_path() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+// repeated uint32 plan_sizes = 5;
+inline int StateDelta::plan_sizes_size() const {
+  return plan_sizes_.size();
 }
-inline void TaskCurrent::set_has_container_path() {
-  _has_bits_[0] |= 0x00000020u;
+inline void StateDelta::clear_plan_sizes() {
+  plan_sizes_.Clear();
 }
-inline void TaskCurrent::clear_has_container_path() {
-  _has_bits_[0] &= ~0x00000020u;
+inline ::google::protobuf::uint32 StateDelta::plan_sizes(int index) const {
+  return plan_sizes_.Get(index);
 }
-inline void TaskCurrent::clear_container_path() {
-  if (container_path_ != &::google::protobuf::internal::kEmptyString) {
-    container_path_->clear();
-  }
-  clear_has_container_path();
+inline void StateDelta::set_plan_sizes(int index, ::google::protobuf::uint32 value) {
+  plan_sizes_.Set(index, value);
 }
-inline const ::std::string& TaskCurrent::container_path() const {
-  return *container_path_;
+inline void StateDelta::add_plan_sizes(::google::protobuf::uint32 value) {
+  plan_sizes_.Add(value);
 }
-inline void TaskCurrent::set_container_path(const ::std::string& value) {
-  set_has_container_path();
-  if (container_path_ == &::google::protobuf::internal::kEmptyString) {
-    container_path_ = new ::std::string;
-  }
-  container_path_->assign(value);
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+StateDelta::plan_sizes() const {
+  return plan_sizes_;
 }
-inline void TaskCurrent::set_container_path(const char* value) {
-  set_has_container_path();
-  if (container_path_ == &::google::protobuf::internal::kEmptyString) {
-    container_path_ = new ::std::string;
-  }
-  container_path_->assign(value);
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+StateDelta::mutable_plan_sizes() {
+  return &plan_sizes_;
 }
-inline void TaskCurrent::set_container_path(const char* value, size_t size) {
-  set_has_container_path();
-  if (container_path_ == &::google::protobuf::internal::kEmptyString) {
-    container_path_ = new ::std::string;
-  }
-  container_path_->assign(reinterpret_cast<const char*>(value), size);
+
+// repeated uint32 current_sizes = 6;
+inline int StateDelta::current_sizes_size() const {
+  return current_sizes_.size();
 }
-inline ::std::string* TaskCurrent::mutable_container_path() {
-  set_has_container_path();
-  if (container_path_ == &::google::protobuf::internal::kEmptyString) {
-    container_path_ = new ::std::string;
-  }
-  return container_path_;
+inline void StateDelta::clear_current_sizes() {
+  current_sizes_.Clear();
 }
-inline ::std::string* TaskCurrent::release_container_path() {
-  clear_has_container_path();
-  if (container_path_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = container_path_;
-    container_path_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline ::google::protobuf::uint32 StateDelta::current_sizes(int index) const {
+  return current_sizes_.Get(index);
 }
-inline void TaskCurrent::set_allocated_container_path(::std::string* container_path) {
-  if (container_path_ != &::google::protobuf::internal::kEmptyString) {
-    delete container_path_;
-  }
-  if (container_path) {
-    set_has_container_path();
-    container_path_ = container_path;
-  } else {
-    clear_has_container_path();
-    container_path_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline void StateDelta::set_current_sizes(int index, ::google::protobuf::uint32 value) {
+  current_sizes_.Set(index, value);
+}
+inline void StateDelta::add_current_sizes(::google::protobuf::uint32 value) {
+  current_sizes_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+StateDelta::current_sizes() const {
+  return current_sizes_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+StateDelta::mutable_current_sizes() {
+  return &current_sizes_;
 }
 
-// optional .mesos.TaskInfo task_info = 7;
-inline bool TaskCurrent::has_task_info() const {
+// optional .arangodb.Restart restart = 7;
+inline bool StateDelta::has_restart() const {
   return (_has_bits_[0] & 0x00000040u) != 0;
 }
-inline void TaskCurrent::set_has_task_info() {
+inline void StateDelta::set_has_restart() {
   _has_bits_[0] |= 0x00000040u;
 }
-inline void TaskCurrent::clear_has_task_info() {
+inline void StateDelta::clear_has_restart() {
   _has_bits_[0] &= ~0x00000040u;
 }
-inline void TaskCurrent::clear_task_info() {
-  if (task_info_ != NULL) task_info_->::mesos::TaskInfo::Clear();
-  clear_has_task_info();
+inline void StateDelta::clear_restart() {
+  if (restart_ != NULL) restart_->::arangodb::Restart::Clear();
+  clear_has_restart();
 }
-inline const ::mesos::TaskInfo& TaskCurrent::task_info() const {
-  return task_info_ != NULL ? *task_info_ : *default_instance_->task_info_;
+inline const ::arangodb::Restart& StateDelta::restart() const {
+  return restart_ != NULL ? *restart_ : *default_instance_->restart_;
 }
-inline ::mesos::TaskInfo* TaskCurrent::mutable_task_info() {
-  set_has_task_info();
-  if (task_info_ == NULL) task_info_ = new ::mesos::TaskInfo;
-  return task_info_;
+inline ::arangodb::Restart* StateDelta::mutable_restart() {
+  set_has_restart();
+  if (restart_ == NULL) restart_ = new ::arangodb::Restart;
+  return restart_;
 }
-inline ::mesos::TaskInfo* TaskCurrent::release_task_info() {
-  clear_has_task_info();
-  ::mesos::TaskInfo* temp = task_info_;
-  task_info_ = NULL;
+inline ::arangodb::Restart* StateDelta::release_restart() {
+  clear_has_restart();
+  ::arangodb::Restart* temp = restart_;
+  restart_ = NULL;
   return temp;
 }
-inline void TaskCurrent::set_allocated_task_info(::mesos::TaskInfo* task_info) {
-  delete task_info_;
-  task_info_ = task_info;
-  if (task_info) {
-    set_has_task_info();
+inline void StateDelta::set_allocated_restart(::arangodb::Restart* restart) {
+  delete restart_;
+  restart_ = restart;
+  if (restart) {
+    set_has_restart();
   } else {
-    clear_has_task_info();
+    clear_has_restart();
   }
 }
 
-// optional double start_time = 8;
-inline bool TaskCurrent::has_start_time() const {
+// optional bool clear_restart = 8;
+inline bool StateDelta::has_clear_restart() const {
   return (_has_bits_[0] & 0x00000080u) != 0;
 }
-inline void TaskCurrent::set_has_start_time() {
+inline void StateDelta::set_has_clear_restart() {
   _has_bits_[0] |= 0x00000080u;
 }
-inline void TaskCurrent::clear_has_start_time() {
+inline void StateDelta::clear_has_clear_restart() {
   _has_bits_[0] &= ~0x00000080u;
 }
-inline void TaskCurrent::clear_start_time() {
-  start_time_ = 0;
-  clear_has_start_time();
+inline void StateDelta::clear_clear_restart() {
+  clear_restart_ = false;
+  clear_has_clear_restart();
 }
-inline double TaskCurrent::start_time() const {
-  return start_time_;
+inline bool StateDelta::clear_restart() const {
+  return clear_restart_;
 }
-inline void TaskCurrent::set_start_time(double value) {
-  set_has_start_time();
-  start_time_ = value;
+inline void StateDelta::set_clear_restart(bool value) {
+  set_has_clear_restart();
+  clear_restart_ = value;
 }
 
-// optional double kill_time = 9;
-inline bool TaskCurrent::has_kill_time() const {
+// optional bool cluster_complete = 9;
+inline bool StateDelta::has_cluster_complete() const {
   return (_has_bits_[0] & 0x00000100u) != 0;
 }
-inline void TaskCurrent::set_has_kill_time() {
+inline void StateDelta::set_has_cluster_complete() {
   _has_bits_[0] |= 0x00000100u;
 }
-inline void TaskCurrent::clear_has_kill_time() {
+inline void StateDelta::clear_has_cluster_complete() {
   _has_bits_[0] &= ~0x00000100u;
 }
-inline void TaskCurrent::clear_kill_time() {
-  kill_time_ = 0;
-  clear_has_kill_time();
+inline void StateDelta::clear_cluster_complete() {
+  cluster_complete_ = false;
+  clear_has_cluster_complete();
 }
-inline double TaskCurrent::kill_time() const {
-  return kill_time_;
+inline bool StateDelta::cluster_complete() const {
+  return cluster_complete_;
 }
-inline void TaskCurrent::set_kill_time(double value) {
-  set_has_kill_time();
-  kill_time_ = value;
+inline void StateDelta::set_cluster_complete(bool value) {
+  set_has_cluster_complete();
+  cluster_complete_ = value;
 }
 
-// -------------------------------------------------------------------
-
-// TasksCurrent
-
-// repeated .arangodb.TaskCurrent entries = 1;
-inline int TasksCurrent::entries_size() const {
-  return entries_.size();
+// optional .arangodb.Failovers failovers = 10;
+inline bool StateDelta::has_failovers() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
 }
-inline void TasksCurrent::clear_entries() {
-  entries_.Clear();
+inline void StateDelta::set_has_failovers() {
+  _has_bits_[0] |= 0x00000200u;
 }
-inline const ::arangodb::TaskCurrent& TasksCurrent::entries(int index) const {
-  return entries_.Get(index);
+inline void StateDelta::clear_has_failovers() {
+  _has_bits_[0] &= ~0x00000200u;
 }
-inline ::arangodb::TaskCurrent* TasksCurrent::mutable_entries(int index) {
-  return entries_.Mutable(index);
+inline void StateDelta::clear_failovers() {
+  if (failovers_ != NULL) failovers_->::arangodb::Failovers::Clear();
+  clear_has_failovers();
 }
-inline ::arangodb::TaskCurrent* TasksCurrent::add_entries() {
-  return entries_.Add();
+inline const ::arangodb::Failovers& StateDelta::failovers() const {
+  return failovers_ != NULL ? *failovers_ : *default_instance_->failovers_;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::arangodb::TaskCurrent >&
-TasksCurrent::entries() const {
-  return entries_;
+inline ::arangodb::Failovers* StateDelta::mutable_failovers() {
+  set_has_failovers();
+  if (failovers_ == NULL) failovers_ = new ::arangodb::Failovers;
+  return failovers_;
 }
-inline ::google::protobuf::RepeatedPtrField< ::arangodb::TaskCurrent >*
-TasksCurrent::mutable_entries() {
-  return &entries_;
+inline ::arangodb::Failovers* StateDelta::release_failovers() {
+  clear_has_failovers();
+  ::arangodb::Failovers* temp = failovers_;
+  failovers_ = NULL;
+  return temp;
+}
+inline void StateDelta::set_allocated_failovers(::arangodb::Failovers* failovers) {
+  delete failovers_;
+  failovers_ = failovers;
+  if (failovers) {
+    set_has_failovers();
+  } else {
+    clear_has_failovers();
+  }
 }
 
 // -------------------------------------------------------------------
 
-// Current
+// StateShard
 
-// required .arangodb.TasksCurrent agents = 1;
-inline bool Current::has_agents() const {
+// required string key = 1;
+inline bool StateShard::has_key() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void Current::set_has_agents() {
+inline void StateShard::set_has_key() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void Current::clear_has_agents() {
+inline void StateShard::clear_has_key() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void Current::clear_agents() {
-  if (agents_ != NULL) agents_->::arangodb::TasksCurrent::Clear();
-  clear_has_agents();
-}
-inline const ::arangodb::TasksCurrent& Current::agents() const {
-  return agents_ != NULL ? *agents_ : *default_instance_->agents_;
-}
-inline ::arangodb::TasksCurrent* Current::mutable_agents() {
-  set_has_agents();
-  if (agents_ == NULL) agents_ = new ::arangodb::TasksCurrent;
-  return agents_;
-}
-inline ::arangodb::TasksCurrent* Current::release_agents() {
-  clear_has_agents();
-  ::arangodb::TasksCurrent* temp = agents_;
-  agents_ = NULL;
-  return temp;
-}
-inline void Current::set_allocated_agents(::arangodb::TasksCurrent* agents) {
-  delete agents_;
-  agents_ = agents;
-  if (agents) {
-    set_has_agents();
-  } else {
-    clear_has_agents();
+inline void StateShard::clear_key() {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    key_->clear();
   }
+  clear_has_key();
 }
-
-// required .arangodb.TasksCurrent coordinators = 2;
-inline bool Current::has_coordinators() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void Current::set_has_coordinators() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Current::clear_has_coordinators() {
-  _has_bits_[0] &= ~0x00000002u;
+inline const ::std::string& StateShard::key() const {
+  return *key_;
 }
-inline void Current::clear_coordinators() {
-  if (coordinators_ != NULL) coordinators_->::arangodb::TasksCurrent::Clear();
-  clear_has_coordinators();
+inline void StateShard::set_key(const ::std::string& value) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(value);
 }
-inline const ::arangodb::TasksCurrent& Current::coordinators() const {
-  return coordinators_ != NULL ? *coordinators_ : *default_instance_->coordinators_;
+inline void StateShard::set_key(const char* value) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(value);
 }
-inline ::arangodb::TasksCurrent* Current::mutable_coordinators() {
-  set_has_coordinators();
-  if (coordinators_ == NULL) coordinators_ = new ::arangodb::TasksCurrent;
-  return coordinators_;
+inline void StateShard::set_key(const char* value, size_t size) {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  key_->assign(reinterpret_cast<const char*>(value), size);
 }
-inline ::arangodb::TasksCurrent* Current::release_coordinators() {
-  clear_has_coordinators();
-  ::arangodb::TasksCurrent* temp = coordinators_;
-  coordinators_ = NULL;
-  return temp;
+inline ::std::string* StateShard::mutable_key() {
+  set_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    key_ = new ::std::string;
+  }
+  return key_;
 }
-inline void Current::set_allocated_coordinators(::arangodb::TasksCurrent* coordinators) {
-  delete coordinators_;
-  coordinators_ = coordinators;
-  if (coordinators) {
-    set_has_coordinators();
+inline ::std::string* StateShard::release_key() {
+  clear_has_key();
+  if (key_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = key_;
+    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void StateShard::set_allocated_key(::std::string* key) {
+  if (key_ != &::google::protobuf::internal::kEmptyString) {
+    delete key_;
+  }
+  if (key) {
+    set_has_key();
+    key_ = key;
   } else {
-    clear_has_coordinators();
+    clear_has_key();
+    key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   }
 }
 
-// required .arangodb.TasksCurrent dbservers = 3;
-inline bool Current::has_dbservers() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// required string variable = 2;
+inline bool StateShard::has_variable() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
 }
-inline void Current::set_has_dbservers() {
-  _has_bits_[0] |= 0x00000004u;
+inline void StateShard::set_has_variable() {
+  _has_bits_[0] |= 0x00000002u;
 }
-inline void Current::clear_has_dbservers() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void StateShard::clear_has_variable() {
+  _has_bits_[0] &= ~0x00000002u;
 }
-inline void Current::clear_dbservers() {
-  if (dbservers_ != NULL) dbservers_->::arangodb::TasksCurrent::Clear();
-  clear_has_dbservers();
+inline void StateShard::clear_variable() {
+  if (variable_ != &::google::protobuf::internal::kEmptyString) {
+    variable_->clear();
+  }
+  clear_has_variable();
 }
-inline const ::arangodb::TasksCurrent& Current::dbservers() const {
-  return dbservers_ != NULL ? *dbservers_ : *default_instance_->dbservers_;
+inline const ::std::string& StateShard::variable() const {
+  return *variable_;
 }
-inline ::arangodb::TasksCurrent* Current::mutable_dbservers() {
-  set_has_dbservers();
-  if (dbservers_ == NULL) dbservers_ = new ::arangodb::TasksCurrent;
-  return dbservers_;
+inline void StateShard::set_variable(const ::std::string& value) {
+  set_has_variable();
+  if (variable_ == &::google::protobuf::internal::kEmptyString) {
+    variable_ = new ::std::string;
+  }
+  variable_->assign(value);
 }
-inline ::arangodb::TasksCurrent* Current::release_dbservers() {
-  clear_has_dbservers();
-  ::arangodb::TasksCurrent* temp = dbservers_;
-  dbservers_ = NULL;
-  return temp;
+inline void StateShard::set_variable(const char* value) {
+  set_has_variable();
+  if (variable_ == &::google::protobuf::internal::kEmptyString) {
+    variable_ = new ::std::string;
+  }
+  variable_->assign(value);
 }
-inline void Current::set_allocated_dbservers(::arangodb::TasksCurrent* dbservers) {
-  delete dbservers_;
-  dbservers_ = dbservers;
-  if (dbservers) {
-    set_has_dbservers();
-  } else {
-    clear_has_dbservers();
+inline void StateShard::set_variable(const char* value, size_t size) {
+  set_has_variable();
+  if (variable_ == &::google::protobuf::internal::kEmptyString) {
+    variable_ = new ::std::string;
   }
+  variable_->assign(reinterpret_cast<const char*>(value), size);
 }
-
-// required .arangodb.TasksCurrent secondaries = 4;
-inline bool Current::has_secondaries() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline ::std::string* StateShard::mutable_variable() {
+  set_has_variable();
+  if (variable_ == &::google::protobuf::internal::kEmptyString) {
+    variable_ = new ::std::string;
+  }
+  return variable_;
 }
-inline void Current::set_has_secondaries() {
-  _has_bits_[0] |= 0x00000008u;
+inline ::std::string* StateShard::release_variable() {
+  clear_has_variable();
+  if (variable_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = variable_;
+    variable_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
 }
-inline void Current::clear_has_secondaries() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void StateShard::set_allocated_variable(::std::string* variable) {
+  if (variable_ != &::google::protobuf::internal::kEmptyString) {
+    delete variable_;
+  }
+  if (variable) {
+    set_has_variable();
+    variable_ = variable;
+  } else {
+    clear_has_variable();
+    variable_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
 }
-inline void Current::clear_secondaries() {
-  if (secondaries_ != NULL) secondaries_->::arangodb::TasksCurrent::Clear();
-  clear_has_secondaries();
+
+// optional bool compressed = 3;
+inline bool StateShard::has_compressed() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline const ::arangodb::TasksCurrent& Current::secondaries() const {
-  return secondaries_ != NULL ? *secondaries_ : *default_instance_->secondaries_;
+inline void StateShard::set_has_compressed() {
+  _has_bits_[0] |= 0x00000004u;
 }
-inline ::arangodb::TasksCurrent* Current::mutable_secondaries() {
-  set_has_secondaries();
-  if (secondaries_ == NULL) secondaries_ = new ::arangodb::TasksCurrent;
-  return secondaries_;
+inline void StateShard::clear_has_compressed() {
+  _has_bits_[0] &= ~0x00000004u;
 }
-inline ::arangodb::TasksCurrent* Current::release_secondaries() {
-  clear_has_secondaries();
-  ::arangodb::TasksCurrent* temp = secondaries_;
-  secondaries_ = NULL;
-  return temp;
+inline void StateShard::clear_compressed() {
+  compressed_ = false;
+  clear_has_compressed();
 }
-inline void Current::set_allocated_secondaries(::arangodb::TasksCurrent* secondaries) {
-  delete secondaries_;
-  secondaries_ = secondaries;
-  if (secondaries) {
-    set_has_secondaries();
-  } else {
-    clear_has_secondaries();
-  }
+inline bool StateShard::compressed() const {
+  return compressed_;
+}
+inline void StateShard::set_compressed(bool value) {
+  set_has_compressed();
+  compressed_ = value;
 }
 
-// required bool cluster_complete = 5;
-inline bool Current::has_cluster_complete() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// optional uint64 size = 4;
+inline bool StateShard::has_size() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline void Current::set_has_cluster_complete() {
-  _has_bits_[0] |= 0x00000010u;
+inline void StateShard::set_has_size() {
+  _has_bits_[0] |= 0x00000008u;
 }
-inline void Current::clear_has_cluster_complete() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void StateShard::clear_has_size() {
+  _has_bits_[0] &= ~0x00000008u;
 }
-inline void Current::clear_cluster_complete() {
-  cluster_complete_ = false;
-  clear_has_cluster_complete();
+inline void StateShard::clear_size() {
+  size_ = GOOGLE_ULONGLONG(0);
+  clear_has_size();
 }
-inline bool Current::cluster_complete() const {
-  return cluster_complete_;
+inline ::google::protobuf::uint64 StateShard::size() const {
+  return size_;
 }
-inline void Current::set_cluster_complete(bool value) {
-  set_has_cluster_complete();
-  cluster_complete_ = value;
+inline void StateShard::set_size(::google::protobuf::uint64 value) {
+  set_has_size();
+  size_ = value;
 }
 
 // -------------------------------------------------------------------
 
-// State
+// StateManifest
 
-// optional .mesos.FrameworkID framework_id = 1;
-inline bool State::has_framework_id() const {
+// required uint64 generation = 1;
+inline bool StateManifest::has_generation() const {
   return (_has_bits_[0] & 0x00000001u) != 0;
 }
-inline void State::set_has_framework_id() {
+inline void StateManifest::set_has_generation() {
   _has_bits_[0] |= 0x00000001u;
 }
-inline void State::clear_has_framework_id() {
+inline void StateManifest::clear_has_generation() {
   _has_bits_[0] &= ~0x00000001u;
 }
-inline void State::clear_framework_id() {
+inline void StateManifest::clear_generation() {
+  generation_ = GOOGLE_ULONGLONG(0);
+  clear_has_generation();
+}
+inline ::google::protobuf::uint64 StateManifest::generation() const {
+  return generation_;
+}
+inline void StateManifest::set_generation(::google::protobuf::uint64 value) {
+  set_has_generation();
+  generation_ = value;
+}
+
+// optional .mesos.FrameworkID framework_id = 2;
+inline bool StateManifest::has_framework_id() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void StateManifest::set_has_framework_id() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void StateManifest::clear_has_framework_id() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void StateManifest::clear_framework_id() {
   if (framework_id_ != NULL) framework_id_->::mesos::FrameworkID::Clear();
   clear_has_framework_id();
 }
-inline const ::mesos::FrameworkID& State::framework_id() const {
+inline const ::mesos::FrameworkID& StateManifest::framework_id() const {
   return framework_id_ != NULL ? *framework_id_ : *default_instance_->framework_id_;
 }
-inline ::mesos::FrameworkID* State::mutable_framework_id() {
+inline ::mesos::FrameworkID* StateManifest::mutable_framework_id() {
   set_has_framework_id();
   if (framework_id_ == NULL) framework_id_ = new ::mesos::FrameworkID;
   return framework_id_;
 }
-inline ::mesos::FrameworkID* State::release_framework_id() {
+inline ::mesos::FrameworkID* StateManifest::release_framework_id() {
   clear_has_framework_id();
   ::mesos::FrameworkID* temp = framework_id_;
   framework_id_ = NULL;
   return temp;
 }
-inline void State::set_allocated_framework_id(::mesos::FrameworkID* framework_id) {
+inline void StateManifest::set_allocated_framework_id(::mesos::FrameworkID* framework_id) {
   delete framework_id_;
   framework_id_ = framework_id;
   if (framework_id) {
@@ -3143,156 +5544,95 @@ inline void State::set_allocated_framework_id(::mesos::FrameworkID* framework_id
   }
 }
 
-// required .arangodb.Targets targets = 2;
-inline bool State::has_targets() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void State::set_has_targets() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void State::clear_has_targets() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void State::clear_targets() {
-  if (targets_ != NULL) targets_->::arangodb::Targets::Clear();
-  clear_has_targets();
-}
-inline const ::arangodb::Targets& State::targets() const {
-  return targets_ != NULL ? *targets_ : *default_instance_->targets_;
-}
-inline ::arangodb::Targets* State::mutable_targets() {
-  set_has_targets();
-  if (targets_ == NULL) targets_ = new ::arangodb::Targets;
-  return targets_;
-}
-inline ::arangodb::Targets* State::release_targets() {
-  clear_has_targets();
-  ::arangodb::Targets* temp = targets_;
-  targets_ = NULL;
-  return temp;
-}
-inline void State::set_allocated_targets(::arangodb::Targets* targets) {
-  delete targets_;
-  targets_ = targets;
-  if (targets) {
-    set_has_targets();
-  } else {
-    clear_has_targets();
-  }
-}
-
-// required .arangodb.Plan plan = 3;
-inline bool State::has_plan() const {
+// optional bool cluster_complete = 3;
+inline bool StateManifest::has_cluster_complete() const {
   return (_has_bits_[0] & 0x00000004u) != 0;
 }
-inline void State::set_has_plan() {
+inline void StateManifest::set_has_cluster_complete() {
   _has_bits_[0] |= 0x00000004u;
 }
-inline void State::clear_has_plan() {
+inline void StateManifest::clear_has_cluster_complete() {
   _has_bits_[0] &= ~0x00000004u;
 }
-inline void State::clear_plan() {
-  if (plan_ != NULL) plan_->::arangodb::Plan::Clear();
-  clear_has_plan();
-}
-inline const ::arangodb::Plan& State::plan() const {
-  return plan_ != NULL ? *plan_ : *default_instance_->plan_;
-}
-inline ::arangodb::Plan* State::mutable_plan() {
-  set_has_plan();
-  if (plan_ == NULL) plan_ = new ::arangodb::Plan;
-  return plan_;
+inline void StateManifest::clear_cluster_complete() {
+  cluster_complete_ = false;
+  clear_has_cluster_complete();
 }
-inline ::arangodb::Plan* State::release_plan() {
-  clear_has_plan();
-  ::arangodb::Plan* temp = plan_;
-  plan_ = NULL;
-  return temp;
+inline bool StateManifest::cluster_complete() const {
+  return cluster_complete_;
 }
-inline void State::set_allocated_plan(::arangodb::Plan* plan) {
-  delete plan_;
-  plan_ = plan;
-  if (plan) {
-    set_has_plan();
-  } else {
-    clear_has_plan();
-  }
+inline void StateManifest::set_cluster_complete(bool value) {
+  set_has_cluster_complete();
+  cluster_complete_ = value;
 }
 
-// required .arangodb.Current current = 4;
-inline bool State::has_current() const {
+// optional uint64 journal_sequence = 4;
+inline bool StateManifest::has_journal_sequence() const {
   return (_has_bits_[0] & 0x00000008u) != 0;
 }
-inline void State::set_has_current() {
+inline void StateManifest::set_has_journal_sequence() {
   _has_bits_[0] |= 0x00000008u;
 }
-inline void State::clear_has_current() {
+inline void StateManifest::clear_has_journal_sequence() {
   _has_bits_[0] &= ~0x00000008u;
 }
-inline void State::clear_current() {
-  if (current_ != NULL) current_->::arangodb::Current::Clear();
-  clear_has_current();
+inline void StateManifest::clear_journal_sequence() {
+  journal_sequence_ = GOOGLE_ULONGLONG(0);
+  clear_has_journal_sequence();
 }
-inline const ::arangodb::Current& State::current() const {
-  return current_ != NULL ? *current_ : *default_instance_->current_;
+inline ::google::protobuf::uint64 StateManifest::journal_sequence() const {
+  return journal_sequence_;
 }
-inline ::arangodb::Current* State::mutable_current() {
-  set_has_current();
-  if (current_ == NULL) current_ = new ::arangodb::Current;
-  return current_;
+inline void StateManifest::set_journal_sequence(::google::protobuf::uint64 value) {
+  set_has_journal_sequence();
+  journal_sequence_ = value;
 }
-inline ::arangodb::Current* State::release_current() {
-  clear_has_current();
-  ::arangodb::Current* temp = current_;
-  current_ = NULL;
-  return temp;
+
+// repeated .arangodb.StateShard shards = 5;
+inline int StateManifest::shards_size() const {
+  return shards_.size();
 }
-inline void State::set_allocated_current(::arangodb::Current* current) {
-  delete current_;
-  current_ = current;
-  if (current) {
-    set_has_current();
-  } else {
-    clear_has_current();
-  }
+inline void StateManifest::clear_shards() {
+  shards_.Clear();
 }
-
-// optional .arangodb.Restart restart = 5;
-inline bool State::has_restart() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline const ::arangodb::StateShard& StateManifest::shards(int index) const {
+  return shards_.Get(index);
 }
-inline void State::set_has_restart() {
-  _has_bits_[0] |= 0x00000010u;
+inline ::arangodb::StateShard* StateManifest::mutable_shards(int index) {
+  return shards_.Mutable(index);
 }
-inline void State::clear_has_restart() {
-  _has_bits_[0] &= ~0x00000010u;
+inline ::arangodb::StateShard* StateManifest::add_shards() {
+  return shards_.Add();
 }
-inline void State::clear_restart() {
-  if (restart_ != NULL) restart_->::arangodb::Restart::Clear();
-  clear_has_restart();
+inline const ::google::protobuf::RepeatedPtrField< ::arangodb::StateShard >&
+StateManifest::shards() const {
+  return shards_;
 }
-inline const ::arangodb::Restart& State::restart() const {
-  return restart_ != NULL ? *restart_ : *default_instance_->restart_;
+inline ::google::protobuf::RepeatedPtrField< ::arangodb::StateShard >*
+StateManifest::mutable_shards() {
+  return &shards_;
 }
-inline ::arangodb::Restart* State::mutable_restart() {
-  set_has_restart();
-  if (restart_ == NULL) restart_ = new ::arangodb::Restart;
-  return restart_;
+
+// optional uint32 schema_version = 6;
+inline bool StateManifest::has_schema_version() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
 }
-inline ::arangodb::Restart* State::release_restart() {
-  clear_has_restart();
-  ::arangodb::Restart* temp = restart_;
-  restart_ = NULL;
-  return temp;
+inline void StateManifest::set_has_schema_version() {
+  _has_bits_[0] |= 0x00000020u;
 }
-inline void State::set_allocated_restart(::arangodb::Restart* restart) {
-  delete restart_;
-  restart_ = restart;
-  if (restart) {
-    set_has_restart();
-  } else {
-    clear_has_restart();
-  }
+inline void StateManifest::clear_has_schema_version() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void StateManifest::clear_schema_version() {
+  schema_version_ = 0u;
+  clear_has_schema_version();
+}
+inline ::google::protobuf::uint32 StateManifest::schema_version() const {
+  return schema_version_;
+}
+inline void StateManifest::set_schema_version(::google::protobuf::uint32 value) {
+  set_has_schema_version();
+  schema_version_ = value;
 }
 
 
@@ -3309,6 +5649,11 @@ inline const EnumDescriptor* GetEnumDescriptor< ::arangodb::TaskPlanState>() {
   return ::arangodb::TaskPlanState_descriptor();
 }
 
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::arangodb::FailoverState>() {
+  return ::arangodb::FailoverState_descriptor();
+}
+
 }  // namespace google
 }  // namespace protobuf
 #endif  // SWIG
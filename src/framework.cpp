@@ -29,6 +29,7 @@
 
 #include <csignal>
 #include <iostream>
+#include <memory>
 #include <stdlib.h>
 #include <string>
 #include <unistd.h>
@@ -39,7 +40,13 @@
 #include "CaretakerStandalone.h"
 #include "CaretakerCluster.h"
 #include "Global.h"
+#include "HealthProbes.h"
 #include "HttpServer.h"
+#include "LeaderElection.h"
+#include "ReverseProxy.h"
+#include "TaskTimeouts.h"
+
+#include <curl/curl.h>
 
 #include <stout/check.hpp>
 #include <stout/exit.hpp>
@@ -156,6 +163,22 @@ static void usage (const string& argv0, const flags::FlagsBase& flags) {
        << "  ARANGODB_ADDITIONAL_COORDINATOR_ARGS\n"
        << "                       overrides '--arangodb_additional_coordinator_args'\n"
        << "  ARANGODB_ZK          overrides '--zk'\n"
+       << "  ARANGODB_STATE_JOURNAL\n"
+       << "                       overrides '--state_journal'\n"
+       << "  ARANGODB_STATE_JOURNAL_MAX_DELTAS\n"
+       << "                       overrides '--state_journal_max_deltas'\n"
+       << "  ARANGODB_STATE_JOURNAL_MAX_BYTES\n"
+       << "                       overrides '--state_journal_max_bytes'\n"
+       << "  ARANGODB_STATE_PERSIST_DELAY\n"
+       << "                       overrides '--state_persist_delay'\n"
+       << "  ARANGODB_STATE_COMPRESSION\n"
+       << "                       overrides '--state_compression'\n"
+       << "  ARANGODB_STANDBY     overrides '--standby'\n"
+       << "  ARANGODB_STANDBY_SESSION_TIMEOUT\n"
+       << "                       overrides '--standby_session_timeout'\n"
+       << "  ARANGODB_PROXY       overrides '--proxy'\n"
+       << "  ARANGODB_SINGLE_OFFER_LAUNCH\n"
+       << "                       overrides '--single_offer_launch'\n"
        << "\n"
        << "  MESOS_MASTER         overrides '--master'\n"
        << "  MESOS_SECRET         secret for mesos authentication\n"
@@ -174,21 +197,6 @@ bool str2bool(const string in) {
   }
 }
 
-/* first, here is the code for the signal handler */
-void catch_child(int sig_num)
-{
-  pid_t pid;
-  /* when we get here, we know there's a zombie child waiting */
-  int child_status;
-
-  pid = waitpid(-1, &child_status, 0);
-  LOG(INFO) << "old haproxy(" << pid << ") exited with status " << child_status;
-  if (child_status != 0) {
-    LOG(INFO) << "Scheduling restart";
-    Global::state().setRestartProxy(RESTART_FRESH_START);
-  }
-}
-
 // -----------------------------------------------------------------------------
 // --SECTION--                                                  public functions
 // -----------------------------------------------------------------------------
@@ -199,6 +207,9 @@ void catch_child(int sig_num)
 
 int main (int argc, char** argv) {
 
+  // libcurl must be initialized once, before any thread is started
+  curl_global_init(CURL_GLOBAL_ALL);
+
   // ...........................................................................
   // command line options
   // ...........................................................................
@@ -320,6 +331,24 @@ int main (int argc, char** argv) {
             "number of offers we are accepting",
             10);
 
+  double offerRetention;
+  flags.add(&offerRetention,
+            "offer_retention",
+            "number of seconds to keep an offer we cannot use yet",
+            5);
+
+  string taskTimeouts;
+  flags.add(&taskTimeouts,
+            "task_timeouts",
+            "timeouts of the task states, like 'start=900,coordinator.killed=30'",
+            "");
+
+  string singleOfferLaunch;
+  flags.add(&singleOfferLaunch,
+            "single_offer_launch",
+            "reserve, create the volume and launch a persistent task with one offer",
+            "true");
+
   string resetState;
   flags.add(&resetState,
             "reset_state",
@@ -429,6 +458,54 @@ int main (int argc, char** argv) {
             "zookeeper for state",
             "");
 
+  string stateJournal;
+  flags.add(&stateJournal,
+            "state_journal",
+            "persist state changes as deltas and write snapshots only from time to time",
+            "false");
+
+  int stateJournalMaxDeltas;
+  flags.add(&stateJournalMaxDeltas,
+            "state_journal_max_deltas",
+            "number of journaled deltas after which a snapshot is written",
+            100);
+
+  int stateJournalMaxBytes;
+  flags.add(&stateJournalMaxBytes,
+            "state_journal_max_bytes",
+            "size of journaled deltas in bytes after which a snapshot is written",
+            1024 * 1024);
+
+  int statePersistDelay;
+  flags.add(&statePersistDelay,
+            "state_persist_delay",
+            "milliseconds to collect further state changes before persisting them",
+            100);
+
+  string stateCompression;
+  flags.add(&stateCompression,
+            "state_compression",
+            "compress the parts of the state with gzip before storing them",
+            "false");
+
+  string standby;
+  flags.add(&standby,
+            "standby",
+            "elect the active instance in zookeeper, all others follow the state",
+            "false");
+
+  double standbySessionTimeout;
+  flags.add(&standbySessionTimeout,
+            "standby_session_timeout",
+            "zookeeper session timeout in seconds for the leader election",
+            10.0);
+
+  string proxy;
+  flags.add(&proxy,
+            "proxy",
+            "reverse proxy in front of the coordinators: haproxy or embedded",
+            "haproxy");
+
   Try<Nothing> load = flags.load(None(), argc, argv);
 
   if (load.isError()) {
@@ -476,6 +553,9 @@ int main (int argc, char** argv) {
   updateFromEnv("ARANGODB_FAILOVER_TIMEOUT", failoverTimeout);
   updateFromEnv("ARANGODB_DECLINE_OFFER_REFUSE_SECONDS", declineOfferRefuseSeconds);
   updateFromEnv("ARANGODB_OFFER_LIMIT", offerLimit);
+  updateFromEnv("ARANGODB_OFFER_RETENTION", offerRetention);
+  updateFromEnv("ARANGODB_TASK_TIMEOUTS", taskTimeouts);
+  updateFromEnv("ARANGODB_SINGLE_OFFER_LAUNCH", singleOfferLaunch);
   updateFromEnv("ARANGODB_RESET_STATE", resetState);
   updateFromEnv("ARANGODB_SECONDARIES_WITH_DBSERVERS", secondariesWithDBservers);
   updateFromEnv("ARANGODB_COORDINATORS_WITH_DBSERVERS", coordinatorsWithDBservers);
@@ -494,6 +574,30 @@ int main (int argc, char** argv) {
 
   updateFromEnv("MESOS_MASTER", master);
   updateFromEnv("ARANGODB_ZK", zk);
+  updateFromEnv("ARANGODB_STATE_JOURNAL", stateJournal);
+  updateFromEnv("ARANGODB_STATE_JOURNAL_MAX_DELTAS", stateJournalMaxDeltas);
+  updateFromEnv("ARANGODB_STATE_JOURNAL_MAX_BYTES", stateJournalMaxBytes);
+  updateFromEnv("ARANGODB_STATE_PERSIST_DELAY", statePersistDelay);
+  updateFromEnv("ARANGODB_STATE_COMPRESSION", stateCompression);
+  updateFromEnv("ARANGODB_STANDBY", standby);
+  updateFromEnv("ARANGODB_STANDBY_SESSION_TIMEOUT", standbySessionTimeout);
+  updateFromEnv("ARANGODB_PROXY", proxy);
+
+  if (stateJournalMaxDeltas < 1) {
+    stateJournalMaxDeltas = 1;
+  }
+
+  if (stateJournalMaxBytes < 1) {
+    stateJournalMaxBytes = 1;
+  }
+
+  if (statePersistDelay < 0) {
+    statePersistDelay = 0;
+  }
+
+  if (standbySessionTimeout < 1.0) {
+    standbySessionTimeout = 1.0;
+  }
 
   if (master.empty()) {
     cerr << "Missing master, either use flag '--master' or set 'MESOS_MASTER'" << endl;
@@ -501,6 +605,23 @@ int main (int argc, char** argv) {
     exit(EXIT_FAILURE);
   }
 
+  if (proxy != "haproxy" && proxy != "embedded") {
+    cerr << "Unknown proxy '" << proxy << "', expecting haproxy or embedded" << endl;
+    usage(argv[0], flags);
+    exit(EXIT_FAILURE);
+  }
+
+  {
+    TaskTimeouts timeouts;
+    string error;
+
+    if (! timeouts.parse(taskTimeouts, error)) {
+      cerr << "Invalid task timeouts: " << error << endl;
+      usage(argv[0], flags);
+      exit(EXIT_FAILURE);
+    }
+  }
+
   if (arangoDBImage.empty()) {
     cerr << "Missing image, please provide an arangodb image to run on the agents via '--arangodb_image' or set 'ARANGODB_IMAGE'" << endl;
     usage(argv[0], flags);
@@ -589,29 +710,82 @@ int main (int argc, char** argv) {
 
   LOG(INFO) << "zookeeper: " << zk;
 
+  Global::setStateJournal(str2bool(stateJournal));
+  Global::setStateJournalMaxDeltas(stateJournalMaxDeltas);
+  Global::setStateJournalMaxBytes(stateJournalMaxBytes);
+  LOG(INFO) << "state journal: " << Global::stateJournal()
+            << " (snapshot every " << Global::stateJournalMaxDeltas()
+            << " deltas or " << Global::stateJournalMaxBytes() << " bytes)";
+  Global::setStatePersistDelay(statePersistDelay);
+  LOG(INFO) << "state persist delay: " << Global::statePersistDelay() << " ms";
+  Global::setStateCompression(str2bool(stateCompression));
+  LOG(INFO) << "state compression: " << Global::stateCompression();
+  Global::setStandby(str2bool(standby));
+  Global::setStandbySessionTimeout(standbySessionTimeout);
+  LOG(INFO) << "standby: " << Global::standby()
+            << " (session timeout " << Global::standbySessionTimeout() << " s)";
+  LOG(INFO) << "proxy: " << proxy;
+
+  if (Global::standby() && zk.empty()) {
+    LOG(ERROR) << "FATAL standby mode needs the state in zookeeper, use '--zk'";
+    exit(EXIT_FAILURE);
+  }
+
   ArangoState state(frameworkName, zk);
   state.init();
 
+  unique_ptr<LeaderElection> election;
+
+  if (Global::standby()) {
+    election.reset(new LeaderElection(
+      frameworkName, zk, Global::standbySessionTimeout()));
+    election->join();
+
+    // follow the state until we are in charge, such that the state and
+    // the task index are ready when we take over
+    while (! election->awaitLeadership(1.0)) {
+      state.tail();
+    }
+  }
+
   if (resetState == "true" || resetState == "y" || resetState == "yes") {
     state.destroy();
   }
+  else if (Global::standby()) {
+    state.takeOver();
+  }
   else {
     state.load();
   }
+
+  state.startPersister();
   
   
-  if (!state.createReverseProxyConfig()) {
-    LOG(ERROR) << "Couldn't create reverse proxy config";
-    exit(EXIT_FAILURE);
+  Global::setState(&state);
+
+  unique_ptr<ReverseProxy> reverseProxy;
+
+  if (proxy == "embedded") {
+    reverseProxy.reset(new ReverseProxy(
+      webuiPort, frameworkPort, ! arangoDBSslKeyfile.empty(),
+      "/service/" + frameworkName));
+
+    if (! reverseProxy->start()) {
+      LOG(ERROR) << "FATAL cannot start the embedded reverse proxy";
+      exit(EXIT_FAILURE);
+    }
+
+    Global::setReverseProxy(reverseProxy.get());
+    state.createReverseProxyConfig();
   }
+  else {
+    if (!state.createReverseProxyConfig()) {
+      LOG(ERROR) << "Couldn't create reverse proxy config";
+      exit(EXIT_FAILURE);
+    }
 
-  struct sigaction new_action;
-  new_action.sa_handler = catch_child;
-  sigemptyset (&new_action.sa_mask);
-  new_action.sa_flags = 0;
-  sigaction(SIGCHLD, &new_action, nullptr);
-  Global::setState(&state);
-  state.setRestartProxy(RESTART_FRESH_START);
+    state.setRestartProxy(RESTART_FRESH_START);
+  }
 
   // ...........................................................................
   // framework
@@ -639,9 +813,9 @@ int main (int argc, char** argv) {
   LOG(INFO) << "failover timeout: " << failoverTimeout;
   
   {
-    auto lease = Global::state().lease();
-    if (lease.state().has_framework_id()) {
-      framework.mutable_id()->CopyFrom(lease.state().framework_id());
+    auto snapshot = Global::state().snapshot();
+    if (snapshot->state().has_framework_id()) {
+      framework.mutable_id()->CopyFrom(snapshot->state().framework_id());
     }
   }
 
@@ -677,6 +851,12 @@ int main (int argc, char** argv) {
   LOG(INFO) << "refuse seconds: " << Global::declineOfferRefuseSeconds();
   Global::setOfferLimit(offerLimit);
   LOG(INFO) << "offer limit: " << Global::offerLimit();
+  Global::setOfferRetention(offerRetention < 0 ? 0 : offerRetention);
+  LOG(INFO) << "offer retention: " << Global::offerRetention();
+  Global::setTaskTimeouts(taskTimeouts);
+  LOG(INFO) << "task timeouts: " << Global::taskTimeouts();
+  Global::setSingleOfferLaunch(str2bool(singleOfferLaunch));
+  LOG(INFO) << "single offer launch: " << Global::singleOfferLaunch();
 
 
   // ...........................................................................
@@ -704,6 +884,15 @@ int main (int argc, char** argv) {
   ArangoManager* manager = new ArangoManager();
   Global::setManager(manager);
 
+  // ...........................................................................
+  // health probes
+  // ...........................................................................
+
+  HealthProbes healthProbes;
+  healthProbes.start();
+
+  Global::setHealthProbes(&healthProbes);
+
   // ...........................................................................
   // scheduler
   // ...........................................................................
@@ -760,9 +949,13 @@ int main (int argc, char** argv) {
   // ensure that the driver process terminates
   driver->stop();
 
+  healthProbes.stop();
+
   delete driver;
   delete manager;
 
+  state.stopPersister();
+
   sleep(30);   // Wait some more time before terminating the process to
                // allow the user to use 
                //   dcos package uninstall arangodb
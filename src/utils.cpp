@@ -73,6 +73,10 @@ SOFTWARE.
 #include <openssl/evp.h>
 #include <openssl/hmac.h>
 
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <strings.h>
+
 #include "Global.h"
 
 using namespace arangodb;
@@ -427,6 +431,24 @@ static size_t ReadMemoryCallback(void* contents, size_t size, size_t nmemb,
   }
 }
 
+static size_t ETagHeaderCallback(char* buffer, size_t size, size_t nitems,
+                                 void* userp) {
+  static char const name[] = "etag:";
+  size_t realsize = size * nitems;
+
+  if (realsize > sizeof(name) - 1 &&
+      strncasecmp(buffer, name, sizeof(name) - 1) == 0) {
+    std::string value(buffer + sizeof(name) - 1, realsize - (sizeof(name) - 1));
+    size_t b = value.find_first_not_of(" \t\r\n");
+    size_t e = value.find_last_not_of(" \t\r\n");
+
+    *static_cast<std::string*>(userp)
+      = (b == std::string::npos) ? "" : value.substr(b, e - b + 1);
+  }
+
+  return realsize;
+}
+
 static std::string base64UrlEncode(std::string const& str) {
   // mop: EEK! openssl :S
   BIO *bio, *b64;
@@ -488,17 +510,14 @@ static std::string createJwt(picojson::value const& body, std::string const& key
 
 static Headers createClusterHeaders() {
   Headers headers = {};
-  std::string const& jwtSecret = Global::arangoDBJwtSecret();
-  if (!jwtSecret.empty()) {
-    picojson::object payload;
-    payload["iss"] = picojson::value("arangodb");
-    payload["server_id"] = picojson::value("mesos_framework");
-    headers["Authorization"] = "bearer " + createJwt(picojson::value(payload), jwtSecret);
+  std::string authorization = arangodb::clusterAuthorization();
+  if (!authorization.empty()) {
+    headers["Authorization"] = authorization;
   }
   return headers;
 }
 
-static int executeHTTPGet (std::string url, Headers const& headers, std::string& resultBody, long& httpCode) {
+static int executeHTTPGet (std::string url, Headers const& headers, std::string& resultBody, long& httpCode, double timeout = 0.0, std::string* etag = nullptr) {
   CURL *curl;
   CURLcode res;
 
@@ -508,22 +527,39 @@ static int executeHTTPGet (std::string url, Headers const& headers, std::string&
 
   if (curl) {
     struct curl_slist* requestHeaders = nullptr;
-    if (headers.size() > 0) {
-      for (auto const& it: headers) {
-        std::string const header(it.first + ": " + it.second);
-        requestHeaders = curl_slist_append(requestHeaders, header.c_str());
-      }
+    std::string receivedETag;
+
+    if (etag != nullptr && ! etag->empty()) {
+      std::string const header("If-None-Match: " + *etag);
+      requestHeaders = curl_slist_append(requestHeaders, header.c_str());
+    }
+    for (auto const& it: headers) {
+      std::string const header(it.first + ": " + it.second);
+      requestHeaders = curl_slist_append(requestHeaders, header.c_str());
+    }
+    if (requestHeaders != nullptr) {
       curl_easy_setopt(curl, CURLOPT_HTTPHEADER, requestHeaders);
     }
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteMemoryCallback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void*) &resultBody);
+    if (etag != nullptr) {
+      curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, ETagHeaderCallback);
+      curl_easy_setopt(curl, CURLOPT_HEADERDATA, (void*) &receivedETag);
+    }
     curl_easy_setopt(curl, CURLOPT_USERAGENT, "libcurl-agent/1.0");
     // mop: XXX :S CURLE 51 and 60...
     curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
     curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
 
+    if (0.0 < timeout) {
+      // no signals, the request might not run in the main thread
+      curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+      curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS,
+                       static_cast<long>(timeout * 1000));
+    }
+
     res = curl_easy_perform(curl);
 
     if (res != CURLE_OK) {
@@ -533,6 +569,11 @@ static int executeHTTPGet (std::string url, Headers const& headers, std::string&
     else {
       httpCode = 0;
       curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
+
+      // a 304 keeps the entity tag the request was made with
+      if (etag != nullptr && httpCode != 304) {
+        *etag = receivedETag;
+      }
     }
     curl_easy_cleanup(curl);
     if (requestHeaders != nullptr) {
@@ -627,7 +668,8 @@ int arangodb::doHTTPPost (std::string url, std::string const& body,
 
 static int executeHTTPPut (std::string url, Headers const& headers, std::string const& body,
                                           std::string& resultBody,
-                                          long& httpCode) {
+                                          long& httpCode,
+                                          double timeout = 0.0) {
   CURL *curl;
   CURLcode res;
   
@@ -658,6 +700,13 @@ static int executeHTTPPut (std::string url, Headers const& headers, std::string
     // mop: XXX :S CURLE 51 and 60...
     curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
     curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 0L);
+
+    if (0.0 < timeout) {
+      // no signals, the request might not run in the main thread
+      curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+      curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS,
+                       static_cast<long>(timeout * 1000));
+    }
     
     res = curl_easy_perform(curl);
 
@@ -749,10 +798,28 @@ int arangodb::doHTTPDelete (std::string url, std::string& resultBody,
   return executeHTTPDelete(url, {}, resultBody, httpCode);
 }
 
+std::string arangodb::clusterAuthorization () {
+  std::string const& jwtSecret = Global::arangoDBJwtSecret();
+  if (jwtSecret.empty()) {
+    return "";
+  }
+  picojson::object payload;
+  payload["iss"] = picojson::value("arangodb");
+  payload["server_id"] = picojson::value("mesos_framework");
+  return "bearer " + createJwt(picojson::value(payload), jwtSecret);
+}
+
 int arangodb::doClusterHTTPGet (std::string url, std::string& resultBody,
-                         long& httpCode) {
+                         long& httpCode, double timeout) {
+  Headers headers = createClusterHeaders();
+  return executeHTTPGet(url, headers, resultBody, httpCode, timeout);
+}
+
+int arangodb::doConditionalClusterHTTPGet (std::string url, std::string& etag,
+                                           std::string& resultBody,
+                                           long& httpCode, double timeout) {
   Headers headers = createClusterHeaders();
-  return executeHTTPGet(url, headers, resultBody, httpCode);
+  return executeHTTPGet(url, headers, resultBody, httpCode, timeout, &etag);
 }
 
 int arangodb::doClusterHTTPPost (std::string url, std::string const& body,
@@ -764,9 +831,9 @@ int arangodb::doClusterHTTPPost (std::string url, std::string const& body,
 
 int arangodb::doClusterHTTPPut (std::string url, std::string const& body,
                                           std::string& resultBody,
-                                          long& httpCode) {
+                                          long& httpCode, double timeout) {
   Headers headers = createClusterHeaders();
-  return executeHTTPPut(url, headers, body, resultBody, httpCode);
+  return executeHTTPPut(url, headers, body, resultBody, httpCode, timeout);
 }
 
 int arangodb::doClusterHTTPDelete (std::string url, std::string& resultBody,
@@ -775,6 +842,47 @@ int arangodb::doClusterHTTPDelete (std::string url, std::string& resultBody,
   return executeHTTPDelete(url, headers, resultBody, httpCode);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief do IP address lookup
+////////////////////////////////////////////////////////////////////////////////
+
+string arangodb::getIPAddress (string hostname) {
+  struct addrinfo hints;
+  struct addrinfo* ai;
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_protocol = 0;
+  hints.ai_flags = AI_ADDRCONFIG;
+  int res = getaddrinfo(hostname.c_str(), nullptr, &hints, &ai);
+
+  if (res != 0) {
+    LOG(WARNING) << "Alarm: res=" << res;
+    return hostname;
+  }
+
+  struct addrinfo* b = ai;
+  std::string result = hostname;
+
+  while (b != nullptr) {
+    auto q = reinterpret_cast<struct sockaddr_in*>(ai->ai_addr);
+    char buffer[INET_ADDRSTRLEN+5];
+    char const* p = inet_ntop(AF_INET, &q->sin_addr, buffer, sizeof(buffer));
+
+    if (p != nullptr) {
+      if (p[0] != '1' || p[1] != '2' || p[2] != '7') {
+        result = p;
+      }
+    }
+    else {
+      LOG(WARNING) << "error in inet_ntop";
+    }
+
+    b = b->ai_next;
+  }
+
+  return result;
+}
+
 
 // -----------------------------------------------------------------------------
 // --SECTION--                                                       END-OF-FILE
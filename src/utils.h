@@ -181,17 +181,44 @@ namespace arangodb {
 
   mesos::Resources filterNotIsPorts (const mesos::Resources&);
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief looks up the IP address of a host, returns the hostname if
+/// this is impossible
+////////////////////////////////////////////////////////////////////////////////
+
+  std::string getIPAddress (std::string hostname);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief the Authorization header the framework sends to the cluster,
+/// empty if no JWT secret is set
+////////////////////////////////////////////////////////////////////////////////
+
+  std::string clusterAuthorization ();
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief do a GET request using libcurl, a return value of 0 means OK, the
 /// body of the result is in resultBody. If libcurl did not initialise 
 /// properly, -1 is returned and resultBody is empty, otherwise, a positive
 /// libcurl error code (see man 3 libcurl-errors) is returned. 
 /// If the result is 0, then httpCode is set to the resulting HTTP code.
+/// A positive timeout limits the whole request to that many seconds.
 ////////////////////////////////////////////////////////////////////////////////
 
   int doHTTPGet (std::string url, std::string& resultBody, long& httpCode);
   // mop: cluster version (auth enabled)
-  int doClusterHTTPGet (std::string url, std::string& resultBody, long& httpCode);
+  int doClusterHTTPGet (std::string url, std::string& resultBody, long& httpCode,
+                        double timeout = 0.0);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief do a conditional GET request to the cluster, the request carries
+/// the entity tag in etag as If-None-Match unless it is empty. On a 304
+/// the body is empty and etag is kept, otherwise etag is set to the
+/// entity tag of the answer, empty if there is none.
+////////////////////////////////////////////////////////////////////////////////
+
+  int doConditionalClusterHTTPGet (std::string url, std::string& etag,
+                                   std::string& resultBody, long& httpCode,
+                                   double timeout = 0.0);
 
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief do a POST request using libcurl, a return value of 0 means
@@ -216,6 +243,7 @@ namespace arangodb {
 /// Otherwise, a positive libcurl error code (see man 3 libcurl-errors)
 /// is returned.
 /// If the result is 0, then httpCode is set to the resulting HTTP code.
+/// A positive timeout limits the whole request to that many seconds.
 ////////////////////////////////////////////////////////////////////////////////
 
   int doHTTPPut (std::string url, std::string const& body,
@@ -223,7 +251,8 @@ namespace arangodb {
                                   long& httpCode);
   int doClusterHTTPPut (std::string url, std::string const& body,
                                   std::string& resultBody,
-                                  long& httpCode);
+                                  long& httpCode,
+                                  double timeout = 0.0);
 
 ////////////////////////////////////////////////////////////////////////////////
 /// @brief do a DELETE request using libcurl, a return value of 0 means OK, the
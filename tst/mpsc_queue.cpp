@@ -0,0 +1,141 @@
+// fills the bounded queue until it is full, runs it around its ring many
+// times, and lets several producers push against a single consumer, each
+// value must arrive exactly once and in the order of its producer
+
+#include "MpscQueue.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace arangodb;
+using namespace std;
+
+static int failures = 0;
+
+static void check (bool ok, string const& what) {
+  if (! ok) {
+    cerr << "FAILED: " << what << endl;
+    ++failures;
+  }
+}
+
+static void fullQueue () {
+  MpscQueue<int> queue(5);
+
+  check(queue.capacity() == 8, "capacity rounded up to a power of two");
+
+  int value = 0;
+  check(! queue.pop(value), "pop from an empty queue fails");
+
+  for (int i = 0;  i < 8;  ++i) {
+    check(queue.push(i), "push into a queue with room");
+  }
+
+  check(! queue.push(8), "push into a full queue fails");
+
+  check(queue.pop(value) && value == 0, "pop the first value");
+  check(queue.push(8), "push after making room");
+  check(! queue.push(9), "push into the full queue fails again");
+
+  for (int i = 1;  i <= 8;  ++i) {
+    check(queue.pop(value) && value == i, "values come out in order");
+  }
+
+  check(! queue.pop(value), "pop from the drained queue fails");
+}
+
+static void wraparound () {
+  MpscQueue<string> queue(4);
+  int next = 0;
+  int expected = 0;
+  bool ordered = true;
+
+  // an odd number of values per round, such that head and tail meet at
+  // every position of the ring
+  for (int round = 0;  round < 1000;  ++round) {
+    for (int i = 0;  i < 3;  ++i) {
+      if (! queue.push(to_string(next++))) {
+        ordered = false;
+      }
+    }
+
+    string value;
+
+    for (int i = 0;  i < 3;  ++i) {
+      if (! queue.pop(value) || value != to_string(expected++)) {
+        ordered = false;
+      }
+    }
+  }
+
+  check(ordered, "values keep their order while wrapping around");
+
+  string value;
+  check(! queue.pop(value), "queue empty after wrapping around");
+}
+
+static void producers () {
+  static int const PRODUCERS = 4;
+  static int const VALUES = 100000;
+
+  MpscQueue<int> queue(64);
+  vector<thread> threads;
+
+  for (int p = 0;  p < PRODUCERS;  ++p) {
+    threads.emplace_back([&queue, p] () {
+      for (int i = 0;  i < VALUES;  ++i) {
+        while (! queue.push(p * VALUES + i)) {
+          this_thread::yield();
+        }
+      }
+    });
+  }
+
+  vector<int> last(PRODUCERS, -1);
+  int received = 0;
+  bool ordered = true;
+
+  while (received < PRODUCERS * VALUES) {
+    int value;
+
+    if (! queue.pop(value)) {
+      this_thread::yield();
+      continue;
+    }
+
+    int p = value / VALUES;
+    int i = value % VALUES;
+
+    if (p < 0 || PRODUCERS <= p || i != last[p] + 1) {
+      ordered = false;
+    }
+    else {
+      last[p] = i;
+    }
+
+    ++received;
+  }
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  check(ordered, "each value once, in the order of its producer");
+
+  int value;
+  check(! queue.pop(value), "queue empty after all producers");
+}
+
+int main () {
+  fullQueue();
+  wraparound();
+  producers();
+
+  if (failures == 0) {
+    cout << "OK" << endl;
+  }
+
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,128 @@
+// packs the tasks of a fresh cluster onto a single big offer: an agent, a
+// DBserver and a coordinator must all be launched with it before the
+// cluster is complete, each type once
+
+#include "ArangoScheduler.h"
+#include "ArangoState.h"
+#include "CaretakerCluster.h"
+#include "Global.h"
+
+#include <mesos/resources.hpp>
+
+#include <curl/curl.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace arangodb;
+using namespace std;
+
+static int failures = 0;
+
+static void check (bool ok, string const& what) {
+  if (! ok) {
+    cerr << "FAILED: " << what << endl;
+    ++failures;
+  }
+}
+
+static mesos::Offer bigOffer () {
+  mesos::Offer offer;
+
+  offer.mutable_id()->set_value("big-offer");
+  offer.mutable_framework_id()->set_value("offer-packing-test");
+  offer.mutable_slave_id()->set_value("big-slave");
+  offer.set_hostname("localhost");
+  offer.mutable_resources()->CopyFrom(mesos::Resources::parse(
+    "cpus(*):16;mem(*):65536;disk(*):65536;ports(*):[31000-31010]").get());
+
+  return offer;
+}
+
+int main () {
+  curl_global_init(CURL_GLOBAL_ALL);
+
+  Global::setMode(OperationMode::CLUSTER);
+  Global::setAsyncReplication(false);
+  Global::setNrAgents(1);
+  Global::setNrDBServers(1);
+  Global::setNrCoordinators(1);
+  Global::setRole("arangodb");
+  Global::setPrincipal("arangodb");
+  Global::setFrameworkName("offer-packing-test");
+  Global::setArangoDBImage("arangodb/arangodb");
+
+  string name = "offer-packing-test-" + to_string(getpid());
+
+  ArangoState state(name, "");
+  Global::setState(&state);
+  state.init();
+
+  ArangoScheduler scheduler;
+  Global::setScheduler(&scheduler);
+
+  CaretakerCluster caretaker;
+  Global::setCaretaker(&caretaker);
+  caretaker.updatePlan({});
+
+  mesos::Offer offer = bigOffer();
+
+  // the accepts are not sent, the batch is only looked at
+  scheduler.beginOfferBatch({});
+  caretaker.checkOffers({ offer });
+
+  vector<string> launched;
+
+  for (auto const& operation : scheduler.batchOperations(offer.id())) {
+    if (operation.type() != mesos::Offer::Operation::LAUNCH) {
+      continue;
+    }
+
+    for (auto const& task : operation.launch().task_infos()) {
+      launched.push_back(task.name());
+    }
+  }
+
+  auto contains = [&] (string const& part) -> int {
+    int n = 0;
+
+    for (auto const& task : launched) {
+      if (task.find(part) != string::npos) {
+        ++n;
+      }
+    }
+
+    return n;
+  };
+
+  check(launched.size() == 3, "three tasks launched with one offer");
+  check(contains("Agent") == 1, "an agent launched");
+  check(contains("DBServer") == 1, "a DBserver launched");
+  check(contains("Coordinator") == 1, "a coordinator launched");
+
+  {
+    auto snapshot = state.snapshot();
+    auto const& current = snapshot->state().current();
+
+    check(! current.cluster_complete(), "cluster not complete yet");
+    check(current.agents().entries(0).slave_id().value() == "big-slave",
+          "agent on the big slave");
+    check(current.dbservers().entries(0).slave_id().value() == "big-slave",
+          "DBserver on the big slave");
+    check(current.coordinators().entries(0).slave_id().value() == "big-slave",
+          "coordinator on the big slave");
+  }
+
+  if (system(("rm -rf ./STATE_" + name).c_str()) != 0) {
+    cerr << "cannot remove the state of the test" << endl;
+  }
+
+  if (failures == 0) {
+    cout << "OK" << endl;
+  }
+
+  return failures == 0 ? 0 : 1;
+}
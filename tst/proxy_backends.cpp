@@ -0,0 +1,162 @@
+// sends the runtime commands of the proxy slots to a fake haproxy admin
+// socket, and checks that changes stay queued until haproxy has taken
+// them
+
+#include "ProxyBackends.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace arangodb;
+using namespace std;
+
+static int failures = 0;
+
+static void check (bool ok, string const& what) {
+  if (! ok) {
+    cerr << "FAILED: " << what << endl;
+    ++failures;
+  }
+}
+
+static string resolve (string const& host) {
+  return host == "coordinator1" ? "10.0.0.1" : "10.0.0.2";
+}
+
+// a fake admin socket, which answers each connection with the given
+// response and records the commands it got
+struct FakeHaproxy {
+  string _path;
+  int _fd;
+  thread _thread;
+  vector<string> _received;
+
+  FakeHaproxy (string const& path, string const& response, size_t connections)
+    : _path(path), _fd(-1) {
+    unlink(_path.c_str());
+
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, _path.c_str(), sizeof(address.sun_path) - 1);
+
+    _fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (bind(_fd, (struct sockaddr*) &address, sizeof(address)) != 0 ||
+        listen(_fd, 8) != 0) {
+      cerr << "cannot listen on " << _path << endl;
+      exit(2);
+    }
+
+    _thread = thread([this, response, connections] () {
+      for (size_t i = 0;  i < connections;  ++i) {
+        int fd = accept(_fd, nullptr, nullptr);
+
+        if (fd < 0) {
+          return;
+        }
+
+        string line;
+        char c;
+
+        while (read(fd, &c, 1) == 1 && c != '\n') {
+          line += c;
+        }
+
+        _received.push_back(line);
+
+        if (write(fd, response.c_str(), response.size()) < 0) {
+          cerr << "cannot answer " << line << endl;
+        }
+
+        close(fd);
+      }
+    });
+  }
+
+  ~FakeHaproxy () {
+    close(_fd);
+    unlink(_path.c_str());
+  }
+
+  void join () {
+    _thread.join();
+  }
+};
+
+int main () {
+  string path = "/tmp/proxy-backends-test-" + to_string(getpid()) + ".sock";
+
+  ProxyBackends backends;
+  backends.resize(2);
+  backends.config("check");
+
+  check(! backends.pending(), "config leaves nothing pending");
+
+  backends.assign({ { "coordinator1", 8529, 10 } });
+
+  vector<string> expected = {
+    "set server arangodb/coordinator0 addr 10.0.0.1 port 8529",
+    "set weight arangodb/coordinator0 10",
+    "set server arangodb/coordinator0 state ready"
+  };
+
+  check(backends.commands(resolve) == expected, "commands of a new backend");
+  check(backends.pending(), "a new backend is pending");
+
+  // no haproxy at all, the changes stay queued
+  string error;
+
+  check(! backends.send(path, resolve, error), "send without a socket");
+  check(backends.pending(), "still pending without a socket");
+  check(backends.commands(resolve) == expected, "commands kept");
+
+  // haproxy refuses, the changes stay queued
+  {
+    FakeHaproxy haproxy(path, "Unknown command.\n", 1);
+
+    check(! backends.send(path, resolve, error), "send to a refusing proxy");
+    haproxy.join();
+
+    check(backends.pending(), "still pending after a refusal");
+    check(error.find("Unknown command") != string::npos, "refusal reported");
+  }
+
+  // haproxy takes all commands
+  {
+    FakeHaproxy haproxy(path, "\n", expected.size());
+
+    check(backends.send(path, resolve, error), "send to a proxy");
+    haproxy.join();
+
+    check(haproxy._received == expected, "commands received");
+    check(! backends.pending(), "nothing pending after the send");
+  }
+
+  // the backend goes away, its slot goes to maintenance
+  backends.assign({});
+
+  {
+    FakeHaproxy haproxy(path, "\n", 1);
+
+    check(backends.send(path, resolve, error), "send a removal");
+    haproxy.join();
+
+    check(haproxy._received.size() == 1 &&
+          haproxy._received[0] == "set server arangodb/coordinator0 state maint",
+          "removal received");
+  }
+
+  if (failures == 0) {
+    cout << "OK" << endl;
+  }
+
+  return failures == 0 ? 0 : 1;
+}
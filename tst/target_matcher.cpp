@@ -0,0 +1,152 @@
+// measures checking a batch of offers against a target: the old way, which
+// flattens the target and counts the ports for each offer, against the
+// shipped TargetMatcher and OfferSummary, which compile the target once,
+// sum up each offer once and reject it by its totals before running find
+//
+// both ways must accept the same offers, the program fails otherwise
+
+#include "TargetMatcher.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace arangodb;
+using namespace std;
+
+static const string Role = "arangodb";
+
+static size_t const Offers = 1000;
+static size_t const Rounds = 100;
+
+// the port check of the old isSuitableOffer
+static uint64_t numberPorts (mesos::Offer const& offer) {
+  uint64_t n = 0;
+
+  for (auto const& resource : offer.resources()) {
+    if (resource.name() == "ports" && resource.type() == mesos::Value::RANGES) {
+      for (auto const& range : resource.ranges().range()) {
+        n += range.end() - range.begin() + 1;
+      }
+    }
+  }
+
+  return n;
+}
+
+static vector<mesos::Offer> makeOffers (size_t n) {
+  vector<mesos::Offer> offers;
+
+  for (size_t i = 0;  i < n;  ++i) {
+    // three out of four offers are too small for the target
+    bool big = i % 4 == 0;
+    string text
+      = "cpus(*):" + string(big ? "4" : "0.5")
+      + ";mem(*):" + string(big ? "8192" : "512")
+      + ";disk(*):" + string(big ? "100000" : "1024")
+      + ";cpus(" + Role + "):0.5"
+      + ";ports(*):[31000-31099, 32000-32099]";
+
+    mesos::Offer offer;
+    offer.mutable_id()->set_value("offer" + to_string(i));
+    offer.mutable_framework_id()->set_value("framework");
+    offer.mutable_slave_id()->set_value("slave" + to_string(i));
+    offer.set_hostname("host" + to_string(i));
+
+    mesos::Resources resources = mesos::Resources::parse(text).get();
+    offer.mutable_resources()->CopyFrom(resources);
+    offers.push_back(offer);
+  }
+
+  return offers;
+}
+
+static Target makeTarget () {
+  Target target;
+  target.set_instances(3);
+  target.set_number_ports(2);
+
+  mesos::Resources minimum
+    = mesos::Resources::parse("cpus(*):1;mem(*):2048;disk(*):8192").get();
+  target.mutable_minimal_resources()->CopyFrom(minimum);
+
+  return target;
+}
+
+int main () {
+  Target target = makeTarget();
+  vector<mesos::Offer> offers = makeOffers(Offers);
+
+  // the old way, everything is done again for each offer
+  auto start = chrono::steady_clock::now();
+  size_t oldFits = 0;
+
+  for (size_t r = 0;  r < Rounds;  ++r) {
+    for (auto const& offer : offers) {
+      if (numberPorts(offer) < target.number_ports()) {
+        continue;
+      }
+
+      mesos::Resources offered = offer.resources();
+      mesos::Resources minimum = target.minimal_resources();
+      minimum = minimum.flatten(Role);
+
+      if (offered.find(minimum).isSome()) {
+        ++oldFits;
+      }
+    }
+  }
+
+  // the shipped way, the matcher is kept and only updated for each batch,
+  // each offer is summed up once per batch
+  auto middle = chrono::steady_clock::now();
+  size_t newFits = 0;
+  TargetMatcher matcher;
+
+  for (size_t r = 0;  r < Rounds;  ++r) {
+    matcher.update(target, Role);
+
+    vector<OfferSummary> summaries;
+    summaries.reserve(offers.size());
+
+    for (auto const& offer : offers) {
+      summaries.emplace_back(offer);
+    }
+
+    for (size_t i = 0;  i < offers.size();  ++i) {
+      OfferSummary const& summary = summaries[i];
+
+      if (summary._ports < matcher.ports() || ! matcher.mightFit(summary)) {
+        continue;
+      }
+
+      mesos::Resources offered = offers[i].resources();
+
+      if (offered.find(matcher.minimum()).isSome()) {
+        ++newFits;
+      }
+    }
+  }
+
+  auto end = chrono::steady_clock::now();
+
+  auto us = [] (chrono::steady_clock::duration d) {
+    return chrono::duration_cast<chrono::microseconds>(d).count();
+  };
+
+  cout << Rounds << " batches of " << Offers << " offers" << endl;
+  cout << "old:      " << us(middle - start) << " us, "
+       << oldFits << " fits" << endl;
+  cout << "compiled: " << us(end - middle) << " us, "
+       << newFits << " fits" << endl;
+
+  if (oldFits != newFits) {
+    cerr << "FAILED: both ways must accept the same offers" << endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
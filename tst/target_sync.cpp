@@ -0,0 +1,199 @@
+// fetches the cluster targets from a stub coordinator and applies the
+// answers: a first answer, a 304, an unchanged body, a malformed body and
+// a change of the numbers
+
+#include "TargetSync.h"
+
+#include <curl/curl.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace arangodb;
+using namespace std;
+
+static int failures = 0;
+
+static void check (bool ok, string const& what) {
+  if (! ok) {
+    cerr << "FAILED: " << what << endl;
+    ++failures;
+  }
+}
+
+// a stub coordinator, which answers a single request with the given
+// status, entity tag and body, and keeps the request it got
+struct StubCoordinator {
+  int _fd;
+  int _port;
+  thread _thread;
+  string _request;
+
+  StubCoordinator (int status, string const& etag, string const& body)
+    : _fd(-1), _port(0) {
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+
+    _fd = socket(AF_INET, SOCK_STREAM, 0);
+    socklen_t length = sizeof(address);
+
+    if (bind(_fd, (struct sockaddr*) &address, sizeof(address)) != 0 ||
+        listen(_fd, 1) != 0 ||
+        getsockname(_fd, (struct sockaddr*) &address, &length) != 0) {
+      cerr << "cannot listen" << endl;
+      exit(2);
+    }
+
+    _port = ntohs(address.sin_port);
+
+    string response = "HTTP/1.1 " + to_string(status)
+                    + (status == 304 ? " Not Modified" : " OK") + "\r\n";
+
+    if (! etag.empty()) {
+      response += "ETag: " + etag + "\r\n";
+    }
+
+    if (status != 304) {
+      response += "Content-Type: application/json\r\n"
+                  "Content-Length: " + to_string(body.size()) + "\r\n";
+    }
+
+    response += "Connection: close\r\n\r\n";
+
+    if (status != 304) {
+      response += body;
+    }
+
+    _thread = thread([this, response] () {
+      int fd = accept(_fd, nullptr, nullptr);
+
+      if (fd < 0) {
+        return;
+      }
+
+      char buffer[4096];
+
+      while (_request.find("\r\n\r\n") == string::npos) {
+        ssize_t n = read(fd, buffer, sizeof(buffer));
+
+        if (n <= 0) {
+          break;
+        }
+
+        _request.append(buffer, n);
+      }
+
+      if (write(fd, response.c_str(), response.size()) < 0) {
+        cerr << "cannot answer" << endl;
+      }
+
+      close(fd);
+    });
+  }
+
+  ~StubCoordinator () {
+    close(_fd);
+  }
+
+  string url () const {
+    return "http://127.0.0.1:" + to_string(_port);
+  }
+
+  TargetSync::Response fetch (string const& etag) {
+    TargetSync::Response response = TargetSync::fetch(url(), etag, 5.0);
+    _thread.join();
+    return response;
+  }
+};
+
+static string targets (int dbservers, int coordinators) {
+  return "{\"numberOfDBServers\":" + to_string(dbservers)
+       + ",\"numberOfCoordinators\":" + to_string(coordinators)
+       + ",\"cleanedServers\":[\"DBServer003\"]}";
+}
+
+int main () {
+  curl_global_init(CURL_GLOBAL_ALL);
+
+  TargetSync sync;
+
+  // the first answer
+  {
+    StubCoordinator coordinator(200, "\"1\"", targets(3, 2));
+    auto response = coordinator.fetch(sync.etag());
+
+    check(coordinator._request.find("GET /_admin/cluster/numberOfServers")
+          == 0, "request path");
+    check(coordinator._request.find("If-None-Match") == string::npos,
+          "first request is unconditional");
+    check(response._httpCode == 200, "first answer is 200");
+    check(sync.apply(response), "first answer changes the targets");
+    check(sync.known(), "targets known");
+    check(sync.dbservers() == 3 && sync.coordinators() == 2, "numbers");
+    check(sync.cleanedServers().size() == 1, "cleaned servers");
+    check(sync.etag() == "\"1\"", "entity tag kept");
+  }
+
+  // not modified
+  {
+    StubCoordinator coordinator(304, "\"1\"", "");
+    auto response = coordinator.fetch(sync.etag());
+
+    check(coordinator._request.find("If-None-Match: \"1\"") != string::npos,
+          "request is conditional");
+    check(response._httpCode == 304, "answer is 304");
+    check(! sync.apply(response), "304 changes nothing");
+    check(sync.statistics()._notModified == 1, "304 counted");
+  }
+
+  // the same body with a new entity tag
+  {
+    StubCoordinator coordinator(200, "\"2\"", targets(3, 2));
+    auto response = coordinator.fetch(sync.etag());
+
+    check(! sync.apply(response), "unchanged body changes nothing");
+    check(sync.statistics()._unchanged == 1, "unchanged body counted");
+    check(sync.etag() == "\"2\"", "entity tag of unchanged body kept");
+  }
+
+  // a malformed body, its entity tag must not be used
+  {
+    StubCoordinator coordinator(200, "\"3\"", "{\"numberOfDBServers\":");
+    auto response = coordinator.fetch(sync.etag());
+
+    check(! sync.apply(response), "malformed body changes nothing");
+    check(sync.statistics()._failures == 1, "malformed body counted");
+    check(sync.etag() == "\"2\"", "entity tag of malformed body dropped");
+    check(sync.dbservers() == 3 && sync.coordinators() == 2,
+          "numbers kept after malformed body");
+  }
+
+  // the numbers change
+  {
+    StubCoordinator coordinator(200, "\"4\"", targets(4, 2));
+    auto response = coordinator.fetch(sync.etag());
+
+    check(coordinator._request.find("If-None-Match: \"2\"") != string::npos,
+          "request is conditional on the last parsed answer");
+    check(sync.apply(response), "new numbers change the targets");
+    check(sync.dbservers() == 4, "new number of DBservers");
+    check(sync.etag() == "\"4\"", "new entity tag");
+  }
+
+  if (failures == 0) {
+    cout << "OK" << endl;
+  }
+
+  return failures == 0 ? 0 : 1;
+}